@@ -0,0 +1,402 @@
+/****************************************************************************
+ * adas_benchmark.cpp
+ *
+ * - 모듈 진입 함수별 마이크로벤치마크 (Google Benchmark)
+ *   : Ego 추정 (GPS 갱신 있음/없음), Lane Selection (직선/곡선)
+ *   : Target 필터/예측/선정 (객체 8 ~ 4096), ACC / AEB / LFA / Arbitration
+ *   : 파이프라인 전체 한 주기 (객체 1 ~ ADAS_MAX_OBJECTS)
+ *   : 교통 생성기 (traffic_gen.h) 처리량, 고밀도 Target Selection 전체 (객체 500 ~ 5000)
+ *   : 이산 사건 스케줄러 (sim_clock.h) 이벤트당 비용 (주기 타이머 1000 ~ 100000 개)
+ *   : 추적 지점 1개 비용 (adas_trace.h, tick 2회만 읽는 경우와 비교)
+ * - 입력은 고정 시드로 생성 (실행마다 같은 입력 -> 결과 비교 가능)
+ * - 빌드 (ADAS 디렉터리에서, bench/CMakeLists.txt: ADAS 소스 C11 + 벤치마크 C++17):
+ *   cmake -S bench -B _bench -DCMAKE_BUILD_TYPE=Release && cmake --build _bench -j
+ * - 실행 예 (회귀 비교용 기준값 저장):
+ *   ./_bench/adas_benchmark --benchmark_repetitions=10 --benchmark_out=base.json --benchmark_out_format=json
+ ****************************************************************************/
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+  #include "adas_pipeline.h"
+  #include "lane_selection.h"
+  #include "target_selection.h"
+  #include "traffic_gen.h"
+  #include "sim_clock.h"
+  #include "adas_trace.h"
+}
+
+/* 결정적 입력 생성 (xorshift32) */
+static uint32_t next_rand(uint32_t *pState)
+{
+    uint32_t x = *pState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *pState = x;
+    return x;
+}
+
+static float rand_range(uint32_t *pState, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(next_rand(pState) >> 8) * (1.0f / 16777216.0f);
+}
+
+/* 객체 n 개: 대부분 자차 차로 안 (필터 통과), 일부는 원거리/옆 차로/대향 */
+static void make_objects(ObjectData_t *pObjs, int n, uint32_t seed)
+{
+    uint32_t rng = seed;
+    for(int i = 0; i < n; i++)
+    {
+        ObjectData_t *o = &pObjs[i];
+        std::memset(o, 0, sizeof(*o));
+        o->Object_ID     = i + 1;
+        o->Object_Type   = ((i % 7) == 0) ? OBJTYPE_PEDESTRIAN : OBJTYPE_CAR;
+        o->Position_X    = rand_range(&rng, 5.0f, 220.0f);
+        o->Position_Y    = rand_range(&rng, -3.0f, 3.0f);
+        o->Distance      = o->Position_X;
+        o->Velocity_X    = rand_range(&rng, 0.0f, 30.0f);
+        o->Velocity_Y    = rand_range(&rng, -1.0f, 1.0f);
+        o->Heading       = ((i % 11) == 0) ? 180.0f : rand_range(&rng, -10.0f, 10.0f);
+        o->Object_Status = OBJSTAT_MOVING;
+    }
+}
+
+static void make_lane(LaneData_t *pLane, int curved)
+{
+    std::memset(pLane, 0, sizeof(*pLane));
+    pLane->Lane_Type            = curved ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+    pLane->Lane_Curvature       = curved ? 400.0f : 0.0f;
+    pLane->Next_Lane_Curvature  = curved ? 350.0f : 0.0f;
+    pLane->Lane_Offset          = 0.2f;
+    pLane->Lane_Heading         = curved ? 3.0f : 0.0f;
+    pLane->Lane_Width           = 3.5f;
+    pLane->Lane_Change_Status   = LANE_CHANGE_KEEP;
+    pLane->Lane_Curve_Direction = curved ? 1 : 0;
+}
+
+static void make_ego(EgoData_t *pEgo, float vx)
+{
+    std::memset(pEgo, 0, sizeof(*pEgo));
+    pEgo->Ego_Velocity_X = vx;
+}
+
+/* ---- Ego Vehicle Estimation (Arg: 1 = GPS 갱신, 0 = 예측만) ---- */
+static void BM_EgoVehicleEstimation(benchmark::State &state)
+{
+    const bool gps = (state.range(0) != 0);
+    EgoVehicleKFState_t kf;
+    InitEgoVehicleKFState(&kf);
+    TimeData_t time = { 0.0f };
+    GPSData_t  gpsData = {};
+    IMUData_t  imu = {};
+    EgoData_t  ego = {};
+    gpsData.GPS_Velocity_X = 8.0f;
+    imu.Linear_Acceleration_X = 0.1f;
+
+    for(auto _ : state)
+    {
+        time.Current_Time += 10.0f;
+        gpsData.GPS_Timestamp = gps ? time.Current_Time : 0.0f;
+        EgoVehicleEstimation(&time, &gpsData, &imu, &ego, &kf);
+        benchmark::DoNotOptimize(ego);
+    }
+}
+BENCHMARK(BM_EgoVehicleEstimation)->ArgName("gps")->Arg(0)->Arg(1);
+
+/* ---- Lane Selection (Arg: 1 = 곡선) ---- */
+static void BM_LaneSelection_Update(benchmark::State &state)
+{
+    LaneData_t lane;
+    EgoData_t  ego;
+    LaneSelectOutput_t ls;
+    make_lane(&lane, (int)state.range(0));
+    make_ego(&ego, 20.0f);
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(LaneSelection_Update(&lane, &ego, &ls));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_LaneSelection_Update)->ArgName("curved")->Arg(0)->Arg(1);
+
+/* ---- Target Selection 공통 입력 (Arg: 객체 수) ---- */
+struct TargetFixture
+{
+    std::vector<ObjectData_t>      Objects;
+    std::vector<FilteredObject_t>  Filtered;
+    std::vector<PredictedObject_t> Predicted;
+    LaneData_t         Lane;
+    EgoData_t          Ego;
+    LaneSelectOutput_t Ls;
+    int Filtered_Count  = 0;
+    int Predicted_Count = 0;
+
+    explicit TargetFixture(int n)
+        : Objects((size_t)n), Filtered((size_t)n), Predicted((size_t)n)
+    {
+        make_objects(Objects.data(), n, 0x2545F491u);
+        make_lane(&Lane, 0);
+        make_ego(&Ego, 20.0f);
+        LaneSelection_Update(&Lane, &Ego, &Ls);
+        Filtered_Count  = select_target_from_object_list(Objects.data(), n, &Ego, &Ls, Filtered.data(), n);
+        Predicted_Count = predict_object_future_path(Filtered.data(), Filtered_Count, &Lane, &Ls,
+                                                     Predicted.data(), n);
+    }
+};
+
+static void BM_SelectTargetFromObjectList(benchmark::State &state)
+{
+    const int n = (int)state.range(0);
+    TargetFixture fx(n);
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(select_target_from_object_list(fx.Objects.data(), n, &fx.Ego, &fx.Ls,
+                                                                fx.Filtered.data(), n));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["kept"] = fx.Filtered_Count;
+}
+BENCHMARK(BM_SelectTargetFromObjectList)->ArgName("objects")->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_PredictObjectFuturePath(benchmark::State &state)
+{
+    const int n = (int)state.range(0);
+    TargetFixture fx(n);
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(predict_object_future_path(fx.Filtered.data(), fx.Filtered_Count, &fx.Lane,
+                                                            &fx.Ls, fx.Predicted.data(), n));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * fx.Filtered_Count);
+}
+BENCHMARK(BM_PredictObjectFuturePath)->ArgName("objects")->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_SelectTargetsForAccAeb(benchmark::State &state)
+{
+    const int n = (int)state.range(0);
+    TargetFixture fx(n);
+    ACC_Target_t accTarget;
+    AEB_Target_t aebTarget;
+    for(auto _ : state)
+    {
+        select_targets_for_acc_aeb(&fx.Ego, fx.Predicted.data(), fx.Predicted_Count, &fx.Ls,
+                                   &accTarget, &aebTarget);
+        benchmark::DoNotOptimize(accTarget);
+        benchmark::DoNotOptimize(aebTarget);
+    }
+    state.SetItemsProcessed(state.iterations() * fx.Predicted_Count);
+}
+BENCHMARK(BM_SelectTargetsForAccAeb)->ArgName("objects")->RangeMultiplier(8)->Range(8, 4096);
+
+/* ---- 교통 생성기 (Arg: 객체 수, 프레임마다 새 목록) ---- */
+static void BM_TrafficGen_Generate(benchmark::State &state)
+{
+    const int n = (int)state.range(0);
+    std::vector<ObjectData_t> objs((size_t)n);
+    TrafficGenConfig_t cfg;
+    TrafficGen_DefaultConfig(&cfg);
+    cfg.Object_Count = n;
+    uint64_t frame = 0;
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(TrafficGen_Generate(&cfg, frame++, objs.data(), n));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TrafficGen_Generate)->ArgName("objects")->Arg(500)->Arg(5000);
+
+/* ---- 고밀도 Target Selection 전체 (필터 -> 예측 -> 선정, 생성기 입력) ---- */
+static void BM_TargetSelection_Dense(benchmark::State &state)
+{
+    const int n = (int)state.range(0);
+    std::vector<ObjectData_t>      objs((size_t)n);
+    std::vector<FilteredObject_t>  filtered((size_t)n);
+    std::vector<PredictedObject_t> predicted((size_t)n);
+    TrafficGenConfig_t cfg;
+    TrafficGen_DefaultConfig(&cfg);
+    cfg.Object_Count = n;
+    TrafficGen_Generate(&cfg, 0, objs.data(), n);
+
+    LaneData_t lane;
+    EgoData_t  ego;
+    LaneSelectOutput_t ls;
+    make_lane(&lane, 0);
+    make_ego(&ego, cfg.Ego_Speed);
+    LaneSelection_Update(&lane, &ego, &ls);
+    ACC_Target_t accTarget;
+    AEB_Target_t aebTarget;
+    int kept = 0;
+
+    for(auto _ : state)
+    {
+        kept = select_target_from_object_list(objs.data(), n, &ego, &ls, filtered.data(), n);
+        int np = predict_object_future_path(filtered.data(), kept, &lane, &ls, predicted.data(), n);
+        select_targets_for_acc_aeb(&ego, predicted.data(), np, &ls, &accTarget, &aebTarget);
+        benchmark::DoNotOptimize(accTarget);
+        benchmark::DoNotOptimize(aebTarget);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["kept"] = kept;
+}
+BENCHMARK(BM_TargetSelection_Dense)->ArgName("objects")->Arg(500)->Arg(1000)->Arg(2000)->Arg(5000);
+
+/* ---- ACC (Arg: ACC_Mode_e) ---- */
+static void BM_AccCalculateAccel(benchmark::State &state)
+{
+    const ACC_Mode_e mode = (ACC_Mode_e)state.range(0);
+    ACC_State_t acc;
+    acc_init_state(&acc);
+    ACC_Target_Data_t target = { 1, 35.0f, ACC_TARGET_MOVING, ACC_TARGET_NORMAL, 18.0f };
+    ACC_Ego_Data_t    ego    = { 20.0f, 0.0f };
+    Lane_Data_t       lane   = { 0.0f, 0.0f, 0.0f, 0 };
+    float t = 0.0f;
+
+    for(auto _ : state)
+    {
+        t += 0.01f;
+        benchmark::DoNotOptimize(acc_mode_selection(&target, &ego, &lane));
+        benchmark::DoNotOptimize(acc_calculate_accel(&acc, mode, &target, &ego, &lane, t, 0.01f));
+    }
+}
+BENCHMARK(BM_AccCalculateAccel)->ArgName("mode")->Arg(ACC_MODE_SPEED)->Arg(ACC_MODE_DISTANCE)->Arg(ACC_MODE_STOP);
+
+/* ---- AEB (TTC -> 모드 -> 감속도) ---- */
+static void BM_Aeb(benchmark::State &state)
+{
+    AEB_Target_Data_t target = {};
+    target.AEB_Target_ID         = 1;
+    target.AEB_Target_Distance   = (float)state.range(0);
+    target.AEB_Target_Velocity_X = 0.0f;
+    target.AEB_Target_Situation  = AEB_TARGET_NORMAL;
+    AEB_Ego_Data_t ego = {};
+    ego.Ego_Velocity_X = 20.0f;
+    TTC_Data_t ttc;
+
+    for(auto _ : state)
+    {
+        calculate_ttc_for_aeb(&target, &ego, &ttc);
+        AEB_Mode_e mode = aeb_mode_selection(&target, &ego, &ttc);
+        benchmark::DoNotOptimize(calculate_decel_for_aeb(mode, &ttc));
+    }
+}
+BENCHMARK(BM_Aeb)->ArgName("distance_m")->Arg(15)->Arg(80);
+
+/* ---- LFA (Arg: 자차 속도 [m/s] -> 저속 PID / 고속 법칙) ---- */
+static void BM_LfaCalculateSteer(benchmark::State &state)
+{
+    LFA_State_t lfa;
+    lfa_init_state(&lfa);
+    LFA_Ego_Data_t ego = {};
+    ego.Ego_Velocity_X = (float)state.range(0);
+    ego.Ego_Yaw_Rate   = 0.5f;
+    Lane_Data_LS_t lane = {};
+    lane.LS_Heading_Error  = 1.5f;
+    lane.LS_Lane_Offset    = 0.3f;
+    lane.LS_Is_Within_Lane = 1;
+    lane.LS_Lane_Curvature = 400.0f;
+
+    for(auto _ : state)
+    {
+        LFA_Mode_e mode = lfa_mode_selection(&ego);
+        benchmark::DoNotOptimize(lfa_calculate_steer(&lfa, mode, &ego, &lane, 0.01f));
+    }
+}
+BENCHMARK(BM_LfaCalculateSteer)->ArgName("speed")->Arg(10)->Arg(25);
+
+/* ---- Arbitration ---- */
+static void BM_Arbitration(benchmark::State &state)
+{
+    VehicleControl_t ctrl;
+    float accel = 1.2f;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(accel);
+        Arbitration(accel, -2.0f, 15.0f, AEB_MODE_ALERT, &ctrl);
+        benchmark::DoNotOptimize(ctrl);
+    }
+}
+BENCHMARK(BM_Arbitration);
+
+/* ---- 파이프라인 전체 한 주기 (Arg: 객체 수) ---- */
+static void BM_PipelineStep(benchmark::State &state)
+{
+    static AdasFrameInput_t  in;
+    static AdasFrameOutput_t out;
+    AdasPipeline_t pipe;
+    AdasPipeline_Init(&pipe, 0.01f);
+
+    std::memset(&in, 0, sizeof(in));
+    in.Object_Count = (int)state.range(0);
+    make_objects(in.Objects, in.Object_Count, 0x9E3779B9u);
+    make_lane(&in.Lane, 0);
+    in.Gps.GPS_Velocity_X = 8.0f;
+
+    for(auto _ : state)
+    {
+        in.Time.Current_Time += 10.0f;
+        in.Gps.GPS_Timestamp = in.Time.Current_Time;
+        AdasPipeline_Step(&pipe, &in, &out);
+        benchmark::DoNotOptimize(out.Control);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PipelineStep)->ArgName("objects")->Arg(1)->Arg(8)->Arg(ADAS_MAX_OBJECTS);
+
+/* ---- 이산 사건 스케줄러 (Arg: 주기 타이머 수, 주기 1 ~ 100 ms / 위상 무작위) ---- */
+static void count_event(SimClock_t *, SimTimer_t *, void *pUser)
+{
+    (*(uint64_t *)pUser)++;
+}
+
+static void BM_SimClock_PeriodicTimers(benchmark::State &state)
+{
+    const int n = (int)state.range(0);
+    std::vector<SimTimer_t> timers((size_t)n);
+    SimClock_t *pClock = new SimClock_t;
+    uint64_t fired = 0;
+    uint32_t seed = 0x5EEDu;
+
+    SimClock_Init(pClock, 0u);
+    for(int i = 0; i < n; i++)
+    {
+        SimTime_t period = 1000u + (next_rand(&seed) % 99001u);      /* [µs] */
+        SimTimer_Init(&timers[(size_t)i], count_event, &fired, 0);
+        SimClock_ScheduleAt(pClock, &timers[(size_t)i], next_rand(&seed) % period, period);
+    }
+
+    for(auto _ : state)
+        SimClock_RunUntil(pClock, SimClock_Now(pClock) + SIM_US_PER_MS);  /* 가상 1 ms */
+
+    state.SetItemsProcessed((int64_t)fired);
+    state.counters["cascades/event"] = fired ? (double)pClock->Cascaded / (double)fired : 0.0;
+    delete pClock;
+}
+BENCHMARK(BM_SimClock_PeriodicTimers)->ArgName("timers")->Arg(1000)->Arg(10000)->Arg(100000);
+
+/* ---- 추적 지점 1개 (활성 빌드의 ADAS_TRACE_BEGIN/END 와 같은 호출, 기록 없음 = tick 2회 기준) ---- */
+static void BM_TraceScope(benchmark::State &state)
+{
+    const bool record = (state.range(0) != 0);
+    AdasTrace_ThreadInit("bench");
+    for(auto _ : state)
+    {
+        uint64_t t0 = AdasTrace_Tick();
+        uint64_t t1 = AdasTrace_Tick();
+        if(record)
+            AdasTrace_Record(ADAS_TRACE_AEB, t0, t1);
+        else
+            benchmark::DoNotOptimize(t1 - t0);
+    }
+    AdasTrace_Reset();
+}
+BENCHMARK(BM_TraceScope)->ArgName("record")->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -1,21 +1,12 @@
 #ifndef ACC_H
 #define ACC_H
 
+#include "adas_shared.h"  /* ACC_Mode_e (Speed, Distance, Stop) */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/**
- * @brief ACC 제어 모드
- * (Speed, Distance, Stop)
- */
-typedef enum
-{
-    ACC_MODE_SPEED = 0,
-    ACC_MODE_DISTANCE,
-    ACC_MODE_STOP
-} ACC_Mode_e;
-
 /**
  * @brief ACC 타겟 상태 (Moving, Stopped, Stationary, Oncoming)
  */
@@ -61,7 +52,7 @@ typedef struct
     float Ego_Velocity_X;       /* (0, 100) [m/s] */
     float Ego_Acceleration_X;   /* (-10, 10) [m/s²] */
     /* 필요하다면 Ego_Velocity_Y, Heading 등 추가 */
-} Ego_Data_t;
+} ACC_Ego_Data_t;
 
 /**
  * @brief 차선 데이터 (Lane Data)
@@ -76,13 +67,31 @@ typedef struct
     int   LS_Is_Curved_Lane;    /* (True=1, False=0) */
 } Lane_Data_t;
 
+/**
+ * @brief ACC 내부 상태 (PID 적분/과거오차 + 모드 전환 추적)
+ *  - 제어기 인스턴스마다 1개, acc_init_state()로 초기화
+ *  - Prev_Mode / Prev_Accel: 비활성 PID로 전환될 때 적분항을 역산하여
+ *    출력이 연속되도록(bumpless) 하는 데 사용
+ */
+typedef struct
+{
+    float      Dist_Integral;
+    float      Dist_Prev_Error;
+    float      Prev_Time_Distance;  /* [s] */
+    float      Speed_Integral;
+    float      Speed_Prev_Error;
+    ACC_Mode_e Prev_Mode;
+    float      Prev_Accel;          /* 직전 주기 최종 출력 [m/s^2] */
+    int        Is_Initialized;      /* (True=1, False=0) */
+} ACC_State_t;
+
 /**
  * @brief 2.2.4.1.1 acc_mode_selection
  * ACC 제어 모드(Speed, Distance, Stop) 결정
  */
 ACC_Mode_e acc_mode_selection(
     const ACC_Target_Data_t *pAccTargetData,
-    const Ego_Data_t        *pEgoData,
+    const ACC_Ego_Data_t    *pEgoData,
     const Lane_Data_t       *pLaneData
 );
 
@@ -93,7 +102,7 @@ ACC_Mode_e acc_mode_selection(
 float calculate_accel_for_distance_pid(
     ACC_Mode_e               accMode,          /* (Speed, Distance, Stop) */
     const ACC_Target_Data_t *pAccTargetData,
-    const Ego_Data_t        *pEgoData,
+    const ACC_Ego_Data_t    *pEgoData,
     float                    current_time
 );
 
@@ -102,9 +111,9 @@ float calculate_accel_for_distance_pid(
  * 속도 모드에서의 종방향 가속도 계산
  */
 float calculate_accel_for_speed_pid(
-    const Ego_Data_t  *pEgoData,
-    const Lane_Data_t *pLaneData,
-    float              delta_time
+    const ACC_Ego_Data_t *pEgoData,
+    const Lane_Data_t    *pLaneData,
+    float                 delta_time
 );
 
 /**
@@ -117,6 +126,37 @@ float acc_output_selection(
     float      Accel_Speed_X
 );
 
+/**
+ * @brief ACC 상태 초기화
+ */
+void acc_init_state(ACC_State_t *pState);
+
+/**
+ * @brief 기본 인스턴스 상태 (calculate_accel_for_*_pid 용) 읽기/쓰기 (스냅샷/복원용)
+ */
+void acc_get_default_state(ACC_State_t *pState);
+void acc_set_default_state(const ACC_State_t *pState);
+
+/**
+ * @brief 모드 디스패치 ACC 계산
+ *  - accMode에 해당하는 PID만 계산 (Speed -> 속도 PID, Distance -> 거리 PID, Stop -> 0.0)
+ *  - 모드 전환 시 새로 활성화되는 PID의 적분항을 직전 출력 기준으로 역산 (bumpless)
+ *  - 결과는 calculate_accel_for_*_pid + acc_output_selection 조합과 동일한 의미
+ * @param pState       : (입출력) ACC 내부 상태
+ * @param current_time : (입력) 현재 시각 [s]
+ * @param delta_time   : (입력) 제어 주기 [s]
+ * @return float       : 최종 ACC 가속도 Accel_ACC_X [m/s^2]
+ */
+float acc_calculate_accel(
+    ACC_State_t             *pState,
+    ACC_Mode_e               accMode,
+    const ACC_Target_Data_t *pAccTargetData,
+    const ACC_Ego_Data_t    *pEgoData,
+    const Lane_Data_t       *pLaneData,
+    float                    current_time,
+    float                    delta_time
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,150 @@
+/****************************************************************************
+ * adas_bench_stats.h
+ *
+ * - 벤치마크(bench/adas_benchmark.cpp) 결과 기준값 저장 + 통계적 회귀 검출
+ *   : 입력 = Google Benchmark JSON (--benchmark_repetitions=N, 반복별 값 사용, 집계 항목 무시)
+ *   : 기준값 = CSV (벤치마크마다 중앙값 / MAD / p99 + 반복별 표본)
+ * - 잡음에 강한 통계: 중앙값, MAD(중앙값 절대 편차), 순위 기반 Mann-Whitney U 검정
+ *   : 단측 검정 (새 결과가 기준보다 느린가), 동순위 없고 표본이 작으면 정확 분포, 그 외 정규 근사
+ *   : 회귀 = p < Alpha 이고 중앙값 증가율 > Threshold_Pct
+ * - 개발 PC 에서 로컬 실행 (tools/bench_compare.c)
+ ****************************************************************************/
+#ifndef ADAS_BENCH_STATS_H
+#define ADAS_BENCH_STATS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_BENCH_MAX_SERIES    256   /* 파일당 벤치마크 수 */
+#define ADAS_BENCH_MAX_SAMPLES   128   /* 벤치마크당 반복 수 */
+#define ADAS_BENCH_NAME_LEN      128
+#define ADAS_BENCH_MIN_SAMPLES   5     /* 검정에 필요한 최소 반복 수 (양쪽 각각) */
+#define ADAS_BENCH_EXACT_MAX     20    /* 정확 분포 사용 최대 표본 수 (양쪽 각각) */
+
+/**
+ * @brief 비교할 시간 항목
+ */
+typedef enum
+{
+    ADAS_BENCH_METRIC_CPU = 0,     /* cpu_time */
+    ADAS_BENCH_METRIC_REAL         /* real_time */
+} AdasBenchMetric_e;
+
+/**
+ * @brief 벤치마크 1개 (반복별 표본 [ns])
+ */
+typedef struct
+{
+    char   Name[ADAS_BENCH_NAME_LEN];
+    int    Count;
+    double Samples_Ns[ADAS_BENCH_MAX_SAMPLES];
+} AdasBenchSeries_t;
+
+/**
+ * @brief 결과 파일 1개 (JSON 또는 기준값 CSV)
+ */
+typedef struct
+{
+    int               Count;
+    int               Truncated;   /* 최대 수 초과로 버린 벤치마크/표본 있음 */
+    AdasBenchSeries_t Series[ADAS_BENCH_MAX_SERIES];
+} AdasBenchSet_t;
+
+/**
+ * @brief 요약 통계
+ */
+typedef struct
+{
+    int    Count;
+    double Median_Ns;
+    double Mad_Ns;                 /* median(|x - median|) (정규 분포 환산 계수 미적용) */
+    double P99_Ns;                 /* 최근접 순위 */
+    double Min_Ns;
+} AdasBenchSummary_t;
+
+/**
+ * @brief 비교 판정
+ */
+typedef enum
+{
+    ADAS_BENCH_SAME = 0,           /* 유의하지 않음 또는 임계값 이하 */
+    ADAS_BENCH_REGRESSION,         /* 유의 + 임계값 초과 (느려짐) */
+    ADAS_BENCH_IMPROVEMENT,        /* 유의 + 임계값 초과 (빨라짐) */
+    ADAS_BENCH_INSUFFICIENT,       /* 표본 부족 -> 검정 안 함 */
+    ADAS_BENCH_MISSING             /* 한쪽에만 있음 */
+} AdasBenchVerdict_e;
+
+/**
+ * @brief 벤치마크 1개 비교 결과
+ */
+typedef struct
+{
+    char               Name[ADAS_BENCH_NAME_LEN];
+    AdasBenchSummary_t Base;
+    AdasBenchSummary_t New;
+    double             Delta_Pct;      /* (New - Base) / Base 중앙값 [%] */
+    double             P_Slower;       /* 단측 p (New > Base) */
+    double             P_Faster;       /* 단측 p (New < Base) */
+    AdasBenchVerdict_e Verdict;
+} AdasBenchCompare_t;
+
+/**
+ * @brief 요약 통계 계산
+ * @return 0 : 성공, -1 : 인자 오류 / 표본 없음
+ */
+int AdasBenchStats_Summarize(const double *pSamples, int count, AdasBenchSummary_t *pOut);
+
+/**
+ * @brief Mann-Whitney U 단측 p 값 (B 가 A 보다 큰 쪽으로 치우쳤는가)
+ *  - 동순위 없고 양쪽 <= ADAS_BENCH_EXACT_MAX 이면 정확 분포, 그 외 정규 근사 (동순위/연속성 보정)
+ * @return p (0 ~ 1), 인자 오류면 1
+ */
+double AdasBenchStats_MannWhitneyGreater(const double *pA, int countA, const double *pB, int countB);
+
+/**
+ * @brief Google Benchmark JSON 읽기 (run_type "aggregate" 제외, time_unit -> ns 환산)
+ * @return 0 : 성공, -1 : 파일/형식 오류
+ */
+int AdasBench_LoadGbenchJson(const char *path, AdasBenchMetric_e metric, AdasBenchSet_t *pSet);
+
+/**
+ * @brief 기준값 CSV 저장 / 읽기
+ *  - 헤더: name,count,median_ns,mad_ns,p99_ns,samples_ns (표본은 공백 구분)
+ * @return 0 : 성공, -1 : 파일/형식 오류
+ */
+int AdasBench_SaveBaseline(const char *path, const AdasBenchSet_t *pSet);
+int AdasBench_LoadBaseline(const char *path, AdasBenchSet_t *pSet);
+
+/**
+ * @brief 이름으로 찾기 (없으면 NULL)
+ */
+const AdasBenchSeries_t *AdasBench_Find(const AdasBenchSet_t *pSet, const char *name);
+
+/**
+ * @brief 벤치마크 1개 비교
+ */
+void AdasBench_CompareSeries(const AdasBenchSeries_t *pBase, const AdasBenchSeries_t *pNew,
+                             double alpha, double thresholdPct, AdasBenchCompare_t *pOut);
+
+/**
+ * @brief 기준 / 새 결과 전체 비교 (기준 순서, 새 결과에만 있는 항목은 뒤에 MISSING)
+ * @param pOut     : 결과 배열 (용량 maxOut)
+ * @return 결과 수
+ */
+int AdasBench_Compare(const AdasBenchSet_t *pBase, const AdasBenchSet_t *pNew,
+                      double alpha, double thresholdPct,
+                      AdasBenchCompare_t *pOut, int maxOut);
+
+/**
+ * @brief 판정 이름 ("same", "REGRESSION", ...)
+ */
+const char *AdasBench_VerdictName(AdasBenchVerdict_e verdict);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_BENCH_STATS_H */
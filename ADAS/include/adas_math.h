@@ -0,0 +1,139 @@
+/****************************************************************************
+ * adas_math.h
+ *
+ * - 전 모듈 공용 수학 커널: 각도 정규화, atan, sin/cos
+ * - 모든 함수는 입력 값과 무관하게 O(1) (루프/반복 없음) -> WCET 상한 보장
+ * - 다항식 근사 + 최대 오차 명시, 스칼라(inline) / 배치(SIMD, adas_math.c) 제공
+ ****************************************************************************/
+#ifndef ADAS_MATH_H
+#define ADAS_MATH_H
+
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_MATH_PI        (3.14159265358979f)
+#define ADAS_MATH_HALF_PI   (1.57079632679490f)
+#define ADAS_MATH_DEG2RAD   (0.0174532925199433f)
+#define ADAS_MATH_RAD2DEG   (57.2957795130823f)
+
+/* 최대 절대 오차 (테스트로 검증, adas_math_test.cpp) */
+#define ADAS_MATH_ATAN_MAX_ERR     (1.5e-5f)   /* [rad] (~0.001°), 전 구간 */
+#define ADAS_MATH_SINCOS_MAX_ERR   (2.0e-7f)   /* [rad], |x| <= ADAS_MATH_TRIG_EXACT_LIMIT */
+
+/* 정확도 보장 입력 범위 (밖의 값도 유한 시간/유한 값 반환, 정확도만 저하) */
+#define ADAS_MATH_WRAP_EXACT_LIMIT (1.0e6f)    /* [°] */
+#define ADAS_MATH_TRIG_EXACT_LIMIT (1.0e4f)    /* [rad] */
+
+/* sin/cos 인자 상한: 사분면 인덱스 int 변환 overflow 방지 */
+#define ADAS_MATH_TRIG_ARG_CLAMP   (1.0e8f)    /* [rad] */
+
+/**
+ * @brief 각도 정규화 (±180°), 분기/반복 없음
+ *  - deg - 360 * round(deg / 360), 결과 [-180, 180]
+ *  - 기존 while 루프 방식과 달리 큰 값/Inf 에서도 상수 시간 (Inf -> NaN, NaN -> NaN)
+ */
+static inline float AdasMath_WrapDeg180(float deg)
+{
+    return deg - (360.0f * rintf(deg * (1.0f / 360.0f)));
+}
+
+/**
+ * @brief atan 근사 (A&S 4.4.49, 9차 홀수 다항식)
+ *  - |x| > 1 은 atan(x) = ±π/2 - atan(1/x) 로 [-1, 1] 구간에 축약
+ *  - 최대 오차 ADAS_MATH_ATAN_MAX_ERR, ±Inf -> ±π/2
+ */
+static inline float AdasMath_AtanF(float x)
+{
+    float ax  = fabsf(x);
+    int   inv = (ax > 1.0f);
+    float r   = inv ? (1.0f / x) : x;   /* cmov/blend 로 컴파일 */
+    float z   = r * r;
+
+    float p = r * (0.9998660f + z * (-0.3302995f + z * (0.1801410f + z * (-0.0851330f + z * 0.0208351f))));
+
+    float hp = copysignf(ADAS_MATH_HALF_PI, x);
+    return inv ? (hp - p) : p;
+}
+
+/**
+ * @brief sin/cos 동시 계산 (Cephes 다항식, π/2 Cody-Waite 축약)
+ *  - 최대 오차 ADAS_MATH_SINCOS_MAX_ERR (|x| <= ADAS_MATH_TRIG_EXACT_LIMIT)
+ *  - |x| > ADAS_MATH_TRIG_ARG_CLAMP 는 포화 후 계산 (NaN -> 포화값)
+ */
+static inline void AdasMath_SinCosF(float x, float *pSin, float *pCos)
+{
+    x = fminf(fmaxf(x, -ADAS_MATH_TRIG_ARG_CLAMP), ADAS_MATH_TRIG_ARG_CLAMP);
+
+    float q  = rintf(x * (2.0f / ADAS_MATH_PI));
+    int   qi = (int)q;
+
+    /* r = x - q*(π/2), 3단 분할 상수로 상쇄 오차 최소화 */
+    float r = x - q * 1.5703125f;
+    r = r - q * 4.837512969970703125e-4f;
+    r = r - q * 7.54978995489188216e-8f;
+
+    float z = r * r;
+    float s = r + r * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f);
+    float c = 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+
+    /* 사분면 보정: q mod 4 = 0:(s,c) 1:(c,-s) 2:(-s,-c) 3:(-c,s) */
+    int   swap  = qi & 1;
+    float sinV  = swap ? c : s;
+    float cosV  = swap ? s : c;
+    float sSign = (qi & 2) ? -1.0f : 1.0f;
+    float cSign = ((qi + 1) & 2) ? -1.0f : 1.0f;
+
+    *pSin = sSign * sinV;
+    *pCos = cSign * cosV;
+}
+
+/**
+ * @brief cos 근사 (AdasMath_SinCosF 참조)
+ */
+static inline float AdasMath_CosF(float x)
+{
+    float s, c;
+    AdasMath_SinCosF(x, &s, &c);
+    return c;
+}
+
+/**
+ * @brief sin 근사 (AdasMath_SinCosF 참조)
+ */
+static inline float AdasMath_SinF(float x)
+{
+    float s, c;
+    AdasMath_SinCosF(x, &s, &c);
+    return s;
+}
+
+/*=============================================================
+ * 배치(SIMD) 변형
+ *  - x86 SSE2 빌드 시 4-lane 벡터 경로, 그 외는 스칼라 루프 fallback
+ *  - 스칼라 함수와 동일 다항식/축약 -> 정확도 범위 내 결과 일치
+ *  - pIn == pOut (in-place) 허용
+ *============================================================*/
+
+/**
+ * @brief 각도 정규화 배치 (|deg| <= ADAS_MATH_WRAP_EXACT_LIMIT 에서 스칼라와 동일)
+ */
+void AdasMath_WrapDeg180_Batch(const float *pIn, float *pOut, int count);
+
+/**
+ * @brief atan 배치
+ */
+void AdasMath_AtanF_Batch(const float *pIn, float *pOut, int count);
+
+/**
+ * @brief sin/cos 배치 (pSin, pCos 중 NULL 인 출력은 생략)
+ */
+void AdasMath_SinCosF_Batch(const float *pIn, float *pSin, float *pCos, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_MATH_H */
@@ -0,0 +1,156 @@
+/****************************************************************************
+ * adas_metrics.h
+ *
+ * - 단계별 실행 시간 분포 (WCET / 꼬리 지연 근거 자료)
+ * - 런타임 주기 기상 지연 / 완료 시간 분포 (jitter 근거 자료, tools/jitter_bench.c)
+ * - 고정 버킷 log-linear(HDR 방식) 히스토그램 [ns]
+ *   : 0 ~ 2*SUB-1 은 1ns 단위 선형, 그 위는 2의 거듭제곱 구간마다 SUB 개 등분
+ *   : 상대 오차 <= 1/SUB (SUB = 32 -> 약 3%), 최대 2^40 ns (초과 값은 마지막 버킷)
+ *   : 최대/최소/합계는 정확한 값 별도 보관
+ * - 기록(제어 루프)은 잠금 없음: 히스토그램마다 단일 기록자 + 시퀀스 잠금(seqlock)
+ *   : 기록자 Seq 홀수 -> 갱신 -> Seq 짝수, 진단 스레드는 Seq 가 같은 짝수일 때만 복사 채택
+ *   : 태스크 그래프 모드에서도 한 주기에 한 단계는 한 스레드만 실행 -> 단일 기록자 유지
+ * - 진단 스레드: AdasMetrics_Snapshot 으로 찢김 없는 복사본 -> 백분위수/최대
+ ****************************************************************************/
+#ifndef ADAS_METRICS_H
+#define ADAS_METRICS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_HIST_SUB_BITS   5
+#define ADAS_HIST_SUB_COUNT  (1u << ADAS_HIST_SUB_BITS)
+#define ADAS_HIST_MAX_BITS   40
+#define ADAS_HIST_BUCKETS    ((ADAS_HIST_MAX_BITS - ADAS_HIST_SUB_BITS + 1) * ADAS_HIST_SUB_COUNT)
+#define ADAS_HIST_MAX_VALUE  ((1ULL << ADAS_HIST_MAX_BITS) - 1)
+
+/* Snapshot 재시도 한도 (기록자가 계속 갱신 중이면 실패 반환) */
+#define ADAS_HIST_SNAPSHOT_RETRIES  64
+
+/**
+ * @brief 계측 항목 (0 ~ ARBITRATION 은 AdasStage_e 와 같은 번호)
+ */
+typedef enum
+{
+    ADAS_METRIC_EGO = 0,
+    ADAS_METRIC_LANE,
+    ADAS_METRIC_TARGET,              /* Target 단계 전체 */
+    ADAS_METRIC_ACC,
+    ADAS_METRIC_AEB,
+    ADAS_METRIC_LFA,
+    ADAS_METRIC_ARBITRATION,
+    ADAS_METRIC_TARGET_FILTER,       /* select_target_from_object_list */
+    ADAS_METRIC_TARGET_PREDICT,      /* predict_object_future_path */
+    ADAS_METRIC_TARGET_SELECT,       /* select_targets_for_acc_aeb */
+    ADAS_METRIC_PIPELINE,            /* 7단계 전체 (병렬 시 임계 경로) */
+    ADAS_METRIC_WAKE,                /* 기상 지연: 실제 기상 - 예정 시각(release) */
+    ADAS_METRIC_RESPONSE,            /* 완료 시간: 주기 처리 종료 - release (마감 = 주기) */
+    ADAS_METRIC_COUNT
+} AdasMetric_e;
+
+/**
+ * @brief 지연 히스토그램 (기록자 1개)
+ */
+typedef struct
+{
+    uint32_t Seq;                    /* 홀수 = 갱신 중 */
+    uint32_t Reserved;
+    uint64_t Count;
+    uint64_t Sum_Ns;
+    uint64_t Min_Ns;                 /* Count = 0 이면 UINT64_MAX */
+    uint64_t Max_Ns;
+    uint64_t Buckets[ADAS_HIST_BUCKETS];
+} AdasLatencyHist_t;
+
+/**
+ * @brief 단계별 히스토그램 묶음
+ */
+typedef struct
+{
+    AdasLatencyHist_t Hist[ADAS_METRIC_COUNT];
+} AdasMetrics_t;
+
+/**
+ * @brief 요약 (백분위수는 해당 버킷 상한, Max 로 제한)
+ */
+typedef struct
+{
+    uint64_t Count;
+    uint64_t Min_Ns;
+    double   Mean_Ns;
+    uint64_t P50_Ns;
+    uint64_t P99_Ns;
+    uint64_t P999_Ns;
+    uint64_t P9999_Ns;
+    uint64_t Max_Ns;
+} AdasLatencySummary_t;
+
+/**
+ * @brief 초기화 (모든 히스토그램 비움)
+ */
+void AdasMetrics_Init(AdasMetrics_t *pMetrics);
+
+/**
+ * @brief 히스토그램 비우기 (기록자 스레드에서만 호출)
+ */
+void AdasHist_Reset(AdasLatencyHist_t *pHist);
+
+/**
+ * @brief pSrc 를 pDst 에 합침 (pDst 기록자 스레드에서, pSrc 는 기록이 끝났거나 복사본)
+ *  - 스레드별 히스토그램을 모아 전체 분포 계산 (같은 버킷 구조 -> 정확히 합산)
+ */
+void AdasHist_Merge(AdasLatencyHist_t *pDst, const AdasLatencyHist_t *pSrc);
+
+/**
+ * @brief (기록자) 값 1개 기록 - 잠금/시스템 콜 없음
+ */
+void AdasHist_Record(AdasLatencyHist_t *pHist, uint64_t valueNs);
+
+/**
+ * @brief 값 -> 버킷 번호 / 버킷 -> 포함 범위 [하한, 상한]
+ */
+uint32_t AdasHist_BucketOf(uint64_t valueNs);
+uint64_t AdasHist_BucketLow(uint32_t bucket);
+uint64_t AdasHist_BucketHigh(uint32_t bucket);
+
+/**
+ * @brief (임의 스레드) 찢김 없는 복사본
+ * @return 0 : 성공, -1 : 인자 오류 / 재시도 한도 초과
+ */
+int AdasHist_Snapshot(const AdasLatencyHist_t *pHist, AdasLatencyHist_t *pOut);
+
+/**
+ * @brief (임의 스레드) 전 항목 복사본 (항목마다 찢김 없음, 항목 간 시점은 다를 수 있음)
+ * @return 0 : 성공, -1 : 인자 오류 / 일부 항목 재시도 한도 초과
+ */
+int AdasMetrics_Snapshot(const AdasMetrics_t *pMetrics, AdasMetrics_t *pOut);
+
+/**
+ * @brief 백분위수 [ns] (복사본에 사용, percentile = 0 ~ 100)
+ *  - 순위 ceil(p/100 * Count) 번째 값이 속한 버킷 상한 (Max 초과 안 함), Count = 0 이면 0
+ */
+uint64_t AdasHist_Percentile(const AdasLatencyHist_t *pHist, double percentile);
+
+/**
+ * @brief 요약 계산 (복사본에 사용)
+ */
+void AdasHist_Summarize(const AdasLatencyHist_t *pHist, AdasLatencySummary_t *pSummary);
+
+/**
+ * @brief 항목 이름 (범위 밖이면 "?")
+ */
+const char *AdasMetrics_Name(AdasMetric_e metric);
+
+/**
+ * @brief 항목별 요약 표 출력 (내부에서 Snapshot 사용, 기록이 없는 항목은 생략)
+ */
+void AdasMetrics_Print(const AdasMetrics_t *pMetrics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_METRICS_H */
@@ -0,0 +1,124 @@
+/****************************************************************************
+ * adas_perf.h
+ *
+ * - 단계별 하드웨어 성능 카운터 (Linux perf_event_open, 선택 계측 모드)
+ *   : cycles / instructions / L1D 읽기 miss / LLC miss / branch miss
+ *   : + 소프트웨어 카운터 page fault / context switch (mlock, 선점 확인용)
+ * - 카운터는 한 그룹으로 열어 read() 1회에 동시 값 읽기 (단계 경계마다 1회)
+ *   : 단계 실행 전/후 값의 차이를 해당 단계에 누적 (합계 / 최대)
+ *   : 하드웨어 카운터는 사용자 공간만 계수 (exclude_kernel, perf_event_paranoid <= 2 에서 동작)
+ *   : 소프트웨어 카운터는 커널 포함 (문맥 전환은 커널 안 이벤트)
+ *     paranoid >= 2 (비특권) 이면 page fault 는 사용자 모드만, 문맥 전환은 사용 불가
+ * - 열기는 계측 대상 스레드(런타임 루프 스레드)에서 호출, 카운터는 그 스레드만 계수
+ * - 열 수 없는 카운터는 건너뜀 (VM / 컨테이너 / 비 Linux)
+ *   : 하나도 못 열면 모든 호출이 아무 일도 하지 않음 -> 런타임 동작 그대로
+ * - 단계 경계마다 시스템 콜 1회 (~1us) 추가 -> 파이프라인 전체 시간은 그만큼 증가
+ ****************************************************************************/
+#ifndef ADAS_PERF_H
+#define ADAS_PERF_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 카운터 종류
+ */
+typedef enum
+{
+    ADAS_PERF_CYCLES = 0,
+    ADAS_PERF_INSTRUCTIONS,
+    ADAS_PERF_L1D_MISS,          /* L1D 읽기 miss */
+    ADAS_PERF_LLC_MISS,          /* 마지막 단계 캐시 miss */
+    ADAS_PERF_BRANCH_MISS,
+    ADAS_PERF_PAGE_FAULTS,       /* 소프트웨어 카운터 */
+    ADAS_PERF_CTX_SWITCHES,      /* 소프트웨어 카운터 */
+    ADAS_PERF_COUNTER_COUNT
+} AdasPerfCounter_e;
+
+/**
+ * @brief 그룹 읽기 값 (열리지 않은 카운터는 0)
+ */
+typedef struct
+{
+    uint64_t Value[ADAS_PERF_COUNTER_COUNT];
+    uint64_t Time_Enabled;       /* [ns] 그룹 활성 시간 */
+    uint64_t Time_Running;       /* [ns] 실제 계수 시간 (< Enabled 이면 다중화) */
+} AdasPerfSample_t;
+
+/**
+ * @brief 단계별 누적 (단계 1회 실행 = 표본 1개)
+ */
+typedef struct
+{
+    uint64_t Samples;
+    uint64_t Total[ADAS_PERF_COUNTER_COUNT];
+    uint64_t Max[ADAS_PERF_COUNTER_COUNT];
+} AdasPerfStageStats_t;
+
+/**
+ * @brief 카운터 그룹 + 단계별 누적
+ */
+typedef struct
+{
+    int      Leader_Fd;                              /* -1 = 열린 카운터 없음 */
+    int      Fd[ADAS_PERF_COUNTER_COUNT];            /* -1 = 사용 불가 */
+    int      Slot_Count;                             /* 그룹 안 카운터 수 */
+    uint8_t  Slot_Counter[ADAS_PERF_COUNTER_COUNT];  /* 그룹 읽기 순서 -> 카운터 */
+    uint64_t Multiplexed;                            /* 다중화 중 표본 수 (값은 보정 안 함) */
+    uint64_t Not_Running;                            /* 계수 안 된 구간 (표본 버림) */
+    AdasPerfStageStats_t Stage[ADAS_STAGE_COUNT];
+} AdasPerf_t;
+
+/**
+ * @brief 호출 스레드 카운터 그룹 열기 + 시작
+ * @return 연 카운터 수 (0 = 사용 불가, 이후 호출은 아무 일도 안 함), -1 : 인자 오류
+ */
+int AdasPerf_Open(AdasPerf_t *pPerf);
+
+/**
+ * @brief 카운터 닫기 (누적값 유지, 중복 호출 가능)
+ */
+void AdasPerf_Close(AdasPerf_t *pPerf);
+
+/**
+ * @brief 카운터 사용 가능 여부
+ */
+int AdasPerf_IsAvailable(const AdasPerf_t *pPerf, AdasPerfCounter_e counter);
+
+/**
+ * @brief 그룹 값 읽기 (시스템 콜 1회)
+ * @return 0 : 성공, -1 : 열린 카운터 없음 / 읽기 실패
+ */
+int AdasPerf_Read(const AdasPerf_t *pPerf, AdasPerfSample_t *pSample);
+
+/**
+ * @brief 단계 전/후 값의 차이를 단계 누적에 더함
+ *  - 계수 시간이 늘지 않은 구간은 버림, 다중화 구간은 Multiplexed 증가 후 그대로 누적
+ */
+void AdasPerf_AddStage(AdasPerf_t *pPerf, AdasStage_e stage,
+                       const AdasPerfSample_t *pBefore, const AdasPerfSample_t *pAfter);
+
+/**
+ * @brief 단계 누적 초기화 (카운터는 유지)
+ */
+void AdasPerf_Reset(AdasPerf_t *pPerf);
+
+/**
+ * @brief 카운터 이름 (범위 밖이면 "?")
+ */
+const char *AdasPerf_CounterName(AdasPerfCounter_e counter);
+
+/**
+ * @brief 단계별 요약 출력 (단계 1회 평균, IPC, miss / 1k 명령어, 사용 불가 항목은 "-")
+ */
+void AdasPerf_Print(const AdasPerf_t *pPerf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_PERF_H */
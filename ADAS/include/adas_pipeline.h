@@ -0,0 +1,171 @@
+/****************************************************************************
+ * adas_pipeline.h
+ *
+ * - 7개 모듈(Ego -> Lane -> Target -> ACC -> AEB -> LFA -> Arbitration)을
+ *   한 제어 주기(frame)로 묶은 파이프라인
+ * - 모듈 간 중간 결과는 AdasFrameOutput_t 에 모두 남김 (로깅/디버깅용)
+ * - 단계(stage) 단위 실행 API 제공 -> 런타임이 단계별 시간 계측/예산 검사
+ * - 단계별 입력/출력 데이터 선언 -> 태스크 그래프로 독립 단계 병렬 실행
+ *   (Target 이후 ACC / AEB / LFA 체인은 Arbitration 까지 서로 독립,
+ *    LFA 는 Target 결과를 쓰지 않으므로 Target 과도 동시 실행)
+ ****************************************************************************/
+#ifndef ADAS_PIPELINE_H
+#define ADAS_PIPELINE_H
+
+#include "adas_shared.h"
+#include "ego_vehicle_estimation.h"
+#include "acc.h"
+#include "aeb.h"
+#include "lfa.h"
+#include "arbitration.h"
+#include "adas_task_graph.h"
+#include "adas_metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 한 주기에 처리하는 최대 객체 수 */
+#define ADAS_MAX_OBJECTS  64
+
+/**
+ * @brief 파이프라인 단계 (실행 순서)
+ */
+typedef enum
+{
+    ADAS_STAGE_EGO = 0,       /* Ego Vehicle Estimation */
+    ADAS_STAGE_LANE,          /* Lane Selection */
+    ADAS_STAGE_TARGET,        /* Target Selection (필터링/예측/선정) */
+    ADAS_STAGE_ACC,
+    ADAS_STAGE_AEB,
+    ADAS_STAGE_LFA,
+    ADAS_STAGE_ARBITRATION,
+    ADAS_STAGE_COUNT
+} AdasStage_e;
+
+/**
+ * @brief 단계 간 데이터 (태스크 그래프 입력/출력 비트)
+ */
+typedef enum
+{
+    ADAS_DATA_INPUT       = (1u << 0),   /* AdasFrameInput_t (읽기 전용) */
+    ADAS_DATA_EGO         = (1u << 1),
+    ADAS_DATA_LANE_SELECT = (1u << 2),
+    ADAS_DATA_TARGETS     = (1u << 3),   /* Filtered/Predicted/Acc_Target/Aeb_Target */
+    ADAS_DATA_ACC_CMD     = (1u << 4),
+    ADAS_DATA_AEB_CMD     = (1u << 5),
+    ADAS_DATA_LFA_CMD     = (1u << 6),
+    ADAS_DATA_CONTROL     = (1u << 7)
+} AdasData_e;
+
+/**
+ * @brief 한 주기 입력 (센서/인지 결과)
+ */
+typedef struct
+{
+    TimeData_t   Time;          /* Current_Time [ms] */
+    GPSData_t    Gps;
+    IMUData_t    Imu;
+    LaneData_t   Lane;
+    int          Object_Count;  /* (0 ~ ADAS_MAX_OBJECTS) */
+    ObjectData_t Objects[ADAS_MAX_OBJECTS];
+} AdasFrameInput_t;
+
+/**
+ * @brief 한 주기 출력 (모듈별 중간 결과 + 최종 제어)
+ */
+typedef struct
+{
+    EgoData_t          Ego;
+    LaneSelectOutput_t Lane_Select;
+
+    int                Filtered_Count;
+    FilteredObject_t   Filtered[ADAS_MAX_OBJECTS];
+    int                Predicted_Count;
+    PredictedObject_t  Predicted[ADAS_MAX_OBJECTS];
+    ACC_Target_t       Acc_Target;
+    AEB_Target_t       Aeb_Target;
+
+    ACC_Mode_e         Acc_Mode;
+    float              Accel_Acc;   /* [m/s^2] */
+
+    AEB_Mode_e         Aeb_Mode;
+    TTC_Data_t         Ttc;
+    float              Decel_Aeb;   /* [m/s^2] */
+
+    LFA_Mode_e         Lfa_Mode;
+    float              Steer_Lfa;   /* [°] */
+
+    VehicleControl_t   Control;
+} AdasFrameOutput_t;
+
+/**
+ * @brief 파이프라인 (주기 간 유지되는 제어기 상태)
+ */
+typedef struct
+{
+    EgoVehicleKFState_t Kf;
+    ACC_State_t         Acc;
+    LFA_State_t         Lfa;
+    float               Delta_Time;  /* 제어 주기 [s] */
+    AdasMetrics_t      *pMetrics;    /* Target 내부 시간 기록 대상 (NULL = 없음, 스냅샷 제외) */
+} AdasPipeline_t;
+
+/**
+ * @brief 파이프라인 초기화
+ * @param deltaTime : 제어 주기 [s] (> 0)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasPipeline_Init(AdasPipeline_t *pPipe, float deltaTime);
+
+/**
+ * @brief 한 단계 실행 (이전 단계 결과는 pOut 에 있어야 함)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasPipeline_RunStage(AdasPipeline_t         *pPipe,
+                          AdasStage_e             stage,
+                          const AdasFrameInput_t *pIn,
+                          AdasFrameOutput_t      *pOut);
+
+/**
+ * @brief 전 단계 순서대로 실행 (한 주기)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasPipeline_Step(AdasPipeline_t         *pPipe,
+                      const AdasFrameInput_t *pIn,
+                      AdasFrameOutput_t      *pOut);
+
+/**
+ * @brief 7단계를 태스크 그래프로 등록 (태스크 번호 = AdasStage_e)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasPipeline_BuildGraph(AdasTaskGraph_t *pGraph);
+
+/**
+ * @brief 태스크 그래프로 한 주기 실행 (AdasPipeline_BuildGraph + AdasTaskGraph_Start 이후)
+ *  - 결과는 AdasPipeline_Step 과 동일, 독립 단계는 워커에서 동시 실행
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasPipeline_StepGraph(AdasTaskGraph_t        *pGraph,
+                           AdasPipeline_t         *pPipe,
+                           const AdasFrameInput_t *pIn,
+                           AdasFrameOutput_t      *pOut);
+
+/**
+ * @brief Target 단계 내부(필터/예측/선정) 시간 기록 대상 지정 (NULL = 해제, 기본)
+ *  - 인스턴스별 (파이프라인마다 다른 대상 가능), 스냅샷 캡처/복원 대상 아님
+ *  - 지정 시 Target 단계마다 단조 시각 4회 추가 조회
+ *  - 파이프라인 실행 전에 지정 (실행 중 변경 비보장)
+ */
+void AdasPipeline_SetMetrics(AdasPipeline_t *pPipe, AdasMetrics_t *pMetrics);
+
+/**
+ * @brief 단계 이름 (로그 출력용)
+ */
+const char *AdasPipeline_StageName(AdasStage_e stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_PIPELINE_H */
@@ -0,0 +1,141 @@
+/****************************************************************************
+ * adas_pipelined.h
+ *
+ * - 2코어 파이프라인 실행 모드
+ *   : 인지 스레드 (Ego -> Lane -> Target)   : 프레임 N+1
+ *   : 제어 스레드 (ACC -> AEB -> LFA -> Arbitration) : 프레임 N
+ * - 두 스레드는 3중 버퍼(triple_buffer.h)로 프레임 교환 (wait-free, 최신값 전달)
+ *   : 제어가 느리면 중간 프레임은 버려짐 (Frames_Dropped 로 계측)
+ * - 스레드별 CPU 고정/SCHED_FIFO 는 AdasRuntime_ApplyRtSettings 재사용
+ * - 순차 실행 대비 비교용 계측
+ *   : 추가 지연 = 인지 게시 ~ 제어 시작 사이 전달(hand-off) 지연
+ *   : 처리량 한계 = 1 / max(인지, 제어) (순차 실행은 1 / (인지 + 제어))
+ ****************************************************************************/
+#ifndef ADAS_PIPELINED_H
+#define ADAS_PIPELINED_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+#include "adas_runtime.h"
+#include "triple_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 인지/제어 경계: 이 단계부터 제어 스레드에서 실행 */
+#define ADAS_PIPELINED_FIRST_CONTROL_STAGE  ADAS_STAGE_ACC
+
+/**
+ * @brief 파이프라인 모드 설정
+ */
+typedef struct
+{
+    uint64_t Period_Ns;        /* 인지 주기 [ns] (0 = 쉬지 않고 실행, 처리량 측정용) */
+    uint64_t Cycle_Limit;      /* 인지 프레임 수 (0 = 정지 요청까지) */
+    int      Rt_Priority;      /* SCHED_FIFO 우선순위 (0 = 사용 안 함, 두 스레드 공통) */
+    int      Perception_Cpu;   /* 인지 스레드 CPU (-1 = 고정 안 함) */
+    int      Control_Cpu;      /* 제어 스레드 CPU (-1 = 고정 안 함) */
+    int      Lock_Memory;      /* mlockall (True=1, False=0) */
+    uint32_t Spin_Limit;       /* 제어 스레드: 새 프레임 대기 시 busy-poll 횟수 */
+    uint64_t Poll_Sleep_Ns;    /* 제어 스레드: busy-poll 후 휴면 [ns] (0 = 계속 spin, 전용 코어용) */
+} AdasPipelinedConfig_t;
+
+/**
+ * @brief 계측 결과 (스레드 종료 시 기록, Run 반환 후 유효)
+ */
+typedef struct
+{
+    uint64_t Frames_Published;     /* 인지 -> 게시 */
+    uint64_t Frames_Processed;     /* 제어 완료 */
+    uint64_t Frames_Dropped;       /* 제어가 보지 못하고 덮어쓰인 프레임 */
+    uint64_t Deadline_Misses;      /* 인지 주기 마감 초과 */
+    uint64_t Perception_Total_Ns;
+    uint64_t Perception_Max_Ns;
+    uint64_t Control_Total_Ns;
+    uint64_t Control_Max_Ns;
+    uint64_t Handoff_Total_Ns;     /* 게시 ~ 제어 시작 (파이프라인 추가 지연) */
+    uint64_t Handoff_Max_Ns;
+    uint64_t Latency_Total_Ns;     /* 인지 시작(release) ~ 제어 완료 (end-to-end) */
+    uint64_t Latency_Max_Ns;
+    uint64_t Elapsed_Ns;           /* Run 전체 소요 */
+    int      Rt_Failed;            /* ADAS_RT_FAIL_* (두 스레드 OR) */
+} AdasPipelinedStats_t;
+
+/**
+ * @brief 스레드 간 교환 프레임 (3중 버퍼 슬롯)
+ */
+typedef struct
+{
+    uint64_t          Seq;          /* 1부터 증가 */
+    uint64_t          Release_Ns;   /* 인지 시작 시각 */
+    uint64_t          Publish_Ns;   /* 게시 시각 */
+    AdasFrameInput_t  Input;
+    AdasFrameOutput_t Output;       /* 인지 단계 결과 (제어 스레드가 나머지 채움) */
+} AdasPipelinedFrame_t;
+
+/**
+ * @brief 파이프라인 모드 인스턴스
+ *  - Pipeline.Kf 는 인지 스레드, Pipeline.Acc/Lfa 는 제어 스레드만 사용
+ *  - pfnInput 은 인지 스레드, pfnOutput 은 제어 스레드에서 호출
+ */
+typedef struct
+{
+    AdasPipelinedConfig_t Config;
+    AdasPipelinedStats_t  Stats;
+    AdasPipeline_t        Pipeline;
+    AdasFrameInput_t      Input;        /* 인지 스레드 전용 (주기 간 유지) */
+    AdasFrameOutput_t     Output;       /* 마지막 제어 결과 (Run 반환 후 유효) */
+    AdasPipelinedFrame_t  Slots[TRIPLE_BUFFER_SLOTS];
+    TripleBuffer_t        Exchange;
+    AdasInputFn_t         pfnInput;
+    AdasOutputFn_t        pfnOutput;
+    void                 *pUser;
+    AdasCycleLog_t       *pLog;         /* 제어 스레드에서 기록 (NULL = 기록 안 함) */
+    volatile int          Stop_Requested;
+    int                   Producer_Done;  /* 인지 스레드 종료 (__atomic) */
+} AdasPipelined_t;
+
+/**
+ * @brief 기본 설정 (10ms 주기, 무한 실행, CPU 고정/RT 설정 없음, 20us 폴링)
+ */
+void AdasPipelined_DefaultConfig(AdasPipelinedConfig_t *pConfig);
+
+/**
+ * @brief 초기화 (파이프라인/3중 버퍼 포함)
+ *  - Period_Ns = 0 이면 제어기 dt 는 10ms 로 가정
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasPipelined_Init(AdasPipelined_t             *pPl,
+                       const AdasPipelinedConfig_t *pConfig,
+                       AdasInputFn_t                pfnInput,
+                       AdasOutputFn_t               pfnOutput,
+                       void                        *pUser);
+
+/**
+ * @brief 주기 기록기 연결 (Run 이전, NULL = 기록 안 함, 닫기는 호출자 몫)
+ */
+void AdasPipelined_SetLog(AdasPipelined_t *pPl, AdasCycleLog_t *pLog);
+
+/**
+ * @brief 인지/제어 스레드 생성 후 종료까지 대기
+ *  - 종료: Cycle_Limit 도달 / 정지 요청 / 입력 콜백 종료 -> 남은 프레임 처리 후 제어 종료
+ * @return 0 : 정상 종료, -1 : 인자 오류 또는 스레드 생성 실패
+ */
+int AdasPipelined_Run(AdasPipelined_t *pPl);
+
+/**
+ * @brief 정지 요청 (async-signal-safe)
+ */
+void AdasPipelined_RequestStop(AdasPipelined_t *pPl);
+
+/**
+ * @brief 계측 결과 + 순차 실행 대비 지연/처리량 요약 출력
+ */
+void AdasPipelined_PrintStats(const AdasPipelined_t *pPl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_PIPELINED_H */
@@ -0,0 +1,122 @@
+/****************************************************************************
+ * adas_replay.h
+ *
+ * - 기록 로그(cycle_log.h) 오프라인 재생: 실시간 대기 없이 최대 속도로 7단계 재실행
+ *   : 가상 시계 = 기록된 Input.Time (주기 대기/시스템 시각 미사용)
+ *   : 레코드 입력은 매핑 영역에서 그대로 사용 (복사 없음)
+ * - 재계산 출력과 기록 출력을 비트 단위(memcmp)로 비교 -> 항목별 불일치 수
+ * - 체크포인트 경계(Checkpoint_Interval 배수)로 로그를 나눠 스레드별 병렬 재생
+ *   : 경계 직전 레코드에 상태 스냅샷이 있으면 복원 후 경계부터 바로 재생
+ *     (로그 Snapshot_Interval 이 있으면 경계는 그 배수로 올림) -> 순차 재생과 비트 단위 동일
+ *   : 스냅샷이 없으면 경계 Warmup_Cycles 이전부터 재생해 상태를 수렴시킨 뒤
+ *     경계부터 비교 (Warmup 이 경계보다 길면 0부터 -> 순차와 동일)
+ *   : 첫 구간(0부터)은 항상 순차 재생과 비트 단위 동일
+ * - 기록 시와 같은 빌드/제어 주기(Delta_Time)에서만 비트 단위 일치 보장
+ ****************************************************************************/
+#ifndef ADAS_REPLAY_H
+#define ADAS_REPLAY_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+#include "cycle_log.h"
+#include "adas_snapshot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_REPLAY_MAX_SHARDS   64
+#define ADAS_REPLAY_NO_MISMATCH  UINT64_MAX
+
+/**
+ * @brief 비교 항목 (AdasReplay_Compare 반환 비트 = 1 << 항목)
+ */
+typedef enum
+{
+    ADAS_REPLAY_FIELD_EGO = 0,      /* EgoData_t */
+    ADAS_REPLAY_FIELD_LANE,         /* LaneSelectOutput_t */
+    ADAS_REPLAY_FIELD_TARGETS,      /* ACC/AEB 타깃 */
+    ADAS_REPLAY_FIELD_ACC,          /* 모드 + 가속도 */
+    ADAS_REPLAY_FIELD_AEB,          /* 모드 + 감속도 + TTC */
+    ADAS_REPLAY_FIELD_LFA,          /* 모드 + 조향각 */
+    ADAS_REPLAY_FIELD_CONTROL,      /* VehicleControl_t */
+    ADAS_REPLAY_FIELD_COUNT
+} AdasReplayField_e;
+
+/**
+ * @brief 재생 설정
+ */
+typedef struct
+{
+    int      Thread_Count;          /* 재생 스레드 수 (1 ~ ADAS_REPLAY_MAX_SHARDS) */
+    uint64_t Checkpoint_Interval;   /* 구간 경계 단위 [주기] (> 0) */
+    uint64_t Warmup_Cycles;         /* 스냅샷 없는 구간의 상태 수렴용 재생 주기 수 (비교 제외) */
+    float    Delta_Time;            /* 기록 시 제어 주기 [s] (> 0) */
+    int      Cpu_Base;              /* 스레드 i 고정 CPU = Base + i (-1 = 고정 안 함, CPU_SETSIZE 이상은 고정 안 함) */
+} AdasReplayConfig_t;
+
+/**
+ * @brief 구간 (스레드 1개 담당)
+ *  - [Start, First) : 워밍업 (비교 제외), [First, End) : 비교 구간
+ *  - Restored = 1 이면 스냅샷 복원으로 시작 (Start = First)
+ */
+typedef struct
+{
+    uint64_t Start;
+    uint64_t First;
+    uint64_t End;
+    int      Restored;
+    uint64_t Cycles_Run;
+    uint64_t Mismatches;
+    uint64_t First_Mismatch;        /* 레코드 번호 (없으면 ADAS_REPLAY_NO_MISMATCH) */
+    uint64_t Field_Mismatches[ADAS_REPLAY_FIELD_COUNT];
+    uint64_t Elapsed_Ns;
+} AdasReplayShard_t;
+
+/**
+ * @brief 재생 결과
+ */
+typedef struct
+{
+    uint64_t Records;               /* 비교한 레코드 수 (= 로그 레코드 수) */
+    uint64_t Cycles_Run;            /* 워밍업 포함 실행 주기 수 */
+    int      Restored_Shards;       /* 스냅샷으로 시작한 구간 수 */
+    uint64_t Mismatches;            /* 불일치 레코드 수 */
+    uint64_t First_Mismatch;
+    uint64_t Field_Mismatches[ADAS_REPLAY_FIELD_COUNT];
+    uint64_t Elapsed_Ns;            /* 벽시계 (스레드 생성 ~ 전부 종료) */
+    double   Cycles_Per_Sec;        /* Records / Elapsed */
+    int      Shard_Count;
+    AdasReplayShard_t Shards[ADAS_REPLAY_MAX_SHARDS];
+} AdasReplayResult_t;
+
+/**
+ * @brief 기본 설정 (1 스레드, 경계 1000 주기, 워밍업 500 주기, 10ms)
+ */
+void AdasReplay_DefaultConfig(AdasReplayConfig_t *pConfig);
+
+/**
+ * @brief 재계산 출력과 레코드 출력 비트 단위 비교
+ * @return 불일치 항목 비트 (1 << AdasReplayField_e), 0 = 일치
+ */
+uint32_t AdasReplay_Compare(const AdasCycleRecord_t *pRec, const AdasFrameOutput_t *pOut);
+
+/**
+ * @brief 로그 전체 재생 + 비교 (구간별 스레드, 종료까지 대기)
+ * @param pLog : AdasCycleLog_OpenRead 로 연 로그
+ * @return 0 : 성공 (불일치 여부는 pResult), -1 : 인자 오류, -2 : 스레드 생성 실패
+ */
+int AdasReplay_Run(const AdasCycleLog_t     *pLog,
+                   const AdasReplayConfig_t *pConfig,
+                   AdasReplayResult_t       *pResult);
+
+/**
+ * @brief 결과 요약 출력 (처리량, 항목별 불일치)
+ */
+void AdasReplay_PrintResult(const AdasReplayResult_t *pResult);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_REPLAY_H */
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * adas_rng.h
+ *
+ * - 시뮬레이션 / 벤치마크 / 시험 입력 생성용 의사 난수 (제어 경로에서는 사용 안 함)
+ * - xoroshiro128++ (상태 128 bit, 주기 2^128 - 1), 시드 확장은 SplitMix64
+ *   : (seed, stream) 쌍마다 독립 수열 -> 프레임 / 스레드 / 실행별로 재현 가능
+ * - Philox4x32-10 (Salmon et al., SC'11): 카운터 기반 - 출력 = f(카운터, 키), 상태 없음
+ *   : 임의 위치 샘플을 독립 계산 (병렬 생성 / 구간 재현), 배치 함수는 SIMD (adas_rng.c)
+ * - 전부 inline (배치 제외), 전역 상태 없음 (상태는 호출자 소유 -> 스레드 안전)
+ ****************************************************************************/
+#ifndef ADAS_RNG_H
+#define ADAS_RNG_H
+
+#include <stdint.h>
+#include <math.h>
+#include "adas_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint64_t S[2];
+} AdasRng_t;
+
+/* Philox4x32 곱셈 / 키 증분 상수, 라운드 수 */
+#define ADAS_PHILOX_M0      0xD2511F53u
+#define ADAS_PHILOX_M1      0xCD9E8D57u
+#define ADAS_PHILOX_W0      0x9E3779B9u
+#define ADAS_PHILOX_W1      0xBB67AE85u
+#define ADAS_PHILOX_ROUNDS  10
+
+/**
+ * @brief SplitMix64 (시드 확장 / 정수 해시)
+ */
+static inline uint64_t AdasRng_SplitMix64(uint64_t *pState)
+{
+    uint64_t z = (*pState += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief 초기화: 같은 (seed, stream) -> 같은 수열, stream 이 다르면 사실상 독립
+ */
+static inline void AdasRng_Seed(AdasRng_t *pRng, uint64_t seed, uint64_t stream)
+{
+    uint64_t sm = seed ^ (stream * 0xD1B54A32D192ED03ull);
+    pRng->S[0] = AdasRng_SplitMix64(&sm);
+    pRng->S[1] = AdasRng_SplitMix64(&sm);
+    if((pRng->S[0] | pRng->S[1]) == 0u)
+        pRng->S[0] = 1u;   /* 전부 0 상태 금지 */
+}
+
+static inline uint64_t AdasRng_Rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief 다음 64 bit
+ */
+static inline uint64_t AdasRng_Next64(AdasRng_t *pRng)
+{
+    uint64_t s0 = pRng->S[0];
+    uint64_t s1 = pRng->S[1];
+    uint64_t r  = AdasRng_Rotl(s0 + s1, 17) + s0;
+
+    s1 ^= s0;
+    pRng->S[0] = AdasRng_Rotl(s0, 49) ^ s1 ^ (s1 << 21);
+    pRng->S[1] = AdasRng_Rotl(s1, 28);
+    return r;
+}
+
+/**
+ * @brief 균등 분포 [0, 1) (상위 24 bit)
+ */
+static inline float AdasRng_UniformF(AdasRng_t *pRng)
+{
+    return (float)(AdasRng_Next64(pRng) >> 40) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief 균등 분포 [lo, hi)
+ */
+static inline float AdasRng_RangeF(AdasRng_t *pRng, float lo, float hi)
+{
+    return lo + ((hi - lo) * AdasRng_UniformF(pRng));
+}
+
+/**
+ * @brief 확률 p 로 1 (p <= 0 -> 항상 0, p >= 1 -> 항상 1)
+ */
+static inline int AdasRng_Chance(AdasRng_t *pRng, float p)
+{
+    return AdasRng_UniformF(pRng) < p;
+}
+
+/**
+ * @brief 표준 정규 분포 2 개 (Box-Muller, 난수 64 bit 1 회)
+ *  - u1 은 (0, 1] -> log(0) 없음, |z| 최대 약 5.8
+ */
+static inline void AdasRng_Normal2F(AdasRng_t *pRng, float *pZ0, float *pZ1)
+{
+    uint64_t bits = AdasRng_Next64(pRng);
+    float u1 = (float)((bits >> 40) + 1u) * (1.0f / 16777216.0f);
+    float u2 = (float)((bits >> 16) & 0xFFFFFFu) * (1.0f / 16777216.0f);
+    float r  = sqrtf(-2.0f * logf(u1));
+    float s, c;
+
+    AdasMath_SinCosF((2.0f * ADAS_MATH_PI) * u2, &s, &c);
+    *pZ0 = r * c;
+    *pZ1 = r * s;
+}
+
+/**
+ * @brief 근사 정규 분포 (Irwin-Hall: 16 bit 균등 4 개 합, 난수 64 bit 1 회, 초월 함수 없음)
+ *  - 평균 0, 표준편차 1, 범위 ±sqrt(12) (꼬리 절단) -> 센서 잡음 등 대량 생성용
+ */
+static inline float AdasRng_NormalFastF(AdasRng_t *pRng)
+{
+    uint64_t bits = AdasRng_Next64(pRng);
+    uint32_t sum  = (uint32_t)(bits & 0xFFFFu) + (uint32_t)((bits >> 16) & 0xFFFFu) +
+                    (uint32_t)((bits >> 32) & 0xFFFFu) + (uint32_t)(bits >> 48);
+    /* (sum / 65536 - 2) * sqrt(3) */
+    return ((float)sum * (1.0f / 65536.0f) - 2.0f) * 1.7320508f;
+}
+
+/**
+ * @brief Philox4x32-10 블록 1 개: 카운터 128 bit + 키 64 bit -> 난수 128 bit
+ */
+static inline void AdasRng_Philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for(int r = 0; r < ADAS_PHILOX_ROUNDS; r++)
+    {
+        uint64_t p0 = (uint64_t)ADAS_PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t)ADAS_PHILOX_M1 * c2;
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        k0 += ADAS_PHILOX_W0;
+        k1 += ADAS_PHILOX_W1;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+/**
+ * @brief Philox4x32-10 배치 (SoA): i 번째 카운터 = { pCtr0[i], pCtr1[i], ctr2, ctr3 }
+ *  - 결과 i 번째 블록 = { pOut0[i], pOut1[i], pOut2[i], pOut3[i] } (스칼라와 비트 단위 동일)
+ */
+void AdasRng_Philox4x32_Batch(const uint32_t *pCtr0, const uint32_t *pCtr1, uint32_t ctr2, uint32_t ctr3,
+                              const uint32_t key[2], int count,
+                              uint32_t *pOut0, uint32_t *pOut1, uint32_t *pOut2, uint32_t *pOut3);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_RNG_H */
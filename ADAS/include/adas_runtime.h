@@ -0,0 +1,207 @@
+/****************************************************************************
+ * adas_runtime.h
+ *
+ * - 고정 주기 실시간 제어 루프 (executive)
+ *   : 절대 시각 기준 clock_nanosleep(TIMER_ABSTIME) -> 주기 누적 오차(drift) 없음
+ * - 주기마다 입력 콜백 -> 파이프라인 7단계 -> 출력 콜백
+ * - 단계별 실행 시간/예산 초과(overrun), 주기 마감 초과(deadline miss),
+ *   기상 지연(wake-up latency = jitter) 계측
+ * - 선택 사항: SCHED_FIFO 우선순위, CPU 고정(affinity), mlockall
+ * - 선택 사항: 태스크 그래프 워커 풀 (독립 단계 병렬 실행 -> 임계 경로 단축)
+ * - 선택 사항: 주기별 입력/출력 바이너리 기록 (cycle_log.h, mmap 직접 작성)
+ * - 선택 사항: 이상/모드 전환 이벤트 텔레메트리 (adas_telemetry.h, 링 기록만)
+ ****************************************************************************/
+#ifndef ADAS_RUNTIME_H
+#define ADAS_RUNTIME_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+#include "cycle_log.h"
+#include "adas_telemetry.h"
+#include "adas_metrics.h"
+#include "adas_perf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 런타임 설정
+ */
+typedef struct
+{
+    uint64_t Period_Ns;                          /* 제어 주기 [ns] (기본 10ms) */
+    uint64_t Cycle_Limit;                        /* 실행 주기 수 (0 = 정지 요청까지) */
+    uint64_t Stage_Budget_Ns[ADAS_STAGE_COUNT];  /* 단계별 시간 예산 [ns] (0 = 검사 안 함) */
+    int      Rt_Priority;                        /* SCHED_FIFO 우선순위 (1~99, 0 = 사용 안 함) */
+    int      Cpu_Id;                             /* 고정할 CPU 번호 (-1 = 고정 안 함) */
+    int      Lock_Memory;                        /* mlockall(현재+미래) (True=1, False=0) */
+    int      Worker_Count;                       /* 태스크 그래프 워커 수 (0 = 순차 실행) */
+    int      Worker_Cpu_Base;                    /* 워커 i 고정 CPU = Base + i (-1 = 고정 안 함) */
+} AdasRuntimeConfig_t;
+
+/**
+ * @brief 런타임 계측 결과
+ *  - Wake_Latency: 예정 시각(release) 대비 실제 기상 지연 = 주기 시작 jitter
+ *  - Deadline_Misses: 주기 처리가 다음 release 이후에 끝난 횟수
+ *  - Skipped_Periods: 마감 초과로 건너뛴 release 수 (밀린 주기를 몰아서 실행하지 않음)
+ *  - Stage_*: 태스크 그래프 모드에서는 각 태스크 자체 실행 시간 (동시 실행 포함)
+ *  - Stage_* / Pipeline_* 평균은 Pipeline_Runs 기준 (입력 없는 주기 제외), Wake_Latency 평균은 Cycles 기준
+ */
+typedef struct
+{
+    uint64_t Cycles;
+    uint64_t Input_Missing;                     /* 참조 입력 없음으로 건너뛴 주기 */
+    uint64_t Input_Torn;                        /* 처리 후 입력 재확인 실패로 출력을 버린 주기 */
+    uint64_t Pipeline_Runs;                     /* 파이프라인을 실행한 주기 (= Cycles - Input_Missing) */
+    uint64_t Deadline_Misses;
+    uint64_t Skipped_Periods;
+    uint64_t Stage_Overruns[ADAS_STAGE_COUNT];
+    uint64_t Stage_Max_Ns[ADAS_STAGE_COUNT];
+    uint64_t Stage_Total_Ns[ADAS_STAGE_COUNT];
+    uint64_t Pipeline_Max_Ns;                   /* 7단계 전체 (병렬 시 임계 경로) */
+    uint64_t Pipeline_Total_Ns;
+    uint64_t Cycle_Max_Ns;                      /* 입력~출력 콜백 포함 처리 시간 최대 */
+    uint64_t Wake_Latency_Max_Ns;
+    uint64_t Wake_Latency_Total_Ns;
+} AdasRuntimeStats_t;
+
+/* RT 설정 적용 결과 비트 (AdasRuntime_ApplyRtSettings 반환값) */
+#define ADAS_RT_FAIL_MLOCK     (1 << 0)
+#define ADAS_RT_FAIL_AFFINITY  (1 << 1)
+#define ADAS_RT_FAIL_SCHED     (1 << 2)
+
+/**
+ * @brief 입력 콜백: pIn 채우기 (Time.Current_Time 은 런타임이 논리 시각으로 미리 채움)
+ * @return 0 : 계속, < 0 : 루프 종료
+ */
+typedef int  (*AdasInputFn_t)(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn);
+
+/**
+ * @brief 참조 입력 콜백 (zero-copy, 예: 공유 메모리 프레임을 그 자리에서 사용)
+ *  - *ppIn : 이번 주기 입력 (다음 콜백 호출 전까지 유효), NULL 이면 이번 주기 파이프라인 건너뜀
+ *  - 입력 시각은 프레임의 Time.Current_Time 을 그대로 사용 (런타임 논리 시각 미적용)
+ * @return 0 : 계속, < 0 : 루프 종료
+ */
+typedef int  (*AdasInputRefFn_t)(void *pUser, uint64_t cycle, const AdasFrameInput_t **ppIn);
+
+/**
+ * @brief 참조 입력 재확인 콜백 (파이프라인 실행 후, 출력/기록 전에 호출)
+ *  - 처리하는 동안 입력이 덮어쓰였으면 0 -> 런타임은 이번 주기 출력/기록을 버리고
+ *    파이프라인 상태 / 출력을 주기 시작 전으로 되돌림 (Input_Torn 증가)
+ * @return 1 : 유효, 0 : 사용 중 덮어쓰임
+ */
+typedef int  (*AdasInputCheckFn_t)(void *pUser, uint64_t cycle, const AdasFrameInput_t *pIn);
+
+/**
+ * @brief 출력 콜백: 제어 결과 전달 (액추에이터/로그)
+ */
+typedef void (*AdasOutputFn_t)(void *pUser, uint64_t cycle, const AdasFrameOutput_t *pOut);
+
+/**
+ * @brief 런타임 인스턴스
+ */
+typedef struct
+{
+    AdasRuntimeConfig_t Config;
+    AdasRuntimeStats_t  Stats;
+    AdasPipeline_t      Pipeline;
+    AdasTaskGraph_t     Graph;           /* Worker_Count > 0 일 때 사용 */
+    AdasFrameInput_t    Input;
+    AdasFrameOutput_t   Output;
+    AdasInputFn_t       pfnInput;
+    AdasInputRefFn_t    pfnInputRef;     /* 설정 시 pfnInput 대신 사용 */
+    AdasInputCheckFn_t  pfnInputCheck;   /* NULL = 재확인 안 함 */
+    AdasPipeline_t      Pipeline_Saved;  /* 재확인 실패 시 되돌릴 주기 시작 상태 */
+    AdasFrameOutput_t   Output_Saved;
+    AdasOutputFn_t      pfnOutput;
+    void               *pUser;
+    AdasCycleLog_t     *pLog;            /* NULL = 기록 안 함 */
+    AdasTelemChannel_t *pTelem;          /* NULL = 이벤트 기록 안 함 */
+    AdasMetrics_t      *pMetrics;        /* NULL = 지연 히스토그램 기록 안 함 */
+    AdasPerf_t         *pPerf;           /* NULL = 성능 카운터 계측 안 함 */
+    volatile int        Stop_Requested;  /* 시그널 핸들러에서 설정 가능 */
+} AdasRuntime_t;
+
+/**
+ * @brief 기본 설정 (10ms 주기, 무한 실행, 예산 검사/RT 설정 없음)
+ */
+void AdasRuntime_DefaultConfig(AdasRuntimeConfig_t *pConfig);
+
+/**
+ * @brief 런타임 초기화 (파이프라인 초기화, Worker_Count > 0 이면 워커 풀 생성)
+ * @param pfnInput  : 입력 콜백 (NULL 이면 이전 입력 재사용)
+ * @param pfnOutput : 출력 콜백 (NULL 가능)
+ * @return 0 : 성공, -1 : 인자 오류 또는 워커 생성 실패
+ */
+int AdasRuntime_Init(AdasRuntime_t             *pRt,
+                     const AdasRuntimeConfig_t *pConfig,
+                     AdasInputFn_t              pfnInput,
+                     AdasOutputFn_t             pfnOutput,
+                     void                      *pUser);
+
+/**
+ * @brief 참조 입력 콜백 설정 (Init 이후, NULL = 복사 입력 콜백 사용)
+ * @param pfnInputCheck : 처리 후 입력 재확인 (NULL = 안 함, 설정 시 주기마다 상태 백업 복사)
+ */
+void AdasRuntime_SetInputRef(AdasRuntime_t *pRt, AdasInputRefFn_t pfnInputRef, AdasInputCheckFn_t pfnInputCheck);
+
+/**
+ * @brief 주기 기록기 연결 (Init 이후, NULL = 기록 안 함, 닫기는 호출자 몫)
+ */
+void AdasRuntime_SetLog(AdasRuntime_t *pRt, AdasCycleLog_t *pLog);
+
+/**
+ * @brief 텔레메트리 채널 연결 (Init 이후, 루프 스레드 전용 채널, NULL = 기록 안 함)
+ *  - 입력 없음 / 마감 초과 / 단계 예산 초과 / ACC·AEB·LFA 모드 전환을 이벤트로 기록
+ */
+void AdasRuntime_SetTelemetry(AdasRuntime_t *pRt, AdasTelemChannel_t *pCh);
+
+/**
+ * @brief 단계별 지연 히스토그램 연결 (Init 이후, NULL = 기록 안 함)
+ *  - 7단계 + 파이프라인 전체를 주기마다 기록, Target 내부 단계는 AdasPipeline_SetMetrics 로 함께 지정
+ *  - 기상 지연(WAKE) / release 기준 완료 시간(RESPONSE) 도 주기마다 기록 (입력 없는 주기 포함)
+ *  - 진단 스레드는 AdasMetrics_Snapshot 으로 실행 중에도 읽기 가능
+ */
+void AdasRuntime_SetMetrics(AdasRuntime_t *pRt, AdasMetrics_t *pMetrics);
+
+/**
+ * @brief 단계별 성능 카운터 연결 (Init 이후, NULL = 계측 안 함)
+ *  - pPerf 는 AdasRuntime_Run 을 호출할 스레드에서 AdasPerf_Open 한 것
+ *  - 순차 실행 전용 (태스크 그래프 모드는 단계가 워커 스레드에서 실행되어 무시)
+ */
+void AdasRuntime_SetPerf(AdasRuntime_t *pRt, AdasPerf_t *pPerf);
+
+/**
+ * @brief 워커 풀 종료 (Worker_Count = 0 이면 아무것도 안 함)
+ */
+void AdasRuntime_Destroy(AdasRuntime_t *pRt);
+
+/**
+ * @brief 호출 스레드에 RT 설정 적용 (mlockall -> CPU 고정 -> SCHED_FIFO)
+ *  - 권한 부족 등으로 실패한 항목은 비트로 반환, 나머지는 계속 적용
+ * @return 0 : 전부 적용 (또는 설정 없음), 그 외 : ADAS_RT_FAIL_* 비트 조합
+ */
+int AdasRuntime_ApplyRtSettings(const AdasRuntimeConfig_t *pConfig);
+
+/**
+ * @brief 고정 주기 루프 실행 (Cycle_Limit 도달 / 정지 요청 / 입력 콜백 종료까지)
+ * @return 0 : 정상 종료, -1 : 인자 오류
+ */
+int AdasRuntime_Run(AdasRuntime_t *pRt);
+
+/**
+ * @brief 루프 정지 요청 (async-signal-safe, 현재 주기 완료 후 종료)
+ */
+void AdasRuntime_RequestStop(AdasRuntime_t *pRt);
+
+/**
+ * @brief 계측 결과 요약 출력
+ */
+void AdasRuntime_PrintStats(const AdasRuntime_t *pRt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_RUNTIME_H */
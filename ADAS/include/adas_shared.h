@@ -73,6 +73,7 @@ typedef struct {
     float       Lane_Heading;        
     float       Lane_Width;          
     LaneChangeStatus_e Lane_Change_Status;
+    int         Lane_Curve_Direction;  /* 곡선 방향: 우=+1, 좌=-1, 미정=0 */
 } LaneData_t;
 
 typedef struct {
@@ -239,6 +240,7 @@ typedef enum {
 
 #define LFA_LOW_SPEED_THRESHOLD 16.67f
 #define LFA_MAX_STEERING_ANGLE  540.0f
+#define LFA_STANLEY_GAIN        1.0f    /* Stanley cross-track gain k */
 
 #ifdef __cplusplus
 }
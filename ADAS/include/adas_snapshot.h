@@ -0,0 +1,79 @@
+/****************************************************************************
+ * adas_snapshot.h
+ *
+ * - 파이프라인 전체 상태 스냅샷/복원 (체크포인트)
+ *   : 인스턴스 상태  - AdasPipeline_t (칼만 필터, ACC/LFA PID, 제어 주기)
+ *   : 전역 상태      - acc.c / lfa.c 기본 인스턴스(단일 인스턴스 API) PID 상태
+ * - POD 고정 크기 구조체 -> memcpy/파일 기록 가능
+ *   : Pipeline.pMetrics 는 캡처 시 NULL, 복원 시 대상 인스턴스 값 유지 (다른 포인터 없음)
+ * - 헤더 Magic/Version/Size 로 다른 빌드의 스냅샷 복원 거부
+ * - 게인 스케줄/Stanley LUT 는 설정(초기화 시 생성)이므로 제외
+ * - 캡처 비용 = 수백 바이트 복사 (매 주기 찍어도 무방)
+ ****************************************************************************/
+#ifndef ADAS_SNAPSHOT_H
+#define ADAS_SNAPSHOT_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_SNAPSHOT_MAGIC    0x50534441u   /* "ADSP" */
+#define ADAS_SNAPSHOT_VERSION  2u
+
+/* 반환 코드 */
+#define ADAS_SNAPSHOT_ERR_ARG      (-1)
+#define ADAS_SNAPSHOT_ERR_VERSION  (-2)   /* Magic/Version/Size 불일치 */
+
+/**
+ * @brief 파이프라인 상태 스냅샷
+ *  - Cycle: 이 상태 이후 처음 실행할 주기 번호 (= 캡처 시점까지 처리한 주기 수)
+ */
+typedef struct
+{
+    uint32_t            Magic;
+    uint32_t            Version;
+    uint32_t            Size;          /* sizeof(AdasSnapshot_t) */
+    uint32_t            Reserved;
+    uint64_t            Cycle;
+
+    AdasPipeline_t      Pipeline;
+
+    ACC_State_t         Acc_Default;   /* acc.c 기본 인스턴스 */
+    LFA_State_t         Lfa_Default;   /* lfa.c 기본 인스턴스 */
+} AdasSnapshot_t;
+
+/**
+ * @brief 현재 상태 캡처
+ * @param cycle : 다음에 실행할 주기 번호
+ * @return 0 : 성공, ADAS_SNAPSHOT_ERR_ARG : 인자 오류
+ */
+int AdasSnapshot_Capture(AdasSnapshot_t *pSnap, const AdasPipeline_t *pPipe, uint64_t cycle);
+
+/**
+ * @brief 스냅샷 검증 (Magic/Version/Size)
+ * @return 0 : 유효, ADAS_SNAPSHOT_ERR_ARG / ADAS_SNAPSHOT_ERR_VERSION
+ */
+int AdasSnapshot_Validate(const AdasSnapshot_t *pSnap);
+
+/**
+ * @brief 파이프라인 인스턴스 상태 복원 (검증 실패 시 아무것도 바꾸지 않음)
+ *  - 인스턴스별이므로 여러 스레드가 각자 파이프라인에 동시 복원 가능
+ *  - pPipe->pMetrics 는 유지 -> 대상은 AdasPipeline_Init 으로 초기화된 인스턴스
+ * @return 0 : 성공, ADAS_SNAPSHOT_ERR_ARG / ADAS_SNAPSHOT_ERR_VERSION
+ */
+int AdasSnapshot_Restore(const AdasSnapshot_t *pSnap, AdasPipeline_t *pPipe);
+
+/**
+ * @brief acc.c / lfa.c 기본 인스턴스 상태 복원 (전역, 단일 스레드에서만 호출)
+ * @return 0 : 성공, ADAS_SNAPSHOT_ERR_ARG / ADAS_SNAPSHOT_ERR_VERSION
+ */
+int AdasSnapshot_RestoreDefaults(const AdasSnapshot_t *pSnap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_SNAPSHOT_H */
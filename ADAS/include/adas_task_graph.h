@@ -0,0 +1,132 @@
+/****************************************************************************
+ * adas_task_graph.h
+ *
+ * - 정적 태스크 그래프(DAG) 실행기
+ *   : 태스크는 입력/출력 데이터 비트마스크를 한 번만 선언
+ *   : Build 시 선언 순서 기준으로 의존성 계산
+ *     (앞 태스크 출력 -> 뒤 태스크 입력 (RAW), 출력 충돌 (WAW), 읽은 뒤 쓰기 (WAR))
+ * - 고정 워커 풀 (Start 시 1회 생성) + 호출 스레드도 함께 실행
+ *   : 독립 체인은 워커로 분산, 모든 태스크 완료 시 Run 반환 (join)
+ *   : 주기당 동적 할당/스레드 생성 없음
+ * - 워커는 Spin_Limit 만큼 busy-poll 후 condvar 대기 (깨어나는 지연 감소)
+ ****************************************************************************/
+#ifndef ADAS_TASK_GRAPH_H
+#define ADAS_TASK_GRAPH_H
+
+#include <stdint.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_TASK_GRAPH_MAX_TASKS    16
+#define ADAS_TASK_GRAPH_MAX_WORKERS  8
+
+/* 실행 스레드 표시 (Task_Thread): 0 = Run 호출 스레드, 1~ = 워커 번호 + 1 */
+#define ADAS_TASK_GRAPH_CALLER       0
+
+/**
+ * @brief 태스크 함수 (pCtx : Run 에 전달한 주기별 컨텍스트, arg : 태스크별 고정 인자)
+ */
+typedef void (*AdasTaskFn_t)(void *pCtx, int arg);
+
+/**
+ * @brief 태스크 선언
+ */
+typedef struct
+{
+    const char   *Name;
+    AdasTaskFn_t  pfnRun;
+    int           Arg;
+    uint32_t      Inputs;    /* 읽는 데이터 비트 */
+    uint32_t      Outputs;   /* 쓰는 데이터 비트 */
+} AdasTaskDesc_t;
+
+struct AdasTaskGraph_s;
+
+/**
+ * @brief 워커 스레드 (그래프 내부에 보관, 스레드 인자로 사용)
+ */
+typedef struct
+{
+    struct AdasTaskGraph_s *pGraph;
+    int                     Id;       /* Task_Thread 표시값 (워커 번호 + 1) */
+    pthread_t               Thread;
+} AdasTaskWorker_t;
+
+/**
+ * @brief 태스크 그래프 + 실행기
+ *  - 정적 부분(Build) / 실행기(Start) / 주기별 상태(Run) 로 구분
+ */
+typedef struct AdasTaskGraph_s
+{
+    /* 정적 그래프 */
+    int            Task_Count;
+    AdasTaskDesc_t Tasks[ADAS_TASK_GRAPH_MAX_TASKS];
+    int            Pred_Count[ADAS_TASK_GRAPH_MAX_TASKS];
+    int            Succ_Count[ADAS_TASK_GRAPH_MAX_TASKS];
+    uint8_t        Succ[ADAS_TASK_GRAPH_MAX_TASKS][ADAS_TASK_GRAPH_MAX_TASKS];
+    uint32_t       Pred_Mask[ADAS_TASK_GRAPH_MAX_TASKS];   /* 직접 선행 태스크 비트 */
+
+    /* 실행기 */
+    int              Worker_Count;
+    AdasTaskWorker_t Workers[ADAS_TASK_GRAPH_MAX_WORKERS];
+    pthread_mutex_t  Lock;
+    pthread_cond_t   Work_Cv;
+    pthread_cond_t   Done_Cv;
+    uint32_t         Spin_Limit;
+    int              Started;
+    int              Shutdown;
+    int              Rt_Failed;   /* 워커 CPU 고정/SCHED_FIFO 실패 여부 (True=1) */
+
+    /* 주기별 상태 (Lock 보호) */
+    void            *pCtx;
+    int              Remaining[ADAS_TASK_GRAPH_MAX_TASKS];
+    uint8_t          Ready[ADAS_TASK_GRAPH_MAX_TASKS];
+    int              Ready_Head;
+    int              Ready_Count;
+    int              Done_Count;
+
+    /* 마지막 Run 계측 */
+    uint64_t         Task_Ns[ADAS_TASK_GRAPH_MAX_TASKS];
+    int              Task_Thread[ADAS_TASK_GRAPH_MAX_TASKS];
+} AdasTaskGraph_t;
+
+/**
+ * @brief 태스크 등록 + 의존성 계산 (Start 전 1회)
+ * @return 0 : 성공, -1 : 인자 오류 (개수 초과, 함수 NULL)
+ */
+int AdasTaskGraph_Build(AdasTaskGraph_t *pGraph, const AdasTaskDesc_t *pTasks, int taskCount);
+
+/**
+ * @brief 워커 풀 생성
+ * @param workerCount : 워커 수 (0 = 호출 스레드만 사용, 순차 실행)
+ * @param cpuBase     : 워커 i 를 CPU (cpuBase + i) 에 고정 (-1 = 고정 안 함, CPU_SETSIZE 이상인 워커는 고정 안 함)
+ * @param rtPriority  : 워커 SCHED_FIFO 우선순위 (0 = 사용 안 함, 실패 시 기본 정책으로 생성)
+ * @return 0 : 성공, -1 : 인자 오류 또는 스레드 생성 실패
+ */
+int AdasTaskGraph_Start(AdasTaskGraph_t *pGraph, int workerCount, int cpuBase, int rtPriority);
+
+/**
+ * @brief 한 주기 실행 (모든 태스크 완료 후 반환)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasTaskGraph_Run(AdasTaskGraph_t *pGraph, void *pCtx);
+
+/**
+ * @brief 워커 종료 + 자원 해제 (Start 하지 않았으면 아무것도 안 함)
+ */
+void AdasTaskGraph_Stop(AdasTaskGraph_t *pGraph);
+
+/**
+ * @brief task 가 pred 에 (직접 또는 간접) 의존하는지
+ * @return 1 : 의존, 0 : 독립 (동시 실행 가능)
+ */
+int AdasTaskGraph_DependsOn(const AdasTaskGraph_t *pGraph, int task, int pred);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_TASK_GRAPH_H */
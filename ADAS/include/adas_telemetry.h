@@ -0,0 +1,161 @@
+/****************************************************************************
+ * adas_telemetry.h
+ *
+ * - 제어 루프용 비동기 구조화 텔레메트리 (루프 안 printf 대체)
+ *   : 루프 스레드는 이벤트 ID + 원시 인자(64비트 x 최대 6개)만 링에 기록
+ *     -> 서식화/stdio 잠금/write 시스템 콜은 저우선순위 출력 스레드가 담당
+ *   : 이벤트 서식(printf 형식 문자열)은 ID 별로 미리 정의된 표 (adas_telemetry.c)
+ * - 생산자 스레드마다 채널 1개 = SPSC 링 (spsc_queue.h, 64B 레코드 = 캐시 라인 1개)
+ *   : 링이 가득 차면 대기하지 않고 레코드를 버림 (채널 Dropped 증가)
+ *   : 출력 스레드는 버린 수가 늘면 "dropped" 줄을 끼워 넣어 공백을 표시
+ * - 기록 비용: 시각 1회(vDSO) + 슬롯 작성 + release 저장 (잠금/시스템 콜 없음)
+ ****************************************************************************/
+#ifndef ADAS_TELEMETRY_H
+#define ADAS_TELEMETRY_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "spsc_queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_TELEM_MAX_ARGS       6
+#define ADAS_TELEM_MAX_CHANNELS   4
+#define ADAS_TELEM_RING_CAPACITY  1024   /* 채널별 레코드 수 (2의 거듭제곱) */
+#define ADAS_TELEM_NAME_LEN       16
+
+/**
+ * @brief 이벤트 ID (서식은 adas_telemetry.c 이벤트 표)
+ *  - 인자 형식은 서식의 변환 문자로 결정: d/i = 부호 있는 정수, u/x = 부호 없는 정수,
+ *    f/e/g = 실수 (AdasTelemetry_F 로 비트 변환해 전달)
+ */
+typedef enum
+{
+    ADAS_TELEM_EV_INPUT_MISSING = 0, /* cycle */
+    ADAS_TELEM_EV_DEADLINE_MISS,     /* cycle, busy[us], skipped */
+    ADAS_TELEM_EV_STAGE_OVERRUN,     /* cycle, stage, time[us], budget[us] */
+    ADAS_TELEM_EV_ACC_MODE,          /* cycle, from, to */
+    ADAS_TELEM_EV_AEB_MODE,          /* cycle, from, to, ttc[s] */
+    ADAS_TELEM_EV_LFA_MODE,          /* cycle, from, to */
+    ADAS_TELEM_EV_CONTROL,           /* cycle, throttle, brake, steer, accel, decel */
+    ADAS_TELEM_EV_INPUT_TORN,        /* cycle */
+    ADAS_TELEM_EV_COUNT
+} AdasTelemEvent_e;
+
+/**
+ * @brief 링 레코드 (64B)
+ */
+typedef struct
+{
+    uint64_t Stamp_Ns;                    /* 기록 시각 (CLOCK_MONOTONIC) */
+    uint16_t Event;                       /* AdasTelemEvent_e */
+    uint16_t Arg_Count;
+    uint32_t Reserved;
+    uint64_t Args[ADAS_TELEM_MAX_ARGS];
+} AdasTelemRecord_t;
+
+/**
+ * @brief 생산자 채널 (생산자 스레드 1개 전용)
+ */
+typedef struct
+{
+    SpscQueue_t       Ring;
+    AdasTelemRecord_t Storage[ADAS_TELEM_RING_CAPACITY] __attribute__((aligned(SPSC_QUEUE_CACHE_LINE)));
+    char              Name[ADAS_TELEM_NAME_LEN];
+    uint64_t          Reported_Drops;     /* 출력 스레드가 이미 표시한 버림 수 */
+} AdasTelemChannel_t;
+
+/**
+ * @brief 텔레메트리 인스턴스 (채널 + 출력 스레드)
+ */
+typedef struct
+{
+    AdasTelemChannel_t Channels[ADAS_TELEM_MAX_CHANNELS];
+    int                Channel_Count;
+    FILE              *pOut;
+    uint64_t           Poll_Ns;           /* 링이 모두 비었을 때 출력 스레드 휴면 [ns] */
+    uint64_t           Start_Ns;          /* 출력 시각 기준 */
+    uint64_t           Written;           /* 출력한 레코드 수 (출력 스레드) */
+    pthread_t          Thread;
+    int                Started;
+    volatile int       Stop_Requested;
+} AdasTelemetry_t;
+
+/**
+ * @brief 초기화 (채널 없음, 출력 스레드 미시작)
+ * @param pOut : 출력 스트림 (NULL 이면 stdout)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasTelemetry_Init(AdasTelemetry_t *pTelem, FILE *pOut);
+
+/**
+ * @brief 생산자 채널 추가 (Start 이전)
+ * @return 채널, NULL : 채널 수 초과 또는 인자 오류
+ */
+AdasTelemChannel_t *AdasTelemetry_AddChannel(AdasTelemetry_t *pTelem, const char *name);
+
+/**
+ * @brief 출력 스레드 시작 (SCHED_OTHER + nice 19, RT 우선순위 상속 안 함)
+ * @param cpu : 고정 CPU (-1 = 고정 안 함, 제어 루프와 다른 CPU 권장)
+ * @return 0 : 성공, -1 : 인자 오류 / 스레드 생성 실패
+ */
+int AdasTelemetry_Start(AdasTelemetry_t *pTelem, int cpu);
+
+/**
+ * @brief 출력 스레드 종료 (남은 레코드 모두 출력 + flush 후 join)
+ *  - 호출 전에 생산자는 기록을 멈춰야 함
+ */
+void AdasTelemetry_Stop(AdasTelemetry_t *pTelem);
+
+/**
+ * @brief (생산자) 이벤트 기록 - 잠금/시스템 콜/서식화 없음
+ * @param argCount : 0 ~ ADAS_TELEM_MAX_ARGS (초과분은 버림)
+ * @return 0 : 성공, -1 : 링 가득 참 (레코드 버림) 또는 인자 오류
+ */
+int AdasTelemetry_Emit(AdasTelemChannel_t *pCh, uint16_t event, uint32_t argCount, const uint64_t *pArgs);
+
+/**
+ * @brief (출력 스레드 미시작 시) 채널에 쌓인 레코드를 서식화해 출력 (소비자 역할)
+ * @return 출력한 레코드 수
+ */
+uint32_t AdasTelemetry_Drain(AdasTelemetry_t *pTelem);
+
+/**
+ * @brief 레코드 1개를 한 줄로 서식화 ("<시각> <채널> <이벤트> <인자...>")
+ * @return 작성한 문자 수 (끝 '\0' 제외, bufSize 보다 길면 잘림)
+ */
+int AdasTelemetry_Format(const AdasTelemetry_t *pTelem, const AdasTelemChannel_t *pCh,
+                         const AdasTelemRecord_t *pRec, char *pBuf, size_t bufSize);
+
+/**
+ * @brief 전 채널 버린 레코드 수 합계
+ */
+uint64_t AdasTelemetry_Dropped(const AdasTelemetry_t *pTelem);
+
+/**
+ * @brief 이벤트 이름 (범위 밖이면 "?")
+ */
+const char *AdasTelemetry_EventName(uint16_t event);
+
+/* 인자 변환: 실수는 비트 그대로 전달 (출력 스레드에서 복원) */
+static inline uint64_t AdasTelemetry_F(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline uint64_t AdasTelemetry_I(int64_t value)
+{
+    return (uint64_t)value;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_TELEMETRY_H */
@@ -0,0 +1,67 @@
+/****************************************************************************
+ * adas_time.h
+ *
+ * - 런타임/계측 공용 단조(monotonic) 시간 유틸 (ns 단위 정수)
+ * - CLOCK_MONOTONIC 기준: 벽시계 보정(NTP 등)에 영향받지 않음
+ * - POSIX clock_gettime 필요 (-D_GNU_SOURCE 또는 _POSIX_C_SOURCE >= 199309L)
+ ****************************************************************************/
+#ifndef ADAS_TIME_H
+#define ADAS_TIME_H
+
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_NS_PER_SEC  (1000000000ULL)
+#define ADAS_NS_PER_MS   (1000000ULL)
+#define ADAS_NS_PER_US   (1000ULL)
+
+/**
+ * @brief timespec -> ns
+ */
+static inline uint64_t AdasTime_ToNs(const struct timespec *pTs)
+{
+    return ((uint64_t)pTs->tv_sec * ADAS_NS_PER_SEC) + (uint64_t)pTs->tv_nsec;
+}
+
+/**
+ * @brief ns -> timespec
+ */
+static inline void AdasTime_FromNs(uint64_t ns, struct timespec *pTs)
+{
+    pTs->tv_sec  = (time_t)(ns / ADAS_NS_PER_SEC);
+    pTs->tv_nsec = (long)(ns % ADAS_NS_PER_SEC);
+}
+
+/**
+ * @brief 현재 단조 시각 [ns]
+ */
+static inline uint64_t AdasTime_NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return AdasTime_ToNs(&ts);
+}
+
+/**
+ * @brief 절대 단조 시각까지 대기 (시그널 인터럽트 시 재시도)
+ *  - 절대 시각이므로 재시도해도 누적 오차 없음
+ */
+static inline void AdasTime_SleepUntilNs(uint64_t releaseNs)
+{
+    struct timespec ts;
+    AdasTime_FromNs(releaseNs, &ts);
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_TIME_H */
@@ -0,0 +1,174 @@
+/****************************************************************************
+ * adas_trace.h
+ *
+ * - 단계별 주기 추적 (scoped trace point) -> Chrome trace JSON (Perfetto / chrome://tracing)
+ * - 컴파일 시 제거 가능: -DADAS_TRACE=1 로 빌드할 때만 추적 지점이 코드로 들어감
+ *   : 기본(ADAS_TRACE=0)은 ADAS_TRACE_BEGIN/END/THREAD 가 빈 문장 -> 비용 0
+ *   : API 함수(기록/내보내기)는 항상 링크 가능 (추적 없이 빌드하면 빈 trace)
+ * - 시각: x86 은 TSC(rdtsc), 그 외는 CLOCK_MONOTONIC
+ *   : TSC -> ns 환산은 내보내기 시점 보정값 사용 (invariant TSC 가정)
+ * - 스레드별 링 버퍼 (스레드 첫 기록 시 할당, 잠금 없음)
+ *   : 가득 차면 가장 오래된 이벤트부터 덮어씀 (최근 구간 비행 기록)
+ *   : 스레드 종료 시 링 반납 (pthread key 소멸자), 이벤트는 새 스레드가 재사용할 때까지 유지
+ *     -> 동시에 살아 있는 스레드 ADAS_TRACE_MAX_THREADS 개까지, 누적 스레드 수 제한 없음
+ *   : RT 스레드는 루프 전에 ADAS_TRACE_THREAD 로 미리 할당 권장
+ * - 내보내기는 추적 중인 스레드가 멈춘 뒤 호출 (기록과 동시 실행 비보장)
+ ****************************************************************************/
+#ifndef ADAS_TRACE_H
+#define ADAS_TRACE_H
+
+#include <stdint.h>
+#include "adas_time.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef ADAS_TRACE
+#define ADAS_TRACE 0
+#endif
+
+#define ADAS_TRACE_MAX_THREADS    16
+#define ADAS_TRACE_RING_CAPACITY  16384   /* 스레드별 이벤트 수 (2의 거듭제곱) */
+#define ADAS_TRACE_NAME_LEN       16
+
+/**
+ * @brief 추적 지점 ID (이름은 AdasTrace_Name)
+ */
+typedef enum
+{
+    ADAS_TRACE_CYCLE = 0,          /* 런타임 한 주기 (입력 ~ 기록) */
+    ADAS_TRACE_INPUT,              /* 입력 콜백 */
+    ADAS_TRACE_EGO,                /* EgoVehicleEstimation */
+    ADAS_TRACE_LANE,               /* LaneSelection_Update */
+    ADAS_TRACE_TARGET_FILTER,      /* select_target_from_object_list */
+    ADAS_TRACE_TARGET_PREDICT,     /* predict_object_future_path */
+    ADAS_TRACE_TARGET_SELECT,      /* select_targets_for_acc_aeb */
+    ADAS_TRACE_ACC,
+    ADAS_TRACE_AEB,
+    ADAS_TRACE_LFA,
+    ADAS_TRACE_ARBITRATION,
+    ADAS_TRACE_OUTPUT,             /* 출력 콜백 + 주기 기록 */
+    ADAS_TRACE_ID_COUNT
+} AdasTraceId_e;
+
+/**
+ * @brief 완료 이벤트 (16B)
+ */
+typedef struct
+{
+    uint64_t Start_Tick;
+    uint32_t Duration_Tick;        /* 2^32 tick 초과 시 포화 */
+    uint16_t Id;                   /* AdasTraceId_e */
+    uint16_t Reserved;
+} AdasTraceEvent_t;
+
+/**
+ * @brief 스레드별 링 (Head = 누적 기록 수, 슬롯 = Head & (용량 - 1))
+ */
+typedef struct
+{
+    AdasTraceEvent_t *pEvents;
+    uint64_t          Head;
+    uint64_t          Flushed_Head;    /* 마지막 내보내기 시점 Head */
+    char              Name[ADAS_TRACE_NAME_LEN];
+    int               Tid;             /* 내보내기용 스레드 번호 (1부터, 재사용 시 새 번호) */
+    int               State;           /* 소유 상태 (adas_trace.c, __atomic) */
+} AdasTraceRing_t;
+
+/* 호출 스레드 링 (첫 기록/ThreadInit 전에는 NULL) */
+extern __thread AdasTraceRing_t *g_pAdasTraceRing;
+
+/**
+ * @brief 현재 tick (TSC 또는 ns)
+ */
+static inline uint64_t AdasTrace_Tick(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return AdasTime_NowNs();
+#endif
+}
+
+/**
+ * @brief 호출 스레드 링 할당 후 기록 (AdasTrace_Record 의 첫 호출 경로)
+ */
+void AdasTrace_RecordSlow(uint16_t id, uint64_t startTick, uint64_t endTick);
+
+/**
+ * @brief 호출 스레드 링에 완료 이벤트 1개 기록 (첫 호출 시 링 할당)
+ *  - 링 할당 실패/스레드 수 초과 시 버림
+ *  - 빠른 경로는 인라인: 슬롯 작성 + Head 증가 (함수 호출/원자 연산 없음)
+ */
+static inline void AdasTrace_Record(uint16_t id, uint64_t startTick, uint64_t endTick)
+{
+    AdasTraceRing_t *pRing = g_pAdasTraceRing;
+    if(__builtin_expect((pRing == NULL) || (pRing->pEvents == NULL), 0))
+    {
+        AdasTrace_RecordSlow(id, startTick, endTick);
+        return;
+    }
+
+    uint64_t dur = (endTick > startTick) ? (endTick - startTick) : 0;
+    AdasTraceEvent_t *pEv = &pRing->pEvents[pRing->Head & (ADAS_TRACE_RING_CAPACITY - 1)];
+    pEv->Start_Tick    = startTick;
+    pEv->Duration_Tick = (dur > UINT32_MAX) ? UINT32_MAX : (uint32_t)dur;
+    pEv->Id            = id;
+    pRing->Head++;
+}
+
+/**
+ * @brief 호출 스레드 링 할당 + 이름 지정 (내보내기 시 스레드 이름)
+ * @return 0 : 성공, -1 : 동시 스레드 수 초과 / 할당 실패
+ */
+int AdasTrace_ThreadInit(const char *name);
+
+/**
+ * @brief tick -> ns 환산 계수 보정 (약 10ms, 내보내기 시 미보정이면 자동 호출)
+ * @return ns / tick
+ */
+double AdasTrace_Calibrate(void);
+
+/**
+ * @brief 모든 링 비우기 (할당/이름은 유지, 추적 스레드가 멈춘 상태에서 호출)
+ */
+void AdasTrace_Reset(void);
+
+/**
+ * @brief 링에 남아 있는 이벤트 수 합계 / 덮어써서 잃은 이벤트 수 합계
+ *  - 잃은 수에는 내보내기 전에 종료 스레드 링이 재사용되어 버려진 이벤트 포함
+ */
+uint64_t AdasTrace_EventCount(void);
+uint64_t AdasTrace_Overwritten(void);
+
+/**
+ * @brief 추적 지점 이름 (범위 밖이면 "?")
+ */
+const char *AdasTrace_Name(uint16_t id);
+
+/**
+ * @brief Chrome trace JSON 내보내기 (완료 이벤트 "ph":"X" + 스레드 이름 메타데이터)
+ *  - ts/dur 은 us 단위 (가장 이른 이벤트 = 0)
+ * @return 기록한 이벤트 수, -1 : 파일 열기/쓰기 실패
+ */
+long AdasTrace_ExportChrome(const char *path);
+
+/* ----------------------------------------------------------------------------
+ * 추적 지점 매크로 (같은 블록 안에서 BEGIN(id) ... END(id) 짝)
+ * ---------------------------------------------------------------------------*/
+#if ADAS_TRACE
+#define ADAS_TRACE_BEGIN(id)      const uint64_t adas_trace_t0_##id = AdasTrace_Tick()
+#define ADAS_TRACE_END(id)        AdasTrace_Record((uint16_t)(id), adas_trace_t0_##id, AdasTrace_Tick())
+#define ADAS_TRACE_THREAD(name)   (void)AdasTrace_ThreadInit(name)
+#else
+#define ADAS_TRACE_BEGIN(id)      ((void)0)
+#define ADAS_TRACE_END(id)        ((void)0)
+#define ADAS_TRACE_THREAD(name)   ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADAS_TRACE_H */
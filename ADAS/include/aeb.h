@@ -1,20 +1,12 @@
 #ifndef AEB_H
 #define AEB_H
 
+#include "adas_shared.h"  /* AEB_Mode_e (Normal, Alert, Brake), AEB 상수 */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/**
- * @brief AEB 모드 (Normal, Alert, Brake)
- */
-typedef enum
-{
-    AEB_MODE_NORMAL = 0,
-    AEB_MODE_ALERT,
-    AEB_MODE_BRAKE
-} AEB_Mode_e;
-
 /**
  * @brief AEB 타겟 상황 (Normal, Cut-in, Cut-out)
  */
@@ -45,7 +37,7 @@ typedef struct
 {
     float Ego_Velocity_X;   /* (0, 100) [m/s] */
     /* 필요시 Ego_Acceleration_X 등 추가 가능 */
-} Ego_Data_t;
+} AEB_Ego_Data_t;
 
 /**
  * @brief TTC Data 구조체
@@ -59,11 +51,12 @@ typedef struct
     float Relative_Speed; /* (-100, 100) [m/s] */
 } TTC_Data_t;
 
-/* 최대 감속 성능, 경고 시 여유시간 등 상수 정의 */
-#define AEB_MAX_BRAKE_DECEL         (-10.0f)  /* 실제 제동시 최대 감속도 [m/s^2] */
-#define AEB_MIN_BRAKE_DECEL         (-2.0f)   /* 최소 감속도 (약하게 브레이크) [m/s^2] */
-#define AEB_DEFAULT_MAX_DECEL       (9.0f)    /* TTC_Brake 계산용(양수) */
-#define AEB_ALERT_BUFFER_TIME       (1.2f)    /* 경고 여유시간 */
+/* 최대 감속 성능, 경고 시 여유시간 등 상수는 adas_shared.h 정의 사용
+ *  - AEB_MAX_BRAKE_DECEL   : 실제 제동시 최대 감속도 [m/s^2]
+ *  - AEB_MIN_BRAKE_DECEL   : 최소 감속도 (약하게 브레이크) [m/s^2]
+ *  - AEB_DEFAULT_MAX_DECEL : TTC_Brake 계산용(양수)
+ *  - AEB_ALERT_BUFFER_TIME : 경고 여유시간
+ */
 
 /**
  * @brief 2.2.3.1.1 calculate_ttc_for_aeb
@@ -73,7 +66,7 @@ typedef struct
  * @param pTtcData        (출력) TTC, TTC_Brake, TTC_Alert, Relative_Speed
  */
 void calculate_ttc_for_aeb(const AEB_Target_Data_t *pAebTargetData,
-                           const Ego_Data_t        *pEgoData,
+                           const AEB_Ego_Data_t    *pEgoData,
                            TTC_Data_t              *pTtcData);
 
 /**
@@ -85,7 +78,7 @@ void calculate_ttc_for_aeb(const AEB_Target_Data_t *pAebTargetData,
  * @return AEB_Mode_e    (출력)  현재 AEB 모드 (Normal, Alert, Brake)
  */
 AEB_Mode_e aeb_mode_selection(const AEB_Target_Data_t *pAebTargetData,
-                              const Ego_Data_t        *pEgoData,
+                              const AEB_Ego_Data_t    *pEgoData,
                               const TTC_Data_t        *pTtcData);
 
 /**
@@ -0,0 +1,169 @@
+/****************************************************************************
+ * cycle_log.h
+ *
+ * - 주기별 입력/단계 출력 바이너리 기록기 (고정 길이 레코드, 추가 전용)
+ * - 파일 구조 (버전 관리): [AdasCycleLogHeader_t][AdasCycleRecord_t x N][AdasSnapshot_t x M]
+ *   : 헤더의 Magic/Version/크기 필드로 기록/재생 측 레이아웃 불일치 검출
+ *   : 스냅샷은 별도 구역 (레코드 크기에 포함하지 않음, M = N / Snapshot_Interval)
+ * - 기록 경로는 I/O 시스템 콜 / page fault 없음
+ *   : 생성 시 용량만큼 디스크 공간 예약(posix_fallocate) 후 mmap(MAP_SHARED | MAP_POPULATE)
+ *     + 전 페이지 쓰기 접근(pre-touch) -> 첫 기록 시 쓰기 fault 제거
+ *   : 주기마다 매핑된 레코드 슬롯에 직접 작성 -> 디스크 반영은 커널 writeback
+ *   : 용량 초과 시 기록하지 않고 Dropped 증가 (재매핑/확장 없음)
+ * - 헤더 Record_Count / Snapshot_Count 는 작성 후 release 로 갱신
+ *   -> 비정상 종료 시에도 Record_Count 까지는 완전한 레코드
+ * - Snapshot_Interval 레코드마다 모듈 상태 스냅샷(adas_snapshot.h) 기록
+ *   : 스냅샷 k = 레코드 (k + 1) * Snapshot_Interval - 1 처리 후 상태 (AdasCycleLog_GetSnapshot)
+ *   -> 재생 시 해당 레코드 다음부터 워밍업 없이 바로 시작 (구간 병렬 재생)
+ * - 닫을 때 스냅샷 구역을 마지막 레코드 뒤로 당기고 파일 크기를 줄임
+ * - 같은 호스트/빌드 간 재생 전용 (엔디안/구조체 패딩 변환 없음)
+ ****************************************************************************/
+#ifndef CYCLE_LOG_H
+#define CYCLE_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "adas_pipeline.h"
+#include "adas_snapshot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_CYCLE_LOG_MAGIC     0x474C4441u   /* "ADLG" */
+#define ADAS_CYCLE_LOG_VERSION   3u   /* 2: 레코드 스냅샷 추가, 3: 스냅샷 별도 구역 */
+
+/* 반환 코드 */
+#define ADAS_CYCLE_LOG_ERR_ARG     (-1)   /* 인자 오류 / 시스템 콜 실패 */
+#define ADAS_CYCLE_LOG_ERR_LAYOUT  (-2)   /* Magic/Version/크기 불일치 */
+#define ADAS_CYCLE_LOG_ERR_FULL    (-3)   /* 용량 초과 (레코드 버림) */
+
+/**
+ * @brief 파일 헤더
+ */
+typedef struct
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Header_Size;    /* sizeof(AdasCycleLogHeader_t) */
+    uint32_t Record_Size;    /* sizeof(AdasCycleRecord_t) */
+    uint32_t Input_Size;     /* sizeof(AdasFrameInput_t) */
+    uint32_t Max_Objects;
+    uint64_t Capacity;       /* 예약 레코드 수 */
+    uint64_t Record_Count;   /* 완료된 레코드 수 (__atomic) */
+    uint64_t Dropped;        /* 용량 초과로 버린 레코드 수 */
+    uint64_t Start_Ns;       /* 생성 시각 (CLOCK_MONOTONIC) */
+    uint32_t Snapshot_Interval;   /* 스냅샷 간격 [레코드] (0 = 없음) */
+    uint32_t Snapshot_Size;       /* sizeof(AdasSnapshot_t) */
+    uint64_t Snapshot_Offset;     /* 스냅샷 구역 시작 [B] (= 레코드 구역 끝) */
+    uint64_t Snapshot_Capacity;   /* 예약 스냅샷 수 */
+    uint64_t Snapshot_Count;      /* 완료된 스냅샷 수 (__atomic) */
+} AdasCycleLogHeader_t;
+
+/**
+ * @brief 한 주기 레코드 (입력 전체 + 단계별 출력)
+ *  - 열거형은 int32_t 로 저장
+ *  - Filtered/Predicted 객체 배열은 제외 (입력 + 선정 타깃으로 재계산 가능)
+ */
+typedef struct
+{
+    uint64_t           Cycle;
+    uint64_t           Stamp_Ns;       /* 기록 시각 (CLOCK_MONOTONIC) */
+
+    AdasFrameInput_t   Input;
+
+    EgoData_t          Ego;
+    LaneSelectOutput_t Lane_Select;
+    ACC_Target_t       Acc_Target;
+    AEB_Target_t       Aeb_Target;
+    TTC_Data_t         Ttc;
+
+    int32_t            Acc_Mode;       /* ACC_Mode_e */
+    int32_t            Aeb_Mode;       /* AEB_Mode_e */
+    int32_t            Lfa_Mode;       /* LFA_Mode_e */
+    float              Accel_Acc;      /* [m/s^2] */
+    float              Decel_Aeb;      /* [m/s^2] */
+    float              Steer_Lfa;      /* [°] */
+
+    VehicleControl_t   Control;
+
+    /* 이 레코드 처리 후 상태가 스냅샷 구역에 있음 (AdasCycleLog_GetSnapshot) */
+    int32_t            Has_Snapshot;   /* (True=1, False=0) */
+    int32_t            Reserved;
+} AdasCycleRecord_t;
+
+/**
+ * @brief 기록기/읽기 핸들
+ */
+typedef struct
+{
+    int                   Fd;
+    unsigned char        *pBase;
+    size_t                Map_Size;
+    AdasCycleLogHeader_t *pHeader;
+    AdasCycleRecord_t    *pRecords;
+    AdasSnapshot_t       *pSnapshots;
+    uint64_t              Capacity;
+    uint64_t              Count;       /* 기록기: 작성한 수, 읽기: 유효 레코드 수 */
+    uint64_t              Snapshot_Capacity;
+    uint64_t              Snapshot_Count;
+    int                   Is_Writer;
+} AdasCycleLog_t;
+
+/**
+ * @brief 기록 파일 생성 (기존 파일은 덮어씀) + 용량만큼 공간 예약/매핑 + 전 페이지 pre-touch
+ * @param capacity         : 최대 레코드 수 (> 0)
+ * @param snapshotInterval : 스냅샷 간격 [레코드] (0 = 스냅샷 없음)
+ * @return 0 : 성공, ADAS_CYCLE_LOG_ERR_ARG : 인자 오류/시스템 콜 실패
+ */
+int AdasCycleLog_Create(AdasCycleLog_t *pLog, const char *path, uint64_t capacity,
+                        uint32_t snapshotInterval);
+
+/**
+ * @brief (제어 루프) 한 주기 기록 - 매핑 영역에 직접 작성, 블로킹 없음
+ * @param pPipe : 이번 주기 처리 후 파이프라인 (스냅샷 간격마다 캡처, NULL = 스냅샷 안 함)
+ * @return 0 : 성공, ADAS_CYCLE_LOG_ERR_FULL : 용량 초과, ADAS_CYCLE_LOG_ERR_ARG : 인자 오류
+ */
+int AdasCycleLog_Append(AdasCycleLog_t          *pLog,
+                        uint64_t                 cycle,
+                        const AdasFrameInput_t  *pIn,
+                        const AdasFrameOutput_t *pOut,
+                        const AdasPipeline_t    *pPipe);
+
+/**
+ * @brief (기록기, 비실시간 스레드) 작성된 페이지 디스크 반영 요청 (msync MS_ASYNC)
+ * @return 0 : 성공, ADAS_CYCLE_LOG_ERR_ARG : 실패
+ */
+int AdasCycleLog_Flush(AdasCycleLog_t *pLog);
+
+/**
+ * @brief 기록 파일 열기 (읽기 전용 매핑) + 레이아웃 검증
+ * @return 0 : 성공, ADAS_CYCLE_LOG_ERR_ARG : 없음/실패, ADAS_CYCLE_LOG_ERR_LAYOUT : 버전/크기 불일치
+ */
+int AdasCycleLog_OpenRead(AdasCycleLog_t *pLog, const char *path);
+
+/**
+ * @brief 레코드 수 (기록기: 작성 수, 읽기: 유효 레코드 수)
+ */
+uint64_t AdasCycleLog_Count(const AdasCycleLog_t *pLog);
+
+/**
+ * @brief idx 번째 레코드 (복사 없이 매핑 영역 포인터, 범위 밖이면 NULL)
+ */
+const AdasCycleRecord_t *AdasCycleLog_Get(const AdasCycleLog_t *pLog, uint64_t idx);
+
+/**
+ * @brief idx 번째 레코드 처리 후 상태 스냅샷 (Snapshot.Cycle = idx + 1, 없으면 NULL)
+ */
+const AdasSnapshot_t *AdasCycleLog_GetSnapshot(const AdasCycleLog_t *pLog, uint64_t idx);
+
+/**
+ * @brief 닫기 (기록기는 스냅샷 구역을 레코드 뒤로 당기고, 예약 공간을 실제 기록 크기로 줄인 뒤 디스크 반영)
+ */
+void AdasCycleLog_Close(AdasCycleLog_t *pLog);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLE_LOG_H */
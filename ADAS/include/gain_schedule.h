@@ -0,0 +1,103 @@
+/****************************************************************************
+ * gain_schedule.h
+ *
+ * - ACC(거리/속도 PID), LFA(저속 PID) 게인 스케줄링
+ * - Ego 속도(및 LFA는 곡률) 기준 균일 격자 테이블 + 쌍선형 보간
+ * - 기본 테이블은 컴파일 타임 상수, 캘리브레이션 blob으로 시동 시 교체 가능
+ ****************************************************************************/
+#ifndef GAIN_SCHEDULE_H
+#define GAIN_SCHEDULE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "interp_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 스케줄 대상 제어기
+ */
+typedef enum
+{
+    GAIN_SCHED_ACC_DISTANCE = 0,  /* X: Ego 속도 [m/s] */
+    GAIN_SCHED_ACC_SPEED,         /* X: Ego 속도 [m/s] */
+    GAIN_SCHED_LFA_LOW_SPEED,     /* X: Ego 속도 [m/s], Y: 곡률 [1/m] */
+    GAIN_SCHED_COUNT
+} GainScheduleId_e;
+
+/**
+ * @brief PID 게인 (테이블 채널 순서와 동일: Kp, Ki, Kd)
+ */
+typedef struct
+{
+    float Kp;
+    float Ki;
+    float Kd;
+} PID_Gains_t;
+
+/*=== 캘리브레이션 blob 형식 (little-endian) ===
+ *  [GainScheduleBlobHeader_t]
+ *  Table_Count x { [GainScheduleBlobTable_t] [X_Count*Y_Count*3 float] }
+ */
+#define GAIN_SCHEDULE_BLOB_MAGIC    0x48435347u  /* "GSCH" */
+#define GAIN_SCHEDULE_BLOB_VERSION  1u
+#define GAIN_SCHEDULE_MAX_POINTS    256          /* blob 테이블당 최대 격자점 수 */
+
+typedef struct
+{
+    uint32_t Magic;
+    uint16_t Version;
+    uint16_t Table_Count;
+} GainScheduleBlobHeader_t;
+
+typedef struct
+{
+    uint16_t Id;        /* GainScheduleId_e */
+    uint16_t X_Count;
+    uint16_t Y_Count;
+    uint16_t Reserved;
+    float    X_Min;
+    float    X_Step;
+    float    Y_Min;
+    float    Y_Step;
+} GainScheduleBlobTable_t;
+
+/**
+ * @brief 현재 운전 조건에서의 PID 게인 조회
+ * @param id        : 대상 제어기
+ * @param egoSpeed  : Ego 종방향 속도 [m/s]
+ * @param curvature : 차선 곡률 [1/m] (1D 스케줄은 무시)
+ * @param pOut      : (출력) 보간된 게인
+ */
+void GainSchedule_GetPidGains(GainScheduleId_e id,
+                              float egoSpeed,
+                              float curvature,
+                              PID_Gains_t *pOut);
+
+/**
+ * @brief 스케줄 테이블 교체 (시동 시 1회, 제어 루프 동작 중 호출 금지)
+ *        격자 데이터(pTable->pData)는 내부 저장소로 복사되므로 호출 후 해제해도 됨
+ * @return 0 on success, negative on error (채널 수 != 3, 격자점 > GAIN_SCHEDULE_MAX_POINTS,
+ *         격자 오류, NaN/Inf 값 등)
+ */
+int GainSchedule_Install(GainScheduleId_e id, const InterpTable2D_t *pTable);
+
+/**
+ * @brief 캘리브레이션 blob을 파싱하여 포함된 테이블을 설치
+ *        blob 내용은 내부 저장소로 복사되므로 호출 후 해제해도 됨
+ * @return 설치된 테이블 수, 형식 오류 / NaN·Inf 값 시 negative (이 경우 기존 테이블 유지)
+ */
+int GainSchedule_LoadBlob(const void *pBlob, size_t blobSize);
+
+/**
+ * @brief 모든 스케줄을 컴파일 타임 기본 테이블로 복원
+ */
+void GainSchedule_ResetDefaults(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GAIN_SCHEDULE_H */
@@ -0,0 +1,85 @@
+/****************************************************************************
+ * interp_table.h
+ *
+ * - 균일 격자 1D/2D 룩업 테이블 + 분기 없는(branch-free) 쌍선형 보간
+ * - 게인 스케줄링(gain_schedule), Stanley LUT 등에서 공통 사용
+ * - 축 범위 밖 입력(NaN 포함)은 가장자리 값으로 포화(clamp)
+ ****************************************************************************/
+#ifndef INTERP_TABLE_H
+#define INTERP_TABLE_H
+
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 균일 격자 보간 테이블
+ *  - 데이터 배치: pData[y][x][ch] (row-major, 채널 인터리브)
+ *  - Y_Count == 1 이면 1D 테이블 (y 입력 무시)
+ *  - 나눗셈 제거를 위해 격자 간격은 역수(Inv_Step)로 보관
+ */
+typedef struct
+{
+    float        X_Min;       /* X축 첫 격자 값 */
+    float        X_Inv_Step;  /* 1 / X축 격자 간격 */
+    int          X_Count;     /* X축 격자 수 (>= 1) */
+    float        Y_Min;       /* Y축 첫 격자 값 */
+    float        Y_Inv_Step;  /* 1 / Y축 격자 간격 */
+    int          Y_Count;     /* Y축 격자 수 (>= 1) */
+    int          Channels;    /* 격자점당 값 개수 (>= 1) */
+    const float *pData;       /* X_Count * Y_Count * Channels 개 */
+} InterpTable2D_t;
+
+/* 축 좌표 -> (하위 인덱스, 상위 인덱스, 보간 비율), 비교 결과를 정수로 써서 분기 제거 */
+static inline void InterpTable_Axis(float v, float vMin, float invStep, int count,
+                                    int *pI0, int *pI1, float *pT)
+{
+    float f = (v - vMin) * invStep;
+    f = fminf(fmaxf(f, 0.0f), (float)(count - 1));   /* NaN -> 0 */
+    int i0 = (int)f;
+    *pI0 = i0;
+    *pI1 = i0 + (i0 < (count - 1));
+    *pT  = f - (float)i0;
+}
+
+/**
+ * @brief 쌍선형 보간 (모든 채널)
+ * @param pTbl : 보간 테이블
+ * @param x, y : 조회 좌표 (1D 테이블은 y 무시)
+ * @param pOut : (출력) Channels 개의 보간 값
+ */
+static inline void InterpTable2D_EvalN(const InterpTable2D_t *pTbl, float x, float y, float *pOut)
+{
+    int   ix0, ix1, iy0, iy1;
+    float tx, ty;
+    InterpTable_Axis(x, pTbl->X_Min, pTbl->X_Inv_Step, pTbl->X_Count, &ix0, &ix1, &tx);
+    InterpTable_Axis(y, pTbl->Y_Min, pTbl->Y_Inv_Step, pTbl->Y_Count, &iy0, &iy1, &ty);
+
+    const int    ch   = pTbl->Channels;
+    const float *r0   = pTbl->pData + (iy0 * pTbl->X_Count) * ch;
+    const float *r1   = pTbl->pData + (iy1 * pTbl->X_Count) * ch;
+    for(int c = 0; c < ch; c++)
+    {
+        float a = r0[ix0 * ch + c] + tx * (r0[ix1 * ch + c] - r0[ix0 * ch + c]);
+        float b = r1[ix0 * ch + c] + tx * (r1[ix1 * ch + c] - r1[ix0 * ch + c]);
+        pOut[c] = a + ty * (b - a);
+    }
+}
+
+/**
+ * @brief 쌍선형 보간 (단일 채널 테이블 전용)
+ */
+static inline float InterpTable2D_Eval(const InterpTable2D_t *pTbl, float x, float y)
+{
+    float out;
+    InterpTable2D_EvalN(pTbl, x, y, &out);
+    return out;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERP_TABLE_H */
@@ -1,19 +1,12 @@
 #ifndef LFA_H
 #define LFA_H
 
+#include "adas_shared.h"  /* LFA_Mode_e (저속/고속), LFA_MAX_STEERING_ANGLE */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/**
- * @brief LFA 모드 (저속/고속)
- */
-typedef enum
-{
-    LFA_MODE_LOW_SPEED = 0,
-    LFA_MODE_HIGH_SPEED
-} LFA_Mode_e;
-
 /**
  * @brief Lane Data(LS)
  *  - LS_Heading_Error: 진행 방향과 차선 방향 차이 (°)
@@ -21,6 +14,9 @@ typedef enum
  *  - LS_Is_Changing_Lane: 차선 변경 여부
  *  - LS_Is_Within_Lane: 차선 내 여부
  *  - LS_Is_Curved_Lane: 곡선 차선 여부
+ *  - LS_Lane_Curvature: 곡률 반경 (0 = 직선/미정), 게인 스케줄 입력
+ *  - LS_Next_Lane_Curvature: 다음 구간 곡률 반경 (0 = 직선/미정), Pure Pursuit 경로 preview
+ *  - LS_Curve_Direction: 곡선 방향 (미정이면 preview는 look-ahead 단축에만 사용)
  */
 typedef struct
 {
@@ -29,6 +25,9 @@ typedef struct
     int   LS_Is_Changing_Lane; /* (True=1, False=0) */
     int   LS_Is_Within_Lane;   /* (True=1, False=0) */
     int   LS_Is_Curved_Lane;   /* (True=1, False=0) */
+    float LS_Lane_Curvature;   /* (0 ~ ∞) [m] */
+    float LS_Next_Lane_Curvature; /* (0 ~ ∞) [m] */
+    int   LS_Curve_Direction;  /* (우=+1, 좌=-1, 미정=0) */
 } Lane_Data_LS_t;
 
 /**
@@ -42,22 +41,54 @@ typedef struct
     float Ego_Velocity_X;      /* (0, 100) [m/s] */
     float Ego_Yaw_Rate;        /* (-180, 180) [°/s] */
     float Ego_Steering_Angle;  /* (-540, 540) [°] */
-} Ego_Data_t;
+} LFA_Ego_Data_t;
+
+/**
+ * @brief 고속 모드 조향 법칙
+ */
+typedef enum
+{
+    LFA_HS_LAW_STANLEY = 0,     /* 기본값 */
+    LFA_HS_LAW_PURE_PURSUIT
+} LFA_High_Speed_Law_e;
+
+/* Pure Pursuit 파라미터 */
+#define LFA_PP_WHEELBASE         (2.9f)   /* [m] */
+#define LFA_PP_PREVIEW_HORIZON   (60.0f)  /* [m] Next_Lane_Curvature 가 완전히 반영되는 거리 */
+#define LFA_PP_MIN_LOOKAHEAD     (3.0f)   /* [m] */
+#define LFA_PP_MAX_CURVE_OFFSET  (1.75f)  /* [m] look-ahead 점에서 허용하는 곡선 횡편차 (반차로) */
+
+/**
+ * @brief LFA 내부 상태 (저속 PID 적분/과거오차 + 모드 전환 추적)
+ *  - 제어기 인스턴스마다 1개, lfa_init_state()로 초기화
+ *  - Prev_Steer_Raw: 모드 선택 직후(감쇠/증폭 전) 조향각, PID 진입 시 적분항 역산 기준
+ */
+typedef struct
+{
+    float      Pid_Integral;
+    float      Pid_Prev_Error;
+    LFA_Mode_e Prev_Mode;
+    float      Prev_Steer_Raw;  /* [°] */
+    int        Is_Initialized;  /* (True=1, False=0) */
+    LFA_High_Speed_Law_e High_Speed_Law;  /* lfa_init_state: Stanley */
+} LFA_State_t;
 
 /**
  * @brief LFA 모드 선택 함수 (2.2.4.1.1)
  * @param pEgoData  : (입력) Ego 차량 속도
  * @return LFA_Mode_e: (출력) LOW_SPEED or HIGH_SPEED
  */
-LFA_Mode_e lfa_mode_selection(const Ego_Data_t *pEgoData);
+LFA_Mode_e lfa_mode_selection(const LFA_Ego_Data_t *pEgoData);
 
 /**
  * @brief 저속 모드 PID 조향각 계산 (2.2.4.1.2)
- * @param pLaneData : (입력) 차선 오차, heading 오차
+ * @param pEgoData  : (입력) Ego 차량 속도 (게인 스케줄 입력)
+ * @param pLaneData : (입력) 차선 오차, heading 오차, 곡률
  * @param deltaTime : (입력) 제어 루프 시간 간격
  * @return float     : Steering_Angle_PID (-540 ~ 540) [°]
  */
-float calculate_steer_in_low_speed_pid(const Lane_Data_LS_t *pLaneData,
+float calculate_steer_in_low_speed_pid(const LFA_Ego_Data_t *pEgoData,
+                                       const Lane_Data_LS_t *pLaneData,
                                        float deltaTime);
 
 /**
@@ -66,9 +97,32 @@ float calculate_steer_in_low_speed_pid(const Lane_Data_LS_t *pLaneData,
  * @param pLaneData : (입력) 차선 오차, heading 오차
  * @return float     : Steering_Angle_Stanley (-540 ~ 540) [°]
  */
-float calculate_steer_in_high_speed_stanley(const Ego_Data_t    *pEgoData,
+float calculate_steer_in_high_speed_stanley(const LFA_Ego_Data_t *pEgoData,
                                             const Lane_Data_LS_t *pLaneData);
 
+/**
+ * @brief Pure Pursuit look-ahead 거리
+ *  - 속도 스케줄 테이블 (0 ~ 40 m/s) 보간
+ *  - preview 곡률 κ 에 대해 0.5*κ*Ld² <= LFA_PP_MAX_CURVE_OFFSET 이 되도록 단축
+ * @param vx        : (입력) 종방향 속도 [m/s]
+ * @param pLaneData : (입력) 현재/다음 곡률 반경
+ * @return float     : look-ahead 거리 [m]
+ */
+float lfa_pure_pursuit_lookahead(float vx, const Lane_Data_LS_t *pLaneData);
+
+/**
+ * @brief 고속 모드 Pure Pursuit 조향각 계산 (경로 preview)
+ *  - 목표점 방위 α = headingErr + atan(cte / Ld) + dir * 0.5 * κ_preview * Ld
+ *    κ_preview = 현재 곡률 -> 다음 곡률 (Ld / LFA_PP_PREVIEW_HORIZON 비율로 혼합)
+ *  - steer = atan(2 * L * sin(α) / Ld), 부호 규칙은 Stanley 와 동일
+ *  - 닫힌 형태 O(1) 계산 (반복 솔버 없음)
+ * @param pEgoData  : (입력) Ego 차량 속도
+ * @param pLaneData : (입력) 차선 오차, heading 오차, 곡률/방향
+ * @return float     : Steering_Angle_PurePursuit (-540 ~ 540) [°]
+ */
+float calculate_steer_in_high_speed_pure_pursuit(const LFA_Ego_Data_t *pEgoData,
+                                                 const Lane_Data_LS_t *pLaneData);
+
 /**
  * @brief LFA 최종 출력 선택 (2.2.4.1.4)
  * @param lfaMode        : (입력) 현재 모드(LOW_SPEED/HIGH_SPEED)
@@ -82,7 +136,46 @@ float lfa_output_selection(LFA_Mode_e lfaMode,
                            float steeringAnglePID,
                            float steeringAngleStanley,
                            const Lane_Data_LS_t *pLaneData,
-                           const Ego_Data_t     *pEgoData);
+                           const LFA_Ego_Data_t *pEgoData);
+
+/**
+ * @brief LFA 상태 초기화
+ */
+void lfa_init_state(LFA_State_t *pState);
+
+/**
+ * @brief 기본 인스턴스 상태 (calculate_steer_in_low_speed_pid 용) 읽기/쓰기 (스냅샷/복원용)
+ */
+void lfa_get_default_state(LFA_State_t *pState);
+void lfa_set_default_state(const LFA_State_t *pState);
+
+/**
+ * @brief 고속 조향 법칙 이름 -> 값 (CLI / 설정용)
+ * @param pName : "stanley" 또는 "pursuit" (대소문자 구분)
+ * @return 0 : 성공, -1 : 알 수 없는 이름 (pLaw 변경 없음)
+ */
+int lfa_parse_high_speed_law(const char *pName, LFA_High_Speed_Law_e *pLaw);
+
+/**
+ * @brief 고속 조향 법칙 이름 ("stanley" / "pursuit")
+ */
+const char *lfa_high_speed_law_name(LFA_High_Speed_Law_e law);
+
+/**
+ * @brief 모드 디스패치 LFA 계산
+ *  - lfaMode에 해당하는 제어 법칙만 계산
+ *    (LOW_SPEED -> PID, HIGH_SPEED -> pState->High_Speed_Law: Stanley / Pure Pursuit)
+ *  - 고속 -> PID 전환 시 PID 적분항을 직전 조향각 기준으로 역산 (bumpless)
+ *  - 이후 lfa_output_selection과 동일한 감쇠/증폭/clamp 적용
+ * @param pState    : (입출력) LFA 내부 상태
+ * @param deltaTime : (입력) 제어 루프 시간 간격 [s]
+ * @return float     : 최종 조향각 Steer_LFA_Angle (-540 ~ 540)
+ */
+float lfa_calculate_steer(LFA_State_t          *pState,
+                          LFA_Mode_e            lfaMode,
+                          const LFA_Ego_Data_t *pEgoData,
+                          const Lane_Data_LS_t *pLaneData,
+                          float                 deltaTime);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,219 @@
+/****************************************************************************
+ * scenario_batch.h
+ *
+ * - 시나리오 일괄 실행기 (출시 검증용 파라미터 격자 전수 실행)
+ *   : 시나리오 = 끼어들기(CUT_IN) / 정지-출발(STOP_AND_GO) / 곡선(CURVE)
+ *   : 격자 = 자차 속도 x 선행차 간격 x 시나리오별 파라미터, 실행 번호 <-> 조건 1:1 (재현 가능)
+ *   : 실행마다 내장 차량 모델(vehicle_sim.h) + 전체 파이프라인 폐루프
+ * - 작업 훔치기(work stealing) 스레드 풀
+ *   : 스레드마다 실행 번호 구간 [Begin, End) 소유, 앞에서 묶음(<= 8 실행)씩 꺼내 처리
+ *   : 자기 구간이 비면 다른 스레드 구간의 뒤쪽 절반을 가져옴 (구간별 mutex)
+ *   : 묶음 = 차량 배치 1개 (VehicleSim_Step 한 번에 최대 8 실행 적분)
+ * - KPI 스트리밍 집계 (실행 수와 무관한 고정 메모리)
+ *   : 스레드별 시나리오 종류 x KPI 마다 Welford 평균/분산 + 최소/최대 + log-linear 히스토그램
+ *     (adas_metrics.h, 분위수 상대 오차 약 3%), 종료 시 스레드별 집계를 합침
+ ****************************************************************************/
+#ifndef SCENARIO_BATCH_H
+#define SCENARIO_BATCH_H
+
+#include <stdint.h>
+#include "adas_metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCENARIO_BATCH_MAX_THREADS  64
+#define SCENARIO_BATCH_MAX_GRIDS    16
+
+/* 최소 TTC 상한 [s] (접근하지 않은 실행 = 이 값) */
+#define SCENARIO_TTC_MAX            100.0f
+
+/* KPI 히스토그램 고정 소수점 배율 (값 * 배율 -> 정수 기록, 1e-6 단위) */
+#define SCENARIO_STAT_SCALE         1.0e6
+
+/**
+ * @brief 시나리오 종류
+ *  - CUT_IN      : 선행차가 옆 차로(좌측)에서 자차보다 느리게 주행, 간격 <= Param 이 되면 차로 진입
+ *  - STOP_AND_GO : 같은 차로 선행차가 Param [m/s^2] 로 정지 -> 정차 -> 출발 반복
+ *  - CURVE       : 곡률 반경 Param [m] 원호 도로 (+ = 좌회전), Lead_Gap > 0 이면 선행차 있음
+ */
+typedef enum
+{
+    SCENARIO_CUT_IN = 0,
+    SCENARIO_STOP_AND_GO,
+    SCENARIO_CURVE,
+    SCENARIO_TYPE_COUNT
+} ScenarioType_e;
+
+/**
+ * @brief 실행별 KPI
+ */
+typedef enum
+{
+    SCENARIO_KPI_MIN_TTC = 0,        /* 최소 TTC [s] (같은 차로 선행차 접근 시) */
+    SCENARIO_KPI_MAX_DECEL,          /* 최대 감속도 [m/s^2] */
+    SCENARIO_KPI_MAX_JERK,           /* 최대 |jerk| [m/s^3] */
+    SCENARIO_KPI_LANE_RMS,           /* 차선 중심 횡위치 RMS [m] */
+    SCENARIO_KPI_AEB_ACTIVATIONS,    /* AEB 제동 진입 횟수 */
+    SCENARIO_KPI_COUNT
+} ScenarioKpi_e;
+
+/**
+ * @brief 실행 1개 조건
+ */
+typedef struct
+{
+    ScenarioType_e Type;
+    float Ego_Speed;                 /* 초기 자차 속도 [m/s] */
+    float Lead_Gap;                  /* 초기 선행차 간격 [m] (CURVE 는 0 = 선행차 없음) */
+    float Param;                     /* 종류별 파라미터 (ScenarioType_e 참고) */
+} ScenarioInstance_t;
+
+/**
+ * @brief 격자 축 (Count 개 등간격, Count = 1 이면 Min)
+ */
+typedef struct
+{
+    float Min;
+    float Max;
+    int   Count;
+} ScenarioAxis_t;
+
+/**
+ * @brief 파라미터 격자 (실행 수 = 세 축 Count 곱, Param 축이 가장 빨리 변함)
+ */
+typedef struct
+{
+    ScenarioType_e Type;
+    ScenarioAxis_t Ego_Speed;
+    ScenarioAxis_t Lead_Gap;
+    ScenarioAxis_t Param;
+} ScenarioGrid_t;
+
+/**
+ * @brief 실행 1개 결과
+ */
+typedef struct
+{
+    float Kpi[SCENARIO_KPI_COUNT];
+    int   Collision;                 /* 같은 차로 선행차 간격 <= 0 (이후 KPI 집계 중단) */
+    int   Lane_Departure;            /* |횡위치| > (차선 폭 - 차폭) / 2 */
+} ScenarioResult_t;
+
+/**
+ * @brief KPI 스트리밍 통계 (Welford + 히스토그램)
+ */
+typedef struct
+{
+    uint64_t          Count;
+    double            Mean;
+    double            M2;            /* 편차 제곱합 */
+    double            Min;
+    double            Max;
+    AdasLatencyHist_t Sketch;        /* 값 * SCENARIO_STAT_SCALE (음수는 0) */
+} ScenarioStat_t;
+
+/**
+ * @brief 시나리오 종류별 집계
+ */
+typedef struct
+{
+    uint64_t       Runs;
+    uint64_t       Collisions;
+    uint64_t       Departures;
+    ScenarioStat_t Kpi[SCENARIO_KPI_COUNT];
+} ScenarioAggregate_t;
+
+/**
+ * @brief 결과 콜백 (워커 스레드에서 호출 -> 스레드 안전해야 함, 실행 순서 보장 없음)
+ *  - index : 전체 격자 목록 기준 실행 번호 (격자 순서대로 이어 붙인 번호)
+ */
+typedef void (*ScenarioResultFn_t)(void *pUser, int64_t index,
+                                   const ScenarioInstance_t *pInst, const ScenarioResult_t *pResult);
+
+/**
+ * @brief 일괄 실행 설정
+ */
+typedef struct
+{
+    float Delta_Time;                /* 제어 주기 [s] (기본 0.01) */
+    float Duration;                  /* 실행 1개 시뮬레이션 시간 [s] (기본 20) */
+    int   Thread_Count;              /* 워커 수 (기본 1, 최대 SCENARIO_BATCH_MAX_THREADS) */
+    int   Batch_Size;                /* 묶음 실행 수 (1 ~ 8, 기본 8) */
+    ScenarioResultFn_t pfnResult;    /* NULL 가능 */
+    void *pUser;
+} ScenarioBatchConfig_t;
+
+/**
+ * @brief 일괄 실행 계측
+ */
+typedef struct
+{
+    int64_t  Runs;
+    uint64_t Steals;                 /* 구간 훔치기 성공 횟수 */
+    uint64_t Wall_Ns;
+    uint64_t Thread_Runs[SCENARIO_BATCH_MAX_THREADS];
+} ScenarioBatchStats_t;
+
+/**
+ * @brief 기본 설정
+ */
+void ScenarioBatch_DefaultConfig(ScenarioBatchConfig_t *pConfig);
+
+/**
+ * @brief 격자 실행 수 (축 Count <= 0 이면 0)
+ */
+int64_t ScenarioGrid_Count(const ScenarioGrid_t *pGrid);
+
+/**
+ * @brief 격자 내 index 번째 실행 조건
+ * @return 0 : 성공, -1 : 인자 오류 / 범위 밖
+ */
+int ScenarioGrid_Instance(const ScenarioGrid_t *pGrid, int64_t index, ScenarioInstance_t *pInst);
+
+/**
+ * @brief 묶음 실행 (호출 스레드, count = 1 ~ 8) - 결과는 묶음 구성과 무관
+ * @return 0 : 성공, -1 : 인자 오류 / 메모리 부족
+ */
+int ScenarioBatch_RunBlock(const ScenarioInstance_t *pInst, int count,
+                           const ScenarioBatchConfig_t *pConfig, ScenarioResult_t *pResults);
+
+/**
+ * @brief 격자 목록 전체 실행 (작업 훔치기 스레드 풀)
+ * @param gridCount : 1 ~ SCENARIO_BATCH_MAX_GRIDS
+ * @param pAgg   : 시나리오 종류별 집계 [SCENARIO_TYPE_COUNT] (내부에서 초기화)
+ * @param pStats : NULL 가능
+ * @return 0 : 성공, -1 : 인자 오류 / 메모리 부족 / 스레드 생성 실패
+ */
+int ScenarioBatch_Run(const ScenarioGrid_t *pGrids, int gridCount, const ScenarioBatchConfig_t *pConfig,
+                      ScenarioAggregate_t *pAgg, ScenarioBatchStats_t *pStats);
+
+/**
+ * @brief 통계 초기화 / 값 추가 / 합치기 (Chan 병렬 분산 공식)
+ */
+void   ScenarioStat_Init(ScenarioStat_t *pStat);
+void   ScenarioStat_Add(ScenarioStat_t *pStat, double value);
+void   ScenarioStat_Merge(ScenarioStat_t *pDst, const ScenarioStat_t *pSrc);
+
+/**
+ * @brief 표본 표준편차 (Count < 2 이면 0)
+ */
+double ScenarioStat_Stddev(const ScenarioStat_t *pStat);
+
+/**
+ * @brief 분위수 (percentile = 0 ~ 100, 히스토그램 버킷 상한 기준)
+ */
+double ScenarioStat_Quantile(const ScenarioStat_t *pStat, double percentile);
+
+/**
+ * @brief 이름 (범위 밖이면 "?")
+ */
+const char *ScenarioBatch_TypeName(ScenarioType_e type);
+const char *ScenarioBatch_KpiName(ScenarioKpi_e kpi);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCENARIO_BATCH_H */
@@ -0,0 +1,125 @@
+/****************************************************************************
+ * sensor_fault.h
+ *
+ * - GPS / IMU 센서 열화 / 고장 주입 (Ego 추정기 부하 시험용)
+ *   : 가우시안 잡음, 바이어스 드리프트, 스파이크, 유실(dropout), 전달 지연 + 지터, 늦은 도착(순서 뒤바뀜)
+ * - 카운터 기반 (Philox4x32-10, adas_rng.h): 샘플 k 의 열화 = f(Seed, stream, 센서, k)
+ *   : 순서 / 분할과 무관하게 같은 결과 -> 스레드별 구간 병렬 생성, 임의 구간 재현
+ *   : 바이어스도 상태 없이 계산 (Bias_Period_Ms 간격 매듭 값 ~ N(0, Bias_Sigma), 매듭 사이 선형 보간)
+ * - 시각 [ms]: 측정 시각 = Index * Period_Ms (센서 고유 주기), 도착 시각 = 측정 + 지연
+ *   : 도착 순 정렬 후 SensorFault_Latest 로 제어 주기마다 "지금까지 도착한 최신 샘플" 을 꺼내
+ *     GPSData_t / IMUData_t 로 전달 (GPS_Timestamp = 측정 시각 -> 50 ms 유효성 검사 대상)
+ ****************************************************************************/
+#ifndef SENSOR_FAULT_H
+#define SENSOR_FAULT_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SENSOR_FAULT_MAX_CHANNELS  3   /* GPS: vx, vy / IMU: ax, ay, yaw rate */
+
+/* stream 상한 (카운터 상위 4 bit 는 센서 / 블록 구분) */
+#define SENSOR_FAULT_STREAM_MAX    ((1ull << 60) - 1u)
+
+/**
+ * @brief 센서 종류
+ */
+typedef enum
+{
+    SENSOR_FAULT_GPS = 0,
+    SENSOR_FAULT_IMU,
+    SENSOR_FAULT_SENSOR_COUNT
+} SensorFaultSensor_e;
+
+/**
+ * @brief 채널별 값 열화
+ */
+typedef struct
+{
+    float Noise_Sigma;               /* 백색 잡음 표준편차 */
+    float Bias_Sigma;                /* 바이어스 매듭 표준편차 (0 = 바이어스 없음) */
+    float Spike_Prob;                /* 샘플당 스파이크 확률 */
+    float Spike_Amplitude;           /* 스파이크 크기 (부호 무작위) */
+} SensorFaultChannel_t;
+
+/**
+ * @brief 센서별 설정
+ */
+typedef struct
+{
+    float Period_Ms;                 /* 샘플 주기 (GPS 기본 100, IMU 기본 10) */
+    float Bias_Period_Ms;            /* 바이어스 매듭 간격 (기본 2000) */
+    float Dropout_Prob;              /* 샘플 유실 확률 */
+    float Latency_Ms;                /* 평균 전달 지연 */
+    float Jitter_Ms;                 /* 지연 균등 분포 ±Jitter_Ms (지연 < 0 이면 0) */
+    float Late_Prob;                 /* 추가 지연 확률 (뒤 샘플보다 늦게 도착 -> 순서 뒤바뀜) */
+    float Late_Max_Ms;               /* 추가 지연 균등 0 ~ Late_Max_Ms */
+    SensorFaultChannel_t Channel[SENSOR_FAULT_MAX_CHANNELS];
+} SensorFaultSensorConfig_t;
+
+/**
+ * @brief 전체 설정
+ */
+typedef struct
+{
+    uint64_t Seed;
+    SensorFaultSensorConfig_t Sensor[SENSOR_FAULT_SENSOR_COUNT];
+} SensorFaultConfig_t;
+
+/**
+ * @brief 샘플 (호출자: Index / Value = 참값 설정 -> SensorFault_Apply 가 나머지 / 열화 값 기록)
+ */
+typedef struct
+{
+    uint64_t Index;                  /* 센서 샘플 번호 */
+    double   Measure_Time;           /* [ms] (double: float 는 ~4.6 h 이후 ulp > 1 ms -> 지연 / 순서 소실) */
+    double   Arrival_Time;           /* [ms] */
+    float    Value[SENSOR_FAULT_MAX_CHANNELS];
+    uint8_t  Dropped;                /* 1 = 유실 (도착 안 함) */
+    uint8_t  Spike_Mask;             /* bit c = 채널 c 스파이크 */
+    uint8_t  Late;                   /* 1 = 추가 지연 */
+} SensorSample_t;
+
+/**
+ * @brief 기본 설정 (MAX_SENSOR_NOISE_* 임계값을 넘는 스파이크 포함)
+ */
+void SensorFault_DefaultConfig(SensorFaultConfig_t *pConfig);
+
+/**
+ * @brief 열화 주입 (샘플마다 독립, 배열 순서 / 분할 무관)
+ * @param stream : 차량 / 실행 번호 등 (0 ~ SENSOR_FAULT_STREAM_MAX)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int SensorFault_Apply(const SensorFaultConfig_t *pConfig, SensorFaultSensor_e sensor, uint64_t stream,
+                      SensorSample_t *pSamples, int count);
+
+/**
+ * @brief 도착 시각 순 정렬 (안정 정렬, 거의 정렬된 입력에서 O(n))
+ */
+void SensorFault_SortByArrival(SensorSample_t *pSamples, int count);
+
+/**
+ * @brief now 까지 도착한 샘플 중 가장 늦게 도착한 것 (유실 제외)
+ *  - pSorted : 도착 순 정렬 배열, *pCursor : 다음 확인 위치 (처음 0, 호출마다 전진)
+ *  - pPrev   : 이전 반환값 (새로 도착한 샘플이 없으면 그대로 반환)
+ *  - 늦게 도착한 옛 샘플도 "최신 도착" 이면 반환 (순서 뒤바뀜 -> 추정기의 타임스탬프 검사 대상)
+ * @return 최신 샘플 (아직 없으면 NULL)
+ */
+const SensorSample_t *SensorFault_Latest(const SensorSample_t *pSorted, int count, int *pCursor,
+                                         double now, const SensorSample_t *pPrev);
+
+/**
+ * @brief 샘플 -> 파이프라인 입력 (GPS: vx, vy, 측정 시각 / IMU: ax, ay, yaw rate)
+ */
+void SensorFault_ToGps(const SensorSample_t *pSample, GPSData_t *pGps);
+void SensorFault_ToImu(const SensorSample_t *pSample, IMUData_t *pImu);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_FAULT_H */
@@ -0,0 +1,172 @@
+/****************************************************************************
+ * sensor_ingest.h
+ *
+ * - 센서 드라이버 스레드 -> 제어 루프 입력 경로 (GPS / IMU / 객체 목록)
+ * - 센서별 채널 1개 = 생산자 1개 (드라이버 스레드) / 소비자 1개 (제어 루프)
+ *   : QUEUE   모드 - SPSC 링 큐 (spsc_queue.h), 주기마다 일괄(batch) 꺼냄
+ *   : MAILBOX 모드 - 3중 버퍼 (triple_buffer.h), 최신값만 전달
+ * - 제어 루프 쪽 Drain 은 잠금/시스템 콜 없음 (시각은 vDSO clock_gettime)
+ * - 생산자는 링/메일박스 슬롯에 직접 작성 (중간 복사 없음)
+ * - 샘플마다 게시 시각을 찍어 센서 -> 루프 전달 지연(handoff) 계측
+ ****************************************************************************/
+#ifndef SENSOR_INGEST_H
+#define SENSOR_INGEST_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+#include "adas_pipeline.h"
+#include "spsc_queue.h"
+#include "triple_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 채널별 큐 용량 (2의 거듭제곱, 제어 주기 동안 들어오는 샘플 수보다 충분히 크게) */
+#define ADAS_INGEST_GPS_CAPACITY  16
+#define ADAS_INGEST_IMU_CAPACITY  64
+#define ADAS_INGEST_OBJ_CAPACITY  4
+
+/**
+ * @brief 센서 채널
+ */
+typedef enum
+{
+    ADAS_SENSOR_GPS = 0,
+    ADAS_SENSOR_IMU,
+    ADAS_SENSOR_OBJECTS,
+    ADAS_SENSOR_COUNT
+} AdasSensor_e;
+
+/* Drain 반환 비트 (이번 주기에 갱신된 센서) */
+#define ADAS_INGEST_UPDATED(sensor)  (1 << (sensor))
+
+/**
+ * @brief 채널 전달 모드
+ */
+typedef enum
+{
+    ADAS_INGEST_MODE_QUEUE = 0,   /* 모든 샘플 전달 (가득 차면 새 샘플 버림) */
+    ADAS_INGEST_MODE_MAILBOX      /* 최신 샘플만 전달 (이전 샘플 덮어씀) */
+} AdasIngestMode_e;
+
+/**
+ * @brief 게시 시각이 찍힌 센서 샘플
+ */
+typedef struct
+{
+    uint64_t  Stamp_Ns;
+    GPSData_t Data;
+} AdasGpsSample_t;
+
+typedef struct
+{
+    uint64_t  Stamp_Ns;
+    IMUData_t Data;
+} AdasImuSample_t;
+
+typedef struct
+{
+    uint64_t     Stamp_Ns;
+    int          Object_Count;
+    ObjectData_t Objects[ADAS_MAX_OBJECTS];
+} AdasObjectList_t;
+
+/**
+ * @brief 채널 계측 (소비자 기록)
+ *  - Lost = 게시 - 수신 (QUEUE: 가득 차서 버림, MAILBOX: 덮어쓰임)
+ */
+typedef struct
+{
+    uint64_t Received;
+    uint64_t Lost;
+    uint64_t Max_Batch;          /* 한 주기 최대 수신 개수 */
+    uint64_t Handoff_Total_Ns;   /* 게시 ~ Drain */
+    uint64_t Handoff_Max_Ns;
+} AdasIngestStats_t;
+
+/**
+ * @brief 채널 (모드에 따라 Queue 또는 Mailbox 사용)
+ */
+typedef struct
+{
+    AdasIngestMode_e  Mode;
+    SpscQueue_t       Queue;
+    TripleBuffer_t    Mailbox;
+    uint64_t          Published;   /* 생산자 기록 (__atomic) */
+    char              Pad[SPSC_QUEUE_CACHE_LINE];
+    AdasIngestStats_t Stats;       /* 소비자 기록 */
+} AdasIngestChannel_t;
+
+/**
+ * @brief 센서 입력 경로 (저장 공간 포함, 정적/전역 배치 권장)
+ */
+typedef struct
+{
+    AdasIngestChannel_t Channel[ADAS_SENSOR_COUNT];
+
+    /* 큐 저장 공간 */
+    AdasGpsSample_t  Gps_Ring[ADAS_INGEST_GPS_CAPACITY];
+    AdasImuSample_t  Imu_Ring[ADAS_INGEST_IMU_CAPACITY];
+    AdasObjectList_t Obj_Ring[ADAS_INGEST_OBJ_CAPACITY];
+
+    /* 메일박스 저장 공간 */
+    AdasGpsSample_t  Gps_Slots[TRIPLE_BUFFER_SLOTS];
+    AdasImuSample_t  Imu_Slots[TRIPLE_BUFFER_SLOTS];
+    AdasObjectList_t Obj_Slots[TRIPLE_BUFFER_SLOTS];
+
+    /* 소비자 일괄 수신 버퍼 */
+    AdasGpsSample_t  Gps_Batch[ADAS_INGEST_GPS_CAPACITY];
+    AdasImuSample_t  Imu_Batch[ADAS_INGEST_IMU_CAPACITY];
+    AdasObjectList_t Obj_Batch[ADAS_INGEST_OBJ_CAPACITY];
+} AdasSensorIngest_t;
+
+/**
+ * @brief 초기화
+ * @param pModes : 센서별 모드 (ADAS_SENSOR_COUNT 개, NULL = GPS/IMU QUEUE, 객체 MAILBOX)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasIngest_Init(AdasSensorIngest_t *pIngest, const AdasIngestMode_e *pModes);
+
+/**
+ * @brief (GPS 드라이버 스레드) 샘플 게시
+ * @return 0 : 성공, -1 : 큐 가득 참 또는 인자 오류
+ */
+int AdasIngest_PushGps(AdasSensorIngest_t *pIngest, const GPSData_t *pGps);
+
+/**
+ * @brief (IMU 드라이버 스레드) 샘플 게시
+ * @return 0 : 성공, -1 : 큐 가득 참 또는 인자 오류
+ */
+int AdasIngest_PushImu(AdasSensorIngest_t *pIngest, const IMUData_t *pImu);
+
+/**
+ * @brief (인지 스레드) 객체 목록 게시 (objCount > ADAS_MAX_OBJECTS 이면 잘림)
+ * @return 0 : 성공, -1 : 큐 가득 참 또는 인자 오류
+ */
+int AdasIngest_PushObjects(AdasSensorIngest_t *pIngest, const ObjectData_t *pObjs, int objCount);
+
+/**
+ * @brief (제어 루프) 모든 채널을 비워 최신 샘플로 pIn 갱신
+ *  - 새 샘플이 없는 센서는 pIn 의 이전 값 유지
+ *  - QUEUE 모드에서 받은 전체 샘플은 다음 Drain 전까지 *_Batch 에 남음
+ * @return 갱신된 센서 비트 (ADAS_INGEST_UPDATED), -1 : 인자 오류
+ */
+int AdasIngest_Drain(AdasSensorIngest_t *pIngest, AdasFrameInput_t *pIn);
+
+/**
+ * @brief AdasInputFn_t 어댑터 (pUser = AdasSensorIngest_t*)
+ *  - 런타임 입력 콜백으로 등록하면 주기마다 Drain
+ */
+int AdasIngest_InputFn(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn);
+
+/**
+ * @brief 채널별 계측 결과 출력
+ */
+void AdasIngest_PrintStats(const AdasSensorIngest_t *pIngest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_INGEST_H */
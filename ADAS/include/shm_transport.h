@@ -0,0 +1,168 @@
+/****************************************************************************
+ * shm_transport.h
+ *
+ * - 시뮬레이터(Carla 브리지 등) <-> ADAS 스택 간 POSIX 공유 메모리 링 전송
+ *   : shm_open + mmap, 직렬화(JSON 등) 없음
+ * - 영역 구조 (버전 관리): [AdasShmHeader_t][AdasShmFrame_t x ADAS_SHM_RING_SLOTS]
+ *   : 프레임 = 시퀀스 + AdasFrameInput_t (ego 센서 / 차선 / 객체 배열 고정 크기)
+ *   : 헤더의 Magic/Version/크기 필드로 양쪽 레이아웃 불일치 검출
+ * - 슬롯별 seqlock (홀수 = 작성 중)
+ *   : 생산자는 슬롯에 직접 작성 (BeginWrite -> 작성 -> EndWrite)
+ *   : 소비자는 복사 없이 슬롯을 그 자리에서 읽고, 사용 후 (출력 전) Validate 로 덮어쓰기 여부 확인
+ *   : 링 깊이만큼(슬롯 수 - 1 프레임) 소비자가 늦어도 읽는 슬롯은 덮어쓰이지 않음
+ * - 소비자 매핑은 읽기 전용 (PROT_READ)
+ * - glibc 2.34 미만은 -lrt 링크 필요
+ ****************************************************************************/
+#ifndef SHM_TRANSPORT_H
+#define SHM_TRANSPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADAS_SHM_MAGIC         0x4D534441u   /* "ADSM" */
+#define ADAS_SHM_VERSION       1u
+#define ADAS_SHM_RING_SLOTS    8u            /* 2의 거듭제곱 */
+#define ADAS_SHM_NAME_MAX      64
+#define ADAS_SHM_DEFAULT_NAME  "/adas_sim_frames"
+
+/* 반환 코드 */
+#define ADAS_SHM_ERR_ARG       (-1)   /* 인자 오류 / 시스템 콜 실패 */
+#define ADAS_SHM_ERR_LAYOUT    (-2)   /* Magic/Version/크기 불일치 또는 생산자 미초기화 */
+
+/**
+ * @brief 영역 헤더 (생산자가 Magic 을 마지막에 기록 -> 초기화 완료 표시)
+ */
+typedef struct
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Header_Size;   /* sizeof(AdasShmHeader_t) */
+    uint32_t Frame_Size;    /* sizeof(AdasShmFrame_t) */
+    uint32_t Input_Size;    /* sizeof(AdasFrameInput_t) */
+    uint32_t Slot_Count;
+    uint32_t Max_Objects;
+    uint32_t Reserved;
+    uint64_t Write_Index;   /* 게시 완료 프레임 수 (= 최신 Frame_Id, __atomic) */
+    uint8_t  Pad[64 - 40];
+} __attribute__((aligned(64))) AdasShmHeader_t;
+
+/**
+ * @brief 링 슬롯 (프레임)
+ */
+typedef struct
+{
+    uint32_t         Seq;          /* seqlock (홀수 = 작성 중) */
+    uint32_t         Reserved;
+    uint64_t         Frame_Id;     /* 1부터 증가 */
+    uint64_t         Publish_Ns;   /* CLOCK_MONOTONIC 게시 시각 (같은 호스트 기준) */
+    AdasFrameInput_t Input;        /* Time.Current_Time = 시뮬레이션 시각 [ms] */
+} __attribute__((aligned(64))) AdasShmFrame_t;
+
+/**
+ * @brief 공유 메모리 영역 전체
+ */
+typedef struct
+{
+    AdasShmHeader_t Header;
+    AdasShmFrame_t  Frames[ADAS_SHM_RING_SLOTS];
+} AdasShmRegion_t;
+
+/**
+ * @brief 소비자 계측
+ */
+typedef struct
+{
+    uint64_t Frames_Read;
+    uint64_t Frames_Skipped;   /* 읽기 전에 더 새 프레임이 와서 건너뛴 수 */
+    uint64_t Torn_Reads;       /* 사용 중 덮어쓰인 프레임 (Validate 실패) */
+    uint64_t Retries;          /* 작성 중 슬롯을 만나 다시 읽은 횟수 */
+} AdasShmStats_t;
+
+/**
+ * @brief 전송 핸들 (생산자 또는 소비자 한쪽)
+ */
+typedef struct
+{
+    int                   Fd;
+    AdasShmRegion_t      *pRegion;
+    int                   Is_Producer;
+    char                  Name[ADAS_SHM_NAME_MAX];
+
+    /* 생산자 */
+    AdasShmFrame_t       *pWriting;
+
+    /* 소비자 */
+    uint64_t              Last_Frame_Id;
+    const AdasShmFrame_t *pHeld;      /* 이번 주기에 반환한 프레임 (InputRef / InputCheck 어댑터용) */
+    uint32_t              Held_Seq;
+    AdasShmStats_t        Stats;
+} AdasShmTransport_t;
+
+/**
+ * @brief (생산자) 영역 생성 + 헤더 초기화 (이미 있으면 덮어씀)
+ * @param name : "/" 로 시작하는 shm 이름 (NULL = ADAS_SHM_DEFAULT_NAME)
+ * @return 0 : 성공, ADAS_SHM_ERR_ARG : 인자 오류/시스템 콜 실패
+ */
+int AdasShm_Create(AdasShmTransport_t *pT, const char *name);
+
+/**
+ * @brief (소비자) 기존 영역 열기 (읽기 전용) + 레이아웃 검증
+ * @return 0 : 성공, ADAS_SHM_ERR_ARG : 없음/실패, ADAS_SHM_ERR_LAYOUT : 버전/크기 불일치
+ */
+int AdasShm_Open(AdasShmTransport_t *pT, const char *name);
+
+/**
+ * @brief 매핑 해제 (생산자이고 unlink != 0 이면 shm 이름 삭제)
+ */
+void AdasShm_Close(AdasShmTransport_t *pT, int unlink);
+
+/**
+ * @brief (생산자) 다음 슬롯 작성 시작 (슬롯 Seq 홀수로 표시)
+ * @return 작성할 프레임 (Input 만 채우면 됨), NULL : 인자 오류
+ */
+AdasShmFrame_t *AdasShm_BeginWrite(AdasShmTransport_t *pT);
+
+/**
+ * @brief (생산자) 작성 완료 -> 게시 (Seq 짝수, Write_Index 증가)
+ * @return 게시한 Frame_Id, 0 : BeginWrite 없음
+ */
+uint64_t AdasShm_EndWrite(AdasShmTransport_t *pT);
+
+/**
+ * @brief (소비자) 최신 프레임을 복사 없이 획득
+ * @param ppFrame : 슬롯 포인터 (다음 프레임이 링을 한 바퀴 돌기 전까지 유효)
+ * @param pSeq    : Validate 용 시퀀스
+ * @return 1 : 새 프레임, 0 : 새 프레임 없음, ADAS_SHM_ERR_ARG : 인자 오류
+ */
+int AdasShm_AcquireLatest(AdasShmTransport_t *pT, const AdasShmFrame_t **ppFrame, uint32_t *pSeq);
+
+/**
+ * @brief (소비자) 획득 이후 프레임이 덮어쓰이지 않았는지 확인 (사용 완료 후 호출)
+ * @return 1 : 유효, 0 : 사용 중 덮어쓰임 (Torn_Reads 증가)
+ */
+int AdasShm_Validate(AdasShmTransport_t *pT, const AdasShmFrame_t *pFrame, uint32_t seq);
+
+/**
+ * @brief AdasInputRefFn_t 어댑터 (pUser = 소비자 AdasShmTransport_t*)
+ *  - 새 프레임이 있으면 최신 프레임 포인터 반환
+ *  - 새 프레임이 없으면 *ppIn = NULL (직전 프레임 재전달 없음, 런타임은 Input_Missing 으로 건너뜀)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int AdasShm_InputRefFn(void *pUser, uint64_t cycle, const AdasFrameInput_t **ppIn);
+
+/**
+ * @brief AdasInputCheckFn_t 어댑터: 이번 주기 프레임 Validate (파이프라인 실행 후, 출력 전)
+ * @return 1 : 유효, 0 : 처리 중 덮어쓰임 (Torn_Reads 증가) / 이번 주기 프레임 아님
+ */
+int AdasShm_InputCheckFn(void *pUser, uint64_t cycle, const AdasFrameInput_t *pIn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHM_TRANSPORT_H */
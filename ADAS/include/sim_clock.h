@@ -0,0 +1,173 @@
+/****************************************************************************
+ * sim_clock.h
+ *
+ * - 가상 시계 + 이산 사건(discrete-event) 스케줄러 (폐루프 / 센서 비동기 시뮬레이션용)
+ *   : 센서 도착(고유 주기 + 지연), 제어 주기, 액추에이터 지연 등을 타이머 이벤트로 예약
+ *   : 다음 이벤트 시각으로 바로 건너뜀 -> 벽시계와 무관하게 CPU 가 허용하는 만큼 빠르게 실행
+ * - 시각: 정수 µs (SimTime_t, 64 bit) -> 주기 누적 오차 없음, TimeData_t 용 ms 는 SimClock_NowMs
+ * - 계층 타이밍 휠 (64 슬롯 x 11 단, 단마다 6 bit -> 64 bit 시각 전 범위, 휠 밖 대기열 없음)
+ *   : 타이머는 (만료 시각 ^ 현재 시각) 의 최상위 bit 가 속한 단, 그 단의 만료 시각 자리 슬롯에 연결
+ *   : 시계가 상위 단 슬롯 경계에 도달하면 그 슬롯만 하위 단으로 재배치 (cascade)
+ *   : 단마다 64 bit 점유 비트맵 -> 다음 이벤트 시각 = 비트맵 ctz, 빈 시간 구간은 비용 없음
+ *   : 예약 / 취소 O(1) (타이머는 호출자 소유 침입형 이중 연결 리스트 노드, 동적 할당 없음)
+ * - 동시각 이벤트: Priority 오름차순, 같으면 예약 순 (1 단 슬롯 = 같은 시각, 정렬 삽입)
+ *   : 콜백에서 현재 시각으로 예약한 이벤트는 지금 실행 중인 묶음 다음에 실행
+ * - 단일 스레드 전용 (시뮬레이션 인스턴스별 시계 1 개)
+ ****************************************************************************/
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIM_CLOCK_SLOT_BITS   6
+#define SIM_CLOCK_SLOTS       (1 << SIM_CLOCK_SLOT_BITS)
+#define SIM_CLOCK_LEVELS      11                          /* 11 x 6 bit >= 64 bit */
+
+#define SIM_CLOCK_BUCKET_FIRING 0xFFFFu
+
+#define SIM_US_PER_MS         1000ull
+#define SIM_US_PER_SEC        1000000ull
+
+/** @brief 가상 시각 [µs] */
+typedef uint64_t SimTime_t;
+
+struct SimClock;
+struct SimTimer;
+
+/**
+ * @brief 이벤트 콜백 (콜백 안에서 예약 / 취소 / SimClock_Stop 가능)
+ */
+typedef void (*SimEventFn_t)(struct SimClock *pClock, struct SimTimer *pTimer, void *pUser);
+
+/**
+ * @brief 연결 리스트 노드 (슬롯 머리 = 보초 노드, 원형)
+ */
+typedef struct SimLink
+{
+    struct SimLink *pNext;
+    struct SimLink *pPrev;
+} SimLink_t;
+
+/**
+ * @brief 타이머 (호출자 소유, 예약 중에는 이동 / 해제 금지)
+ */
+typedef struct SimTimer
+{
+    SimLink_t    Link;              /* 첫 멤버 (링크 -> 타이머 변환) */
+    SimTime_t    Expires;           /* 만료 시각 [µs] */
+    SimTime_t    Period;            /* 0 = 1 회, > 0 = 주기 (만료 시각 += Period 로 재예약, 드리프트 없음) */
+    uint64_t     Seq;               /* 예약 순번 (동시각 정렬) */
+    int32_t      Priority;          /* 동시각 정렬 (작을수록 먼저) */
+    uint16_t     Bucket;            /* 연결된 슬롯 (단 * SIM_CLOCK_SLOTS + 슬롯), 실행 묶음 = SIM_CLOCK_BUCKET_FIRING */
+    uint8_t      Armed;
+    SimEventFn_t Fn;
+    void        *pUser;
+} SimTimer_t;
+
+/**
+ * @brief 가상 시계 / 이벤트 휠
+ */
+typedef struct SimClock
+{
+    SimTime_t Now;
+    uint64_t  Seq;
+    uint64_t  Pending[SIM_CLOCK_LEVELS];                 /* 슬롯 점유 비트맵 */
+    SimLink_t Wheel[SIM_CLOCK_LEVELS][SIM_CLOCK_SLOTS];
+    SimLink_t Firing;                                    /* 실행 중인 동시각 묶음 */
+    int       Stop;
+
+    /* 통계 */
+    uint64_t  Fired;                                     /* 실행한 이벤트 수 */
+    uint64_t  Cascaded;                                  /* 하위 단 재배치 횟수 */
+    uint32_t  Armed;                                     /* 예약 중인 타이머 수 */
+} SimClock_t;
+
+/**
+ * @brief 시계 초기화 (예약 없음, Now = start)
+ */
+void SimClock_Init(SimClock_t *pClock, SimTime_t start);
+
+/**
+ * @brief 타이머 초기화 (예약 안 됨)
+ * @param priority : 동시각 실행 순서 (예: 센서 도착 0 < 제어 주기 10 < 액추에이터 20)
+ */
+void SimTimer_Init(SimTimer_t *pTimer, SimEventFn_t fn, void *pUser, int32_t priority);
+
+/**
+ * @brief 절대 시각 예약 (이미 예약된 타이머는 취소 후 다시 예약)
+ * @param period : 0 = 1 회, > 0 = 주기 [µs]
+ * @return 0 : 성공, -1 : 인자 오류 / when < Now
+ */
+int SimClock_ScheduleAt(SimClock_t *pClock, SimTimer_t *pTimer, SimTime_t when, SimTime_t period);
+
+/**
+ * @brief 상대 시각 예약 (Now + delay)
+ * @return 0 : 성공, -1 : 인자 오류 / 시각 overflow
+ */
+int SimClock_ScheduleIn(SimClock_t *pClock, SimTimer_t *pTimer, SimTime_t delay, SimTime_t period);
+
+/**
+ * @brief 예약 취소 (예약 안 된 타이머는 무시)
+ */
+void SimClock_Cancel(SimClock_t *pClock, SimTimer_t *pTimer);
+
+/**
+ * @brief 다음 "할 일" 시각 (이벤트 만료 또는 상위 단 재배치 시각, 실제 이벤트보다 빠를 수 있음)
+ * @return 0 : 있음, -1 : 예약 없음
+ */
+int SimClock_NextWake(const SimClock_t *pClock, SimTime_t *pWhen);
+
+/**
+ * @brief end 시각까지 실행 (만료 시각 <= end 인 이벤트 전부, 종료 시 Now = end)
+ *  - 콜백이 SimClock_Stop 을 호출하면 그 묶음 처리 후 중단 (Now = 중단 시각)
+ * @return 실행한 이벤트 수
+ */
+uint64_t SimClock_RunUntil(SimClock_t *pClock, SimTime_t end);
+
+/**
+ * @brief 다음 이벤트 시각의 묶음 하나 실행 (Now = 그 시각)
+ * @return 실행한 이벤트 수 (0 = 예약 없음)
+ */
+uint64_t SimClock_Step(SimClock_t *pClock);
+
+/**
+ * @brief (콜백에서) 실행 중단 요청
+ */
+static inline void SimClock_Stop(SimClock_t *pClock)
+{
+    pClock->Stop = 1;
+}
+
+/**
+ * @brief 현재 가상 시각 [µs]
+ */
+static inline SimTime_t SimClock_Now(const SimClock_t *pClock)
+{
+    return pClock->Now;
+}
+
+/**
+ * @brief 현재 가상 시각 [ms] (TimeData_t.Current_Time / GPS_Timestamp 용, float: 1 ms 해상도 ~ 4.6 시간까지)
+ */
+static inline float SimClock_NowMs(const SimClock_t *pClock)
+{
+    return (float)((double)pClock->Now * (1.0 / (double)SIM_US_PER_MS));
+}
+
+/**
+ * @brief ms -> µs (반올림)
+ */
+static inline SimTime_t SimTime_FromMs(double ms)
+{
+    return (ms > 0.0) ? (SimTime_t)((ms * (double)SIM_US_PER_MS) + 0.5) : 0u;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_CLOCK_H */
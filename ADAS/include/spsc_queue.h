@@ -0,0 +1,93 @@
+/****************************************************************************
+ * spsc_queue.h
+ *
+ * - 단일 생산자 / 단일 소비자 lock-free 링 큐 (고정 크기 원소, 바이트 복사)
+ * - 용량은 2의 거듭제곱, 저장 공간은 호출자 제공 (동적 할당 없음)
+ * - 생산자 변수(Head)와 소비자 변수(Tail)는 서로 다른 캐시 라인
+ *   : 상대 인덱스는 각자 캐시(Tail_Cache / Head_Cache)해 두고
+ *     가득 참/빔 판단이 필요할 때만 상대 캐시 라인을 읽음
+ * - Push/Pop 모두 시스템 콜/잠금 없음, 큐가 가득 차면 Push 실패 (Dropped 증가)
+ * - GCC/Clang __atomic 내장 함수 사용 (헤더는 C++ 테스트에서도 포함 가능)
+ ****************************************************************************/
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SPSC_QUEUE_CACHE_LINE  64
+
+/**
+ * @brief SPSC 링 큐
+ *  - Head/Tail 은 계속 증가하는 인덱스 (슬롯 = 인덱스 & Mask)
+ */
+typedef struct
+{
+    /* 읽기 전용 (Init 이후) */
+    unsigned char *pBuf;
+    uint32_t       Elem_Size;
+    uint32_t       Mask;
+    char           Pad0[SPSC_QUEUE_CACHE_LINE];
+
+    /* 생산자 전용 */
+    uint32_t       Head;
+    uint32_t       Tail_Cache;
+    uint64_t       Dropped;        /* 가득 차서 버린 원소 수 */
+    char           Pad1[SPSC_QUEUE_CACHE_LINE];
+
+    /* 소비자 전용 */
+    uint32_t       Tail;
+    uint32_t       Head_Cache;
+    char           Pad2[SPSC_QUEUE_CACHE_LINE];
+} SpscQueue_t;
+
+/**
+ * @brief 초기화
+ * @param pStorage : capacity * elemSize 바이트
+ * @param capacity : 2의 거듭제곱 (>= 2)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int SpscQueue_Init(SpscQueue_t *pQ, void *pStorage, uint32_t elemSize, uint32_t capacity);
+
+/**
+ * @brief (생산자) 원소 1개 추가
+ * @return 0 : 성공, -1 : 가득 참 (원소 버림) 또는 인자 오류
+ */
+int SpscQueue_Push(SpscQueue_t *pQ, const void *pElem);
+
+/**
+ * @brief (생산자) 다음 슬롯을 직접 작성 (복사 없는 Push: WriteSlot -> 작성 -> Commit)
+ * @return 슬롯 포인터, NULL : 가득 참 (Dropped 증가) 또는 인자 오류
+ */
+void *SpscQueue_WriteSlot(SpscQueue_t *pQ);
+
+/**
+ * @brief (생산자) WriteSlot 으로 작성한 슬롯 게시
+ */
+void SpscQueue_Commit(SpscQueue_t *pQ);
+
+/**
+ * @brief (소비자) 최대 maxCount 개를 꺼내 pOut 에 순서대로 복사
+ * @return 꺼낸 원소 수 (0 = 빔)
+ */
+uint32_t SpscQueue_PopBatch(SpscQueue_t *pQ, void *pOut, uint32_t maxCount);
+
+/**
+ * @brief 현재 원소 수 (동시 실행 중에는 근사값)
+ */
+uint32_t SpscQueue_Count(const SpscQueue_t *pQ);
+
+/**
+ * @brief 용량
+ */
+uint32_t SpscQueue_Capacity(const SpscQueue_t *pQ);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSC_QUEUE_H */
@@ -0,0 +1,90 @@
+/****************************************************************************
+ * stanley_lut.h
+ *
+ * - Stanley 횡방향 보정각 atan(k * cte / vx) [°] 의 (cte, vx) 룩업 테이블
+ * - 테이블 크기/해상도/허용 오차는 컴파일 타임 매크로 (빌드 시 -D 로 변경 가능)
+ * - 값은 StanleyLut_Init()에서 1회 생성 (C에는 constexpr 없음, pthread_once -> 여러 스레드 동시 호출 안전) + 오차 검증
+ * - 테이블 범위 밖 / 초기화 전 / 오차 초과 시 정확한 제어 법칙으로 fallback
+ ****************************************************************************/
+#ifndef STANLEY_LUT_H
+#define STANLEY_LUT_H
+
+#include "adas_shared.h"  /* LFA_STANLEY_GAIN, LFA_MAX_STEERING_ANGLE */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 횡방향 오차(cte) 축 [m] : LS_Lane_Offset 범위, 격자 수로 해상도 결정 */
+#ifndef STANLEY_LUT_CTE_MIN
+#define STANLEY_LUT_CTE_MIN    (-2.0f)
+#endif
+#ifndef STANLEY_LUT_CTE_MAX
+#define STANLEY_LUT_CTE_MAX    (2.0f)
+#endif
+#ifndef STANLEY_LUT_CTE_COUNT
+#define STANLEY_LUT_CTE_COUNT  41     /* 0.1 m 간격 */
+#endif
+
+/* 종방향 속도(vx) 범위 [m/s] : 고속 모드(>= 16.67 m/s) 포함
+ * - 격자는 1/vx 에 대해 균일 (atan 인자 k*cte/vx 가 1/vx 에 선형 -> 보간 오차 최소) */
+#ifndef STANLEY_LUT_VX_MIN
+#define STANLEY_LUT_VX_MIN     (10.0f)
+#endif
+#ifndef STANLEY_LUT_VX_MAX
+#define STANLEY_LUT_VX_MAX     (50.0f)
+#endif
+#ifndef STANLEY_LUT_VX_COUNT
+#define STANLEY_LUT_VX_COUNT   21
+#endif
+
+/* 허용 보간 오차 [°] : 초기화 시 격자 중간점에서 실측, 초과하면 테이블 미사용 */
+#ifndef STANLEY_LUT_MAX_ERR_DEG
+#define STANLEY_LUT_MAX_ERR_DEG  (0.01f)
+#endif
+
+/**
+ * @brief 테이블 생성 + 오차 검증 (여러 번 / 여러 스레드에서 호출해도 1회만 생성, 생성 완료 후 반환)
+ * @return 0  : 테이블 사용
+ *         -1 : 실측 오차 > STANLEY_LUT_MAX_ERR_DEG -> 테이블 비활성 (정확한 법칙 사용)
+ */
+int StanleyLut_Init(void);
+
+/**
+ * @brief 테이블 사용 여부 (StanleyLut_Init 성공 시 1)
+ */
+int StanleyLut_IsActive(void);
+
+/**
+ * @brief 생성 시 실측한 최대 보간 오차 [°] (초기화 전 -1)
+ */
+float StanleyLut_MeasuredMaxErrDeg(void);
+
+/**
+ * @brief Stanley 횡방향 보정각 atan(k * cte / vx) [°]
+ *  - vx < 0.1 m/s 는 0.1로 보호 (calculate_steer_in_high_speed_stanley와 동일)
+ * @param cte : 횡방향 오차 [m]
+ * @param vx  : 종방향 속도 [m/s]
+ */
+float StanleyLut_OffsetDeg(float cte, float vx);
+
+/**
+ * @brief Stanley 조향각 배치 계산 (튜닝/다수 차량 시뮬레이션용)
+ *  - pOutDeg[i] = clamp(pHeadingErr[i] + OffsetDeg(pCte[i], pVx[i]), ±LFA_MAX_STEERING_ANGLE)
+ *  - SSE2 빌드 시 4개씩 인덱스/보간 가중치/보간을 벡터로 계산, 범위 밖 요소만 정확한 법칙
+ * @param pHeadingErr : (입력) heading 오차 [°]
+ * @param pCte        : (입력) 횡방향 오차 [m]
+ * @param pVx         : (입력) 종방향 속도 [m/s]
+ * @param pOutDeg     : (출력) 조향각 [°]
+ */
+void StanleyLut_Steer_Batch(const float *pHeadingErr,
+                            const float *pCte,
+                            const float *pVx,
+                            float       *pOutDeg,
+                            int          count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STANLEY_LUT_H */
@@ -0,0 +1,75 @@
+/****************************************************************************
+ * traffic_gen.h
+ *
+ * - 고밀도 교통 객체 목록 생성기 (Target Selection 부하 시험 / 벤치마크 / 시나리오 입력)
+ *   : 자차 기준 도로 구간 [-Range_Behind, Range_Ahead] 에 ObjectData_t 목록 생성
+ *   : 차로 배치 (같은 방향 Lane_Count 개 + 좌측 대향 차로), 객체 종류 비율, 끼어들기 / 대향 / 정지 비율
+ *   : 센서 잡음 = 위치 / 속도 / 방향 근사 가우시안 (AdasRng_NormalFastF, 초월 함수 없음)
+ * - 결정적: (Seed, frame) 이 같으면 같은 목록 (프레임마다 독립 난수 흐름 -> 병렬 생성 가능)
+ *   : 프레임 간 객체 추적 연속성은 없음 (매 프레임 새 스냅숏)
+ * - 좌표: X = 전방 [m], Y = 좌측 [m] (자차 차로 중심 0), Heading [°] (진행 방향 0, 대향 180)
+ *   속도는 절대 속도 (Target Selection 입력 규약)
+ ****************************************************************************/
+#ifndef TRAFFIC_GEN_H
+#define TRAFFIC_GEN_H
+
+#include <stdint.h>
+#include "adas_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRAFFIC_GEN_TYPE_COUNT  4   /* OBJTYPE_CAR ~ OBJTYPE_MOTORCYCLE */
+
+/**
+ * @brief 생성 설정
+ *  - 객체 수 = Object_Count (> 0) 또는 Density * 전체 차로 수 * 구간 길이 [km] (반올림)
+ *  - 보행자: 가장 오른쪽 차로 바깥 (갓길/보도), 자전거: 가장 오른쪽 차로 우측 가장자리
+ *  - 차량 / 이륜차: 임의 차로 중심 부근, Oncoming_Rate 비율은 대향 차로 (Oncoming_Lane_Count > 0 일 때)
+ */
+typedef struct
+{
+    uint64_t Seed;
+    int   Object_Count;                        /* > 0 이면 밀도 대신 고정 개수 */
+    float Density;                             /* 차로 km 당 객체 수 (기본 40) */
+    int   Lane_Count;                          /* 같은 방향 차로 수 (기본 3) */
+    int   Ego_Lane;                            /* 자차 차로 (0 = 가장 왼쪽, 기본 1) */
+    int   Oncoming_Lane_Count;                 /* 대향 차로 수 (기본 2) */
+    float Lane_Width;                          /* [m] (기본 3.5) */
+    float Range_Ahead;                         /* [m] (기본 200) */
+    float Range_Behind;                        /* [m] (기본 50) */
+    float Ego_Speed;                           /* 주변 차량 평균 속도 기준 [m/s] (기본 20) */
+    float Speed_Sigma;                         /* 차량 속도 표준편차 [m/s] (기본 3) */
+    float Type_Mix[TRAFFIC_GEN_TYPE_COUNT];    /* 종류 가중치 (합 > 0, 기본 0.85 / 0.05 / 0.05 / 0.05) */
+    float Cut_In_Rate;                         /* 자차 옆 차로 차량 중 끼어들기 비율 (기본 0.1) */
+    float Oncoming_Rate;                       /* 차량 / 이륜차 중 대향 차로 비율 (기본 0.2) */
+    float Stopped_Rate;                        /* 정지 비율 (기본 0.05) */
+    float Pos_Noise;                           /* 위치 잡음 표준편차 [m] (기본 0.2) */
+    float Vel_Noise;                           /* 속도 잡음 표준편차 [m/s] (기본 0.3) */
+    float Heading_Noise;                       /* 방향 잡음 표준편차 [°] (기본 1) */
+} TrafficGenConfig_t;
+
+/**
+ * @brief 기본 설정
+ */
+void TrafficGen_DefaultConfig(TrafficGenConfig_t *pConfig);
+
+/**
+ * @brief 설정에 따른 생성 객체 수 (설정 오류면 -1)
+ */
+int TrafficGen_Count(const TrafficGenConfig_t *pConfig);
+
+/**
+ * @brief frame 번째 객체 목록 생성 (Object_ID = 1 ~ n, Object_Cell_ID = 0)
+ * @param capacity : pObjs 크기 (생성 수가 더 많으면 앞에서 capacity 개만)
+ * @return 생성 개수, -1 : 인자 / 설정 오류
+ */
+int TrafficGen_Generate(const TrafficGenConfig_t *pConfig, uint64_t frame,
+                        ObjectData_t *pObjs, int capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRAFFIC_GEN_H */
@@ -0,0 +1,77 @@
+/****************************************************************************
+ * triple_buffer.h
+ *
+ * - 단일 생산자 / 단일 소비자 최신값(latest-value) 교환용 3중 버퍼
+ * - 생산자/소비자 모두 wait-free (원자적 exchange 1회, 잠금/대기 없음)
+ *   : 생산자는 항상 자기 슬롯에 쓰고, 소비자는 항상 자기 슬롯을 읽음
+ *   : 가운데(middle) 슬롯만 원자적으로 교환 -> 읽는 중인 슬롯은 덮어쓰지 않음
+ * - 소비자가 느리면 중간 프레임은 버려지고 최신 프레임만 전달됨
+ * - 슬롯 저장 공간은 호출자가 제공 (3 * Slot_Size 바이트, 동적 할당 없음)
+ * - GCC/Clang __atomic 내장 함수 사용 (헤더는 C++ 테스트에서도 포함 가능)
+ ****************************************************************************/
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRIPLE_BUFFER_SLOTS       3
+#define TRIPLE_BUFFER_CACHE_LINE  64
+
+/**
+ * @brief 3중 버퍼
+ *  - State    : bit0~1 = middle 슬롯 인덱스, bit2 = 새 데이터(fresh) 플래그
+ *  - Write_Idx: 생산자 전용, Read_Idx: 소비자 전용 (서로 다른 캐시 라인)
+ */
+typedef struct
+{
+    unsigned char *pSlots;
+    size_t         Slot_Size;
+    unsigned       State;
+    char           Pad0[TRIPLE_BUFFER_CACHE_LINE];
+    unsigned       Write_Idx;
+    char           Pad1[TRIPLE_BUFFER_CACHE_LINE];
+    unsigned       Read_Idx;
+} TripleBuffer_t;
+
+/**
+ * @brief 초기화
+ * @param pStorage : 3 * slotSize 바이트 (슬롯 내용은 변경하지 않음)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int TripleBuffer_Init(TripleBuffer_t *pTb, void *pStorage, size_t slotSize);
+
+/**
+ * @brief (생산자) 현재 쓰기 슬롯
+ */
+void *TripleBuffer_WriteSlot(TripleBuffer_t *pTb);
+
+/**
+ * @brief (생산자) 쓰기 슬롯 게시 -> 새 쓰기 슬롯으로 교체 (wait-free)
+ */
+void TripleBuffer_Publish(TripleBuffer_t *pTb);
+
+/**
+ * @brief (소비자) 새 데이터가 있으면 읽기 슬롯으로 가져옴 (wait-free)
+ * @return 1 : 새 데이터 수신, 0 : 새 데이터 없음 (읽기 슬롯 유지)
+ */
+int TripleBuffer_Acquire(TripleBuffer_t *pTb);
+
+/**
+ * @brief (소비자) 현재 읽기 슬롯 (다음 Acquire 전까지 유효)
+ */
+void *TripleBuffer_ReadSlot(TripleBuffer_t *pTb);
+
+/**
+ * @brief 새 데이터 게시 여부 (소비자가 대기 판단용, 상태 변경 없음)
+ */
+int TripleBuffer_HasFresh(const TripleBuffer_t *pTb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRIPLE_BUFFER_H */
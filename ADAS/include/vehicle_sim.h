@@ -0,0 +1,171 @@
+/****************************************************************************
+ * vehicle_sim.h
+ *
+ * - 폐루프(closed-loop) 시험용 내장 차량 플랜트 모델 (CARLA 대체, 오프라인/실시간보다 빠르게)
+ *   : VehicleControl_t(throttle/brake/steer) 입력 -> GPS / IMU / 차선 / 선행차 입력 합성
+ * - 종방향: 명령 가속도 1차 지연(actuator lag) + 구름 저항 + 공기 저항, 후진 없음
+ * - 횡방향: 자전거(bicycle) 모델
+ *   : KINEMATIC - 기구학 모델 (횡속도/요레이트가 기구학 값을 짧은 지연으로 추종)
+ *   : DYNAMIC   - 선형 타이어 동역학 모델, 저속(Blend_Speed_Lo ~ Hi)에서 기구학 모델과 혼합
+ *   : 조향 명령도 1차 지연, steer +1 = 오른쪽 최대 조향 (CARLA 규약)
+ * - 고정 스텝 RK4 적분 (명령은 스텝 동안 유지, zero-order hold)
+ * - 다수 차량 배치: 상태는 SoA(항목별 배열), 8대 묶음 단위 적분
+ *   (sin/cos = AdasMath SSE2 배치, 나머지 미분 수식은 비교 없는 루프 -> -O2 자동 벡터화)
+ * - 좌표계: 월드 x 전방(시작 방향) / y 좌측, heading 반시계 +, 도로는 원점에서 x 방향으로 출발
+ *   : 도로 곡률 k [1/m] (+ = 좌회전, 0 = 직선), 차선 중심 = 도로 중심선
+ *   : Lane_Offset = 차선 중심 기준 자차 횡위치 (+ = 좌측), 곡선 도로는 원호 반 바퀴 이내에서 유효
+ *   : 선행차는 도로를 따라 Lead_Speed 로 주행 (횡위치 Lead_Offset), 객체 위치는 자차 기준 (x 전방 / y 좌측)
+ *   : 선행차 속도 / 횡위치는 Step 사이에 호출자가 바꿀 수 있음 (끼어들기 / 정지-출발 시나리오)
+ ****************************************************************************/
+#ifndef VEHICLE_SIM_H
+#define VEHICLE_SIM_H
+
+#include <stdint.h>
+#include "adas_pipeline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 선행차 Object_ID */
+#define VEHICLE_SIM_LEAD_ID  1
+
+/**
+ * @brief 횡방향 모델
+ */
+typedef enum
+{
+    VEHICLE_SIM_KINEMATIC = 0,
+    VEHICLE_SIM_DYNAMIC
+} VehicleSimModel_e;
+
+/**
+ * @brief 차량 파라미터 (배치 전체 공통)
+ */
+typedef struct
+{
+    VehicleSimModel_e Model;
+    float Mass;                 /* [kg] */
+    float Yaw_Inertia;          /* [kg m^2] */
+    float Lf;                   /* 무게중심 ~ 앞축 [m] */
+    float Lr;                   /* 무게중심 ~ 뒤축 [m] */
+    float Cf;                   /* 앞 타이어 코너링 강성 (축 합) [N/rad] */
+    float Cr;                   /* 뒤 타이어 코너링 강성 (축 합) [N/rad] */
+    float Max_Accel;            /* throttle 1.0 명령 가속도 [m/s^2] (Arbitration 정규화와 동일) */
+    float Max_Decel;            /* brake 1.0 명령 감속도 [m/s^2] */
+    float Accel_Tau;            /* 종방향 액추에이터 시정수 [s] */
+    float Steer_Tau;            /* 조향 액추에이터 시정수 [s] */
+    float Max_Wheel_Angle;      /* steer 1.0 바퀴 조향각 [°] */
+    float Rolling_Accel;        /* 구름 저항 감속도 [m/s^2] */
+    float Drag_Coeff;           /* 공기 저항 0.5*rho*CdA/m [1/m] */
+    float Blend_Speed_Lo;       /* DYNAMIC: 이 속도 이하 기구학 [m/s] */
+    float Blend_Speed_Hi;       /* DYNAMIC: 이 속도 이상 동역학 [m/s] */
+    float Lane_Width;           /* [m] */
+    int   Substeps;             /* VehicleSim_Step 1회당 RK4 스텝 수 (>= 1) */
+} VehicleSimParams_t;
+
+/**
+ * @brief 차량 1대 초기 조건
+ */
+typedef struct
+{
+    float Speed;                /* 종방향 속도 [m/s] */
+    float Lane_Offset;          /* 차선 중심 기준 횡위치 [m] (+ = 좌측) */
+    float Heading;              /* 도로 방향 기준 heading [°] */
+    float Road_Curvature;       /* [1/m] (+ = 좌회전, 0 = 직선) */
+    float Lead_Gap;             /* 선행차 거리 (도로 중심선 길이) [m], <= 0 이면 선행차 없음 */
+    float Lead_Speed;           /* 선행차 속도 [m/s] */
+    float Lead_Offset;          /* 선행차 횡위치 (차선 중심 기준, + = 좌측) [m] */
+} VehicleSimInit_t;
+
+/**
+ * @brief 차량 배치 (SoA)
+ *  - 상태: X, Y [m], Psi [rad], Vx, Vy [m/s] (차체 기준), R [rad/s], Accel [m/s^2], Delta [rad] (+ = 좌)
+ *  - 명령: Accel_Cmd [m/s^2], Delta_Cmd [rad] (VehicleSim_ApplyControl 로 갱신, 다음 Step 동안 유지)
+ *  - 배열 길이는 Capacity (Count 를 벡터 폭 배수로 올림), 한 블록으로 할당
+ */
+typedef struct
+{
+    int      Count;
+    int      Capacity;
+    VehicleSimParams_t Params;
+    double   Time;              /* 시뮬레이션 시각 [s] */
+    uint64_t Steps;
+
+    float   *X;
+    float   *Y;
+    float   *Psi;
+    float   *Vx;
+    float   *Vy;
+    float   *R;
+    float   *Accel;
+    float   *Delta;
+    float   *Accel_Cmd;
+    float   *Delta_Cmd;
+    float   *Road_Curvature;
+    float   *Lead_S;            /* 선행차 도로 중심선 위치 [m] */
+    float   *Lead_Speed;        /* < 0 = 선행차 없음 */
+    float   *Lead_Offset;       /* 선행차 횡위치 [m] (+ = 좌측) */
+
+    void    *pBlock;
+} VehicleSimFleet_t;
+
+/**
+ * @brief 기본 파라미터 (중형 승용차, 동역학 모델, 10ms 스텝 1회)
+ */
+void VehicleSim_DefaultParams(VehicleSimParams_t *pParams);
+
+/**
+ * @brief 배치 생성 (모든 차량 = 직선 도로 정지 상태, 선행차 없음)
+ * @param pParams : NULL 이면 기본 파라미터
+ * @return 0 : 성공, -1 : 인자 오류 / 메모리 부족
+ */
+int VehicleSim_Init(VehicleSimFleet_t *pFleet, int count, const VehicleSimParams_t *pParams);
+
+/**
+ * @brief 배치 해제
+ */
+void VehicleSim_Destroy(VehicleSimFleet_t *pFleet);
+
+/**
+ * @brief 차량 1대 초기 조건 설정 (도로 시작점, 명령/액추에이터 상태 0)
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int VehicleSim_SetVehicle(VehicleSimFleet_t *pFleet, int index, const VehicleSimInit_t *pInit);
+
+/**
+ * @brief 제어 명령 적용 (Arbitration 출력, 다음 Step 부터 유효)
+ *  - 명령 가속도 = throttle * Max_Accel - brake * Max_Decel
+ *  - 명령 바퀴 조향각 = -steer * Max_Wheel_Angle (steer + = 오른쪽)
+ */
+void VehicleSim_ApplyControl(VehicleSimFleet_t *pFleet, int index, const VehicleControl_t *pControl);
+
+/**
+ * @brief 전 차량 dt 만큼 적분 (Substeps 회 RK4), 선행차 이동
+ */
+void VehicleSim_Step(VehicleSimFleet_t *pFleet, float dt);
+
+/**
+ * @brief 센서 입력 합성 (시각 / GPS / IMU / 차선 / 선행차 객체)
+ *  - GPS 속도 = 차체 기준 속도, IMU = 차체 기준 가속도 + 요레이트 [°/s]
+ *  - Lane_Curvature = 곡률 반경 [m] (직선 0), Lane_Curve_Direction 우 = +1 / 좌 = -1
+ * @return 0 : 성공, -1 : 인자 오류
+ */
+int VehicleSim_Sense(const VehicleSimFleet_t *pFleet, int index, AdasFrameInput_t *pIn);
+
+/**
+ * @brief 차선 기준 위치 (횡위치 [m], 도로 방향 [rad], 도로 중심선 위치 [m])
+ */
+void VehicleSim_LanePose(const VehicleSimFleet_t *pFleet, int index,
+                         float *pOffset, float *pRoadHeading, float *pStation);
+
+/**
+ * @brief 선행차까지 중심선 거리 [m] (선행차 없으면 +Inf)
+ */
+float VehicleSim_LeadGap(const VehicleSimFleet_t *pFleet, int index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VEHICLE_SIM_H */
@@ -1,24 +1,119 @@
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
 #include "acc.h"
+#include "gain_schedule.h"
 
-/* Distance PID 적분, 과거오차 저장 */
-static float s_distIntegral  = 0.0f;
-static float s_distPrevError = 0.0f;
+/* 기본 인스턴스 상태: calculate_accel_for_*_pid (단일 인스턴스 API) 용
+ * - Distance/Speed PID 적분, 과거오차, 이전 시간(거리 PID Delta Time 계산용) */
+static ACC_State_t s_accState;
 
-/* Speed PID 적분, 과거오차 저장 */
-static float s_speedIntegral  = 0.0f;
-static float s_speedPrevError = 0.0f;
+/* 목표속도 대비 속도 오차 (곡선 차선이면 15 m/s 제한) */
+static float speed_error(const ACC_Ego_Data_t *pEgoData, const Lane_Data_t *pLaneData)
+{
+    /* 기본 목표 속도: 80 km/h = 22.22 m/s */
+    float baseTargetSpeed = 22.22f;
+
+    /* 곡선 차선이면 속도 제한: 15 m/s */
+    if(pLaneData->LS_Is_Curved_Lane)
+    {
+        if(baseTargetSpeed > 15.0f)
+        {
+            baseTargetSpeed = 15.0f;
+        }
+    }
+
+    /* 오차 = 목표속도 - 현재속도 */
+    return baseTargetSpeed - pEgoData->Ego_Velocity_X;
+}
+
+/* 기준거리 대비 거리 오차 */
+static float distance_error(const ACC_Target_Data_t *pAccTargetData)
+{
+    /* 기준거리 = 40m (설계서에서) */
+    float targetDist = 40.0f;
+    return targetDist - pAccTargetData->ACC_Target_Distance;
+}
+
+/* 거리 PID 1스텝 */
+static float distance_pid_step(ACC_State_t             *pState,
+                               const ACC_Target_Data_t *pAccTargetData,
+                               const ACC_Ego_Data_t    *pEgoData,
+                               float                    current_time)
+{
+    /* Delta Time 계산 */
+    float deltaTime = current_time - pState->Prev_Time_Distance;
+    if(deltaTime < 0.0f)  deltaTime = 0.01f; /* fallback */
+    pState->Prev_Time_Distance = current_time;
+
+    float distErr = distance_error(pAccTargetData);
+
+    /* PID Gains : Ego 속도 기준 스케줄 */
+    PID_Gains_t g;
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_DISTANCE, pEgoData->Ego_Velocity_X, 0.0f, &g);
+
+    pState->Dist_Integral  += distErr * deltaTime;
+    float dErr              = (distErr - pState->Dist_Prev_Error) / (deltaTime + 1e-5f);
+    pState->Dist_Prev_Error = distErr;
+
+    float accelDist = (g.Kp * distErr) + (g.Ki * pState->Dist_Integral) + (g.Kd * dErr);
+
+    /* Stop 모드의 경우 (정지 유지) / Stopped 타겟과 ego도 거의 0이면 강제 제동 */
+    if((pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED) &&
+       (pEgoData->Ego_Velocity_X < 0.5f))
+    {
+        /* -3.0 => 강제정지 */
+        accelDist = -3.0f;
+    }
+
+    return accelDist;
+}
+
+/* 속도 PID 1스텝 */
+static float speed_pid_step(ACC_State_t          *pState,
+                            const ACC_Ego_Data_t *pEgoData,
+                            const Lane_Data_t    *pLaneData,
+                            float                 delta_time)
+{
+    float speedErr = speed_error(pEgoData, pLaneData);
+
+    /* PID 게인 : Ego 속도 기준 스케줄 */
+    PID_Gains_t g;
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, pEgoData->Ego_Velocity_X, 0.0f, &g);
+
+    pState->Speed_Integral  += speedErr * delta_time;
+    float dErr               = (speedErr - pState->Speed_Prev_Error) / (delta_time + 1e-5f);
+    pState->Speed_Prev_Error = speedErr;
+
+    return (g.Kp * speedErr) + (g.Ki * pState->Speed_Integral) + (g.Kd * dErr);
+}
+
+/*
+ * 비활성 -> 활성 전환 시 적분항 역산 (bumpless transfer)
+ *  - 다음 PID 스텝 출력 = Kp*e + Ki*(I + e*dt) + Kd*0 이 직전 출력과 같도록 I 설정
+ *  - Ki 기여분은 [MIN_ACCEL, MAX_ACCEL]로 제한 (역산 발산 방지)
+ */
+static float back_calculate_integral(float prevOutput, float err, float dt, const PID_Gains_t *pGains)
+{
+    if(pGains->Ki < 1e-6f)
+    {
+        return 0.0f;
+    }
 
-/* 이전 시간 저장(예: 거리 PID에서 Delta Time 계산용) */
-static float s_prevTimeDistance = 0.0f;
+    float iTerm = prevOutput - (pGains->Kp * err);
+    if(iTerm > MAX_ACCEL) iTerm = MAX_ACCEL;
+    if(iTerm < MIN_ACCEL) iTerm = MIN_ACCEL;
+
+    return (iTerm / pGains->Ki) - (err * dt);
+}
 
 /**
  * @brief 2.2.4.1.1 ACC 모드 결정
  */
 ACC_Mode_e acc_mode_selection(
     const ACC_Target_Data_t *pAccTargetData,
-    const Ego_Data_t        *pEgoData,
+    const ACC_Ego_Data_t    *pEgoData,
     const Lane_Data_t       *pLaneData
 )
 {
@@ -68,7 +163,7 @@ ACC_Mode_e acc_mode_selection(
 float calculate_accel_for_distance_pid(
     ACC_Mode_e               accMode,
     const ACC_Target_Data_t *pAccTargetData,
-    const Ego_Data_t        *pEgoData,
+    const ACC_Ego_Data_t    *pEgoData,
     float                    current_time
 )
 {
@@ -84,42 +179,16 @@ float calculate_accel_for_distance_pid(
         return 0.0f;
     }
 
-    /* Delta Time 계산 (예: current_time ms단위 가정) */
-    float deltaTime = current_time - s_prevTimeDistance;
-    if(deltaTime < 0.0f)  deltaTime = 0.01f; /* fallback */
-    s_prevTimeDistance = current_time;
-
-    /* 기준거리 = 40m (설계서에서) */
-    float targetDist = 40.0f;
-    float distErr    = targetDist - pAccTargetData->ACC_Target_Distance;
-
-    /* PID Gains */
-    float Kp = 0.4f, Ki = 0.05f, Kd = 0.1f;
-
-    s_distIntegral     += distErr * deltaTime;
-    float dErr          = (distErr - s_distPrevError) / (deltaTime + 1e-5f);
-    s_distPrevError     = distErr;
-
-    float accelDist = (Kp * distErr) + (Ki * s_distIntegral) + (Kd * dErr);
-
-    /* Stop 모드의 경우 (정지 유지) / Stopped 타겟과 ego도 거의 0이면 강제 제동 */
-    if((pAccTargetData->ACC_Target_Status == ACC_TARGET_STOPPED) &&
-       (pEgoData->Ego_Velocity_X < 0.5f))
-    {
-        /* -3.0 => 강제정지 */
-        accelDist = -3.0f;
-    }
-
-    return accelDist;
+    return distance_pid_step(&s_accState, pAccTargetData, pEgoData, current_time);
 }
 
 /**
  * @brief 2.2.4.1.3 속도 PID 계산
  */
 float calculate_accel_for_speed_pid(
-    const Ego_Data_t  *pEgoData,
-    const Lane_Data_t *pLaneData,
-    float              delta_time
+    const ACC_Ego_Data_t *pEgoData,
+    const Lane_Data_t    *pLaneData,
+    float                 delta_time
 )
 {
     if((pEgoData == NULL) || (pLaneData == NULL) || (delta_time <= 0.0f))
@@ -127,33 +196,7 @@ float calculate_accel_for_speed_pid(
         return 0.0f;
     }
 
-    /* 기본 목표 속도: 80 km/h = 22.22 m/s */
-    float baseTargetSpeed = 22.22f;
-
-    /* 곡선 차선이면 속도 제한: 15 m/s */
-    if(pLaneData->LS_Is_Curved_Lane)
-    {
-        if(baseTargetSpeed > 15.0f)
-        {
-            baseTargetSpeed = 15.0f;
-        }
-    }
-
-    /* 오차 = 목표속도 - 현재속도 */
-    float speedErr = baseTargetSpeed - pEgoData->Ego_Velocity_X;
-
-    /* PID 게인 */
-    float Kp = 0.5f;
-    float Ki = 0.1f;
-    float Kd = 0.05f;
-
-    s_speedIntegral      += speedErr * delta_time;
-    float dErr            = (speedErr - s_speedPrevError) / (delta_time + 1e-5f);
-    s_speedPrevError      = speedErr;
-
-    float accelSpeed = (Kp * speedErr) + (Ki * s_speedIntegral) + (Kd * dErr);
-
-    return accelSpeed;
+    return speed_pid_step(&s_accState, pEgoData, pLaneData, delta_time);
 }
 
 /**
@@ -184,3 +227,99 @@ float acc_output_selection(
 
     return 0.0f;
 }
+
+/**
+ * @brief ACC 상태 초기화
+ */
+void acc_init_state(ACC_State_t *pState)
+{
+    if(pState == NULL)
+    {
+        return;
+    }
+
+    memset(pState, 0, sizeof(*pState));
+    pState->Prev_Mode = ACC_MODE_SPEED;
+}
+
+void acc_get_default_state(ACC_State_t *pState)
+{
+    if(pState != NULL)
+    {
+        *pState = s_accState;
+    }
+}
+
+void acc_set_default_state(const ACC_State_t *pState)
+{
+    if(pState != NULL)
+    {
+        s_accState = *pState;
+    }
+}
+
+/**
+ * @brief 모드 디스패치 ACC 계산 (활성 모드의 PID만 계산)
+ */
+float acc_calculate_accel(
+    ACC_State_t             *pState,
+    ACC_Mode_e               accMode,
+    const ACC_Target_Data_t *pAccTargetData,
+    const ACC_Ego_Data_t    *pEgoData,
+    const Lane_Data_t       *pLaneData,
+    float                    current_time,
+    float                    delta_time
+)
+{
+    if((pState == NULL) || (pAccTargetData == NULL) || (pEgoData == NULL) ||
+       (pLaneData == NULL) || (delta_time <= 0.0f))
+    {
+        return 0.0f;
+    }
+
+    /* 모드 전환 감지: 새로 활성화되는 PID의 상태만 맞춤
+     *  - 첫 주기(초기화 직후)도 전환으로 취급: 과거 오차 / 이전 시각을 현재 기준으로 시드, 적분 0
+     *    (시드 없이 시작하면 거리 PID Delta Time = current_time - 0 -> 적분 / 미분 폭주)
+     *  - 이후 모드 전환: 적분항을 직전 출력 기준으로 역산 (bumpless) */
+    bool firstCycle  = (pState->Is_Initialized == 0);
+    bool modeChanged = firstCycle || (accMode != pState->Prev_Mode);
+    PID_Gains_t g;
+
+    float accelOut = 0.0f;
+    if(accMode == ACC_MODE_SPEED)
+    {
+        if(modeChanged)
+        {
+            float err = speed_error(pEgoData, pLaneData);
+            GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, pEgoData->Ego_Velocity_X, 0.0f, &g);
+            pState->Speed_Integral   = firstCycle ? 0.0f
+                                                  : back_calculate_integral(pState->Prev_Accel, err, delta_time, &g);
+            pState->Speed_Prev_Error = err;
+        }
+        accelOut = speed_pid_step(pState, pEgoData, pLaneData, delta_time);
+    }
+    else if(accMode == ACC_MODE_DISTANCE)
+    {
+        if(modeChanged)
+        {
+            float err = distance_error(pAccTargetData);
+            GainSchedule_GetPidGains(GAIN_SCHED_ACC_DISTANCE, pEgoData->Ego_Velocity_X, 0.0f, &g);
+            pState->Dist_Integral      = firstCycle ? 0.0f
+                                                    : back_calculate_integral(pState->Prev_Accel, err, delta_time, &g);
+            pState->Dist_Prev_Error    = err;
+            pState->Prev_Time_Distance = current_time - delta_time;
+        }
+        accelOut = distance_pid_step(pState, pAccTargetData, pEgoData, current_time);
+    }
+    else
+    {
+        /* Stop 모드: 정지 유지 (PID 계산 없음) */
+        accelOut = 0.0f;
+    }
+
+    pState->Prev_Mode      = accMode;
+    pState->Prev_Accel     = accelOut;
+    pState->Is_Initialized = 1;
+
+    return accelOut;
+}
@@ -0,0 +1,508 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* strtok_r */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "adas_bench_stats.h"
+
+static const char *const s_verdictNames[] = {
+    "same", "REGRESSION", "improved", "insufficient", "missing"
+};
+
+const char *AdasBench_VerdictName(AdasBenchVerdict_e verdict)
+{
+    if((unsigned)verdict > ADAS_BENCH_MISSING)
+        return "?";
+    return s_verdictNames[verdict];
+}
+
+static int cmp_double(const void *pA, const void *pB)
+{
+    double a = *(const double *)pA;
+    double b = *(const double *)pB;
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+static double sorted_median(const double *pSorted, int count)
+{
+    if((count & 1) != 0)
+        return pSorted[count / 2];
+    return 0.5 * (pSorted[count / 2 - 1] + pSorted[count / 2]);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasBenchStats_Summarize
+ * ---------------------------------------------------------------------------*/
+int AdasBenchStats_Summarize(const double *pSamples, int count, AdasBenchSummary_t *pOut)
+{
+    if(!pOut)
+        return -1;
+    memset(pOut, 0, sizeof(*pOut));
+    if(!pSamples || (count <= 0) || (count > ADAS_BENCH_MAX_SAMPLES))
+        return -1;
+
+    double sorted[ADAS_BENCH_MAX_SAMPLES];
+    double dev[ADAS_BENCH_MAX_SAMPLES];
+    memcpy(sorted, pSamples, (size_t)count * sizeof(double));
+    qsort(sorted, (size_t)count, sizeof(double), cmp_double);
+
+    double med = sorted_median(sorted, count);
+    for(int i = 0; i < count; i++)
+        dev[i] = fabs(sorted[i] - med);
+    qsort(dev, (size_t)count, sizeof(double), cmp_double);
+
+    int p99 = (int)ceil(0.99 * (double)count) - 1;
+    if(p99 < 0) p99 = 0;
+
+    pOut->Count     = count;
+    pOut->Median_Ns = med;
+    pOut->Mad_Ns    = sorted_median(dev, count);
+    pOut->P99_Ns    = sorted[p99];
+    pOut->Min_Ns    = sorted[0];
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * Mann-Whitney U
+ *  - U_B = B 가 A 보다 큰 쌍 수 (+ 같은 쌍 0.5) = R_B - nB(nB+1)/2
+ *  - 정확 분포: U 의 경우의 수 = Gauss 이항 계수 [nA+nB, nA]_q 의 계수
+ *    (k = 1..nA 에 대해 (1 - q^(nB+k)) 곱 / (1 - q^k) 나눗셈, 각 단계가 정수 계수 다항식)
+ * ---------------------------------------------------------------------------*/
+static double exact_upper_tail(int nA, int nB, double uObs)
+{
+    static double poly[ADAS_BENCH_EXACT_MAX * ADAS_BENCH_EXACT_MAX + 1];
+    const int maxU = nA * nB;
+
+    memset(poly, 0, (size_t)(maxU + 1) * sizeof(double));
+    poly[0] = 1.0;
+    for(int k = 1; k <= nA; k++)
+    {
+        int up = nB + k;
+        for(int u = maxU; u >= up; u--)     /* x (1 - q^up) */
+            poly[u] -= poly[u - up];
+        for(int u = k; u <= maxU; u++)      /* / (1 - q^k) */
+            poly[u] += poly[u - k];
+    }
+
+    double total = 0.0;
+    double tail  = 0.0;
+    int    uMin  = (int)ceil(uObs - 1e-9);
+    for(int u = 0; u <= maxU; u++)
+    {
+        total += poly[u];
+        if(u >= uMin)
+            tail += poly[u];
+    }
+    return (total > 0.0) ? (tail / total) : 1.0;
+}
+
+typedef struct
+{
+    double Value;
+    int    From_B;
+} RankItem_t;
+
+static int cmp_rank_item(const void *pA, const void *pB)
+{
+    return cmp_double(&((const RankItem_t *)pA)->Value, &((const RankItem_t *)pB)->Value);
+}
+
+double AdasBenchStats_MannWhitneyGreater(const double *pA, int countA, const double *pB, int countB)
+{
+    if(!pA || !pB || (countA <= 0) || (countB <= 0) ||
+       (countA > ADAS_BENCH_MAX_SAMPLES) || (countB > ADAS_BENCH_MAX_SAMPLES))
+        return 1.0;
+
+    RankItem_t items[2 * ADAS_BENCH_MAX_SAMPLES];
+    int n = countA + countB;
+    for(int i = 0; i < countA; i++) { items[i].Value = pA[i]; items[i].From_B = 0; }
+    for(int j = 0; j < countB; j++) { items[countA + j].Value = pB[j]; items[countA + j].From_B = 1; }
+    qsort(items, (size_t)n, sizeof(RankItem_t), cmp_rank_item);
+
+    /* 평균 순위 + 동순위 보정항 sum(t^3 - t) */
+    double rankB  = 0.0;
+    double tieSum = 0.0;
+    for(int i = 0; i < n; )
+    {
+        int j = i + 1;
+        while((j < n) && (items[j].Value == items[i].Value))
+            j++;
+        double avgRank = 0.5 * (double)(i + 1 + j);   /* 순위 i+1 ~ j 의 평균 */
+        for(int k = i; k < j; k++)
+            if(items[k].From_B) rankB += avgRank;
+        double t = (double)(j - i);
+        tieSum += t * t * t - t;
+        i = j;
+    }
+
+    double uB = rankB - 0.5 * (double)countB * (double)(countB + 1);
+
+    if((tieSum == 0.0) && (countA <= ADAS_BENCH_EXACT_MAX) && (countB <= ADAS_BENCH_EXACT_MAX))
+        return exact_upper_tail(countA, countB, uB);
+
+    double nn   = (double)n;
+    double mean = 0.5 * (double)countA * (double)countB;
+    double var  = ((double)countA * (double)countB / 12.0) * ((nn + 1.0) - tieSum / (nn * (nn - 1.0)));
+    if(var <= 0.0)
+        return 1.0;
+
+    double z = (uB - mean - 0.5) / sqrt(var);
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+/* ----------------------------------------------------------------------------
+ * 결과 집합
+ * ---------------------------------------------------------------------------*/
+const AdasBenchSeries_t *AdasBench_Find(const AdasBenchSet_t *pSet, const char *name)
+{
+    if(!pSet || !name)
+        return NULL;
+    for(int i = 0; i < pSet->Count; i++)
+        if(strcmp(pSet->Series[i].Name, name) == 0)
+            return &pSet->Series[i];
+    return NULL;
+}
+
+/* 이름으로 찾고 없으면 추가 (가득 차면 NULL) */
+static AdasBenchSeries_t *find_or_add(AdasBenchSet_t *pSet, const char *name)
+{
+    AdasBenchSeries_t *pSeries = (AdasBenchSeries_t *)AdasBench_Find(pSet, name);
+    if(pSeries)
+        return pSeries;
+    if(pSet->Count >= ADAS_BENCH_MAX_SERIES)
+    {
+        pSet->Truncated = 1;
+        return NULL;
+    }
+    pSeries = &pSet->Series[pSet->Count++];
+    pSeries->Count = 0;
+    snprintf(pSeries->Name, sizeof(pSeries->Name), "%s", name);
+    return pSeries;
+}
+
+static void add_sample(AdasBenchSet_t *pSet, AdasBenchSeries_t *pSeries, double valueNs)
+{
+    if(pSeries->Count >= ADAS_BENCH_MAX_SAMPLES)
+    {
+        pSet->Truncated = 1;
+        return;
+    }
+    pSeries->Samples_Ns[pSeries->Count++] = valueNs;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if(!fp)
+        return NULL;
+
+    char  *pBuf = NULL;
+    long   size = -1;
+    if(fseek(fp, 0, SEEK_END) == 0)
+        size = ftell(fp);
+    if((size >= 0) && (fseek(fp, 0, SEEK_SET) == 0))
+        pBuf = (char *)malloc((size_t)size + 1);
+    if(pBuf && (fread(pBuf, 1, (size_t)size, fp) != (size_t)size))
+    {
+        free(pBuf);
+        pBuf = NULL;
+    }
+    if(pBuf)
+        pBuf[size] = '\0';
+    fclose(fp);
+    return pBuf;
+}
+
+/* ----------------------------------------------------------------------------
+ * Google Benchmark JSON
+ *  - "benchmarks": [ {평면 객체}, ... ] 만 해석 (키는 객체 안에서 검색)
+ * ---------------------------------------------------------------------------*/
+
+/* 문자열 끝 따옴표 위치 (이스케이프 건너뜀) */
+static const char *skip_string(const char *p)
+{
+    for(p++; *p && (*p != '"'); p++)
+        if((*p == '\\') && p[1]) p++;
+    return p;
+}
+
+/* [pBegin, pEnd) 객체 안에서 "key": 뒤 값 시작 위치 (없으면 NULL) */
+static const char *json_value(const char *pBegin, const char *pEnd, const char *key)
+{
+    size_t keyLen = strlen(key);
+    for(const char *p = pBegin; p < pEnd; p++)
+    {
+        if(*p != '"')
+            continue;
+        const char *q = skip_string(p);
+        if((q >= pEnd) || (*q != '"'))
+            return NULL;
+        if(((size_t)(q - p - 1) == keyLen) && (strncmp(p + 1, key, keyLen) == 0))
+        {
+            const char *v = q + 1;
+            while((v < pEnd) && ((*v == ' ') || (*v == '\t') || (*v == '\n') || (*v == '\r'))) v++;
+            if((v < pEnd) && (*v == ':'))
+            {
+                v++;
+                while((v < pEnd) && ((*v == ' ') || (*v == '\t') || (*v == '\n') || (*v == '\r'))) v++;
+                return v;
+            }
+        }
+        p = q;
+    }
+    return NULL;
+}
+
+static int json_string(const char *pBegin, const char *pEnd, const char *key, char *pOut, size_t outSize)
+{
+    const char *v = json_value(pBegin, pEnd, key);
+    if(!v || (*v != '"'))
+        return -1;
+    const char *q = skip_string(v);
+    size_t len = (size_t)(q - v - 1);
+    if(len >= outSize) len = outSize - 1;
+    memcpy(pOut, v + 1, len);
+    pOut[len] = '\0';
+    return 0;
+}
+
+static int json_number(const char *pBegin, const char *pEnd, const char *key, double *pOut)
+{
+    const char *v = json_value(pBegin, pEnd, key);
+    if(!v)
+        return -1;
+    char *endp;
+    double d = strtod(v, &endp);
+    if(endp == v)
+        return -1;
+    *pOut = d;
+    return 0;
+}
+
+static double unit_to_ns(const char *unit)
+{
+    if(strcmp(unit, "us") == 0) return 1.0e3;
+    if(strcmp(unit, "ms") == 0) return 1.0e6;
+    if(strcmp(unit, "s") == 0)  return 1.0e9;
+    return 1.0;
+}
+
+int AdasBench_LoadGbenchJson(const char *path, AdasBenchMetric_e metric, AdasBenchSet_t *pSet)
+{
+    if(!path || !pSet)
+        return -1;
+    pSet->Count     = 0;
+    pSet->Truncated = 0;
+
+    char *pText = read_file(path);
+    if(!pText)
+        return -1;
+
+    int rc = -1;
+    const char *p = strstr(pText, "\"benchmarks\"");
+    if(p)
+        p = strchr(p, '[');
+    if(p)
+    {
+        rc = 0;
+        p++;
+        for(;;)
+        {
+            while(*p && (*p != '{') && (*p != ']'))
+                p++;
+            if(*p != '{')
+                break;
+
+            /* 객체 끝 (문자열 안 괄호 무시) */
+            const char *pObj = p;
+            int depth = 0;
+            for(; *p; p++)
+            {
+                if(*p == '"') { p = skip_string(p); if(!*p) break; continue; }
+                if(*p == '{') depth++;
+                if((*p == '}') && (--depth == 0)) break;
+            }
+            if(!*p)
+            {
+                rc = -1;
+                break;
+            }
+            const char *pEndObj = p++;
+
+            char name[ADAS_BENCH_NAME_LEN];
+            char runType[32] = "iteration";
+            char unit[8]     = "ns";
+            double t;
+            (void)json_string(pObj, pEndObj, "run_type", runType, sizeof(runType));
+            if(strcmp(runType, "aggregate") == 0)
+                continue;
+            if((json_string(pObj, pEndObj, "run_name", name, sizeof(name)) != 0) &&
+               (json_string(pObj, pEndObj, "name", name, sizeof(name)) != 0))
+                continue;
+            if(json_number(pObj, pEndObj, (metric == ADAS_BENCH_METRIC_REAL) ? "real_time" : "cpu_time", &t) != 0)
+                continue;
+            (void)json_string(pObj, pEndObj, "time_unit", unit, sizeof(unit));
+
+            AdasBenchSeries_t *pSeries = find_or_add(pSet, name);
+            if(pSeries)
+                add_sample(pSet, pSeries, t * unit_to_ns(unit));
+        }
+    }
+
+    free(pText);
+    return rc;
+}
+
+/* ----------------------------------------------------------------------------
+ * 기준값 CSV
+ * ---------------------------------------------------------------------------*/
+int AdasBench_SaveBaseline(const char *path, const AdasBenchSet_t *pSet)
+{
+    if(!path || !pSet)
+        return -1;
+
+    FILE *fp = fopen(path, "w");
+    if(!fp)
+        return -1;
+
+    fprintf(fp, "name,count,median_ns,mad_ns,p99_ns,samples_ns\n");
+    for(int i = 0; i < pSet->Count; i++)
+    {
+        const AdasBenchSeries_t *pSeries = &pSet->Series[i];
+        AdasBenchSummary_t s;
+        if(AdasBenchStats_Summarize(pSeries->Samples_Ns, pSeries->Count, &s) != 0)
+            continue;
+
+        fprintf(fp, "%s,%d,%.17g,%.17g,%.17g,", pSeries->Name, s.Count, s.Median_Ns, s.Mad_Ns, s.P99_Ns);
+        for(int k = 0; k < pSeries->Count; k++)
+            fprintf(fp, "%s%.17g", (k == 0) ? "" : " ", pSeries->Samples_Ns[k]);
+        fprintf(fp, "\n");
+    }
+
+    int err = ferror(fp);
+    if((fclose(fp) != 0) || err)
+        return -1;
+    return 0;
+}
+
+int AdasBench_LoadBaseline(const char *path, AdasBenchSet_t *pSet)
+{
+    if(!path || !pSet)
+        return -1;
+    pSet->Count     = 0;
+    pSet->Truncated = 0;
+
+    char *pText = read_file(path);
+    if(!pText)
+        return -1;
+
+    int rc = 0;
+    int lineNo = 0;
+    char *pSave = NULL;
+    for(char *pLine = strtok_r(pText, "\r\n", &pSave); pLine; pLine = strtok_r(NULL, "\r\n", &pSave))
+    {
+        if(lineNo++ == 0)
+        {
+            if(strncmp(pLine, "name,", 5) != 0) { rc = -1; break; }
+            continue;
+        }
+
+        /* name,count,median,mad,p99,samples -> 이름 뒤 5번째 쉼표 이후가 표본 */
+        char *pComma = strchr(pLine, ',');
+        char *pSamples = pComma;
+        for(int c = 0; (c < 4) && pSamples; c++)
+            pSamples = strchr(pSamples + 1, ',');
+        if(!pComma || !pSamples) { rc = -1; break; }
+        *pComma = '\0';
+
+        AdasBenchSeries_t *pSeries = find_or_add(pSet, pLine);
+        if(!pSeries)
+            continue;
+
+        char *p = pSamples + 1;
+        for(;;)
+        {
+            char *endp;
+            double v = strtod(p, &endp);
+            if(endp == p)
+                break;
+            add_sample(pSet, pSeries, v);
+            p = endp;
+        }
+    }
+
+    free(pText);
+    return rc;
+}
+
+/* ----------------------------------------------------------------------------
+ * 비교
+ * ---------------------------------------------------------------------------*/
+void AdasBench_CompareSeries(const AdasBenchSeries_t *pBase, const AdasBenchSeries_t *pNew,
+                             double alpha, double thresholdPct, AdasBenchCompare_t *pOut)
+{
+    if(!pOut)
+        return;
+
+    memset(pOut, 0, sizeof(*pOut));
+    pOut->P_Slower = 1.0;
+    pOut->P_Faster = 1.0;
+    const AdasBenchSeries_t *pAny = pBase ? pBase : pNew;
+    if(pAny)
+        snprintf(pOut->Name, sizeof(pOut->Name), "%s", pAny->Name);
+
+    if(!pBase || !pNew)
+    {
+        pOut->Verdict = ADAS_BENCH_MISSING;
+        if(pBase) (void)AdasBenchStats_Summarize(pBase->Samples_Ns, pBase->Count, &pOut->Base);
+        if(pNew)  (void)AdasBenchStats_Summarize(pNew->Samples_Ns, pNew->Count, &pOut->New);
+        return;
+    }
+
+    (void)AdasBenchStats_Summarize(pBase->Samples_Ns, pBase->Count, &pOut->Base);
+    (void)AdasBenchStats_Summarize(pNew->Samples_Ns, pNew->Count, &pOut->New);
+    if(pOut->Base.Median_Ns > 0.0)
+        pOut->Delta_Pct = 100.0 * (pOut->New.Median_Ns - pOut->Base.Median_Ns) / pOut->Base.Median_Ns;
+
+    if((pBase->Count < ADAS_BENCH_MIN_SAMPLES) || (pNew->Count < ADAS_BENCH_MIN_SAMPLES))
+    {
+        pOut->Verdict = ADAS_BENCH_INSUFFICIENT;
+        return;
+    }
+
+    pOut->P_Slower = AdasBenchStats_MannWhitneyGreater(pBase->Samples_Ns, pBase->Count,
+                                                       pNew->Samples_Ns, pNew->Count);
+    pOut->P_Faster = AdasBenchStats_MannWhitneyGreater(pNew->Samples_Ns, pNew->Count,
+                                                       pBase->Samples_Ns, pBase->Count);
+
+    if((pOut->P_Slower < alpha) && (pOut->Delta_Pct > thresholdPct))
+        pOut->Verdict = ADAS_BENCH_REGRESSION;
+    else if((pOut->P_Faster < alpha) && (-pOut->Delta_Pct > thresholdPct))
+        pOut->Verdict = ADAS_BENCH_IMPROVEMENT;
+    else
+        pOut->Verdict = ADAS_BENCH_SAME;
+}
+
+int AdasBench_Compare(const AdasBenchSet_t *pBase, const AdasBenchSet_t *pNew,
+                      double alpha, double thresholdPct,
+                      AdasBenchCompare_t *pOut, int maxOut)
+{
+    if(!pBase || !pNew || !pOut || (maxOut <= 0))
+        return 0;
+
+    int n = 0;
+    for(int i = 0; (i < pBase->Count) && (n < maxOut); i++)
+    {
+        const AdasBenchSeries_t *pB = &pBase->Series[i];
+        AdasBench_CompareSeries(pB, AdasBench_Find(pNew, pB->Name), alpha, thresholdPct, &pOut[n++]);
+    }
+    for(int i = 0; (i < pNew->Count) && (n < maxOut); i++)
+    {
+        const AdasBenchSeries_t *pN = &pNew->Series[i];
+        if(!AdasBench_Find(pBase, pN->Name))
+            AdasBench_CompareSeries(NULL, pN, alpha, thresholdPct, &pOut[n++]);
+    }
+    return n;
+}
@@ -0,0 +1,155 @@
+#include <math.h>
+#include "adas_math.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ADAS_MATH_USE_SSE2 1
+#else
+#define ADAS_MATH_USE_SSE2 0
+#endif
+
+/*─────────────────────────────
+  SSE2 4-lane 구현
+  - _mm_cvtps_epi32 는 MXCSR 기본 반올림(최근접 짝수) = rintf 와 동일
+  - 분기 대신 비교 마스크 + and/andnot/or 로 선택
+─────────────────────────────*/
+#if ADAS_MATH_USE_SSE2
+
+static inline __m128 sse_select(__m128 mask, __m128 a, __m128 b)
+{
+    /* mask ? a : b */
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128 sse_wrap_deg180(__m128 x)
+{
+    __m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.0f / 360.0f)));
+    return _mm_sub_ps(x, _mm_mul_ps(_mm_set1_ps(360.0f), _mm_cvtepi32_ps(k)));
+}
+
+static inline __m128 sse_atan(__m128 x)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one      = _mm_set1_ps(1.0f);
+
+    __m128 ax  = _mm_andnot_ps(signMask, x);
+    __m128 inv = _mm_cmpgt_ps(ax, one);
+    __m128 r   = sse_select(inv, _mm_div_ps(one, x), x);
+    __m128 z   = _mm_mul_ps(r, r);
+
+    __m128 p = _mm_set1_ps(0.0208351f);
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(-0.0851330f));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(0.1801410f));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(-0.3302995f));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(0.9998660f));
+    p = _mm_mul_ps(p, r);
+
+    __m128 hp = _mm_or_ps(_mm_and_ps(signMask, x), _mm_set1_ps(ADAS_MATH_HALF_PI));
+    return sse_select(inv, _mm_sub_ps(hp, p), p);
+}
+
+static inline void sse_sincos(__m128 x, __m128 *pSin, __m128 *pCos)
+{
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-ADAS_MATH_TRIG_ARG_CLAMP)),
+                   _mm_set1_ps(ADAS_MATH_TRIG_ARG_CLAMP));
+
+    __m128i qi = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(2.0f / ADAS_MATH_PI)));
+    __m128  q  = _mm_cvtepi32_ps(qi);
+
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(1.5703125f)));
+    r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(4.837512969970703125e-4f)));
+    r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(7.54978995489188216e-8f)));
+    __m128 z = _mm_mul_ps(r, r);
+
+    __m128 s = _mm_set1_ps(-1.9515295891e-4f);
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(8.3321608736e-3f));
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(-1.6666654611e-1f));
+    s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), s));
+
+    __m128 c = _mm_set1_ps(2.443315711809948e-5f);
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(-1.388731625493765e-3f));
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(4.166664568298827e-2f));
+    c = _mm_mul_ps(_mm_mul_ps(z, z), c);
+    c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)), c);
+
+    /* 사분면: bit0 -> sin/cos 교환, bit1 -> 부호 (스칼라 AdasMath_SinCosF 와 동일 규칙) */
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    __m128 swap  = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qi, one), one));
+    __m128 sSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qi, two), 30));
+    __m128 cSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(qi, one), two), 30));
+
+    *pSin = _mm_xor_ps(sse_select(swap, c, s), sSign);
+    *pCos = _mm_xor_ps(sse_select(swap, s, c), cSign);
+}
+
+#endif /* ADAS_MATH_USE_SSE2 */
+
+/* ----------------------------------------------------------------------------
+ * AdasMath_WrapDeg180_Batch
+ * ---------------------------------------------------------------------------*/
+void AdasMath_WrapDeg180_Batch(const float *pIn, float *pOut, int count)
+{
+    if(!pIn || !pOut || count <= 0)
+        return;
+
+    int i = 0;
+#if ADAS_MATH_USE_SSE2
+    for(; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(&pOut[i], sse_wrap_deg180(_mm_loadu_ps(&pIn[i])));
+    }
+#endif
+    for(; i < count; i++)
+    {
+        pOut[i] = AdasMath_WrapDeg180(pIn[i]);
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasMath_AtanF_Batch
+ * ---------------------------------------------------------------------------*/
+void AdasMath_AtanF_Batch(const float *pIn, float *pOut, int count)
+{
+    if(!pIn || !pOut || count <= 0)
+        return;
+
+    int i = 0;
+#if ADAS_MATH_USE_SSE2
+    for(; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(&pOut[i], sse_atan(_mm_loadu_ps(&pIn[i])));
+    }
+#endif
+    for(; i < count; i++)
+    {
+        pOut[i] = AdasMath_AtanF(pIn[i]);
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasMath_SinCosF_Batch
+ * ---------------------------------------------------------------------------*/
+void AdasMath_SinCosF_Batch(const float *pIn, float *pSin, float *pCos, int count)
+{
+    if(!pIn || (!pSin && !pCos) || count <= 0)
+        return;
+
+    int i = 0;
+#if ADAS_MATH_USE_SSE2
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128 s, c;
+        sse_sincos(_mm_loadu_ps(&pIn[i]), &s, &c);
+        if(pSin) _mm_storeu_ps(&pSin[i], s);
+        if(pCos) _mm_storeu_ps(&pCos[i], c);
+    }
+#endif
+    for(; i < count; i++)
+    {
+        float s, c;
+        AdasMath_SinCosF(pIn[i], &s, &c);
+        if(pSin) pSin[i] = s;
+        if(pCos) pCos[i] = c;
+    }
+}
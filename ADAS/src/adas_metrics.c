@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <string.h>
+#include "adas_metrics.h"
+#include "adas_time.h"
+
+static const char *const s_metricNames[ADAS_METRIC_COUNT] = {
+    "ego", "lane", "target", "acc", "aeb", "lfa", "arbitration",
+    "tgt_filter", "tgt_predict", "tgt_select", "pipeline",
+    "wake", "response"
+};
+
+const char *AdasMetrics_Name(AdasMetric_e metric)
+{
+    if((unsigned)metric >= ADAS_METRIC_COUNT)
+        return "?";
+    return s_metricNames[metric];
+}
+
+/* ----------------------------------------------------------------------------
+ * 버킷 계산
+ *  - v < 2*SUB      : 버킷 = v (1ns 단위)
+ *  - 그 외 (msb = m) : e = m - SUB_BITS, 버킷 = e*SUB + (v >> e)  (v >> e 는 [SUB, 2*SUB))
+ * ---------------------------------------------------------------------------*/
+uint32_t AdasHist_BucketOf(uint64_t valueNs)
+{
+    if(valueNs > ADAS_HIST_MAX_VALUE)
+        valueNs = ADAS_HIST_MAX_VALUE;
+    if(valueNs < (2u * ADAS_HIST_SUB_COUNT))
+        return (uint32_t)valueNs;
+
+    uint32_t msb = 63u - (uint32_t)__builtin_clzll(valueNs);
+    uint32_t e   = msb - ADAS_HIST_SUB_BITS;
+    return (e * ADAS_HIST_SUB_COUNT) + (uint32_t)(valueNs >> e);
+}
+
+uint64_t AdasHist_BucketLow(uint32_t bucket)
+{
+    if(bucket < (2u * ADAS_HIST_SUB_COUNT))
+        return bucket;
+
+    uint32_t e = (bucket / ADAS_HIST_SUB_COUNT) - 1u;
+    uint64_t m = bucket - (e * ADAS_HIST_SUB_COUNT);
+    return m << e;
+}
+
+uint64_t AdasHist_BucketHigh(uint32_t bucket)
+{
+    if(bucket < (2u * ADAS_HIST_SUB_COUNT))
+        return bucket;
+
+    uint32_t e = (bucket / ADAS_HIST_SUB_COUNT) - 1u;
+    uint64_t m = bucket - (e * ADAS_HIST_SUB_COUNT);
+    return ((m + 1u) << e) - 1u;
+}
+
+void AdasHist_Reset(AdasLatencyHist_t *pHist)
+{
+    if(!pHist)
+        return;
+
+    __atomic_store_n(&pHist->Seq, pHist->Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    pHist->Count  = 0;
+    pHist->Sum_Ns = 0;
+    pHist->Min_Ns = UINT64_MAX;
+    pHist->Max_Ns = 0;
+    memset(pHist->Buckets, 0, sizeof(pHist->Buckets));
+    __atomic_store_n(&pHist->Seq, pHist->Seq + 1, __ATOMIC_RELEASE);
+}
+
+void AdasHist_Merge(AdasLatencyHist_t *pDst, const AdasLatencyHist_t *pSrc)
+{
+    if(!pDst || !pSrc || (pSrc->Count == 0))
+        return;
+
+    __atomic_store_n(&pDst->Seq, pDst->Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    pDst->Count  += pSrc->Count;
+    pDst->Sum_Ns += pSrc->Sum_Ns;
+    if(pSrc->Min_Ns < pDst->Min_Ns) pDst->Min_Ns = pSrc->Min_Ns;
+    if(pSrc->Max_Ns > pDst->Max_Ns) pDst->Max_Ns = pSrc->Max_Ns;
+    for(uint32_t b = 0; b < ADAS_HIST_BUCKETS; b++)
+        pDst->Buckets[b] += pSrc->Buckets[b];
+    __atomic_store_n(&pDst->Seq, pDst->Seq + 1, __ATOMIC_RELEASE);
+}
+
+void AdasMetrics_Init(AdasMetrics_t *pMetrics)
+{
+    if(!pMetrics)
+        return;
+
+    memset(pMetrics, 0, sizeof(*pMetrics));
+    for(int m = 0; m < ADAS_METRIC_COUNT; m++)
+        pMetrics->Hist[m].Min_Ns = UINT64_MAX;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasHist_Record
+ *  - Seq 홀수 기록 후 release 펜스: 이후 갱신이 홀수 Seq 보다 먼저 보이지 않음
+ *  - Seq 짝수는 release 저장: 갱신이 모두 보인 뒤에만 짝수로 관측
+ * ---------------------------------------------------------------------------*/
+void AdasHist_Record(AdasLatencyHist_t *pHist, uint64_t valueNs)
+{
+    if(!pHist)
+        return;
+
+    uint32_t bucket = AdasHist_BucketOf(valueNs);
+
+    __atomic_store_n(&pHist->Seq, pHist->Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    pHist->Buckets[bucket]++;
+    pHist->Count++;
+    pHist->Sum_Ns += valueNs;
+    if(valueNs < pHist->Min_Ns) pHist->Min_Ns = valueNs;
+    if(valueNs > pHist->Max_Ns) pHist->Max_Ns = valueNs;
+
+    __atomic_store_n(&pHist->Seq, pHist->Seq + 1, __ATOMIC_RELEASE);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasHist_Snapshot
+ *  - Seq 짝수(acquire) -> 복사 -> acquire 펜스 -> Seq 재확인, 다르면 재시도
+ * ---------------------------------------------------------------------------*/
+int AdasHist_Snapshot(const AdasLatencyHist_t *pHist, AdasLatencyHist_t *pOut)
+{
+    if(!pHist || !pOut)
+        return -1;
+
+    for(int tries = 0; tries < ADAS_HIST_SNAPSHOT_RETRIES; tries++)
+    {
+        uint32_t seq = __atomic_load_n(&pHist->Seq, __ATOMIC_ACQUIRE);
+        if(seq & 1u)
+            continue;
+
+        memcpy(pOut, pHist, sizeof(*pOut));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if(__atomic_load_n(&pHist->Seq, __ATOMIC_RELAXED) == seq)
+        {
+            pOut->Seq = seq;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int AdasMetrics_Snapshot(const AdasMetrics_t *pMetrics, AdasMetrics_t *pOut)
+{
+    if(!pMetrics || !pOut)
+        return -1;
+
+    int rc = 0;
+    for(int m = 0; m < ADAS_METRIC_COUNT; m++)
+    {
+        if(AdasHist_Snapshot(&pMetrics->Hist[m], &pOut->Hist[m]) != 0)
+            rc = -1;
+    }
+    return rc;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasHist_Percentile
+ * ---------------------------------------------------------------------------*/
+uint64_t AdasHist_Percentile(const AdasLatencyHist_t *pHist, double percentile)
+{
+    if(!pHist || pHist->Count == 0)
+        return 0;
+
+    if(percentile < 0.0)   percentile = 0.0;
+    if(percentile > 100.0) percentile = 100.0;
+
+    /* 순위 = ceil(p * Count / 100), 최소 1 */
+    double   exact = (percentile / 100.0) * (double)pHist->Count;
+    uint64_t rank  = (uint64_t)exact;
+    if((double)rank < exact) rank++;
+    if(rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for(uint32_t b = 0; b < ADAS_HIST_BUCKETS; b++)
+    {
+        seen += pHist->Buckets[b];
+        if(seen >= rank)
+        {
+            uint64_t high = AdasHist_BucketHigh(b);
+            return (high < pHist->Max_Ns) ? high : pHist->Max_Ns;
+        }
+    }
+    return pHist->Max_Ns;
+}
+
+void AdasHist_Summarize(const AdasLatencyHist_t *pHist, AdasLatencySummary_t *pSummary)
+{
+    if(!pSummary)
+        return;
+
+    memset(pSummary, 0, sizeof(*pSummary));
+    if(!pHist || pHist->Count == 0)
+        return;
+
+    pSummary->Count    = pHist->Count;
+    pSummary->Min_Ns   = pHist->Min_Ns;
+    pSummary->Mean_Ns  = (double)pHist->Sum_Ns / (double)pHist->Count;
+    pSummary->P50_Ns   = AdasHist_Percentile(pHist, 50.0);
+    pSummary->P99_Ns   = AdasHist_Percentile(pHist, 99.0);
+    pSummary->P999_Ns  = AdasHist_Percentile(pHist, 99.9);
+    pSummary->P9999_Ns = AdasHist_Percentile(pHist, 99.99);
+    pSummary->Max_Ns   = pHist->Max_Ns;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasMetrics_Print
+ * ---------------------------------------------------------------------------*/
+void AdasMetrics_Print(const AdasMetrics_t *pMetrics)
+{
+    if(!pMetrics)
+        return;
+
+    static AdasLatencyHist_t snap;   /* 비실시간 출력 경로 전용 */
+    const double us = (double)ADAS_NS_PER_US;
+
+    printf("---- Stage Latency [us] ----\n");
+    printf("  %-12s %8s %8s %8s %8s %8s %8s %8s\n", "stage", "count", "mean", "p50", "p99", "p99.9", "p99.99", "max");
+    for(int m = 0; m < ADAS_METRIC_COUNT; m++)
+    {
+        AdasLatencySummary_t s;
+        if(AdasHist_Snapshot(&pMetrics->Hist[m], &snap) != 0)
+        {
+            printf("  %-12s (busy)\n", s_metricNames[m]);
+            continue;
+        }
+        AdasHist_Summarize(&snap, &s);
+        if(s.Count == 0)
+            continue;
+
+        printf("  %-12s %8llu %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n", s_metricNames[m],
+               (unsigned long long)s.Count, s.Mean_Ns / us,
+               (double)s.P50_Ns / us, (double)s.P99_Ns / us, (double)s.P999_Ns / us,
+               (double)s.P9999_Ns / us, (double)s.Max_Ns / us);
+    }
+}
@@ -0,0 +1,264 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* syscall */
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "adas_perf.h"
+
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+static const char *const s_counterNames[ADAS_PERF_COUNTER_COUNT] = {
+    "cycles", "instructions", "l1d_miss", "llc_miss", "branch_miss", "page_faults", "ctx_switches"
+};
+
+const char *AdasPerf_CounterName(AdasPerfCounter_e counter)
+{
+    if((unsigned)counter >= ADAS_PERF_COUNTER_COUNT)
+        return "?";
+    return s_counterNames[counter];
+}
+
+#ifdef __linux__
+/* 카운터 -> perf_event_attr (type, config)
+ *  - 하드웨어 카운터만 사용자 모드로 제한 (문맥 전환은 커널 안에서 일어나므로 제외하면 항상 0) */
+static void counter_attr(AdasPerfCounter_e counter, struct perf_event_attr *pAttr)
+{
+    memset(pAttr, 0, sizeof(*pAttr));
+    pAttr->size           = sizeof(*pAttr);
+    pAttr->type           = PERF_TYPE_HARDWARE;
+    pAttr->exclude_hv     = 1u;
+    pAttr->read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch(counter)
+    {
+    case ADAS_PERF_CYCLES:       pAttr->config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case ADAS_PERF_INSTRUCTIONS: pAttr->config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case ADAS_PERF_BRANCH_MISS:  pAttr->config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    case ADAS_PERF_LLC_MISS:     pAttr->config = PERF_COUNT_HW_CACHE_MISSES; break;
+    case ADAS_PERF_L1D_MISS:
+        pAttr->type   = PERF_TYPE_HW_CACHE;
+        pAttr->config = PERF_COUNT_HW_CACHE_L1D |
+                        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    case ADAS_PERF_PAGE_FAULTS:
+        pAttr->type   = PERF_TYPE_SOFTWARE;
+        pAttr->config = PERF_COUNT_SW_PAGE_FAULTS;
+        break;
+    case ADAS_PERF_CTX_SWITCHES:
+        pAttr->type   = PERF_TYPE_SOFTWARE;
+        pAttr->config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+        break;
+    default:
+        break;
+    }
+    if(pAttr->type != PERF_TYPE_SOFTWARE)
+        pAttr->exclude_kernel = 1u;
+}
+#endif
+
+/* ----------------------------------------------------------------------------
+ * AdasPerf_Open
+ *  - 첫 번째로 열린 카운터가 그룹 리더 (비활성 상태로 열고 마지막에 그룹 전체 활성화)
+ *  - 실패한 카운터는 건너뛰고 나머지로 그룹 구성
+ * ---------------------------------------------------------------------------*/
+int AdasPerf_Open(AdasPerf_t *pPerf)
+{
+    if(!pPerf)
+        return -1;
+
+    memset(pPerf, 0, sizeof(*pPerf));
+    pPerf->Leader_Fd = -1;
+    for(int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++)
+        pPerf->Fd[c] = -1;
+
+#ifdef __linux__
+    for(int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++)
+    {
+        struct perf_event_attr attr;
+        counter_attr((AdasPerfCounter_e)c, &attr);
+        if(pPerf->Leader_Fd < 0)
+            attr.disabled = 1u;      /* 리더만 비활성으로 열기 (그룹 전체 활성화 대기) */
+
+        int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, pPerf->Leader_Fd, 0UL);
+        if((fd < 0) && (c == ADAS_PERF_PAGE_FAULTS))
+        {
+            /* perf_event_paranoid >= 2: 커널 포함 계수 불가 -> 사용자 모드 page fault 만 */
+            attr.exclude_kernel = 1u;
+            fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, pPerf->Leader_Fd, 0UL);
+        }
+        if(fd < 0)
+            continue;
+
+        if(pPerf->Leader_Fd < 0)
+            pPerf->Leader_Fd = fd;
+        pPerf->Fd[c] = fd;
+        pPerf->Slot_Counter[pPerf->Slot_Count++] = (uint8_t)c;
+    }
+
+    if(pPerf->Leader_Fd >= 0)
+    {
+        ioctl(pPerf->Leader_Fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        if(ioctl(pPerf->Leader_Fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0)
+            AdasPerf_Close(pPerf);
+    }
+#endif
+    return pPerf->Slot_Count;
+}
+
+void AdasPerf_Close(AdasPerf_t *pPerf)
+{
+    if(!pPerf)
+        return;
+
+    /* 리더는 마지막에 닫음 */
+    for(int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++)
+    {
+        if((pPerf->Fd[c] >= 0) && (pPerf->Fd[c] != pPerf->Leader_Fd))
+            close(pPerf->Fd[c]);
+        pPerf->Fd[c] = -1;
+    }
+    if(pPerf->Leader_Fd >= 0)
+        close(pPerf->Leader_Fd);
+    pPerf->Leader_Fd  = -1;
+    pPerf->Slot_Count = 0;
+}
+
+int AdasPerf_IsAvailable(const AdasPerf_t *pPerf, AdasPerfCounter_e counter)
+{
+    if(!pPerf || ((unsigned)counter >= ADAS_PERF_COUNTER_COUNT))
+        return 0;
+    return pPerf->Fd[counter] >= 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPerf_Read
+ *  - 그룹 읽기 형식: nr, time_enabled, time_running, value[nr] (리더부터 연 순서)
+ * ---------------------------------------------------------------------------*/
+int AdasPerf_Read(const AdasPerf_t *pPerf, AdasPerfSample_t *pSample)
+{
+    if(!pPerf || !pSample || (pPerf->Leader_Fd < 0))
+        return -1;
+
+    uint64_t buf[3 + ADAS_PERF_COUNTER_COUNT];
+    size_t  want = (3u + (size_t)pPerf->Slot_Count) * sizeof(uint64_t);
+    ssize_t n    = read(pPerf->Leader_Fd, buf, sizeof(buf));
+    if((n < 0) || ((size_t)n != want))
+        return -1;
+
+    uint64_t nr = buf[0];
+    if(nr != (uint64_t)pPerf->Slot_Count)
+        return -1;
+
+    memset(pSample, 0, sizeof(*pSample));
+    pSample->Time_Enabled = buf[1];
+    pSample->Time_Running = buf[2];
+    for(int k = 0; k < pPerf->Slot_Count; k++)
+        pSample->Value[pPerf->Slot_Counter[k]] = buf[3 + k];
+    return 0;
+}
+
+void AdasPerf_AddStage(AdasPerf_t *pPerf, AdasStage_e stage,
+                       const AdasPerfSample_t *pBefore, const AdasPerfSample_t *pAfter)
+{
+    if(!pPerf || !pBefore || !pAfter || ((unsigned)stage >= ADAS_STAGE_COUNT))
+        return;
+
+    uint64_t running = pAfter->Time_Running - pBefore->Time_Running;
+    uint64_t enabled = pAfter->Time_Enabled - pBefore->Time_Enabled;
+    if((pAfter->Time_Running < pBefore->Time_Running) || (running == 0))
+    {
+        pPerf->Not_Running++;
+        return;
+    }
+    if(running < enabled)
+        pPerf->Multiplexed++;
+
+    AdasPerfStageStats_t *pSt = &pPerf->Stage[stage];
+    pSt->Samples++;
+    for(int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++)
+    {
+        uint64_t d = (pAfter->Value[c] > pBefore->Value[c]) ? (pAfter->Value[c] - pBefore->Value[c]) : 0;
+        pSt->Total[c] += d;
+        if(d > pSt->Max[c]) pSt->Max[c] = d;
+    }
+}
+
+void AdasPerf_Reset(AdasPerf_t *pPerf)
+{
+    if(!pPerf)
+        return;
+
+    memset(pPerf->Stage, 0, sizeof(pPerf->Stage));
+    pPerf->Multiplexed = 0;
+    pPerf->Not_Running = 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPerf_Print
+ * ---------------------------------------------------------------------------*/
+/* 칸 표시: 정수 / 소수 둘째 자리, 사용 불가는 "-" */
+static void print_count(int available, double value)
+{
+    if(available)
+        printf(" %9.0f", value);
+    else
+        printf(" %9s", "-");
+}
+
+static void print_ratio(int available, double value)
+{
+    if(available)
+        printf(" %9.2f", value);
+    else
+        printf(" %9s", "-");
+}
+
+void AdasPerf_Print(const AdasPerf_t *pPerf)
+{
+    if(!pPerf)
+        return;
+
+    printf("---- Perf Counters (per stage run) ----\n");
+    if(pPerf->Slot_Count == 0)
+    {
+        printf("unavailable (perf_event_open failed)\n");
+        return;
+    }
+
+    const int hasCyc   = AdasPerf_IsAvailable(pPerf, ADAS_PERF_CYCLES);
+    const int hasIns   = AdasPerf_IsAvailable(pPerf, ADAS_PERF_INSTRUCTIONS);
+    const int hasL1d   = AdasPerf_IsAvailable(pPerf, ADAS_PERF_L1D_MISS);
+    const int hasLlc   = AdasPerf_IsAvailable(pPerf, ADAS_PERF_LLC_MISS);
+    const int hasBr    = AdasPerf_IsAvailable(pPerf, ADAS_PERF_BRANCH_MISS);
+    const int hasPf    = AdasPerf_IsAvailable(pPerf, ADAS_PERF_PAGE_FAULTS);
+    const int hasCs    = AdasPerf_IsAvailable(pPerf, ADAS_PERF_CTX_SWITCHES);
+
+    printf("  %-12s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n", "stage", "runs", "cycles", "instr", "IPC",
+           "l1d/ki", "llc/ki", "br/ki", "pf", "cs");
+    for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+    {
+        const AdasPerfStageStats_t *pSt = &pPerf->Stage[s];
+        double n  = (pSt->Samples > 0) ? (double)pSt->Samples : 1.0;
+        double ki = (pSt->Total[ADAS_PERF_INSTRUCTIONS] > 0) ? ((double)pSt->Total[ADAS_PERF_INSTRUCTIONS] / 1000.0) : 0.0;
+        double cyc = (double)pSt->Total[ADAS_PERF_CYCLES];
+
+        printf("  %-12s %9llu", AdasPipeline_StageName((AdasStage_e)s), (unsigned long long)pSt->Samples);
+        print_count(hasCyc, cyc / n);
+        print_count(hasIns, (double)pSt->Total[ADAS_PERF_INSTRUCTIONS] / n);
+        print_ratio(hasCyc && hasIns && (cyc > 0.0), (cyc > 0.0) ? ((ki * 1000.0) / cyc) : 0.0);
+        print_ratio(hasL1d && hasIns && (ki > 0.0), (ki > 0.0) ? ((double)pSt->Total[ADAS_PERF_L1D_MISS] / ki) : 0.0);
+        print_ratio(hasLlc && hasIns && (ki > 0.0), (ki > 0.0) ? ((double)pSt->Total[ADAS_PERF_LLC_MISS] / ki) : 0.0);
+        print_ratio(hasBr && hasIns && (ki > 0.0), (ki > 0.0) ? ((double)pSt->Total[ADAS_PERF_BRANCH_MISS] / ki) : 0.0);
+        print_count(hasPf, (double)pSt->Total[ADAS_PERF_PAGE_FAULTS]);
+        print_count(hasCs, (double)pSt->Total[ADAS_PERF_CTX_SWITCHES]);
+        printf("\n");
+    }
+    printf("Counters=%d/%d, Multiplexed=%llu, NotRunning=%llu\n", pPerf->Slot_Count, ADAS_PERF_COUNTER_COUNT,
+           (unsigned long long)pPerf->Multiplexed, (unsigned long long)pPerf->Not_Running);
+}
@@ -0,0 +1,296 @@
+#include <string.h>
+#include "adas_pipeline.h"
+#include "lane_selection.h"
+#include "target_selection.h"
+#include "adas_trace.h"
+#include "adas_time.h"
+
+/* TargetSituation_e -> 모듈별 상황 enum (Curve는 Normal 취급) */
+static ACC_Target_Situation_e to_acc_situation(TargetSituation_e situ)
+{
+    if(situ == TGT_SITU_CUTIN)  return ACC_TARGET_CUT_IN;
+    if(situ == TGT_SITU_CUTOUT) return ACC_TARGET_CUT_OUT;
+    return ACC_TARGET_NORMAL;
+}
+
+static AEB_Target_Situation_e to_aeb_situation(TargetSituation_e situ)
+{
+    if(situ == TGT_SITU_CUTIN)  return AEB_TARGET_CUT_IN;
+    if(situ == TGT_SITU_CUTOUT) return AEB_TARGET_CUT_OUT;
+    return AEB_TARGET_NORMAL;
+}
+
+/* t0 이후 경과 시간 기록, 현재 시각 반환 */
+static uint64_t record_since(AdasLatencyHist_t *pHist, uint64_t t0)
+{
+    uint64_t now = AdasTime_NowNs();
+    AdasHist_Record(pHist, now - t0);
+    return now;
+}
+
+/*─────────────────────────────
+  단계별 실행 함수
+─────────────────────────────*/
+
+/* 1) Ego Vehicle Estimation */
+static void stage_ego(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    ADAS_TRACE_BEGIN(ADAS_TRACE_EGO);
+    EgoVehicleEstimation(&pIn->Time, &pIn->Gps, &pIn->Imu, &pOut->Ego, &pPipe->Kf);
+    ADAS_TRACE_END(ADAS_TRACE_EGO);
+}
+
+/* 2) Lane Selection */
+static void stage_lane(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    (void)pPipe;
+    ADAS_TRACE_BEGIN(ADAS_TRACE_LANE);
+    LaneSelection_Update(&pIn->Lane, &pOut->Ego, &pOut->Lane_Select);
+    ADAS_TRACE_END(ADAS_TRACE_LANE);
+}
+
+/* 3) Target Selection : 필터링 -> 경로 예측 -> ACC/AEB 타겟 선정 */
+static void stage_target(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    int objCount = pIn->Object_Count;
+    if(objCount > ADAS_MAX_OBJECTS) objCount = ADAS_MAX_OBJECTS;
+
+    AdasMetrics_t *pMetrics = pPipe->pMetrics;
+    uint64_t t0 = pMetrics ? AdasTime_NowNs() : 0;
+
+    ADAS_TRACE_BEGIN(ADAS_TRACE_TARGET_FILTER);
+    pOut->Filtered_Count  = select_target_from_object_list(pIn->Objects, objCount, &pOut->Ego,
+                                                           &pOut->Lane_Select,
+                                                           pOut->Filtered, ADAS_MAX_OBJECTS);
+    ADAS_TRACE_END(ADAS_TRACE_TARGET_FILTER);
+    if(pMetrics) t0 = record_since(&pMetrics->Hist[ADAS_METRIC_TARGET_FILTER], t0);
+
+    ADAS_TRACE_BEGIN(ADAS_TRACE_TARGET_PREDICT);
+    pOut->Predicted_Count = predict_object_future_path(pOut->Filtered, pOut->Filtered_Count, &pIn->Lane,
+                                                       &pOut->Lane_Select,
+                                                       pOut->Predicted, ADAS_MAX_OBJECTS);
+    ADAS_TRACE_END(ADAS_TRACE_TARGET_PREDICT);
+    if(pMetrics) t0 = record_since(&pMetrics->Hist[ADAS_METRIC_TARGET_PREDICT], t0);
+
+    ADAS_TRACE_BEGIN(ADAS_TRACE_TARGET_SELECT);
+    select_targets_for_acc_aeb(&pOut->Ego, pOut->Predicted, pOut->Predicted_Count, &pOut->Lane_Select,
+                               &pOut->Acc_Target, &pOut->Aeb_Target);
+    ADAS_TRACE_END(ADAS_TRACE_TARGET_SELECT);
+    if(pMetrics) (void)record_since(&pMetrics->Hist[ADAS_METRIC_TARGET_SELECT], t0);
+}
+
+/* 4) ACC : 활성 모드의 PID만 계산 */
+static void stage_acc(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    ACC_Target_Data_t accIn = {
+        .ACC_Target_ID         = pOut->Acc_Target.ACC_Target_ID,
+        .ACC_Target_Distance   = pOut->Acc_Target.ACC_Target_Distance,
+        .ACC_Target_Status     = (ACC_Target_Status_e)pOut->Acc_Target.ACC_Target_Status,
+        .ACC_Target_Situation  = to_acc_situation(pOut->Acc_Target.ACC_Target_Situation),
+        .ACC_Target_Velocity_X = pOut->Acc_Target.ACC_Target_Vel_X
+    };
+    ACC_Ego_Data_t accEgo = { .Ego_Velocity_X=pOut->Ego.Ego_Velocity_X,
+                              .Ego_Acceleration_X=pOut->Ego.Ego_Acceleration_X };
+    Lane_Data_t accLane = {
+        .Lane_Curvature      = pIn->Lane.Lane_Curvature,
+        .Next_Lane_Curvature = pIn->Lane.Next_Lane_Curvature,
+        .LS_Heading_Error    = pOut->Lane_Select.LS_Heading_Error,
+        .LS_Is_Curved_Lane   = pOut->Lane_Select.LS_Is_Curved_Lane
+    };
+
+    ADAS_TRACE_BEGIN(ADAS_TRACE_ACC);
+    pOut->Acc_Mode  = acc_mode_selection(&accIn, &accEgo, &accLane);
+    pOut->Accel_Acc = acc_calculate_accel(&pPipe->Acc, pOut->Acc_Mode, &accIn, &accEgo, &accLane,
+                                          pIn->Time.Current_Time * 0.001f, pPipe->Delta_Time);
+    ADAS_TRACE_END(ADAS_TRACE_ACC);
+}
+
+/* 5) AEB */
+static void stage_aeb(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    (void)pPipe;
+    (void)pIn;
+    AEB_Target_Data_t aebIn = {
+        .AEB_Target_ID         = pOut->Aeb_Target.AEB_Target_ID,
+        .AEB_Target_Distance   = pOut->Aeb_Target.AEB_Target_Distance,
+        .AEB_Target_Velocity_X = pOut->Aeb_Target.AEB_Target_Vel_X,
+        .AEB_Target_Situation  = to_aeb_situation(pOut->Aeb_Target.AEB_Target_Situation)
+    };
+    AEB_Ego_Data_t aebEgo = { .Ego_Velocity_X=pOut->Ego.Ego_Velocity_X };
+
+    ADAS_TRACE_BEGIN(ADAS_TRACE_AEB);
+    calculate_ttc_for_aeb(&aebIn, &aebEgo, &pOut->Ttc);
+    pOut->Aeb_Mode  = aeb_mode_selection(&aebIn, &aebEgo, &pOut->Ttc);
+    pOut->Decel_Aeb = calculate_decel_for_aeb(pOut->Aeb_Mode, &pOut->Ttc);
+    ADAS_TRACE_END(ADAS_TRACE_AEB);
+}
+
+/* 6) LFA : 활성 모드의 조향 법칙만 계산 */
+static void stage_lfa(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    LFA_Ego_Data_t lfaEgo = { .Ego_Velocity_X=pOut->Ego.Ego_Velocity_X,
+                              .Ego_Yaw_Rate=pOut->Ego.Ego_Yaw_Rate,
+                              .Ego_Steering_Angle=0.0f };
+    Lane_Data_LS_t lfaLane = {
+        .LS_Heading_Error       = pOut->Lane_Select.LS_Heading_Error,
+        .LS_Lane_Offset         = pOut->Lane_Select.LS_Lane_Offset,
+        .LS_Is_Changing_Lane    = pOut->Lane_Select.LS_Is_Changing_Lane,
+        .LS_Is_Within_Lane      = pOut->Lane_Select.LS_Is_Within_Lane,
+        .LS_Is_Curved_Lane      = pOut->Lane_Select.LS_Is_Curved_Lane,
+        .LS_Lane_Curvature      = pIn->Lane.Lane_Curvature,
+        .LS_Next_Lane_Curvature = pIn->Lane.Next_Lane_Curvature,
+        .LS_Curve_Direction     = pIn->Lane.Lane_Curve_Direction
+    };
+
+    ADAS_TRACE_BEGIN(ADAS_TRACE_LFA);
+    pOut->Lfa_Mode  = lfa_mode_selection(&lfaEgo);
+    pOut->Steer_Lfa = lfa_calculate_steer(&pPipe->Lfa, pOut->Lfa_Mode, &lfaEgo, &lfaLane, pPipe->Delta_Time);
+    ADAS_TRACE_END(ADAS_TRACE_LFA);
+}
+
+/* 7) Arbitration */
+static void stage_arbitration(AdasPipeline_t *pPipe, const AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut)
+{
+    (void)pPipe;
+    (void)pIn;
+    ADAS_TRACE_BEGIN(ADAS_TRACE_ARBITRATION);
+    Arbitration(pOut->Accel_Acc, pOut->Decel_Aeb, pOut->Steer_Lfa, pOut->Aeb_Mode, &pOut->Control);
+    ADAS_TRACE_END(ADAS_TRACE_ARBITRATION);
+}
+
+typedef void (*StageFn_t)(AdasPipeline_t *, const AdasFrameInput_t *, AdasFrameOutput_t *);
+
+static const StageFn_t s_stageFns[ADAS_STAGE_COUNT] = {
+    stage_ego, stage_lane, stage_target, stage_acc, stage_aeb, stage_lfa, stage_arbitration
+};
+
+static const char *const s_stageNames[ADAS_STAGE_COUNT] = {
+    "ego", "lane", "target", "acc", "aeb", "lfa", "arbitration"
+};
+
+/* 단계별 입력/출력 데이터 (태스크 그래프 의존성) */
+static const uint32_t s_stageInputs[ADAS_STAGE_COUNT] = {
+    ADAS_DATA_INPUT,                                                                /* ego */
+    ADAS_DATA_INPUT | ADAS_DATA_EGO,                                                /* lane */
+    ADAS_DATA_INPUT | ADAS_DATA_EGO | ADAS_DATA_LANE_SELECT,                        /* target */
+    ADAS_DATA_INPUT | ADAS_DATA_EGO | ADAS_DATA_LANE_SELECT | ADAS_DATA_TARGETS,    /* acc */
+    ADAS_DATA_EGO | ADAS_DATA_TARGETS,                                              /* aeb */
+    ADAS_DATA_INPUT | ADAS_DATA_EGO | ADAS_DATA_LANE_SELECT,                        /* lfa */
+    ADAS_DATA_ACC_CMD | ADAS_DATA_AEB_CMD | ADAS_DATA_LFA_CMD                       /* arbitration */
+};
+
+static const uint32_t s_stageOutputs[ADAS_STAGE_COUNT] = {
+    ADAS_DATA_EGO, ADAS_DATA_LANE_SELECT, ADAS_DATA_TARGETS,
+    ADAS_DATA_ACC_CMD, ADAS_DATA_AEB_CMD, ADAS_DATA_LFA_CMD, ADAS_DATA_CONTROL
+};
+
+/* 태스크 그래프 주기별 컨텍스트 (StepGraph 스택에 위치, 할당 없음) */
+typedef struct
+{
+    AdasPipeline_t         *pPipe;
+    const AdasFrameInput_t *pIn;
+    AdasFrameOutput_t      *pOut;
+} GraphCtx_t;
+
+static void graph_stage(void *pCtx, int stage)
+{
+    GraphCtx_t *pG = (GraphCtx_t *)pCtx;
+    s_stageFns[stage](pG->pPipe, pG->pIn, pG->pOut);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipeline_Init
+ * ---------------------------------------------------------------------------*/
+int AdasPipeline_Init(AdasPipeline_t *pPipe, float deltaTime)
+{
+    if(!pPipe || deltaTime <= 0.0f)
+        return -1;
+
+    memset(pPipe, 0, sizeof(*pPipe));
+    InitEgoVehicleKFState(&pPipe->Kf);
+    acc_init_state(&pPipe->Acc);
+    lfa_init_state(&pPipe->Lfa);
+    pPipe->Delta_Time = deltaTime;
+
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipeline_RunStage
+ * ---------------------------------------------------------------------------*/
+int AdasPipeline_RunStage(AdasPipeline_t         *pPipe,
+                          AdasStage_e             stage,
+                          const AdasFrameInput_t *pIn,
+                          AdasFrameOutput_t      *pOut)
+{
+    if(!pPipe || !pIn || !pOut || (unsigned)stage >= ADAS_STAGE_COUNT)
+        return -1;
+
+    s_stageFns[stage](pPipe, pIn, pOut);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipeline_Step
+ * ---------------------------------------------------------------------------*/
+int AdasPipeline_Step(AdasPipeline_t         *pPipe,
+                      const AdasFrameInput_t *pIn,
+                      AdasFrameOutput_t      *pOut)
+{
+    if(!pPipe || !pIn || !pOut)
+        return -1;
+
+    for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+    {
+        s_stageFns[s](pPipe, pIn, pOut);
+    }
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipeline_BuildGraph
+ * ---------------------------------------------------------------------------*/
+int AdasPipeline_BuildGraph(AdasTaskGraph_t *pGraph)
+{
+    if(!pGraph)
+        return -1;
+
+    AdasTaskDesc_t tasks[ADAS_STAGE_COUNT];
+    for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+    {
+        tasks[s].Name    = s_stageNames[s];
+        tasks[s].pfnRun  = graph_stage;
+        tasks[s].Arg     = s;
+        tasks[s].Inputs  = s_stageInputs[s];
+        tasks[s].Outputs = s_stageOutputs[s];
+    }
+    return AdasTaskGraph_Build(pGraph, tasks, ADAS_STAGE_COUNT);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipeline_StepGraph
+ * ---------------------------------------------------------------------------*/
+int AdasPipeline_StepGraph(AdasTaskGraph_t        *pGraph,
+                           AdasPipeline_t         *pPipe,
+                           const AdasFrameInput_t *pIn,
+                           AdasFrameOutput_t      *pOut)
+{
+    if(!pGraph || !pPipe || !pIn || !pOut)
+        return -1;
+
+    GraphCtx_t ctx = { pPipe, pIn, pOut };
+    return AdasTaskGraph_Run(pGraph, &ctx);
+}
+
+void AdasPipeline_SetMetrics(AdasPipeline_t *pPipe, AdasMetrics_t *pMetrics)
+{
+    if(pPipe)
+        pPipe->pMetrics = pMetrics;
+}
+
+const char *AdasPipeline_StageName(AdasStage_e stage)
+{
+    if((unsigned)stage >= ADAS_STAGE_COUNT)
+        return "unknown";
+    return s_stageNames[stage];
+}
@@ -0,0 +1,309 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* clock_nanosleep, pthread_setaffinity_np */
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "adas_pipelined.h"
+#include "adas_time.h"
+#include "adas_trace.h"
+
+/* Period_Ns = 0 (free-run) 일 때의 논리 주기 [ns] */
+#define PIPELINED_FREE_RUN_DT_NS  (10ULL * ADAS_NS_PER_MS)
+
+static inline void cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/* 스레드별 RT 설정 (CPU 고정 + SCHED_FIFO, mlockall 은 Run 에서 1회) */
+static int apply_thread_rt(const AdasPipelinedConfig_t *pConfig, int cpu)
+{
+    AdasRuntimeConfig_t rtCfg;
+    AdasRuntime_DefaultConfig(&rtCfg);
+    rtCfg.Rt_Priority = pConfig->Rt_Priority;
+    rtCfg.Cpu_Id      = cpu;
+    return AdasRuntime_ApplyRtSettings(&rtCfg);
+}
+
+static inline void accumulate(uint64_t *pTotal, uint64_t *pMax, uint64_t value)
+{
+    *pTotal += value;
+    if(value > *pMax) *pMax = value;
+}
+
+/* ----------------------------------------------------------------------------
+ * 인지 스레드: 입력 -> Ego/Lane/Target -> 3중 버퍼 게시
+ *  - 주기/마감 처리는 AdasRuntime_Run 과 동일 (절대 release, 지난 주기 건너뜀)
+ *  - 계측은 지역 변수에 누적 후 종료 시 기록 (제어 스레드와 false sharing 방지)
+ * ---------------------------------------------------------------------------*/
+static void *perception_thread(void *pArg)
+{
+    AdasPipelined_t *pPl = (AdasPipelined_t *)pArg;
+    const uint64_t period   = pPl->Config.Period_Ns;
+    const float    periodMs = (float)((period != 0) ? period : PIPELINED_FREE_RUN_DT_NS) / (float)ADAS_NS_PER_MS;
+
+    int      rtFailed  = apply_thread_rt(&pPl->Config, pPl->Config.Perception_Cpu);
+    ADAS_TRACE_THREAD("perception");
+    uint64_t published = 0, misses = 0, total = 0, maxNs = 0;
+    uint64_t release   = AdasTime_NowNs() + period;
+    uint64_t slot      = 0;
+
+    while(!pPl->Stop_Requested)
+    {
+        if((pPl->Config.Cycle_Limit != 0) && (published >= pPl->Config.Cycle_Limit))
+            break;
+
+        if(period != 0)
+            AdasTime_SleepUntilNs(release);
+        uint64_t wake = AdasTime_NowNs();
+
+        pPl->Input.Time.Current_Time = (float)slot * periodMs;
+        if(pPl->pfnInput && (pPl->pfnInput(pPl->pUser, published, &pPl->Input) < 0))
+            break;
+
+        AdasPipelinedFrame_t *pFrame = (AdasPipelinedFrame_t *)TripleBuffer_WriteSlot(&pPl->Exchange);
+        for(int s = 0; s < ADAS_PIPELINED_FIRST_CONTROL_STAGE; s++)
+        {
+            AdasPipeline_RunStage(&pPl->Pipeline, (AdasStage_e)s, &pPl->Input, &pFrame->Output);
+        }
+        pFrame->Input      = pPl->Input;
+        pFrame->Seq        = ++published;
+        pFrame->Release_Ns = wake;
+        pFrame->Publish_Ns = AdasTime_NowNs();
+        TripleBuffer_Publish(&pPl->Exchange);
+
+        accumulate(&total, &maxNs, pFrame->Publish_Ns - wake);
+
+        slot++;
+        if(period != 0)
+        {
+            release += period;
+            uint64_t done = AdasTime_NowNs();
+            if(done > release)
+            {
+                uint64_t behind = ((done - release) / period) + 1;
+                misses++;
+                release += behind * period;
+                slot    += behind;
+            }
+        }
+    }
+
+    pPl->Stats.Frames_Published    = published;
+    pPl->Stats.Deadline_Misses     = misses;
+    pPl->Stats.Perception_Total_Ns = total;
+    pPl->Stats.Perception_Max_Ns   = maxNs;
+    __atomic_or_fetch(&pPl->Stats.Rt_Failed, rtFailed, __ATOMIC_RELAXED);
+    __atomic_store_n(&pPl->Producer_Done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/* 새 프레임 대기: busy-poll -> (Poll_Sleep_Ns) 휴면 반복
+ * @return 1 : 새 프레임, 0 : 인지 종료 + 남은 프레임 없음 */
+static int wait_for_frame(AdasPipelined_t *pPl)
+{
+    for(;;)
+    {
+        for(uint32_t i = 0; i <= pPl->Config.Spin_Limit; i++)
+        {
+            if(TripleBuffer_Acquire(&pPl->Exchange))
+                return 1;
+            cpu_relax();
+        }
+
+        /* 종료 플래그 확인 후 한 번 더 확인: 마지막 게시 프레임 유실 방지 */
+        if(__atomic_load_n(&pPl->Producer_Done, __ATOMIC_ACQUIRE))
+            return TripleBuffer_Acquire(&pPl->Exchange);
+
+        if(pPl->Config.Poll_Sleep_Ns != 0)
+            AdasTime_SleepUntilNs(AdasTime_NowNs() + pPl->Config.Poll_Sleep_Ns);
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * 제어 스레드: 최신 프레임 수신 -> ACC/AEB/LFA/Arbitration -> 출력
+ *  - 읽기 슬롯은 다음 Acquire 전까지 소비자 전용 -> 제자리(in-place) 계산
+ * ---------------------------------------------------------------------------*/
+static void *control_thread(void *pArg)
+{
+    AdasPipelined_t *pPl = (AdasPipelined_t *)pArg;
+
+    int      rtFailed  = apply_thread_rt(&pPl->Config, pPl->Config.Control_Cpu);
+    ADAS_TRACE_THREAD("control");
+    uint64_t processed = 0, dropped = 0, lastSeq = 0;
+    uint64_t ctrlTotal = 0, ctrlMax = 0, hoTotal = 0, hoMax = 0, latTotal = 0, latMax = 0;
+    AdasPipelinedFrame_t *pFrame = NULL;
+
+    while(wait_for_frame(pPl))
+    {
+        pFrame = (AdasPipelinedFrame_t *)TripleBuffer_ReadSlot(&pPl->Exchange);
+        uint64_t start = AdasTime_NowNs();
+
+        for(int s = ADAS_PIPELINED_FIRST_CONTROL_STAGE; s < ADAS_STAGE_COUNT; s++)
+        {
+            AdasPipeline_RunStage(&pPl->Pipeline, (AdasStage_e)s, &pFrame->Input, &pFrame->Output);
+        }
+        if(pPl->pfnOutput)
+            pPl->pfnOutput(pPl->pUser, pFrame->Seq - 1, &pFrame->Output);
+        if(pPl->pLog)   /* Kf 는 인지 스레드가 갱신 중 -> 스냅샷 없이 기록 */
+            AdasCycleLog_Append(pPl->pLog, pFrame->Seq - 1, &pFrame->Input, &pFrame->Output, NULL);
+
+        uint64_t done = AdasTime_NowNs();
+        accumulate(&ctrlTotal, &ctrlMax, done - start);
+        accumulate(&hoTotal, &hoMax, (start > pFrame->Publish_Ns) ? (start - pFrame->Publish_Ns) : 0);
+        accumulate(&latTotal, &latMax, done - pFrame->Release_Ns);
+
+        dropped += pFrame->Seq - lastSeq - 1;
+        lastSeq  = pFrame->Seq;
+        processed++;
+    }
+
+    if(pFrame)
+        pPl->Output = pFrame->Output;
+
+    pPl->Stats.Frames_Processed = processed;
+    pPl->Stats.Frames_Dropped   = dropped;
+    pPl->Stats.Control_Total_Ns = ctrlTotal;
+    pPl->Stats.Control_Max_Ns   = ctrlMax;
+    pPl->Stats.Handoff_Total_Ns = hoTotal;
+    pPl->Stats.Handoff_Max_Ns   = hoMax;
+    pPl->Stats.Latency_Total_Ns = latTotal;
+    pPl->Stats.Latency_Max_Ns   = latMax;
+    __atomic_or_fetch(&pPl->Stats.Rt_Failed, rtFailed, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipelined_DefaultConfig
+ * ---------------------------------------------------------------------------*/
+void AdasPipelined_DefaultConfig(AdasPipelinedConfig_t *pConfig)
+{
+    if(!pConfig)
+        return;
+
+    memset(pConfig, 0, sizeof(*pConfig));
+    pConfig->Period_Ns      = 10ULL * ADAS_NS_PER_MS;
+    pConfig->Cycle_Limit    = 0;
+    pConfig->Rt_Priority    = 0;
+    pConfig->Perception_Cpu = -1;
+    pConfig->Control_Cpu    = -1;
+    pConfig->Lock_Memory    = 0;
+    pConfig->Spin_Limit     = 1000;
+    pConfig->Poll_Sleep_Ns  = 20ULL * ADAS_NS_PER_US;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipelined_Init
+ * ---------------------------------------------------------------------------*/
+int AdasPipelined_Init(AdasPipelined_t             *pPl,
+                       const AdasPipelinedConfig_t *pConfig,
+                       AdasInputFn_t                pfnInput,
+                       AdasOutputFn_t               pfnOutput,
+                       void                        *pUser)
+{
+    if(!pPl || !pConfig)
+        return -1;
+
+    memset(pPl, 0, sizeof(*pPl));
+    pPl->Config    = *pConfig;
+    pPl->pfnInput  = pfnInput;
+    pPl->pfnOutput = pfnOutput;
+    pPl->pUser     = pUser;
+
+    if(TripleBuffer_Init(&pPl->Exchange, pPl->Slots, sizeof(pPl->Slots[0])) != 0)
+        return -1;
+
+    uint64_t dtNs = (pConfig->Period_Ns != 0) ? pConfig->Period_Ns : PIPELINED_FREE_RUN_DT_NS;
+    return AdasPipeline_Init(&pPl->Pipeline, (float)dtNs / (float)ADAS_NS_PER_SEC);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipelined_Run
+ * ---------------------------------------------------------------------------*/
+int AdasPipelined_Run(AdasPipelined_t *pPl)
+{
+    if(!pPl)
+        return -1;
+
+    if(pPl->Config.Lock_Memory)
+    {
+        AdasRuntimeConfig_t rtCfg;
+        AdasRuntime_DefaultConfig(&rtCfg);
+        rtCfg.Lock_Memory = 1;
+        pPl->Stats.Rt_Failed |= AdasRuntime_ApplyRtSettings(&rtCfg);
+    }
+
+    pthread_t perc, ctrl;
+    uint64_t  t0 = AdasTime_NowNs();
+
+    __atomic_store_n(&pPl->Producer_Done, 0, __ATOMIC_RELEASE);
+    if(pthread_create(&ctrl, NULL, control_thread, pPl) != 0)
+        return -1;
+    if(pthread_create(&perc, NULL, perception_thread, pPl) != 0)
+    {
+        __atomic_store_n(&pPl->Producer_Done, 1, __ATOMIC_RELEASE);
+        pthread_join(ctrl, NULL);
+        return -1;
+    }
+
+    pthread_join(perc, NULL);
+    pthread_join(ctrl, NULL);
+    pPl->Stats.Elapsed_Ns = AdasTime_NowNs() - t0;
+
+    return 0;
+}
+
+void AdasPipelined_SetLog(AdasPipelined_t *pPl, AdasCycleLog_t *pLog)
+{
+    if(pPl)
+        pPl->pLog = pLog;
+}
+
+void AdasPipelined_RequestStop(AdasPipelined_t *pPl)
+{
+    if(pPl)
+        pPl->Stop_Requested = 1;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasPipelined_PrintStats
+ *  - 처리량 한계: 순차 = 1/(인지+제어), 파이프라인 = 1/max(인지, 제어) (평균 기준)
+ * ---------------------------------------------------------------------------*/
+void AdasPipelined_PrintStats(const AdasPipelined_t *pPl)
+{
+    if(!pPl)
+        return;
+
+    const AdasPipelinedStats_t *pSt = &pPl->Stats;
+    double nP = (double)((pSt->Frames_Published > 0) ? pSt->Frames_Published : 1);
+    double nC = (double)((pSt->Frames_Processed > 0) ? pSt->Frames_Processed : 1);
+
+    double percUs = (double)pSt->Perception_Total_Ns / nP / 1000.0;
+    double ctrlUs = (double)pSt->Control_Total_Ns / nC / 1000.0;
+    double hoUs   = (double)pSt->Handoff_Total_Ns / nC / 1000.0;
+    double latUs  = (double)pSt->Latency_Total_Ns / nC / 1000.0;
+    double seqHz  = (percUs + ctrlUs > 0.0) ? 1.0e6 / (percUs + ctrlUs) : 0.0;
+    double bottle = (percUs > ctrlUs) ? percUs : ctrlUs;
+    double pipeHz = (bottle > 0.0) ? 1.0e6 / bottle : 0.0;
+    double rateHz = (pSt->Elapsed_Ns > 0) ? (double)pSt->Frames_Processed * 1.0e9 / (double)pSt->Elapsed_Ns : 0.0;
+
+    printf("---- Pipelined (period=%.3f ms) ----\n", (double)pPl->Config.Period_Ns / (double)ADAS_NS_PER_MS);
+    printf("Published=%llu, Processed=%llu, Dropped=%llu, DeadlineMiss=%llu\n",
+           (unsigned long long)pSt->Frames_Published,
+           (unsigned long long)pSt->Frames_Processed,
+           (unsigned long long)pSt->Frames_Dropped,
+           (unsigned long long)pSt->Deadline_Misses);
+    printf("Perception avg=%.2f us, max=%.2f us | Control avg=%.2f us, max=%.2f us\n",
+           percUs, (double)pSt->Perception_Max_Ns / 1000.0,
+           ctrlUs, (double)pSt->Control_Max_Ns / 1000.0);
+    printf("Handoff(added latency) avg=%.2f us, max=%.2f us | End-to-end avg=%.2f us, max=%.2f us\n",
+           hoUs, (double)pSt->Handoff_Max_Ns / 1000.0,
+           latUs, (double)pSt->Latency_Max_Ns / 1000.0);
+    printf("Throughput measured=%.1f Hz, bound sequential=%.1f Hz, pipelined=%.1f Hz (x%.2f)\n",
+           rateHz, seqHz, pipeHz, (seqHz > 0.0) ? pipeHz / seqHz : 0.0);
+}
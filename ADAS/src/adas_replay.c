@@ -0,0 +1,286 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* pthread_attr_setaffinity_np, CPU_SET */
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include "adas_replay.h"
+#include "adas_time.h"
+
+typedef struct
+{
+    const AdasCycleLog_t     *pLog;
+    const AdasReplayConfig_t *pConfig;
+    AdasReplayShard_t        *pShard;
+} ReplayWorker_t;
+
+static const char *const s_fieldNames[ADAS_REPLAY_FIELD_COUNT] = {
+    "ego", "lane", "targets", "acc", "aeb", "lfa", "control"
+};
+
+/* 비교 대상 구조체는 4바이트 필드만으로 구성 (패딩 없음) -> memcmp 로 비트 단위 비교 */
+#define FIELD_DIFF(a, b)  (memcmp(&(a), &(b), sizeof(a)) != 0)
+
+/* ----------------------------------------------------------------------------
+ * AdasReplay_DefaultConfig
+ * ---------------------------------------------------------------------------*/
+void AdasReplay_DefaultConfig(AdasReplayConfig_t *pConfig)
+{
+    if(!pConfig)
+        return;
+
+    memset(pConfig, 0, sizeof(*pConfig));
+    pConfig->Thread_Count        = 1;
+    pConfig->Checkpoint_Interval = 1000;
+    pConfig->Warmup_Cycles       = 500;
+    pConfig->Delta_Time          = 0.01f;
+    pConfig->Cpu_Base            = -1;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasReplay_Compare
+ * ---------------------------------------------------------------------------*/
+uint32_t AdasReplay_Compare(const AdasCycleRecord_t *pRec, const AdasFrameOutput_t *pOut)
+{
+    if(!pRec || !pOut)
+        return 0;
+
+    int32_t accMode = (int32_t)pOut->Acc_Mode;
+    int32_t aebMode = (int32_t)pOut->Aeb_Mode;
+    int32_t lfaMode = (int32_t)pOut->Lfa_Mode;
+    uint32_t diff = 0;
+
+    if(FIELD_DIFF(pRec->Ego, pOut->Ego))
+        diff |= 1u << ADAS_REPLAY_FIELD_EGO;
+    if(FIELD_DIFF(pRec->Lane_Select, pOut->Lane_Select))
+        diff |= 1u << ADAS_REPLAY_FIELD_LANE;
+    if(FIELD_DIFF(pRec->Acc_Target, pOut->Acc_Target) || FIELD_DIFF(pRec->Aeb_Target, pOut->Aeb_Target))
+        diff |= 1u << ADAS_REPLAY_FIELD_TARGETS;
+    if((pRec->Acc_Mode != accMode) || FIELD_DIFF(pRec->Accel_Acc, pOut->Accel_Acc))
+        diff |= 1u << ADAS_REPLAY_FIELD_ACC;
+    if((pRec->Aeb_Mode != aebMode) || FIELD_DIFF(pRec->Decel_Aeb, pOut->Decel_Aeb) ||
+       FIELD_DIFF(pRec->Ttc, pOut->Ttc))
+        diff |= 1u << ADAS_REPLAY_FIELD_AEB;
+    if((pRec->Lfa_Mode != lfaMode) || FIELD_DIFF(pRec->Steer_Lfa, pOut->Steer_Lfa))
+        diff |= 1u << ADAS_REPLAY_FIELD_LFA;
+    if(FIELD_DIFF(pRec->Control, pOut->Control))
+        diff |= 1u << ADAS_REPLAY_FIELD_CONTROL;
+
+    return diff;
+}
+
+/* ----------------------------------------------------------------------------
+ * 구간 재생 (스레드 본체)
+ *  - 파이프라인/출력은 스레드 스택에 두어 구간 간 공유 없음
+ *  - 계수는 지역 변수로 누적 후 마지막에 한 번 기록
+ * ---------------------------------------------------------------------------*/
+static void *replay_shard(void *pArg)
+{
+    ReplayWorker_t    *pW  = (ReplayWorker_t *)pArg;
+    AdasReplayShard_t *pSh = pW->pShard;
+    AdasPipeline_t     pipe;
+    AdasFrameOutput_t  out;
+    uint64_t           mismatches = 0, firstMismatch = ADAS_REPLAY_NO_MISMATCH;
+    uint64_t           fieldMismatches[ADAS_REPLAY_FIELD_COUNT];
+
+    memset(&out, 0, sizeof(out));
+    memset(fieldMismatches, 0, sizeof(fieldMismatches));
+    AdasPipeline_Init(&pipe, pW->pConfig->Delta_Time);
+    if(pSh->Restored)
+        AdasSnapshot_Restore(AdasCycleLog_GetSnapshot(pW->pLog, pSh->First - 1), &pipe);
+
+    uint64_t t0 = AdasTime_NowNs();
+    for(uint64_t i = pSh->Start; i < pSh->End; i++)
+    {
+        const AdasCycleRecord_t *pRec = AdasCycleLog_Get(pW->pLog, i);
+        AdasPipeline_Step(&pipe, &pRec->Input, &out);
+        if(i < pSh->First)
+            continue;
+
+        uint32_t diff = AdasReplay_Compare(pRec, &out);
+        if(diff != 0)
+        {
+            if(mismatches == 0) firstMismatch = i;
+            mismatches++;
+            for(int f = 0; f < ADAS_REPLAY_FIELD_COUNT; f++)
+                fieldMismatches[f] += (diff >> f) & 1u;
+        }
+    }
+
+    pSh->Elapsed_Ns     = AdasTime_NowNs() - t0;
+    pSh->Cycles_Run     = pSh->End - pSh->Start;
+    pSh->Mismatches     = mismatches;
+    pSh->First_Mismatch = firstMismatch;
+    memcpy(pSh->Field_Mismatches, fieldMismatches, sizeof(fieldMismatches));
+    return NULL;
+}
+
+/* 경계 직전 레코드(First - 1)에 유효한 스냅샷이 있는지 */
+static int has_checkpoint(const AdasCycleLog_t *pLog, uint64_t first)
+{
+    if(first == 0)
+        return 0;
+
+    const AdasSnapshot_t *pSnap = AdasCycleLog_GetSnapshot(pLog, first - 1);
+    return pSnap && (AdasSnapshot_Validate(pSnap) == 0) && (pSnap->Cycle == first);
+}
+
+/* ----------------------------------------------------------------------------
+ * 구간 나누기: 경계 단위 블록을 스레드 수로 균등 분배
+ *  - 로그 스냅샷 간격이 있으면 경계를 그 배수로 올려 모든 경계에 체크포인트 확보
+ * ---------------------------------------------------------------------------*/
+static int plan_shards(const AdasCycleLog_t *pLog, const AdasReplayConfig_t *pConfig, AdasReplayShard_t *pShards)
+{
+    uint64_t records   = AdasCycleLog_Count(pLog);
+    uint64_t interval  = pConfig->Checkpoint_Interval;
+    uint64_t snapEvery = pLog->pHeader->Snapshot_Interval;
+    if(snapEvery != 0)
+        interval = ((interval + snapEvery - 1) / snapEvery) * snapEvery;
+
+    uint64_t blocks    = (records + interval - 1) / interval;
+    uint64_t count     = (uint64_t)pConfig->Thread_Count;
+    if(count > blocks) count = blocks;
+    if(count == 0)     count = 1;
+
+    for(uint64_t k = 0; k < count; k++)
+    {
+        AdasReplayShard_t *pSh = &pShards[k];
+        uint64_t b0 = (k * blocks) / count;
+        uint64_t b1 = ((k + 1) * blocks) / count;
+
+        memset(pSh, 0, sizeof(*pSh));
+        pSh->First = b0 * interval;
+        pSh->End   = (b1 * interval < records) ? (b1 * interval) : records;
+        pSh->Restored = has_checkpoint(pLog, pSh->First);
+        if(pSh->Restored)
+            pSh->Start = pSh->First;
+        else
+            pSh->Start = (pSh->First > pConfig->Warmup_Cycles) ? (pSh->First - pConfig->Warmup_Cycles) : 0;
+        pSh->First_Mismatch = ADAS_REPLAY_NO_MISMATCH;
+    }
+    return (int)count;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasReplay_Run
+ *  - 구간 0 은 호출 스레드에서 실행
+ * ---------------------------------------------------------------------------*/
+int AdasReplay_Run(const AdasCycleLog_t     *pLog,
+                   const AdasReplayConfig_t *pConfig,
+                   AdasReplayResult_t       *pResult)
+{
+    if(!pLog || !pConfig || !pResult)
+        return -1;
+    if((pConfig->Thread_Count < 1) || (pConfig->Thread_Count > ADAS_REPLAY_MAX_SHARDS) ||
+       (pConfig->Checkpoint_Interval == 0) || !(pConfig->Delta_Time > 0.0f))
+        return -1;
+
+    memset(pResult, 0, sizeof(*pResult));
+    pResult->First_Mismatch = ADAS_REPLAY_NO_MISMATCH;
+    pResult->Records        = AdasCycleLog_Count(pLog);
+    if(pResult->Records == 0)
+        return 0;
+
+    int count = plan_shards(pLog, pConfig, pResult->Shards);
+    pResult->Shard_Count = count;
+
+    ReplayWorker_t workers[ADAS_REPLAY_MAX_SHARDS];
+    pthread_t      threads[ADAS_REPLAY_MAX_SHARDS];
+    int            started = 1, rc = 0;
+
+    for(int k = 0; k < count; k++)
+    {
+        workers[k].pLog    = pLog;
+        workers[k].pConfig = pConfig;
+        workers[k].pShard  = &pResult->Shards[k];
+    }
+
+    uint64_t t0 = AdasTime_NowNs();
+    for(int k = 1; k < count; k++)
+    {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        if((pConfig->Cpu_Base >= 0) && (pConfig->Cpu_Base < (CPU_SETSIZE - k)))
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET((size_t)(pConfig->Cpu_Base + k), &set);
+            pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+        }
+        int err = pthread_create(&threads[k], &attr, replay_shard, &workers[k]);
+        pthread_attr_destroy(&attr);
+        if(err != 0)
+        {
+            rc = -2;
+            break;
+        }
+        started++;
+    }
+
+    if(rc == 0)
+    {
+        if((pConfig->Cpu_Base >= 0) && (pConfig->Cpu_Base < CPU_SETSIZE))
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET((size_t)pConfig->Cpu_Base, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+        replay_shard(&workers[0]);
+    }
+
+    for(int k = 1; k < started; k++)
+        pthread_join(threads[k], NULL);
+    pResult->Elapsed_Ns = AdasTime_NowNs() - t0;
+    if(rc != 0)
+        return rc;
+
+    /* 구간 결과 합산 (구간 순서 = 레코드 순서) */
+    for(int k = 0; k < count; k++)
+    {
+        const AdasReplayShard_t *pSh = &pResult->Shards[k];
+        pResult->Cycles_Run += pSh->Cycles_Run;
+        pResult->Restored_Shards += pSh->Restored;
+        pResult->Mismatches += pSh->Mismatches;
+        if((pResult->First_Mismatch == ADAS_REPLAY_NO_MISMATCH) && (pSh->Mismatches != 0))
+            pResult->First_Mismatch = pSh->First_Mismatch;
+        for(int f = 0; f < ADAS_REPLAY_FIELD_COUNT; f++)
+            pResult->Field_Mismatches[f] += pSh->Field_Mismatches[f];
+    }
+    pResult->Cycles_Per_Sec = (pResult->Elapsed_Ns > 0) ?
+        (double)pResult->Records * 1.0e9 / (double)pResult->Elapsed_Ns : 0.0;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasReplay_PrintResult
+ * ---------------------------------------------------------------------------*/
+void AdasReplay_PrintResult(const AdasReplayResult_t *pResult)
+{
+    if(!pResult)
+        return;
+
+    printf("---- Replay (%d shard%s, %d from snapshot) ----\n", pResult->Shard_Count,
+           (pResult->Shard_Count == 1) ? "" : "s", pResult->Restored_Shards);
+    printf("Records=%llu, CyclesRun=%llu, Elapsed=%.3f ms, Rate=%.0f cycles/s\n",
+           (unsigned long long)pResult->Records,
+           (unsigned long long)pResult->Cycles_Run,
+           (double)pResult->Elapsed_Ns / (double)ADAS_NS_PER_MS,
+           pResult->Cycles_Per_Sec);
+
+    if(pResult->Mismatches == 0)
+    {
+        printf("Mismatch=0 (bit-exact)\n");
+        return;
+    }
+
+    printf("Mismatch=%llu, First=%llu\n",
+           (unsigned long long)pResult->Mismatches,
+           (unsigned long long)pResult->First_Mismatch);
+    for(int f = 0; f < ADAS_REPLAY_FIELD_COUNT; f++)
+    {
+        if(pResult->Field_Mismatches[f] != 0)
+            printf("  %-8s %llu\n", s_fieldNames[f], (unsigned long long)pResult->Field_Mismatches[f]);
+    }
+}
@@ -0,0 +1,83 @@
+#include "adas_rng.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ADAS_RNG_USE_SSE2 1
+#else
+#define ADAS_RNG_USE_SSE2 0
+#endif
+
+/*─────────────────────────────
+  SSE2 4-lane Philox
+  - _mm_mul_epu32 는 짝수 lane(0, 2) 32x32 -> 64 곱만 지원
+    -> 홀수 lane 은 64 bit 오른쪽 shift 후 곱하고 hi/lo 를 다시 합침
+─────────────────────────────*/
+#if ADAS_RNG_USE_SSE2
+
+static inline void sse_mulhilo(__m128i a, __m128i m, __m128i *pHi, __m128i *pLo)
+{
+    const __m128i loMask = _mm_set_epi32(0, -1, 0, -1);
+    __m128i even = _mm_mul_epu32(a, m);                         /* lane 0, 2 */
+    __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);     /* lane 1, 3 */
+
+    *pLo = _mm_or_si128(_mm_and_si128(even, loMask), _mm_slli_epi64(odd, 32));
+    *pHi = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(loMask, odd));
+}
+
+static inline void sse_philox(__m128i *pC0, __m128i *pC1, __m128i *pC2, __m128i *pC3, const uint32_t key[2])
+{
+    const __m128i m0 = _mm_set1_epi32((int)ADAS_PHILOX_M0);
+    const __m128i m1 = _mm_set1_epi32((int)ADAS_PHILOX_M1);
+    __m128i c0 = *pC0, c1 = *pC1, c2 = *pC2, c3 = *pC3;
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for(int r = 0; r < ADAS_PHILOX_ROUNDS; r++)
+    {
+        __m128i hi0, lo0, hi1, lo1;
+        sse_mulhilo(c0, m0, &hi0, &lo0);
+        sse_mulhilo(c2, m1, &hi1, &lo1);
+        c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), _mm_set1_epi32((int)k0));
+        c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), _mm_set1_epi32((int)k1));
+        c1 = lo1;
+        c3 = lo0;
+        k0 += ADAS_PHILOX_W0;
+        k1 += ADAS_PHILOX_W1;
+    }
+    *pC0 = c0; *pC1 = c1; *pC2 = c2; *pC3 = c3;
+}
+
+#endif /* ADAS_RNG_USE_SSE2 */
+
+/*─────────────────────────────
+ * AdasRng_Philox4x32_Batch
+─────────────────────────────*/
+void AdasRng_Philox4x32_Batch(const uint32_t *pCtr0, const uint32_t *pCtr1, uint32_t ctr2, uint32_t ctr3,
+                              const uint32_t key[2], int count,
+                              uint32_t *pOut0, uint32_t *pOut1, uint32_t *pOut2, uint32_t *pOut3)
+{
+    if(!pCtr0 || !pCtr1 || !key || !pOut0 || !pOut1 || !pOut2 || !pOut3 || count <= 0)
+        return;
+
+    int i = 0;
+#if ADAS_RNG_USE_SSE2
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128i c0 = _mm_loadu_si128((const __m128i *)&pCtr0[i]);
+        __m128i c1 = _mm_loadu_si128((const __m128i *)&pCtr1[i]);
+        __m128i c2 = _mm_set1_epi32((int)ctr2);
+        __m128i c3 = _mm_set1_epi32((int)ctr3);
+        sse_philox(&c0, &c1, &c2, &c3, key);
+        _mm_storeu_si128((__m128i *)&pOut0[i], c0);
+        _mm_storeu_si128((__m128i *)&pOut1[i], c1);
+        _mm_storeu_si128((__m128i *)&pOut2[i], c2);
+        _mm_storeu_si128((__m128i *)&pOut3[i], c3);
+    }
+#endif
+    for(; i < count; i++)
+    {
+        uint32_t ctr[4] = { pCtr0[i], pCtr1[i], ctr2, ctr3 };
+        uint32_t out[4];
+        AdasRng_Philox4x32(ctr, key, out);
+        pOut0[i] = out[0]; pOut1[i] = out[1]; pOut2[i] = out[2]; pOut3[i] = out[3];
+    }
+}
@@ -0,0 +1,400 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* clock_nanosleep, sched_setaffinity, CPU_SET */
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include "adas_runtime.h"
+#include "adas_time.h"
+#include "adas_trace.h"
+
+/* ----------------------------------------------------------------------------
+ * AdasRuntime_DefaultConfig
+ * ---------------------------------------------------------------------------*/
+void AdasRuntime_DefaultConfig(AdasRuntimeConfig_t *pConfig)
+{
+    if(!pConfig)
+        return;
+
+    memset(pConfig, 0, sizeof(*pConfig));
+    pConfig->Period_Ns   = 10ULL * ADAS_NS_PER_MS;
+    pConfig->Cycle_Limit = 0;
+    pConfig->Rt_Priority = 0;
+    pConfig->Cpu_Id      = -1;
+    pConfig->Lock_Memory = 0;
+    pConfig->Worker_Count    = 0;
+    pConfig->Worker_Cpu_Base = -1;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasRuntime_Init
+ * ---------------------------------------------------------------------------*/
+int AdasRuntime_Init(AdasRuntime_t             *pRt,
+                     const AdasRuntimeConfig_t *pConfig,
+                     AdasInputFn_t              pfnInput,
+                     AdasOutputFn_t             pfnOutput,
+                     void                      *pUser)
+{
+    if(!pRt || !pConfig || pConfig->Period_Ns == 0 ||
+       pConfig->Worker_Count < 0 || pConfig->Worker_Count > ADAS_TASK_GRAPH_MAX_WORKERS)
+        return -1;
+
+    memset(pRt, 0, sizeof(*pRt));
+    pRt->Config    = *pConfig;
+    pRt->pfnInput  = pfnInput;
+    pRt->pfnOutput = pfnOutput;
+    pRt->pUser     = pUser;
+
+    if(AdasPipeline_Init(&pRt->Pipeline, (float)pConfig->Period_Ns / (float)ADAS_NS_PER_SEC) != 0)
+        return -1;
+
+    if(pConfig->Worker_Count > 0)
+    {
+        if((AdasPipeline_BuildGraph(&pRt->Graph) != 0) ||
+           (AdasTaskGraph_Start(&pRt->Graph, pConfig->Worker_Count,
+                                pConfig->Worker_Cpu_Base, pConfig->Rt_Priority) != 0))
+            return -1;
+    }
+    return 0;
+}
+
+void AdasRuntime_SetInputRef(AdasRuntime_t *pRt, AdasInputRefFn_t pfnInputRef, AdasInputCheckFn_t pfnInputCheck)
+{
+    if(pRt)
+    {
+        pRt->pfnInputRef   = pfnInputRef;
+        pRt->pfnInputCheck = pfnInputRef ? pfnInputCheck : NULL;
+    }
+}
+
+void AdasRuntime_SetLog(AdasRuntime_t *pRt, AdasCycleLog_t *pLog)
+{
+    if(pRt)
+        pRt->pLog = pLog;
+}
+
+void AdasRuntime_SetTelemetry(AdasRuntime_t *pRt, AdasTelemChannel_t *pCh)
+{
+    if(pRt)
+        pRt->pTelem = pCh;
+}
+
+void AdasRuntime_SetMetrics(AdasRuntime_t *pRt, AdasMetrics_t *pMetrics)
+{
+    if(!pRt)
+        return;
+    pRt->pMetrics = pMetrics;
+    AdasPipeline_SetMetrics(&pRt->Pipeline, pMetrics);
+}
+
+void AdasRuntime_SetPerf(AdasRuntime_t *pRt, AdasPerf_t *pPerf)
+{
+    if(pRt)
+        pRt->pPerf = pPerf;
+}
+
+/* 모드 전환 이벤트 (이전 모드 갱신) */
+static void emit_mode_change(AdasTelemChannel_t *pCh, uint16_t event, uint64_t cycle,
+                             int32_t *pPrev, int32_t mode, float ttc)
+{
+    if(mode == *pPrev)
+        return;
+
+    uint64_t args[4] = { cycle, AdasTelemetry_I(*pPrev), AdasTelemetry_I(mode), AdasTelemetry_F(ttc) };
+    AdasTelemetry_Emit(pCh, event, (event == ADAS_TELEM_EV_AEB_MODE) ? 4 : 3, args);
+    *pPrev = mode;
+}
+
+void AdasRuntime_Destroy(AdasRuntime_t *pRt)
+{
+    if(pRt)
+        AdasTaskGraph_Stop(&pRt->Graph);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasRuntime_ApplyRtSettings
+ *  - mlockall 먼저: 이후 페이지 폴트로 인한 지연 제거
+ * ---------------------------------------------------------------------------*/
+int AdasRuntime_ApplyRtSettings(const AdasRuntimeConfig_t *pConfig)
+{
+    if(!pConfig)
+        return 0;
+
+    int failed = 0;
+
+    if(pConfig->Lock_Memory)
+    {
+        if(mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+            failed |= ADAS_RT_FAIL_MLOCK;
+    }
+
+    if(pConfig->Cpu_Id >= CPU_SETSIZE)
+    {
+        failed |= ADAS_RT_FAIL_AFFINITY;
+    }
+    else if(pConfig->Cpu_Id >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET((size_t)pConfig->Cpu_Id, &set);
+        if(pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+            failed |= ADAS_RT_FAIL_AFFINITY;
+    }
+
+    if(pConfig->Rt_Priority > 0)
+    {
+        struct sched_param sp;
+        memset(&sp, 0, sizeof(sp));
+        sp.sched_priority = pConfig->Rt_Priority;
+        if(pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp) != 0)
+            failed |= ADAS_RT_FAIL_SCHED;
+    }
+
+    return failed;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasRuntime_Run
+ *  - release(k) = start + k * Period (절대 시각)
+ *  - 처리 종료가 release(k+1) 이후면 deadline miss, 이미 지난 release 는 건너뜀
+ * ---------------------------------------------------------------------------*/
+int AdasRuntime_Run(AdasRuntime_t *pRt)
+{
+    if(!pRt)
+        return -1;
+
+    const uint64_t period    = pRt->Config.Period_Ns;
+    const float    periodMs  = (float)period / (float)ADAS_NS_PER_MS;
+    AdasRuntimeStats_t *pSt  = &pRt->Stats;
+
+    uint64_t release = AdasTime_NowNs() + period;
+    uint64_t slot    = 0;   /* 논리 시각 (release 인덱스) */
+
+    /* 텔레메트리: 모드 전환 검출용 직전 모드 */
+    AdasTelemChannel_t *pTelem = pRt->pTelem;
+    AdasMetrics_t      *pMetrics = pRt->pMetrics;
+
+    /* 성능 카운터: 단계 경계마다 그룹 읽기 (읽기 시간은 단계 시간에서 제외) */
+    AdasPerf_t *pPerf = (pRt->pPerf && (pRt->pPerf->Slot_Count > 0)) ? pRt->pPerf : NULL;
+    AdasPerfSample_t perfPrev, perfCur;
+    int32_t prevAcc = (int32_t)pRt->Output.Acc_Mode;
+    int32_t prevAeb = (int32_t)pRt->Output.Aeb_Mode;
+    int32_t prevLfa = (int32_t)pRt->Output.Lfa_Mode;
+
+    ADAS_TRACE_THREAD("loop");
+
+    while(!pRt->Stop_Requested)
+    {
+        if((pRt->Config.Cycle_Limit != 0) && (pSt->Cycles >= pRt->Config.Cycle_Limit))
+            break;
+
+        AdasTime_SleepUntilNs(release);
+        uint64_t wake = AdasTime_NowNs();
+        ADAS_TRACE_BEGIN(ADAS_TRACE_CYCLE);
+
+        uint64_t latency = (wake > release) ? (wake - release) : 0;
+        pSt->Wake_Latency_Total_Ns += latency;
+        if(latency > pSt->Wake_Latency_Max_Ns) pSt->Wake_Latency_Max_Ns = latency;
+        if(pMetrics)
+            AdasHist_Record(&pMetrics->Hist[ADAS_METRIC_WAKE], latency);
+
+        /* 입력 (참조 입력은 복사 없이 프레임 포인터 사용) */
+        ADAS_TRACE_BEGIN(ADAS_TRACE_INPUT);
+        const AdasFrameInput_t *pIn = &pRt->Input;
+        if(pRt->pfnInputRef)
+        {
+            pIn = NULL;
+            if(pRt->pfnInputRef(pRt->pUser, pSt->Cycles, &pIn) < 0)
+                break;
+        }
+        else
+        {
+            pRt->Input.Time.Current_Time = (float)slot * periodMs;
+            if(pRt->pfnInput && (pRt->pfnInput(pRt->pUser, pSt->Cycles, &pRt->Input) < 0))
+                break;
+        }
+        ADAS_TRACE_END(ADAS_TRACE_INPUT);
+
+        if(!pIn)
+        {
+            pSt->Input_Missing++;
+            if(pTelem)
+            {
+                uint64_t args[1] = { pSt->Cycles };
+                AdasTelemetry_Emit(pTelem, ADAS_TELEM_EV_INPUT_MISSING, 1, args);
+            }
+        }
+        else
+        {
+            /* 재확인 실패 시 되돌릴 상태 (참조 입력 재확인을 쓸 때만) */
+            if(pRt->pfnInputCheck)
+            {
+                pRt->Pipeline_Saved = pRt->Pipeline;
+                pRt->Output_Saved   = pRt->Output;
+            }
+
+            /* 파이프라인 실행 + 단계별 계측 (그래프 모드는 태스크별 실행 시간) */
+            uint64_t stageNs[ADAS_STAGE_COUNT];
+            uint64_t tStart = AdasTime_NowNs();
+            if(pRt->Graph.Started)
+            {
+                AdasPipeline_StepGraph(&pRt->Graph, &pRt->Pipeline, pIn, &pRt->Output);
+                for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+                    stageNs[s] = pRt->Graph.Task_Ns[s];
+            }
+            else
+            {
+                uint64_t t0 = tStart;
+                int perfOk = pPerf && (AdasPerf_Read(pPerf, &perfPrev) == 0);
+                if(perfOk) t0 = AdasTime_NowNs();
+                for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+                {
+                    AdasPipeline_RunStage(&pRt->Pipeline, (AdasStage_e)s, pIn, &pRt->Output);
+                    uint64_t t1 = AdasTime_NowNs();
+                    stageNs[s] = t1 - t0;
+                    if(perfOk)
+                    {
+                        perfOk = (AdasPerf_Read(pPerf, &perfCur) == 0);
+                        if(perfOk)
+                            AdasPerf_AddStage(pPerf, (AdasStage_e)s, &perfPrev, &perfCur);
+                        perfPrev = perfCur;
+                        t1 = AdasTime_NowNs();
+                    }
+                    t0 = t1;
+                }
+            }
+            uint64_t pipeNs = AdasTime_NowNs() - tStart;
+            pSt->Pipeline_Runs++;
+            pSt->Pipeline_Total_Ns += pipeNs;
+            if(pipeNs > pSt->Pipeline_Max_Ns) pSt->Pipeline_Max_Ns = pipeNs;
+            if(pMetrics)
+            {
+                for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+                    AdasHist_Record(&pMetrics->Hist[s], stageNs[s]);
+                AdasHist_Record(&pMetrics->Hist[ADAS_METRIC_PIPELINE], pipeNs);
+            }
+
+            for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+            {
+                uint64_t dt = stageNs[s];
+                pSt->Stage_Total_Ns[s] += dt;
+                if(dt > pSt->Stage_Max_Ns[s]) pSt->Stage_Max_Ns[s] = dt;
+                if((pRt->Config.Stage_Budget_Ns[s] != 0) && (dt > pRt->Config.Stage_Budget_Ns[s]))
+                {
+                    pSt->Stage_Overruns[s]++;
+                    if(pTelem)
+                    {
+                        uint64_t args[4] = { pSt->Cycles, (uint64_t)s,
+                                             AdasTelemetry_F((double)dt / (double)ADAS_NS_PER_US),
+                                             AdasTelemetry_F((double)pRt->Config.Stage_Budget_Ns[s] / (double)ADAS_NS_PER_US) };
+                        AdasTelemetry_Emit(pTelem, ADAS_TELEM_EV_STAGE_OVERRUN, 4, args);
+                    }
+                }
+            }
+        }
+
+        /* 참조 입력 재확인: 처리 중 덮어쓰였으면 이번 주기 결과 폐기 (출력/기록 없음) */
+        if(pIn && pRt->pfnInputCheck && !pRt->pfnInputCheck(pRt->pUser, pSt->Cycles, pIn))
+        {
+            pRt->Pipeline = pRt->Pipeline_Saved;
+            pRt->Output   = pRt->Output_Saved;
+            pSt->Input_Torn++;
+            if(pTelem)
+            {
+                uint64_t args[1] = { pSt->Cycles };
+                AdasTelemetry_Emit(pTelem, ADAS_TELEM_EV_INPUT_TORN, 1, args);
+            }
+            pIn = NULL;
+        }
+
+        if(pIn && pTelem)
+        {
+            const AdasFrameOutput_t *pOut = &pRt->Output;
+            emit_mode_change(pTelem, ADAS_TELEM_EV_ACC_MODE, pSt->Cycles, &prevAcc, (int32_t)pOut->Acc_Mode, 0.0f);
+            emit_mode_change(pTelem, ADAS_TELEM_EV_AEB_MODE, pSt->Cycles, &prevAeb, (int32_t)pOut->Aeb_Mode, pOut->Ttc.TTC);
+            emit_mode_change(pTelem, ADAS_TELEM_EV_LFA_MODE, pSt->Cycles, &prevLfa, (int32_t)pOut->Lfa_Mode, 0.0f);
+        }
+
+        /* 출력 + 기록 */
+        ADAS_TRACE_BEGIN(ADAS_TRACE_OUTPUT);
+        if(pIn && pRt->pfnOutput)
+            pRt->pfnOutput(pRt->pUser, pSt->Cycles, &pRt->Output);
+        if(pIn && pRt->pLog)
+            AdasCycleLog_Append(pRt->pLog, pSt->Cycles, pIn, &pRt->Output, &pRt->Pipeline);
+        ADAS_TRACE_END(ADAS_TRACE_OUTPUT);
+        ADAS_TRACE_END(ADAS_TRACE_CYCLE);
+
+        uint64_t done = AdasTime_NowNs();
+        uint64_t busy = done - wake;
+        if(busy > pSt->Cycle_Max_Ns) pSt->Cycle_Max_Ns = busy;
+        if(pMetrics)
+            AdasHist_Record(&pMetrics->Hist[ADAS_METRIC_RESPONSE], (done > release) ? (done - release) : 0);
+        pSt->Cycles++;
+
+        /* 다음 release: 마감 초과 시 이미 지난 주기는 건너뜀 */
+        release += period;
+        slot++;
+        if(done > release)
+        {
+            uint64_t behind = ((done - release) / period) + 1;
+            pSt->Deadline_Misses++;
+            pSt->Skipped_Periods += behind;
+            if(pTelem)
+            {
+                uint64_t args[3] = { pSt->Cycles - 1, AdasTelemetry_F((double)busy / (double)ADAS_NS_PER_US), behind };
+                AdasTelemetry_Emit(pTelem, ADAS_TELEM_EV_DEADLINE_MISS, 3, args);
+            }
+            release += behind * period;
+            slot    += behind;
+        }
+    }
+
+    return 0;
+}
+
+void AdasRuntime_RequestStop(AdasRuntime_t *pRt)
+{
+    if(pRt)
+        pRt->Stop_Requested = 1;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasRuntime_PrintStats
+ * ---------------------------------------------------------------------------*/
+void AdasRuntime_PrintStats(const AdasRuntime_t *pRt)
+{
+    if(!pRt)
+        return;
+
+    const AdasRuntimeStats_t *pSt = &pRt->Stats;
+    uint64_t n    = (pSt->Cycles > 0) ? pSt->Cycles : 1;
+    uint64_t runs = (pSt->Pipeline_Runs > 0) ? pSt->Pipeline_Runs : 1;   /* 입력 없는 주기 제외 */
+
+    printf("---- Runtime (period=%.3f ms) ----\n", (double)pRt->Config.Period_Ns / (double)ADAS_NS_PER_MS);
+    printf("Cycles=%llu, InputMissing=%llu, InputTorn=%llu, DeadlineMiss=%llu, Skipped=%llu\n",
+           (unsigned long long)pSt->Cycles,
+           (unsigned long long)pSt->Input_Missing,
+           (unsigned long long)pSt->Input_Torn,
+           (unsigned long long)pSt->Deadline_Misses,
+           (unsigned long long)pSt->Skipped_Periods);
+    printf("WakeLatency avg=%.1f us, max=%.1f us, CycleMax=%.1f us\n",
+           (double)pSt->Wake_Latency_Total_Ns / (double)n / 1000.0,
+           (double)pSt->Wake_Latency_Max_Ns / 1000.0,
+           (double)pSt->Cycle_Max_Ns / 1000.0);
+    printf("Pipeline(%s) runs=%llu, avg=%.2f us, max=%.2f us\n",
+           pRt->Graph.Started ? "task graph" : "sequential",
+           (unsigned long long)pSt->Pipeline_Runs,
+           (double)pSt->Pipeline_Total_Ns / (double)runs / 1000.0,
+           (double)pSt->Pipeline_Max_Ns / 1000.0);
+    for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+    {
+        printf("  %-12s avg=%8.2f us, max=%8.2f us, overrun=%llu\n",
+               AdasPipeline_StageName((AdasStage_e)s),
+               (double)pSt->Stage_Total_Ns[s] / (double)runs / 1000.0,
+               (double)pSt->Stage_Max_Ns[s] / 1000.0,
+               (unsigned long long)pSt->Stage_Overruns[s]);
+    }
+}
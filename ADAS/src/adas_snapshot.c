@@ -0,0 +1,64 @@
+#include <string.h>
+#include "adas_snapshot.h"
+
+/* ----------------------------------------------------------------------------
+ * AdasSnapshot_Capture
+ * ---------------------------------------------------------------------------*/
+int AdasSnapshot_Capture(AdasSnapshot_t *pSnap, const AdasPipeline_t *pPipe, uint64_t cycle)
+{
+    if(!pSnap || !pPipe)
+        return ADAS_SNAPSHOT_ERR_ARG;
+
+    memset(pSnap, 0, sizeof(*pSnap));
+    pSnap->Magic    = ADAS_SNAPSHOT_MAGIC;
+    pSnap->Version  = ADAS_SNAPSHOT_VERSION;
+    pSnap->Size     = (uint32_t)sizeof(AdasSnapshot_t);
+    pSnap->Cycle    = cycle;
+    pSnap->Pipeline = *pPipe;
+    pSnap->Pipeline.pMetrics = NULL;    /* 기록 대상은 인스턴스 연결이지 상태가 아님 */
+    acc_get_default_state(&pSnap->Acc_Default);
+    lfa_get_default_state(&pSnap->Lfa_Default);
+    return 0;
+}
+
+int AdasSnapshot_Validate(const AdasSnapshot_t *pSnap)
+{
+    if(!pSnap)
+        return ADAS_SNAPSHOT_ERR_ARG;
+
+    if((pSnap->Magic   != ADAS_SNAPSHOT_MAGIC) ||
+       (pSnap->Version != ADAS_SNAPSHOT_VERSION) ||
+       (pSnap->Size    != sizeof(AdasSnapshot_t)))
+        return ADAS_SNAPSHOT_ERR_VERSION;
+
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasSnapshot_Restore
+ * ---------------------------------------------------------------------------*/
+int AdasSnapshot_Restore(const AdasSnapshot_t *pSnap, AdasPipeline_t *pPipe)
+{
+    if(!pPipe)
+        return ADAS_SNAPSHOT_ERR_ARG;
+
+    int rc = AdasSnapshot_Validate(pSnap);
+    if(rc != 0)
+        return rc;
+
+    AdasMetrics_t *pMetrics = pPipe->pMetrics;
+    *pPipe = pSnap->Pipeline;
+    pPipe->pMetrics = pMetrics;
+    return 0;
+}
+
+int AdasSnapshot_RestoreDefaults(const AdasSnapshot_t *pSnap)
+{
+    int rc = AdasSnapshot_Validate(pSnap);
+    if(rc != 0)
+        return rc;
+
+    acc_set_default_state(&pSnap->Acc_Default);
+    lfa_set_default_state(&pSnap->Lfa_Default);
+    return 0;
+}
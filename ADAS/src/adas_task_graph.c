@@ -0,0 +1,293 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* pthread_attr_setaffinity_np, CPU_SET */
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+#include "adas_task_graph.h"
+#include "adas_time.h"
+#include "adas_trace.h"
+
+#define TASK_GRAPH_DEFAULT_SPIN  2000u
+
+static inline void cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/* ready 큐 (Lock 보유 상태에서 호출, 주기당 태스크는 한 번만 들어가므로 크기 = 최대 태스크 수) */
+static void push_ready(AdasTaskGraph_t *pGraph, int task)
+{
+    int tail = (pGraph->Ready_Head + pGraph->Ready_Count) % ADAS_TASK_GRAPH_MAX_TASKS;
+    pGraph->Ready[tail] = (uint8_t)task;
+    __atomic_store_n(&pGraph->Ready_Count, pGraph->Ready_Count + 1, __ATOMIC_RELEASE);
+}
+
+static int pop_ready(AdasTaskGraph_t *pGraph)
+{
+    int task = pGraph->Ready[pGraph->Ready_Head];
+    pGraph->Ready_Head = (pGraph->Ready_Head + 1) % ADAS_TASK_GRAPH_MAX_TASKS;
+    __atomic_store_n(&pGraph->Ready_Count, pGraph->Ready_Count - 1, __ATOMIC_RELEASE);
+    return task;
+}
+
+/* 태스크 실행 (Lock 해제 상태) */
+static void execute_task(AdasTaskGraph_t *pGraph, int task, int threadId)
+{
+    const AdasTaskDesc_t *pTask = &pGraph->Tasks[task];
+    uint64_t t0 = AdasTime_NowNs();
+    pTask->pfnRun(pGraph->pCtx, pTask->Arg);
+    pGraph->Task_Ns[task]     = AdasTime_NowNs() - t0;
+    pGraph->Task_Thread[task] = threadId;
+}
+
+/* 완료 처리 (Lock 보유): 후속 태스크 해제, 새 ready 또는 전체 완료 시 깨움 */
+static void complete_task(AdasTaskGraph_t *pGraph, int task)
+{
+    int released = 0;
+    for(int i = 0; i < pGraph->Succ_Count[task]; i++)
+    {
+        int s = pGraph->Succ[task][i];
+        if(--pGraph->Remaining[s] == 0)
+        {
+            push_ready(pGraph, s);
+            released++;
+        }
+    }
+    pGraph->Done_Count++;
+
+    if(released > 0)
+        pthread_cond_broadcast(&pGraph->Work_Cv);
+    if((released > 0) || (pGraph->Done_Count == pGraph->Task_Count))
+        pthread_cond_broadcast(&pGraph->Done_Cv);
+}
+
+/* ----------------------------------------------------------------------------
+ * 워커: ready 태스크 실행, 없으면 잠시 spin 후 condvar 대기
+ * ---------------------------------------------------------------------------*/
+static void *worker_main(void *pArg)
+{
+    AdasTaskWorker_t *pWorker = (AdasTaskWorker_t *)pArg;
+    AdasTaskGraph_t  *pGraph  = pWorker->pGraph;
+    int               id      = pWorker->Id;
+
+#if ADAS_TRACE
+    char traceName[ADAS_TRACE_NAME_LEN];
+    snprintf(traceName, sizeof(traceName), "worker-%d", id);
+    ADAS_TRACE_THREAD(traceName);
+#endif
+
+    pthread_mutex_lock(&pGraph->Lock);
+    while(!pGraph->Shutdown)
+    {
+        if(pGraph->Ready_Count > 0)
+        {
+            int task = pop_ready(pGraph);
+            pthread_mutex_unlock(&pGraph->Lock);
+            execute_task(pGraph, task, id);
+            pthread_mutex_lock(&pGraph->Lock);
+            complete_task(pGraph, task);
+            continue;
+        }
+
+        /* 잠금 없이 ready 발생 대기 -> 없으면 condvar */
+        pthread_mutex_unlock(&pGraph->Lock);
+        for(uint32_t i = 0; i < pGraph->Spin_Limit; i++)
+        {
+            if(__atomic_load_n(&pGraph->Ready_Count, __ATOMIC_ACQUIRE) > 0)
+                break;
+            cpu_relax();
+        }
+        pthread_mutex_lock(&pGraph->Lock);
+        if((pGraph->Ready_Count == 0) && !pGraph->Shutdown)
+            pthread_cond_wait(&pGraph->Work_Cv, &pGraph->Lock);
+    }
+    pthread_mutex_unlock(&pGraph->Lock);
+    return NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTaskGraph_Build
+ *  - i < j 인 두 태스크가 같은 데이터를 다루고 한쪽이라도 쓰면 i -> j 간선
+ * ---------------------------------------------------------------------------*/
+int AdasTaskGraph_Build(AdasTaskGraph_t *pGraph, const AdasTaskDesc_t *pTasks, int taskCount)
+{
+    if(!pGraph || !pTasks || taskCount <= 0 || taskCount > ADAS_TASK_GRAPH_MAX_TASKS)
+        return -1;
+
+    for(int i = 0; i < taskCount; i++)
+    {
+        if(!pTasks[i].pfnRun)
+            return -1;
+    }
+
+    memset(pGraph, 0, sizeof(*pGraph));
+    pGraph->Task_Count = taskCount;
+    memcpy(pGraph->Tasks, pTasks, sizeof(pTasks[0]) * (size_t)taskCount);
+
+    for(int j = 0; j < taskCount; j++)
+    {
+        for(int i = 0; i < j; i++)
+        {
+            uint32_t conflict = (pTasks[i].Outputs & (pTasks[j].Inputs | pTasks[j].Outputs)) |
+                                (pTasks[i].Inputs  & pTasks[j].Outputs);
+            if(conflict)
+            {
+                pGraph->Succ[i][pGraph->Succ_Count[i]++] = (uint8_t)j;
+                pGraph->Pred_Count[j]++;
+                pGraph->Pred_Mask[j] |= (1u << i);
+            }
+        }
+    }
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTaskGraph_Start
+ * ---------------------------------------------------------------------------*/
+int AdasTaskGraph_Start(AdasTaskGraph_t *pGraph, int workerCount, int cpuBase, int rtPriority)
+{
+    if(!pGraph || pGraph->Task_Count <= 0 || pGraph->Started ||
+       workerCount < 0 || workerCount > ADAS_TASK_GRAPH_MAX_WORKERS)
+        return -1;
+
+    pthread_mutex_init(&pGraph->Lock, NULL);
+    pthread_cond_init(&pGraph->Work_Cv, NULL);
+    pthread_cond_init(&pGraph->Done_Cv, NULL);
+    pGraph->Spin_Limit   = TASK_GRAPH_DEFAULT_SPIN;
+    pGraph->Shutdown     = 0;
+    pGraph->Worker_Count = 0;
+    pGraph->Started      = 1;
+
+    for(int w = 0; w < workerCount; w++)
+    {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+
+        if((cpuBase >= 0) && (cpuBase < (CPU_SETSIZE - w)))
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET((size_t)(cpuBase + w), &set);
+            pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+        }
+        if(rtPriority > 0)
+        {
+            struct sched_param sp;
+            memset(&sp, 0, sizeof(sp));
+            sp.sched_priority = rtPriority;
+            pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+            pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+            pthread_attr_setschedparam(&attr, &sp);
+        }
+
+        AdasTaskWorker_t *pWorker = &pGraph->Workers[w];
+        pWorker->pGraph = pGraph;
+        pWorker->Id     = w + 1;
+        int rc = pthread_create(&pWorker->Thread, &attr, worker_main, pWorker);
+        if(rc != 0)
+        {
+            /* 권한 부족 등: CPU 고정/RT 없이 재시도 */
+            pGraph->Rt_Failed = 1;
+            rc = pthread_create(&pWorker->Thread, NULL, worker_main, pWorker);
+        }
+        pthread_attr_destroy(&attr);
+
+        if(rc != 0)
+        {
+            AdasTaskGraph_Stop(pGraph);
+            return -1;
+        }
+        pGraph->Worker_Count++;
+    }
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTaskGraph_Run
+ *  - 선행 태스크가 없는 태스크부터 ready, 호출 스레드도 ready 태스크를 실행
+ * ---------------------------------------------------------------------------*/
+int AdasTaskGraph_Run(AdasTaskGraph_t *pGraph, void *pCtx)
+{
+    if(!pGraph || !pGraph->Started)
+        return -1;
+
+    pthread_mutex_lock(&pGraph->Lock);
+    pGraph->pCtx        = pCtx;
+    pGraph->Ready_Head  = 0;
+    pGraph->Ready_Count = 0;
+    pGraph->Done_Count  = 0;
+    for(int t = 0; t < pGraph->Task_Count; t++)
+    {
+        pGraph->Remaining[t] = pGraph->Pred_Count[t];
+        if(pGraph->Remaining[t] == 0)
+            push_ready(pGraph, t);
+    }
+    if(pGraph->Worker_Count > 0)
+        pthread_cond_broadcast(&pGraph->Work_Cv);
+
+    while(pGraph->Done_Count < pGraph->Task_Count)
+    {
+        if(pGraph->Ready_Count > 0)
+        {
+            int task = pop_ready(pGraph);
+            pthread_mutex_unlock(&pGraph->Lock);
+            execute_task(pGraph, task, ADAS_TASK_GRAPH_CALLER);
+            pthread_mutex_lock(&pGraph->Lock);
+            complete_task(pGraph, task);
+        }
+        else
+        {
+            pthread_cond_wait(&pGraph->Done_Cv, &pGraph->Lock);
+        }
+    }
+    pthread_mutex_unlock(&pGraph->Lock);
+
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTaskGraph_Stop
+ * ---------------------------------------------------------------------------*/
+void AdasTaskGraph_Stop(AdasTaskGraph_t *pGraph)
+{
+    if(!pGraph || !pGraph->Started)
+        return;
+
+    pthread_mutex_lock(&pGraph->Lock);
+    pGraph->Shutdown = 1;
+    pthread_cond_broadcast(&pGraph->Work_Cv);
+    pthread_mutex_unlock(&pGraph->Lock);
+
+    for(int w = 0; w < pGraph->Worker_Count; w++)
+    {
+        pthread_join(pGraph->Workers[w].Thread, NULL);
+    }
+
+    pthread_cond_destroy(&pGraph->Done_Cv);
+    pthread_cond_destroy(&pGraph->Work_Cv);
+    pthread_mutex_destroy(&pGraph->Lock);
+    pGraph->Worker_Count = 0;
+    pGraph->Started      = 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTaskGraph_DependsOn : 직접 선행 비트를 선언 역순으로 전파 (전이 폐포)
+ * ---------------------------------------------------------------------------*/
+int AdasTaskGraph_DependsOn(const AdasTaskGraph_t *pGraph, int task, int pred)
+{
+    if(!pGraph || task < 0 || task >= pGraph->Task_Count || pred < 0 || pred >= pGraph->Task_Count)
+        return 0;
+
+    uint32_t reach = pGraph->Pred_Mask[task];
+    for(int i = task - 1; i >= 0; i--)
+    {
+        if(reach & (1u << i))
+            reach |= pGraph->Pred_Mask[i];
+    }
+    return (reach & (1u << pred)) ? 1 : 0;
+}
@@ -0,0 +1,344 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* pthread_attr_setaffinity_np, CPU_SET */
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include "adas_telemetry.h"
+#include "adas_time.h"
+
+#define TELEM_DEFAULT_POLL_NS  (1ULL * ADAS_NS_PER_MS)
+#define TELEM_BATCH            64
+#define TELEM_LINE_LEN         256
+#define TELEM_NICE             19
+
+/**
+ * @brief 이벤트 표 (ID -> 이름 + 인자 서식)
+ *  - 서식 변환 문자로 인자 형식 결정 (d/i, u/x/X, f/e/g), 길이 수식어(l/ll)는 쓰지 않음
+ *  - 플래그는 '-' / '0' 만 적용, 폭/정밀도는 숫자만 ('*' 없음)
+ */
+typedef struct
+{
+    const char *Name;
+    const char *Format;
+} TelemEventDesc_t;
+
+static const TelemEventDesc_t s_events[ADAS_TELEM_EV_COUNT] = {
+    [ADAS_TELEM_EV_INPUT_MISSING] = { "input_missing", "cycle=%u" },
+    [ADAS_TELEM_EV_DEADLINE_MISS] = { "deadline_miss", "cycle=%u busy=%.1f us skipped=%u" },
+    [ADAS_TELEM_EV_STAGE_OVERRUN] = { "stage_overrun", "cycle=%u stage=%u time=%.2f us budget=%.2f us" },
+    [ADAS_TELEM_EV_ACC_MODE]      = { "acc_mode",      "cycle=%u %d -> %d" },
+    [ADAS_TELEM_EV_AEB_MODE]      = { "aeb_mode",      "cycle=%u %d -> %d ttc=%.2f s" },
+    [ADAS_TELEM_EV_LFA_MODE]      = { "lfa_mode",      "cycle=%u %d -> %d" },
+    [ADAS_TELEM_EV_CONTROL]       = { "control",       "cycle=%u throttle=%.2f brake=%.2f steer=%.2f accel=%.2f decel=%.2f" },
+    [ADAS_TELEM_EV_INPUT_TORN]    = { "input_torn",    "cycle=%u" }
+};
+
+const char *AdasTelemetry_EventName(uint16_t event)
+{
+    return (event < ADAS_TELEM_EV_COUNT) ? s_events[event].Name : "?";
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTelemetry_Init / AddChannel
+ * ---------------------------------------------------------------------------*/
+int AdasTelemetry_Init(AdasTelemetry_t *pTelem, FILE *pOut)
+{
+    if(!pTelem)
+        return -1;
+
+    memset(pTelem, 0, sizeof(*pTelem));
+    pTelem->pOut     = pOut ? pOut : stdout;
+    pTelem->Poll_Ns  = TELEM_DEFAULT_POLL_NS;
+    pTelem->Start_Ns = AdasTime_NowNs();
+    return 0;
+}
+
+AdasTelemChannel_t *AdasTelemetry_AddChannel(AdasTelemetry_t *pTelem, const char *name)
+{
+    if(!pTelem || pTelem->Started || pTelem->Channel_Count >= ADAS_TELEM_MAX_CHANNELS)
+        return NULL;
+
+    AdasTelemChannel_t *pCh = &pTelem->Channels[pTelem->Channel_Count];
+    if(SpscQueue_Init(&pCh->Ring, pCh->Storage, sizeof(AdasTelemRecord_t), ADAS_TELEM_RING_CAPACITY) != 0)
+        return NULL;
+
+    snprintf(pCh->Name, sizeof(pCh->Name), "%s", name ? name : "");
+    pCh->Reported_Drops = 0;
+    pTelem->Channel_Count++;
+    return pCh;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTelemetry_Emit
+ *  - 슬롯에 직접 작성 후 Commit (release) -> 출력 스레드가 완성된 레코드만 읽음
+ * ---------------------------------------------------------------------------*/
+int AdasTelemetry_Emit(AdasTelemChannel_t *pCh, uint16_t event, uint32_t argCount, const uint64_t *pArgs)
+{
+    if(!pCh || (argCount != 0 && !pArgs))
+        return -1;
+
+    AdasTelemRecord_t *pRec = (AdasTelemRecord_t *)SpscQueue_WriteSlot(&pCh->Ring);
+    if(!pRec)
+        return -1;
+
+    if(argCount > ADAS_TELEM_MAX_ARGS)
+        argCount = ADAS_TELEM_MAX_ARGS;
+
+    pRec->Stamp_Ns  = AdasTime_NowNs();
+    pRec->Event     = event;
+    pRec->Arg_Count = (uint16_t)argCount;
+    for(uint32_t i = 0; i < argCount; i++)
+        pRec->Args[i] = pArgs[i];
+
+    SpscQueue_Commit(&pCh->Ring);
+    return 0;
+}
+
+/**
+ * @brief 변환 1개의 플래그/폭/정밀도 ("%-08.2f" -> Left=1, Zero=1, Width=8, Precision=2)
+ */
+typedef struct
+{
+    int Left;          /* '-' */
+    int Zero;          /* '0' */
+    int Width;         /* 0 = 없음 */
+    int Precision;     /* -1 = 없음 */
+} TelemSpec_t;
+
+/* 변환 1개 적용 (형식 문자열은 모두 리터럴, 폭/정밀도는 '*' 인자), 정수는 64비트로 확장 */
+static int format_one(char *pBuf, size_t size, const TelemSpec_t *pSpec, char conv, uint64_t arg)
+{
+    const int w  = pSpec->Left ? -pSpec->Width : pSpec->Width;   /* 음수 폭 = 왼쪽 정렬 */
+    const int z  = pSpec->Zero && !pSpec->Left;
+    const int p  = pSpec->Precision;                               /* 음수 = 정밀도 없음 */
+    const int zi = z && (p < 0);                                   /* 정수는 정밀도가 있으면 '0' 무시 (printf 와 같음) */
+    const long long          sv = (long long)(int64_t)arg;
+    const unsigned long long uv = (unsigned long long)arg;
+    double                   fv;
+
+    switch(conv)
+    {
+    case 'd': case 'i':
+        return zi ? snprintf(pBuf, size, "%0*lld", w, sv) : snprintf(pBuf, size, "%*.*lld", w, p, sv);
+    case 'u':
+        return zi ? snprintf(pBuf, size, "%0*llu", w, uv) : snprintf(pBuf, size, "%*.*llu", w, p, uv);
+    case 'x':
+        return zi ? snprintf(pBuf, size, "%0*llx", w, uv) : snprintf(pBuf, size, "%*.*llx", w, p, uv);
+    case 'X':
+        return zi ? snprintf(pBuf, size, "%0*llX", w, uv) : snprintf(pBuf, size, "%*.*llX", w, p, uv);
+    case 'f':
+        memcpy(&fv, &arg, sizeof(fv));
+        return z ? snprintf(pBuf, size, "%0*.*f", w, p, fv) : snprintf(pBuf, size, "%*.*f", w, p, fv);
+    case 'e':
+        memcpy(&fv, &arg, sizeof(fv));
+        return z ? snprintf(pBuf, size, "%0*.*e", w, p, fv) : snprintf(pBuf, size, "%*.*e", w, p, fv);
+    case 'g':
+        memcpy(&fv, &arg, sizeof(fv));
+        return z ? snprintf(pBuf, size, "%0*.*g", w, p, fv) : snprintf(pBuf, size, "%*.*g", w, p, fv);
+    default:
+        return 0;   /* 지원하지 않는 변환: 인자만 소비 */
+    }
+}
+
+/* "%" 다음의 플래그/폭/정밀도 읽기 (+, 공백, # 플래그는 무시), 변환 문자 위치 반환 */
+static const char *parse_spec(const char *p, TelemSpec_t *pSpec)
+{
+    pSpec->Left      = 0;
+    pSpec->Zero      = 0;
+    pSpec->Width     = 0;
+    pSpec->Precision = -1;
+
+    for(; *p && strchr("-+ #0", *p); p++)
+    {
+        if(*p == '-') pSpec->Left = 1;
+        if(*p == '0') pSpec->Zero = 1;
+    }
+    for(; (*p >= '0') && (*p <= '9'); p++)
+        if(pSpec->Width < TELEM_LINE_LEN)
+            pSpec->Width = (pSpec->Width * 10) + (*p - '0');
+    if(*p == '.')
+    {
+        pSpec->Precision = 0;
+        for(p++; (*p >= '0') && (*p <= '9'); p++)
+            if(pSpec->Precision < TELEM_LINE_LEN)
+                pSpec->Precision = (pSpec->Precision * 10) + (*p - '0');
+    }
+    return p;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTelemetry_Format
+ *  - 이벤트 서식을 앞에서부터 읽으며 변환마다 인자 1개 적용 (부족한 인자는 0)
+ * ---------------------------------------------------------------------------*/
+int AdasTelemetry_Format(const AdasTelemetry_t *pTelem, const AdasTelemChannel_t *pCh,
+                         const AdasTelemRecord_t *pRec, char *pBuf, size_t bufSize)
+{
+    if(!pTelem || !pRec || !pBuf || bufSize == 0)
+        return 0;
+
+    uint64_t rel = (pRec->Stamp_Ns > pTelem->Start_Ns) ? (pRec->Stamp_Ns - pTelem->Start_Ns) : 0;
+    int w = snprintf(pBuf, bufSize, "%10.6f %-8s %-14s ",
+                     (double)rel / (double)ADAS_NS_PER_SEC, pCh ? pCh->Name : "",
+                     AdasTelemetry_EventName(pRec->Event));
+    size_t len = (w < 0) ? 0 : (((size_t)w < bufSize) ? (size_t)w : bufSize - 1);
+
+    const char *p  = (pRec->Event < ADAS_TELEM_EV_COUNT) ? s_events[pRec->Event].Format : "";
+    uint32_t    ai = 0;
+    while(*p && (len + 1) < bufSize)
+    {
+        if(*p != '%')
+        {
+            pBuf[len++] = *p++;
+            continue;
+        }
+        if(p[1] == '%')
+        {
+            pBuf[len++] = '%';
+            p += 2;
+            continue;
+        }
+
+        TelemSpec_t spec;
+        p = parse_spec(p + 1, &spec);
+
+        char     conv = *p ? *p++ : '\0';
+        uint64_t arg  = (ai < pRec->Arg_Count) ? pRec->Args[ai] : 0;
+        ai++;
+
+        w = format_one(pBuf + len, bufSize - len, &spec, conv, arg);
+        if(w > 0)
+            len += ((size_t)w < (bufSize - len)) ? (size_t)w : (bufSize - len - 1);
+    }
+    pBuf[len] = '\0';
+    return (int)len;
+}
+
+/* 전 채널 비우기: 버림이 늘었으면 표시 줄 먼저, 레코드는 일괄 Pop 후 한 줄씩 fwrite */
+static uint32_t drain_channels(AdasTelemetry_t *pTelem)
+{
+    AdasTelemRecord_t batch[TELEM_BATCH];
+    char              line[TELEM_LINE_LEN];
+    uint32_t          total = 0;
+
+    for(int c = 0; c < pTelem->Channel_Count; c++)
+    {
+        AdasTelemChannel_t *pCh = &pTelem->Channels[c];
+
+        uint64_t dropped = __atomic_load_n(&pCh->Ring.Dropped, __ATOMIC_RELAXED);
+        if(dropped > pCh->Reported_Drops)
+        {
+            uint64_t rel = AdasTime_NowNs() - pTelem->Start_Ns;
+            fprintf(pTelem->pOut, "%10.6f %-8s %-14s count=%llu\n",
+                    (double)rel / (double)ADAS_NS_PER_SEC, pCh->Name, "dropped",
+                    (unsigned long long)(dropped - pCh->Reported_Drops));
+            pCh->Reported_Drops = dropped;
+        }
+
+        uint32_t n;
+        while((n = SpscQueue_PopBatch(&pCh->Ring, batch, TELEM_BATCH)) > 0)
+        {
+            for(uint32_t i = 0; i < n; i++)
+            {
+                int len = AdasTelemetry_Format(pTelem, pCh, &batch[i], line, sizeof(line) - 1);
+                line[len++] = '\n';
+                fwrite(line, 1, (size_t)len, pTelem->pOut);
+            }
+            pTelem->Written += n;
+            total += n;
+        }
+    }
+    return total;
+}
+
+uint32_t AdasTelemetry_Drain(AdasTelemetry_t *pTelem)
+{
+    if(!pTelem || pTelem->Started)
+        return 0;
+
+    uint32_t n = drain_channels(pTelem);
+    fflush(pTelem->pOut);
+    return n;
+}
+
+/* ----------------------------------------------------------------------------
+ * 출력 스레드: 비우기 -> 전부 비었으면 flush 후 Poll_Ns 휴면
+ *  - setpriority(PRIO_PROCESS, 0) 은 Linux 에서 호출 스레드에만 적용
+ * ---------------------------------------------------------------------------*/
+static void *telemetry_thread(void *pArg)
+{
+    AdasTelemetry_t *pTelem = (AdasTelemetry_t *)pArg;
+    (void)setpriority(PRIO_PROCESS, 0, TELEM_NICE);
+
+    while(!__atomic_load_n(&pTelem->Stop_Requested, __ATOMIC_ACQUIRE))
+    {
+        if(drain_channels(pTelem) == 0)
+        {
+            fflush(pTelem->pOut);
+            AdasTime_SleepUntilNs(AdasTime_NowNs() + pTelem->Poll_Ns);
+        }
+    }
+
+    drain_channels(pTelem);
+    fflush(pTelem->pOut);
+    return NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTelemetry_Start
+ *  - 호출 스레드가 SCHED_FIFO 여도 출력 스레드는 SCHED_OTHER 로 명시 생성
+ * ---------------------------------------------------------------------------*/
+int AdasTelemetry_Start(AdasTelemetry_t *pTelem, int cpu)
+{
+    if(!pTelem || pTelem->Started)
+        return -1;
+
+    pthread_attr_t attr;
+    struct sched_param sp;
+    memset(&sp, 0, sizeof(sp));
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_OTHER);
+    pthread_attr_setschedparam(&attr, &sp);
+    if((cpu >= 0) && (cpu < CPU_SETSIZE))
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET((size_t)cpu, &set);
+        pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+    }
+
+    pTelem->Stop_Requested = 0;
+    int rc = pthread_create(&pTelem->Thread, &attr, telemetry_thread, pTelem);
+    if(rc != 0)   /* CPU 고정 실패 등: 기본 속성으로 재시도 */
+        rc = pthread_create(&pTelem->Thread, NULL, telemetry_thread, pTelem);
+    pthread_attr_destroy(&attr);
+
+    if(rc != 0)
+        return -1;
+    pTelem->Started = 1;
+    return 0;
+}
+
+void AdasTelemetry_Stop(AdasTelemetry_t *pTelem)
+{
+    if(!pTelem || !pTelem->Started)
+        return;
+
+    __atomic_store_n(&pTelem->Stop_Requested, 1, __ATOMIC_RELEASE);
+    pthread_join(pTelem->Thread, NULL);
+    pTelem->Started = 0;
+}
+
+uint64_t AdasTelemetry_Dropped(const AdasTelemetry_t *pTelem)
+{
+    if(!pTelem)
+        return 0;
+
+    uint64_t total = 0;
+    for(int c = 0; c < pTelem->Channel_Count; c++)
+        total += __atomic_load_n(&pTelem->Channels[c].Ring.Dropped, __ATOMIC_RELAXED);
+    return total;
+}
@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "adas_trace.h"
+
+#define TRACE_CALIBRATE_NS  (10ULL * ADAS_NS_PER_MS)
+
+static const char *const s_traceNames[ADAS_TRACE_ID_COUNT] = {
+    "cycle", "input", "ego", "lane", "target_filter", "target_predict", "target_select",
+    "acc", "aeb", "lfa", "arbitration", "output"
+};
+
+/* 링 소유 상태 (__atomic) */
+#define RING_FREE   0      /* 미사용 */
+#define RING_LIVE   1      /* 소유 스레드 실행 중 */
+#define RING_DEAD   2      /* 소유 스레드 종료 -> 내보내기 대상, 재사용 가능 */
+#define RING_CLAIM  3      /* 재사용 초기화 중 */
+
+static AdasTraceRing_t  s_rings[ADAS_TRACE_MAX_THREADS];
+static int              s_ringCount;          /* __atomic: 사용한 적 있는 링 수 (최대 번호 + 1) */
+static int              s_tidSeq;             /* __atomic: 내보내기용 스레드 번호 */
+static uint64_t         s_recycledLost;       /* __atomic: 내보내기 전에 재사용되어 잃은 이벤트 수 */
+static double           s_nsPerTick;          /* 0 = 미보정 */
+static pthread_key_t    s_ringKey;            /* 스레드 종료 시 링 반납 */
+static pthread_once_t   s_keyOnce = PTHREAD_ONCE_INIT;
+static int              s_keyOk;
+__thread AdasTraceRing_t *g_pAdasTraceRing;
+
+const char *AdasTrace_Name(uint16_t id)
+{
+    return (id < ADAS_TRACE_ID_COUNT) ? s_traceNames[id] : "?";
+}
+
+static uint64_t ring_count(const AdasTraceRing_t *pRing)
+{
+    return (pRing->Head < ADAS_TRACE_RING_CAPACITY) ? pRing->Head : ADAS_TRACE_RING_CAPACITY;
+}
+
+/* 마지막 내보내기 이후 기록되어 링에 남은 이벤트 수 */
+static uint64_t ring_unflushed(const AdasTraceRing_t *pRing)
+{
+    uint64_t pending = pRing->Head - pRing->Flushed_Head;
+    uint64_t cnt     = ring_count(pRing);
+    return (pending < cnt) ? pending : cnt;
+}
+
+/* 스레드 종료: 링을 종료 상태로 (이벤트는 내보내기까지 유지) */
+static void release_ring(void *pArg)
+{
+    AdasTraceRing_t *pRing = (AdasTraceRing_t *)pArg;
+    __atomic_store_n(&pRing->State, RING_DEAD, __ATOMIC_RELEASE);
+}
+
+static void create_key(void)
+{
+    s_keyOk = (pthread_key_create(&s_ringKey, release_ring) == 0);
+}
+
+/* 종료된 스레드의 링 하나를 가져옴 (flushedOnly: 내보낸 링만) */
+static AdasTraceRing_t *take_dead_ring(int flushedOnly)
+{
+    int n = __atomic_load_n(&s_ringCount, __ATOMIC_ACQUIRE);
+    for(int r = 0; r < n; r++)
+    {
+        AdasTraceRing_t *pRing = &s_rings[r];
+        int expected = RING_DEAD;
+        if(__atomic_load_n(&pRing->State, __ATOMIC_ACQUIRE) != RING_DEAD)
+            continue;
+        if(flushedOnly && (ring_unflushed(pRing) > 0))
+            continue;
+        if(__atomic_compare_exchange_n(&pRing->State, &expected, RING_CLAIM, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            return pRing;
+    }
+    return NULL;
+}
+
+/* 링 확보 (스레드당 1회)
+ *  - 순서: 내보낸 종료 링 -> 새 슬롯 -> 내보내지 않은 종료 링 (잃은 이벤트는 Overwritten 에 집계)
+ *  - 동시에 살아 있는 스레드가 ADAS_TRACE_MAX_THREADS 개를 넘을 때만 실패 */
+static AdasTraceRing_t *claim_ring(void)
+{
+    pthread_once(&s_keyOnce, create_key);
+
+    AdasTraceRing_t *pRing = take_dead_ring(1);
+    if(!pRing)
+    {
+        int idx = __atomic_load_n(&s_ringCount, __ATOMIC_ACQUIRE);
+        while(idx < ADAS_TRACE_MAX_THREADS)
+        {
+            if(__atomic_compare_exchange_n(&s_ringCount, &idx, idx + 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                pRing = &s_rings[idx];
+                break;
+            }
+        }
+    }
+    if(!pRing)
+        pRing = take_dead_ring(0);
+    if(!pRing)
+        return NULL;
+
+    if(pRing->pEvents)
+        __atomic_fetch_add(&s_recycledLost, ring_unflushed(pRing), __ATOMIC_RELAXED);
+    else
+        pRing->pEvents = (AdasTraceEvent_t *)calloc(ADAS_TRACE_RING_CAPACITY, sizeof(AdasTraceEvent_t));
+    pRing->Head         = 0;
+    pRing->Flushed_Head = 0;
+    pRing->Tid          = __atomic_add_fetch(&s_tidSeq, 1, __ATOMIC_RELAXED);
+    snprintf(pRing->Name, sizeof(pRing->Name), "thread-%d", pRing->Tid);
+    __atomic_store_n(&pRing->State, RING_LIVE, __ATOMIC_RELEASE);
+
+    /* 종료 훅 등록 실패 시에도 기록은 계속 (종료 후 재사용만 안 됨) */
+    if(s_keyOk)
+        (void)pthread_setspecific(s_ringKey, pRing);
+    return pRing;
+}
+
+int AdasTrace_ThreadInit(const char *name)
+{
+    if(!g_pAdasTraceRing)
+        g_pAdasTraceRing = claim_ring();
+    if(!g_pAdasTraceRing || !g_pAdasTraceRing->pEvents)
+        return -1;
+
+    if(name)
+        snprintf(g_pAdasTraceRing->Name, sizeof(g_pAdasTraceRing->Name), "%s", name);
+    return 0;
+}
+
+/* 첫 기록: 링 확보 후 인라인 경로로 다시 기록 (확보 실패 시 버림) */
+void AdasTrace_RecordSlow(uint16_t id, uint64_t startTick, uint64_t endTick)
+{
+    if(AdasTrace_ThreadInit(NULL) != 0)
+        return;
+    AdasTrace_Record(id, startTick, endTick);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTrace_Calibrate
+ *  - 단조 시각 10ms 동안 tick 증가량으로 ns/tick 계산 (TSC 가 아니면 1)
+ * ---------------------------------------------------------------------------*/
+double AdasTrace_Calibrate(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t ns0   = AdasTime_NowNs();
+    uint64_t tick0 = AdasTrace_Tick();
+    AdasTime_SleepUntilNs(ns0 + TRACE_CALIBRATE_NS);
+    uint64_t ns1   = AdasTime_NowNs();
+    uint64_t tick1 = AdasTrace_Tick();
+    s_nsPerTick = (tick1 > tick0) ? ((double)(ns1 - ns0) / (double)(tick1 - tick0)) : 1.0;
+#else
+    s_nsPerTick = 1.0;
+#endif
+    return s_nsPerTick;
+}
+
+void AdasTrace_Reset(void)
+{
+    int n = __atomic_load_n(&s_ringCount, __ATOMIC_ACQUIRE);
+    for(int r = 0; r < n; r++)
+    {
+        s_rings[r].Head         = 0;
+        s_rings[r].Flushed_Head = 0;
+    }
+    __atomic_store_n(&s_recycledLost, 0, __ATOMIC_RELAXED);
+}
+
+uint64_t AdasTrace_EventCount(void)
+{
+    uint64_t total = 0;
+    int n = __atomic_load_n(&s_ringCount, __ATOMIC_ACQUIRE);
+    for(int r = 0; r < n; r++)
+        total += ring_count(&s_rings[r]);
+    return total;
+}
+
+uint64_t AdasTrace_Overwritten(void)
+{
+    uint64_t total = 0;
+    int n = __atomic_load_n(&s_ringCount, __ATOMIC_ACQUIRE);
+    for(int r = 0; r < n; r++)
+        total += s_rings[r].Head - ring_count(&s_rings[r]);
+    return total + __atomic_load_n(&s_recycledLost, __ATOMIC_RELAXED);
+}
+
+/* JSON 문자열 (따옴표 포함, 따옴표 / 역슬래시 / 제어 문자 escape) */
+static void write_json_string(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for(; *s; s++)
+    {
+        unsigned char c = (unsigned char)*s;
+        if((c == '"') || (c == '\\'))
+        {
+            fputc('\\', fp);
+            fputc((int)c, fp);
+        }
+        else if(c < 0x20u)
+            fprintf(fp, "\\u%04x", (unsigned)c);
+        else
+            fputc((int)c, fp);
+    }
+    fputc('"', fp);
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasTrace_ExportChrome
+ *  - 스레드 이름 메타데이터("ph":"M") -> 링별 완료 이벤트를 오래된 것부터
+ *  - 기준 시각 = 전 링에서 가장 이른 Start_Tick
+ *  - 종료된 스레드 링도 포함, 내보낸 링은 재사용 우선 대상
+ * ---------------------------------------------------------------------------*/
+long AdasTrace_ExportChrome(const char *path)
+{
+    if(!path)
+        return -1;
+
+    FILE *fp = fopen(path, "w");
+    if(!fp)
+        return -1;
+
+    if(s_nsPerTick <= 0.0)
+        AdasTrace_Calibrate();
+
+    int n = __atomic_load_n(&s_ringCount, __ATOMIC_ACQUIRE);
+    uint64_t base = UINT64_MAX;
+    for(int r = 0; r < n; r++)
+    {
+        const AdasTraceRing_t *pRing = &s_rings[r];
+        uint64_t cnt = ring_count(pRing);
+        for(uint64_t k = pRing->Head - cnt; k < pRing->Head; k++)
+        {
+            uint64_t t = pRing->pEvents[k & (ADAS_TRACE_RING_CAPACITY - 1)].Start_Tick;
+            if(t < base) base = t;
+        }
+    }
+
+    const double usPerTick = s_nsPerTick / (double)ADAS_NS_PER_US;
+    long written = 0;
+    int  first   = 1;
+
+    fprintf(fp, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for(int r = 0; r < n; r++)
+    {
+        const AdasTraceRing_t *pRing = &s_rings[r];
+        fprintf(fp, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":",
+                first ? "" : ",", pRing->Tid);
+        write_json_string(fp, pRing->Name);
+        fputs("}}", fp);
+        first = 0;
+
+        uint64_t cnt = ring_count(pRing);
+        for(uint64_t k = pRing->Head - cnt; k < pRing->Head; k++)
+        {
+            const AdasTraceEvent_t *pEv = &pRing->pEvents[k & (ADAS_TRACE_RING_CAPACITY - 1)];
+            fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"adas\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    AdasTrace_Name(pEv->Id), pRing->Tid,
+                    (double)(pEv->Start_Tick - base) * usPerTick,
+                    (double)pEv->Duration_Tick * usPerTick);
+            written++;
+        }
+    }
+    fprintf(fp, "\n]}\n");
+
+    int err = ferror(fp);
+    if((fclose(fp) != 0) || err)
+        return -1;
+    for(int r = 0; r < n; r++)
+        s_rings[r].Flushed_Head = s_rings[r].Head;
+    return written;
+}
@@ -10,7 +10,7 @@
  * - TTC_Alert = TTC_Brake + Alert_Buffer_Time
  */
 void calculate_ttc_for_aeb(const AEB_Target_Data_t *pAebTargetData,
-                           const Ego_Data_t        *pEgoData,
+                           const AEB_Ego_Data_t    *pEgoData,
                            TTC_Data_t              *pTtcData)
 {
     if(!pAebTargetData || !pEgoData || !pTtcData)
@@ -64,7 +64,7 @@ void calculate_ttc_for_aeb(const AEB_Target_Data_t *pAebTargetData,
  * - Brake : 긴급 제동 단계
  */
 AEB_Mode_e aeb_mode_selection(const AEB_Target_Data_t *pAebTargetData,
-                              const Ego_Data_t        *pEgoData,
+                              const AEB_Ego_Data_t    *pEgoData,
                               const TTC_Data_t        *pTtcData)
 {
     if(!pAebTargetData || !pEgoData || !pTtcData)
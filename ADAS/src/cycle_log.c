@@ -0,0 +1,291 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* MAP_POPULATE, posix_fallocate */
+#endif
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cycle_log.h"
+#include "adas_time.h"
+
+static size_t records_end(uint64_t records)
+{
+    return sizeof(AdasCycleLogHeader_t) + ((size_t)records * sizeof(AdasCycleRecord_t));
+}
+
+static size_t file_size_for(uint64_t records, uint64_t snapshots)
+{
+    return records_end(records) + ((size_t)snapshots * sizeof(AdasSnapshot_t));
+}
+
+static void reset_handle(AdasCycleLog_t *pLog)
+{
+    memset(pLog, 0, sizeof(*pLog));
+    pLog->Fd = -1;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasCycleLog_Create
+ *  - posix_fallocate 로 블록 예약: 기록 중 디스크 부족 시 SIGBUS 대신 생성 단계에서 실패
+ *  - MAP_POPULATE 는 공유 매핑을 읽기로만 적재 -> 페이지마다 1 byte 써서 쓰기 fault 도 생성 시 처리
+ * ---------------------------------------------------------------------------*/
+int AdasCycleLog_Create(AdasCycleLog_t *pLog, const char *path, uint64_t capacity,
+                        uint32_t snapshotInterval)
+{
+    if(!pLog)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    reset_handle(pLog);
+    if(!path || capacity == 0)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    int fd = open(path, O_CREAT | O_TRUNC | O_RDWR, 0644);
+    if(fd < 0)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    uint64_t snapCapacity = (snapshotInterval != 0) ? (capacity / snapshotInterval) : 0;
+    size_t   size = file_size_for(capacity, snapCapacity);
+    if(posix_fallocate(fd, 0, (off_t)size) != 0)
+    {
+        close(fd);
+        return ADAS_CYCLE_LOG_ERR_ARG;
+    }
+
+    void *pBase = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    if(pBase == MAP_FAILED)
+    {
+        close(fd);
+        return ADAS_CYCLE_LOG_ERR_ARG;
+    }
+
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    for(size_t off = 0; off < size; off += page)
+        ((volatile unsigned char *)pBase)[off] = 0;
+    madvise(pBase, size, MADV_SEQUENTIAL);
+
+    AdasCycleLogHeader_t *pH = (AdasCycleLogHeader_t *)pBase;
+    memset(pH, 0, sizeof(*pH));
+    pH->Magic       = ADAS_CYCLE_LOG_MAGIC;
+    pH->Version     = ADAS_CYCLE_LOG_VERSION;
+    pH->Header_Size = (uint32_t)sizeof(AdasCycleLogHeader_t);
+    pH->Record_Size = (uint32_t)sizeof(AdasCycleRecord_t);
+    pH->Input_Size  = (uint32_t)sizeof(AdasFrameInput_t);
+    pH->Max_Objects = ADAS_MAX_OBJECTS;
+    pH->Capacity    = capacity;
+    pH->Start_Ns    = AdasTime_NowNs();
+    pH->Snapshot_Interval = snapshotInterval;
+    pH->Snapshot_Size     = (uint32_t)sizeof(AdasSnapshot_t);
+    pH->Snapshot_Offset   = records_end(capacity);
+    pH->Snapshot_Capacity = snapCapacity;
+
+    pLog->Fd         = fd;
+    pLog->pBase      = (unsigned char *)pBase;
+    pLog->Map_Size   = size;
+    pLog->pHeader    = pH;
+    pLog->pRecords   = (AdasCycleRecord_t *)(pLog->pBase + sizeof(AdasCycleLogHeader_t));
+    pLog->pSnapshots = (AdasSnapshot_t *)(pLog->pBase + pH->Snapshot_Offset);
+    pLog->Capacity   = capacity;
+    pLog->Snapshot_Capacity = snapCapacity;
+    pLog->Is_Writer  = 1;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasCycleLog_Append
+ *  - 입력 객체 배열은 Object_Count 개만 복사 (나머지 슬롯은 예약 시 0)
+ *  - 스냅샷은 간격마다 스냅샷 구역 다음 칸에 작성 (레코드 크기와 무관)
+ * ---------------------------------------------------------------------------*/
+int AdasCycleLog_Append(AdasCycleLog_t          *pLog,
+                        uint64_t                 cycle,
+                        const AdasFrameInput_t  *pIn,
+                        const AdasFrameOutput_t *pOut,
+                        const AdasPipeline_t    *pPipe)
+{
+    if(!pLog || !pLog->Is_Writer || !pIn || !pOut)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    if(pLog->Count >= pLog->Capacity)
+    {
+        pLog->pHeader->Dropped++;
+        return ADAS_CYCLE_LOG_ERR_FULL;
+    }
+
+    AdasCycleRecord_t *pRec = &pLog->pRecords[pLog->Count];
+    pRec->Cycle    = cycle;
+    pRec->Stamp_Ns = AdasTime_NowNs();
+
+    int objCount = pIn->Object_Count;
+    if(objCount < 0) objCount = 0;
+    if(objCount > ADAS_MAX_OBJECTS) objCount = ADAS_MAX_OBJECTS;
+    memcpy(&pRec->Input, pIn, offsetof(AdasFrameInput_t, Objects) + ((size_t)objCount * sizeof(ObjectData_t)));
+
+    pRec->Ego         = pOut->Ego;
+    pRec->Lane_Select = pOut->Lane_Select;
+    pRec->Acc_Target  = pOut->Acc_Target;
+    pRec->Aeb_Target  = pOut->Aeb_Target;
+    pRec->Ttc         = pOut->Ttc;
+    pRec->Acc_Mode    = (int32_t)pOut->Acc_Mode;
+    pRec->Aeb_Mode    = (int32_t)pOut->Aeb_Mode;
+    pRec->Lfa_Mode    = (int32_t)pOut->Lfa_Mode;
+    pRec->Accel_Acc   = pOut->Accel_Acc;
+    pRec->Decel_Aeb   = pOut->Decel_Aeb;
+    pRec->Steer_Lfa   = pOut->Steer_Lfa;
+    pRec->Control     = pOut->Control;
+
+    /* 스냅샷 간격마다 처리 후 상태 기록 (다음 레코드부터 재생 시작 가능) */
+    uint64_t next     = pLog->Count + 1;
+    uint32_t interval = pLog->pHeader->Snapshot_Interval;
+    pRec->Has_Snapshot = 0;
+    if(pPipe && (interval != 0) && ((next % interval) == 0))
+    {
+        uint64_t k = (next / interval) - 1;
+        if((k < pLog->Snapshot_Capacity) && (AdasSnapshot_Capture(&pLog->pSnapshots[k], pPipe, next) == 0))
+        {
+            pRec->Has_Snapshot  = 1;
+            pLog->Snapshot_Count = k + 1;
+            __atomic_store_n(&pLog->pHeader->Snapshot_Count, pLog->Snapshot_Count, __ATOMIC_RELEASE);
+        }
+    }
+
+    pLog->Count++;
+    __atomic_store_n(&pLog->pHeader->Record_Count, pLog->Count, __ATOMIC_RELEASE);
+    return 0;
+}
+
+int AdasCycleLog_Flush(AdasCycleLog_t *pLog)
+{
+    if(!pLog || !pLog->Is_Writer || !pLog->pBase)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    return (msync(pLog->pBase, pLog->Map_Size, MS_ASYNC) == 0) ? 0 : ADAS_CYCLE_LOG_ERR_ARG;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasCycleLog_OpenRead
+ *  - 유효 레코드 수 = min(헤더 Record_Count, 스냅샷 구역 앞에 들어가는 수)
+ *  - 유효 스냅샷 수 = min(헤더 Snapshot_Count, 파일 끝까지 들어가는 수)
+ * ---------------------------------------------------------------------------*/
+int AdasCycleLog_OpenRead(AdasCycleLog_t *pLog, const char *path)
+{
+    if(!pLog)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    reset_handle(pLog);
+    if(!path)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return ADAS_CYCLE_LOG_ERR_ARG;
+
+    struct stat st;
+    if((fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(AdasCycleLogHeader_t)))
+    {
+        close(fd);
+        return ADAS_CYCLE_LOG_ERR_LAYOUT;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *pBase = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if(pBase == MAP_FAILED)
+    {
+        close(fd);
+        return ADAS_CYCLE_LOG_ERR_ARG;
+    }
+
+    const AdasCycleLogHeader_t *pH = (const AdasCycleLogHeader_t *)pBase;
+    if((pH->Magic       != ADAS_CYCLE_LOG_MAGIC) ||
+       (pH->Version     != ADAS_CYCLE_LOG_VERSION) ||
+       (pH->Header_Size != sizeof(AdasCycleLogHeader_t)) ||
+       (pH->Record_Size != sizeof(AdasCycleRecord_t)) ||
+       (pH->Input_Size  != sizeof(AdasFrameInput_t)) ||
+       (pH->Max_Objects != ADAS_MAX_OBJECTS) ||
+       (pH->Snapshot_Size != sizeof(AdasSnapshot_t)) ||
+       (pH->Snapshot_Offset < sizeof(AdasCycleLogHeader_t)) || (pH->Snapshot_Offset > size))
+    {
+        munmap(pBase, size);
+        close(fd);
+        return ADAS_CYCLE_LOG_ERR_LAYOUT;
+    }
+
+    uint64_t fit       = (pH->Snapshot_Offset - sizeof(AdasCycleLogHeader_t)) / sizeof(AdasCycleRecord_t);
+    uint64_t count     = __atomic_load_n(&pH->Record_Count, __ATOMIC_ACQUIRE);
+    uint64_t snapFit   = (size - pH->Snapshot_Offset) / sizeof(AdasSnapshot_t);
+    uint64_t snapCount = __atomic_load_n(&pH->Snapshot_Count, __ATOMIC_ACQUIRE);
+
+    pLog->Fd         = fd;
+    pLog->pBase      = (unsigned char *)pBase;
+    pLog->Map_Size   = size;
+    pLog->pHeader    = (AdasCycleLogHeader_t *)pBase;
+    pLog->pRecords   = (AdasCycleRecord_t *)(pLog->pBase + sizeof(AdasCycleLogHeader_t));
+    pLog->pSnapshots = (AdasSnapshot_t *)(pLog->pBase + pH->Snapshot_Offset);
+    pLog->Capacity   = fit;
+    pLog->Count      = (count < fit) ? count : fit;
+    pLog->Snapshot_Capacity = snapFit;
+    pLog->Snapshot_Count    = (snapCount < snapFit) ? snapCount : snapFit;
+    return 0;
+}
+
+uint64_t AdasCycleLog_Count(const AdasCycleLog_t *pLog)
+{
+    return pLog ? pLog->Count : 0;
+}
+
+const AdasCycleRecord_t *AdasCycleLog_Get(const AdasCycleLog_t *pLog, uint64_t idx)
+{
+    if(!pLog || !pLog->pRecords || idx >= pLog->Count)
+        return NULL;
+    return &pLog->pRecords[idx];
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasCycleLog_GetSnapshot
+ *  - 스냅샷 k 는 레코드 (k + 1) * Snapshot_Interval - 1 처리 후 상태
+ * ---------------------------------------------------------------------------*/
+const AdasSnapshot_t *AdasCycleLog_GetSnapshot(const AdasCycleLog_t *pLog, uint64_t idx)
+{
+    const AdasCycleRecord_t *pRec = AdasCycleLog_Get(pLog, idx);
+    if(!pRec || !pRec->Has_Snapshot)
+        return NULL;
+
+    uint32_t interval = pLog->pHeader->Snapshot_Interval;
+    if((interval == 0) || (((idx + 1) % interval) != 0))
+        return NULL;
+
+    uint64_t k = ((idx + 1) / interval) - 1;
+    return (k < pLog->Snapshot_Count) ? &pLog->pSnapshots[k] : NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasCycleLog_Close
+ *  - 기록기: 스냅샷 구역을 마지막 레코드 바로 뒤로 이동 -> [헤더][레코드 x Count][스냅샷 x Snapshot_Count]
+ * ---------------------------------------------------------------------------*/
+void AdasCycleLog_Close(AdasCycleLog_t *pLog)
+{
+    if(!pLog)
+        return;
+
+    if(pLog->pBase)
+    {
+        if(pLog->Is_Writer)
+        {
+            AdasCycleLogHeader_t *pH = pLog->pHeader;
+            size_t snapOffset = records_end(pLog->Count);
+            memmove(pLog->pBase + snapOffset, pLog->pSnapshots, (size_t)pLog->Snapshot_Count * sizeof(AdasSnapshot_t));
+            pH->Capacity          = pLog->Count;
+            pH->Snapshot_Offset   = snapOffset;
+            pH->Snapshot_Capacity = pLog->Snapshot_Count;
+            msync(pLog->pBase, file_size_for(pLog->Count, pLog->Snapshot_Count), MS_SYNC);
+        }
+        munmap(pLog->pBase, pLog->Map_Size);
+    }
+    if(pLog->Fd >= 0)
+    {
+        if(pLog->Is_Writer && pLog->pBase)
+            (void)ftruncate(pLog->Fd, (off_t)file_size_for(pLog->Count, pLog->Snapshot_Count));
+        close(pLog->Fd);
+    }
+
+    reset_handle(pLog);
+}
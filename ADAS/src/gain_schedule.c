@@ -0,0 +1,184 @@
+#include <string.h>
+#include <math.h>
+#include "gain_schedule.h"
+
+/*─────────────────────────────
+  기본 스케줄 테이블 (채널: Kp, Ki, Kd)
+  - 설계서 예시 게인으로 전 구간을 채움 -> 기본 동작은 고정 게인과 동일
+  - 캘리브레이션 시 격자점 값만 수정하거나 blob으로 교체
+─────────────────────────────*/
+
+/* ACC 거리 PID : Ego 속도 0 ~ 40 m/s (0 ~ 144 km/h), 10 m/s 간격 */
+static const float s_accDistanceGains[5 * 3] = {
+    /*  0 m/s */ 0.4f, 0.05f, 0.1f,
+    /* 10 m/s */ 0.4f, 0.05f, 0.1f,
+    /* 20 m/s */ 0.4f, 0.05f, 0.1f,
+    /* 30 m/s */ 0.4f, 0.05f, 0.1f,
+    /* 40 m/s */ 0.4f, 0.05f, 0.1f
+};
+
+/* ACC 속도 PID : Ego 속도 0 ~ 40 m/s, 10 m/s 간격 */
+static const float s_accSpeedGains[5 * 3] = {
+    /*  0 m/s */ 0.5f, 0.1f, 0.05f,
+    /* 10 m/s */ 0.5f, 0.1f, 0.05f,
+    /* 20 m/s */ 0.5f, 0.1f, 0.05f,
+    /* 30 m/s */ 0.5f, 0.1f, 0.05f,
+    /* 40 m/s */ 0.5f, 0.1f, 0.05f
+};
+
+/* LFA 저속 PID : Ego 속도 0 ~ 20 m/s (5 m/s 간격) x 곡률 0 ~ 0.01 1/m (반경 100m까지) */
+static const float s_lfaLowSpeedGains[3 * 5 * 3] = {
+    /* k=0.000 */ 0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,
+                  0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,
+    /* k=0.005 */ 0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,
+                  0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,
+    /* k=0.010 */ 0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f,
+                  0.1f, 0.01f, 0.005f,  0.1f, 0.01f, 0.005f
+};
+
+/* 기본 테이블 초기화 값 (기본 / 현재 테이블 공용) */
+#define GAIN_SCHED_DEFAULT_TABLES { \
+    [GAIN_SCHED_ACC_DISTANCE]  = { 0.0f, 1.0f / 10.0f, 5, 0.0f, 1.0f,           1, 3, s_accDistanceGains }, \
+    [GAIN_SCHED_ACC_SPEED]     = { 0.0f, 1.0f / 10.0f, 5, 0.0f, 1.0f,           1, 3, s_accSpeedGains    }, \
+    [GAIN_SCHED_LFA_LOW_SPEED] = { 0.0f, 1.0f / 5.0f,  5, 0.0f, 1.0f / 0.005f,  3, 3, s_lfaLowSpeedGains } \
+}
+
+static const InterpTable2D_t s_defaultTables[GAIN_SCHED_COUNT] = GAIN_SCHED_DEFAULT_TABLES;
+
+/* 현재 사용 중인 테이블 (기본값 또는 Install/LoadBlob 결과) */
+static InterpTable2D_t s_activeTables[GAIN_SCHED_COUNT] = GAIN_SCHED_DEFAULT_TABLES;
+
+/* Install / LoadBlob 으로 설치한 테이블 데이터 저장소 (호출자 버퍼와 수명 분리) */
+static float s_tableData[GAIN_SCHED_COUNT][GAIN_SCHEDULE_MAX_POINTS * 3];
+
+/*─────────────────────────────
+  GainSchedule_GetPidGains
+─────────────────────────────*/
+void GainSchedule_GetPidGains(GainScheduleId_e id,
+                              float egoSpeed,
+                              float curvature,
+                              PID_Gains_t *pOut)
+{
+    if(!pOut || (unsigned)id >= (unsigned)GAIN_SCHED_COUNT)
+        return;
+
+    float g[3];
+    InterpTable2D_EvalN(&s_activeTables[id], egoSpeed, curvature, g);
+    pOut->Kp = g[0];
+    pOut->Ki = g[1];
+    pOut->Kd = g[2];
+}
+
+/* 값 배열이 모두 유한한지 (NaN/Inf 게인 거부) */
+static int CheckFinite(const float *pData, size_t count)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        if(!isfinite(pData[i]))
+            return -1;
+    }
+    return 0;
+}
+
+/* 테이블 형식 검사 */
+static int CheckTable(const InterpTable2D_t *pTable)
+{
+    if(!pTable || !pTable->pData)                      return -1;
+    if(pTable->Channels != 3)                          return -1;
+    if(pTable->X_Count < 1 || pTable->Y_Count < 1)     return -1;
+    if((size_t)pTable->X_Count * (size_t)pTable->Y_Count > GAIN_SCHEDULE_MAX_POINTS) return -1;
+    if(!(pTable->X_Inv_Step > 0.0f) || !(pTable->Y_Inv_Step > 0.0f)) return -1;
+    if(!isfinite(pTable->X_Min) || !isfinite(pTable->Y_Min) ||
+       !isfinite(pTable->X_Inv_Step) || !isfinite(pTable->Y_Inv_Step)) return -1;
+    return CheckFinite(pTable->pData, (size_t)pTable->X_Count * (size_t)pTable->Y_Count * 3u);
+}
+
+/*─────────────────────────────
+  GainSchedule_Install
+  - 격자 데이터는 내부 저장소로 복사 (호출 후 pTable->pData 해제 가능)
+─────────────────────────────*/
+int GainSchedule_Install(GainScheduleId_e id, const InterpTable2D_t *pTable)
+{
+    if((unsigned)id >= (unsigned)GAIN_SCHED_COUNT || CheckTable(pTable) != 0)
+        return -1;
+
+    memcpy(s_tableData[id], pTable->pData,
+           (size_t)pTable->X_Count * (size_t)pTable->Y_Count * 3u * sizeof(float));
+    s_activeTables[id]       = *pTable;
+    s_activeTables[id].pData = s_tableData[id];
+    return 0;
+}
+
+/*─────────────────────────────
+  GainSchedule_LoadBlob
+  - 1차: 전체 형식 / 유한값 검증 (실패 시 아무것도 바꾸지 않음)
+  - 2차: 내부 저장소로 복사 후 설치
+─────────────────────────────*/
+int GainSchedule_LoadBlob(const void *pBlob, size_t blobSize)
+{
+    const unsigned char *p = (const unsigned char *)pBlob;
+    GainScheduleBlobHeader_t hdr;
+
+    if(!p || blobSize < sizeof(hdr))
+        return -1;
+    memcpy(&hdr, p, sizeof(hdr));
+    if(hdr.Magic != GAIN_SCHEDULE_BLOB_MAGIC || hdr.Version != GAIN_SCHEDULE_BLOB_VERSION)
+        return -1;
+
+    for(int pass = 0; pass < 2; pass++)
+    {
+        size_t off = sizeof(hdr);
+        for(int t = 0; t < (int)hdr.Table_Count; t++)
+        {
+            GainScheduleBlobTable_t tbl;
+            if(blobSize - off < sizeof(tbl))
+                return -1;
+            memcpy(&tbl, p + off, sizeof(tbl));
+            off += sizeof(tbl);
+
+            size_t points = (size_t)tbl.X_Count * (size_t)tbl.Y_Count;
+            size_t bytes  = points * 3u * sizeof(float);
+            if(tbl.Id >= GAIN_SCHED_COUNT || points == 0 || points > GAIN_SCHEDULE_MAX_POINTS ||
+               !(tbl.X_Step > 0.0f) || !(tbl.Y_Step > 0.0f) || blobSize - off < bytes)
+            {
+                return -1;
+            }
+            /* NaN/Inf 축 값, 역수가 무한대가 되는 간격 거부 */
+            if(!isfinite(tbl.X_Min) || !isfinite(tbl.Y_Min) ||
+               !isfinite(tbl.X_Step) || !isfinite(tbl.Y_Step) ||
+               !isfinite(1.0f / tbl.X_Step) || !isfinite(1.0f / tbl.Y_Step))
+            {
+                return -1;
+            }
+
+            if(pass == 0)
+            {
+                float gains[GAIN_SCHEDULE_MAX_POINTS * 3];
+                memcpy(gains, p + off, bytes);
+                if(CheckFinite(gains, points * 3u) != 0)
+                    return -1;
+            }
+            else
+            {
+                memcpy(s_tableData[tbl.Id], p + off, bytes);
+                InterpTable2D_t it = {
+                    tbl.X_Min, 1.0f / tbl.X_Step, (int)tbl.X_Count,
+                    tbl.Y_Min, 1.0f / tbl.Y_Step, (int)tbl.Y_Count,
+                    3, s_tableData[tbl.Id]
+                };
+                s_activeTables[tbl.Id] = it;
+            }
+            off += bytes;
+        }
+    }
+
+    return (int)hdr.Table_Count;
+}
+
+/*─────────────────────────────
+  GainSchedule_ResetDefaults
+─────────────────────────────*/
+void GainSchedule_ResetDefaults(void)
+{
+    memcpy(s_activeTables, s_defaultTables, sizeof(s_activeTables));
+}
@@ -1,6 +1,7 @@
 #include <math.h>
 #include <string.h>
 #include "lane_selection.h"
+#include "adas_math.h"
 
 /*---------------------------------------------------------
  * LaneSelection_Update
@@ -47,9 +48,8 @@ int LaneSelection_Update(const LaneData_t *pLaneData,
     ------------------------------------------------------*/
     /* heading_diff_raw = Ego_Heading - Lane_Heading */
     float heading_diff_raw = pEgoData->Ego_Heading - pLaneData->Lane_Heading;
-    /* 정규화(±180) */
-    while(heading_diff_raw >  180.0f) heading_diff_raw -= 360.0f;
-    while(heading_diff_raw < -180.0f) heading_diff_raw += 360.0f;
+    /* 정규화(±180), 반복 없이 O(1) */
+    heading_diff_raw = AdasMath_WrapDeg180(heading_diff_raw);
 
     pLaneOut->LS_Heading_Error = heading_diff_raw;
 
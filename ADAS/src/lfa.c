@@ -1,22 +1,89 @@
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include "lfa.h"
+#include "gain_schedule.h"
+#include "stanley_lut.h"
+#include "adas_math.h"
+#include "interp_table.h"
 
 /* 예시: 속도 기준 (시속 60 km/h = 16.67 m/s) */
 #define LFA_SPEED_THRESHOLD (16.67f)
 
-/* PID 제어를 위한 내부 변수 (저속) */
-static float s_pidIntegral  = 0.0f;
-static float s_pidPrevError = 0.0f;
+/* PID 제어를 위한 내부 변수 (저속), calculate_steer_in_low_speed_pid 기본 인스턴스 */
+static LFA_State_t s_lfaState;
 
-/* 시스템에서 정의한 최대 조향각(±540°) */
-static const float LFA_MAX_STEERING_ANGLE = 540.0f;
+/* 시스템에서 정의한 최대 조향각(±540°): adas_shared.h LFA_MAX_STEERING_ANGLE */
+
+/* Pure Pursuit look-ahead 스케줄 : Ego 속도 0 ~ 40 m/s, 10 m/s 간격 [m] */
+static const float s_ppLookahead[5] = {
+    /*  0 m/s */ 5.0f,
+    /* 10 m/s */ 9.0f,
+    /* 20 m/s */ 15.0f,
+    /* 30 m/s */ 22.0f,
+    /* 40 m/s */ 30.0f
+};
+static const InterpTable2D_t s_ppLookaheadTable = { 0.0f, 0.1f, 5, 0.0f, 0.0f, 1, 1, s_ppLookahead };
+
+/* 곡률 반경 -> 곡률 [1/m] (반경 0 = 직선/미정) */
+static float radius_to_curvature(float radius)
+{
+    return (radius > 1.0f) ? (1.0f / radius) : 0.0f;
+}
+
+/* 저속 PID 오차: 가중합 (K_offset * LaneOffset + K_heading * HeadingError) */
+static float low_speed_pid_error(const Lane_Data_LS_t *pLaneData)
+{
+    float K_offset  = 1.0f;  // 비중 예시
+    float K_heading = 1.0f;
+    float offsetErr = pLaneData->LS_Lane_Offset;    /* (-2.0~2.0) m */
+    float hdgErr    = pLaneData->LS_Heading_Error;  /* (-180~180)° */
+
+    return (K_offset * offsetErr) + (K_heading * hdgErr);
+}
+
+/* PID 게인 스케줄 조회 (곡률 = 1 / 곡률반경, 반경 0은 직선) */
+static void low_speed_pid_gains(const LFA_Ego_Data_t *pEgoData,
+                                const Lane_Data_LS_t *pLaneData,
+                                PID_Gains_t *pGains)
+{
+    float curvature = radius_to_curvature(pLaneData->LS_Lane_Curvature);
+    GainSchedule_GetPidGains(GAIN_SCHED_LFA_LOW_SPEED, pEgoData->Ego_Velocity_X, curvature, pGains);
+}
+
+/* 저속 PID 1스텝 */
+static float low_speed_pid_step(LFA_State_t          *pState,
+                                const LFA_Ego_Data_t *pEgoData,
+                                const Lane_Data_LS_t *pLaneData,
+                                float deltaTime)
+{
+    float error = low_speed_pid_error(pLaneData);
+
+    PID_Gains_t g;
+    low_speed_pid_gains(pEgoData, pLaneData, &g);
+
+    /* 누적오차(적분항) */
+    pState->Pid_Integral += (error * deltaTime);
+
+    /* 미분항 */
+    float dErr = (error - pState->Pid_Prev_Error) / (deltaTime + 1e-6f);
+    pState->Pid_Prev_Error = error;
+
+    /* PID 계산 */
+    float steeringAnglePID = (g.Kp * error) + (g.Ki * pState->Pid_Integral) + (g.Kd * dErr);
+
+    /* 제한 (±540도) */
+    if(steeringAnglePID >  LFA_MAX_STEERING_ANGLE)  steeringAnglePID =  LFA_MAX_STEERING_ANGLE;
+    if(steeringAnglePID < -LFA_MAX_STEERING_ANGLE)  steeringAnglePID = -LFA_MAX_STEERING_ANGLE;
+
+    return steeringAnglePID;
+}
 
 /* ----------------------------------------------------------------------------
  * (2.2.4.1.1) lfa_mode_selection
  *   - 60 km/h(16.67m/s) 기준으로 LOW_SPEED / HIGH_SPEED 모드 분기
  * ---------------------------------------------------------------------------*/
-LFA_Mode_e lfa_mode_selection(const Ego_Data_t *pEgoData)
+LFA_Mode_e lfa_mode_selection(const LFA_Ego_Data_t *pEgoData)
 {
     if(!pEgoData)
     {
@@ -36,66 +103,38 @@ LFA_Mode_e lfa_mode_selection(const Ego_Data_t *pEgoData)
 /* ----------------------------------------------------------------------------
  * (2.2.4.1.2) calculate_steer_in_low_speed_pid
  *  - PID 기반으로 Heading Error + Lane Offset 반영
+ *  - PID 게인은 (Ego 속도, 곡률) 기준 스케줄에서 조회
  * ---------------------------------------------------------------------------*/
-float calculate_steer_in_low_speed_pid(const Lane_Data_LS_t *pLaneData,
+float calculate_steer_in_low_speed_pid(const LFA_Ego_Data_t *pEgoData,
+                                       const Lane_Data_LS_t *pLaneData,
                                        float deltaTime)
 {
-    if(!pLaneData || deltaTime <= 0.0f)
+    if(!pEgoData || !pLaneData || deltaTime <= 0.0f)
         return 0.0f;
 
-    /* 오차 계산: 가중합 (K_offset * LaneOffset + K_heading * HeadingError) */
-    float K_offset  = 1.0f;  // 비중 예시
-    float K_heading = 1.0f;
-    float offsetErr = pLaneData->LS_Lane_Offset;    /* (-2.0~2.0) m */
-    float hdgErr    = pLaneData->LS_Heading_Error;  /* (-180~180)° */
-
-    float error = (K_offset * offsetErr) + (K_heading * hdgErr);
-
-    /* PID 게인 (설계서 예시) */
-    float Kp = 0.1f;
-    float Ki = 0.01f;
-    float Kd = 0.005f;
-
-    /* 누적오차(적분항) */
-    s_pidIntegral += (error * deltaTime);
-
-    /* 미분항 */
-    float dErr = (error - s_pidPrevError) / (deltaTime + 1e-6f);
-    s_pidPrevError = error;
-
-    /* PID 계산 */
-    float steeringAnglePID = (Kp * error) + (Ki * s_pidIntegral) + (Kd * dErr);
-
-    /* 제한 (±540도) */
-    if(steeringAnglePID >  LFA_MAX_STEERING_ANGLE)  steeringAnglePID =  LFA_MAX_STEERING_ANGLE;
-    if(steeringAnglePID < -LFA_MAX_STEERING_ANGLE)  steeringAnglePID = -LFA_MAX_STEERING_ANGLE;
-
-    return steeringAnglePID;
+    return low_speed_pid_step(&s_lfaState, pEgoData, pLaneData, deltaTime);
 }
 
 /* ----------------------------------------------------------------------------
  * (2.2.4.1.3) calculate_steer_in_high_speed_stanley
  *  - Stanley 제어 공식: steer = headingError + atan2(k * cte, velocity)
  *    여기서는 cte를 LS_Lane_Offset이라 간주
+ *  - atan 항은 stanley_lut 보간 테이블로 계산
  * ---------------------------------------------------------------------------*/
-float calculate_steer_in_high_speed_stanley(const Ego_Data_t     *pEgoData,
+float calculate_steer_in_high_speed_stanley(const LFA_Ego_Data_t *pEgoData,
                                             const Lane_Data_LS_t *pLaneData)
 {
     if(!pEgoData || !pLaneData)
         return 0.0f;
 
-    float vx = pEgoData->Ego_Velocity_X;
-    if(vx < 0.1f) vx = 0.1f; // 분모 보호
+    float vx = pEgoData->Ego_Velocity_X;   // 0.1 미만 분모 보호는 StanleyLut_OffsetDeg 내부
 
     float headingErr = pLaneData->LS_Heading_Error;   // (°)
     float cte        = pLaneData->LS_Lane_Offset;     // cross-track error (m)
 
-    /* Stanley 제어에서 사용할 Gain (예시 1.0) */
-    float stanleyGain = 1.0f;
-
-    /* atan2(...) 결과는 rad. -> deg 변환할지 여부는 시스템 설계에 따라 */
-    float steerOffsetRad = atanf((stanleyGain * cte) / vx);
-    float steerOffsetDeg = (steerOffsetRad * 180.0f) / 3.1415926535f;
+    /* atan(k * cte / vx) [°] : (cte, vx) 테이블 보간 (Gain = LFA_STANLEY_GAIN)
+       테이블 범위 밖 / lfa_init_state(StanleyLut_Init) 전에는 정확한 법칙 */
+    float steerOffsetDeg = StanleyLut_OffsetDeg(cte, vx);
 
     /* 최종 조향각(°) = headingErr + offsetDeg */
     float steeringAngleStanley = headingErr + steerOffsetDeg;
@@ -107,33 +146,80 @@ float calculate_steer_in_high_speed_stanley(const Ego_Data_t     *pEgoData,
     return steeringAngleStanley;
 }
 
+/* preview 곡률: 현재 -> 다음 구간 곡률을 look-ahead 거리 비율로 혼합 */
+static float preview_curvature(const Lane_Data_LS_t *pLaneData, float lookahead)
+{
+    float kNow  = radius_to_curvature(pLaneData->LS_Lane_Curvature);
+    float kNext = radius_to_curvature(pLaneData->LS_Next_Lane_Curvature);
+    float w     = fminf(lookahead * (1.0f / LFA_PP_PREVIEW_HORIZON), 1.0f);
+    return kNow + (w * (kNext - kNow));
+}
+
 /* ----------------------------------------------------------------------------
- * (2.2.4.1.4) lfa_output_selection
- *  - 모드(LOW/HIGH) 선택 → PID or Stanley
- *  - 차선 변경/이탈, 곡선 도로 여부, YawRate/SteeringAngle 등에 따라
- *    조향각 감쇠 또는 증폭
+ * lfa_pure_pursuit_lookahead
+ *  - 속도 스케줄 + 곡선 단축 (0.5*κ*Ld² <= LFA_PP_MAX_CURVE_OFFSET)
  * ---------------------------------------------------------------------------*/
-float lfa_output_selection(LFA_Mode_e lfaMode,
-                           float steeringAnglePID,
-                           float steeringAngleStanley,
-                           const Lane_Data_LS_t *pLaneData,
-                           const Ego_Data_t     *pEgoData)
+float lfa_pure_pursuit_lookahead(float vx, const Lane_Data_LS_t *pLaneData)
 {
-    if(!pLaneData || !pEgoData)
-    {
-        return 0.0f;
-    }
+    float ld = InterpTable2D_Eval(&s_ppLookaheadTable, vx, 0.0f);
 
-    float steerOut = 0.0f;
-    if(lfaMode == LFA_MODE_LOW_SPEED)
+    if(pLaneData)
     {
-        steerOut = steeringAnglePID;
-    }
-    else
-    {
-        steerOut = steeringAngleStanley;
+        /* 짧아질수록 preview 곡률도 바뀌므로 속도 스케줄 거리 기준 곡률로 1회만 단축 */
+        float k = preview_curvature(pLaneData, ld);
+        if(k > 1e-6f)
+        {
+            float ldCurve = sqrtf((2.0f * LFA_PP_MAX_CURVE_OFFSET) / k);
+            ld = fminf(ld, ldCurve);
+        }
     }
 
+    return fmaxf(ld, LFA_PP_MIN_LOOKAHEAD);
+}
+
+/* ----------------------------------------------------------------------------
+ * calculate_steer_in_high_speed_pure_pursuit
+ *  - 차선 기준 목표점(look-ahead Ld)의 방위 α 로 Pure Pursuit 조향
+ *  - 곡선 방향 미정(0)이면 곡률 항 없이 직선 차선 기하만 사용
+ * ---------------------------------------------------------------------------*/
+float calculate_steer_in_high_speed_pure_pursuit(const LFA_Ego_Data_t *pEgoData,
+                                                 const Lane_Data_LS_t *pLaneData)
+{
+    if(!pEgoData || !pLaneData)
+        return 0.0f;
+
+    float vx = pEgoData->Ego_Velocity_X;
+    if(vx < 0.1f) vx = 0.1f; // 분모 보호
+
+    float ld  = lfa_pure_pursuit_lookahead(vx, pLaneData);
+    float k   = preview_curvature(pLaneData, ld);
+    float dir = (float)((pLaneData->LS_Curve_Direction > 0) - (pLaneData->LS_Curve_Direction < 0));
+
+    float headingRad = pLaneData->LS_Heading_Error * ADAS_MATH_DEG2RAD;
+    float cte        = pLaneData->LS_Lane_Offset;
+
+    /* 목표점 방위 (rad) : 직선 기하 + 곡선 횡편차 0.5*κ*Ld² 의 각도 환산 */
+    float alpha = headingRad + AdasMath_AtanF(cte / ld) + (dir * 0.5f * k * ld);
+
+    float steerRad = AdasMath_AtanF((2.0f * LFA_PP_WHEELBASE * AdasMath_SinF(alpha)) / ld);
+    float steeringAnglePP = steerRad * ADAS_MATH_RAD2DEG;
+
+    /* clamp */
+    if(steeringAnglePP >  LFA_MAX_STEERING_ANGLE)  steeringAnglePP =  LFA_MAX_STEERING_ANGLE;
+    if(steeringAnglePP < -LFA_MAX_STEERING_ANGLE)  steeringAnglePP = -LFA_MAX_STEERING_ANGLE;
+
+    return steeringAnglePP;
+}
+
+/* ----------------------------------------------------------------------------
+ * 선택된 조향각 후처리 (lfa_output_selection / lfa_calculate_steer 공용)
+ *  - 차선 변경/이탈, 곡선 도로 여부, YawRate/SteeringAngle 등에 따라
+ *    조향각 감쇠 또는 증폭 후 clamp
+ * ---------------------------------------------------------------------------*/
+static float shape_steer_output(float steerOut,
+                                const Lane_Data_LS_t *pLaneData,
+                                const LFA_Ego_Data_t *pEgoData)
+{
     /* 1) 차선 변경 중이면 자동조향 억제(감쇠) */
     if(pLaneData->LS_Is_Changing_Lane)
     {
@@ -171,3 +257,141 @@ float lfa_output_selection(LFA_Mode_e lfaMode,
 
     return steerOut;
 }
+
+/* ----------------------------------------------------------------------------
+ * (2.2.4.1.4) lfa_output_selection
+ *  - 모드(LOW/HIGH) 선택 → PID or Stanley
+ *  - 차선 변경/이탈, 곡선 도로 여부, YawRate/SteeringAngle 등에 따라
+ *    조향각 감쇠 또는 증폭
+ * ---------------------------------------------------------------------------*/
+float lfa_output_selection(LFA_Mode_e lfaMode,
+                           float steeringAnglePID,
+                           float steeringAngleStanley,
+                           const Lane_Data_LS_t *pLaneData,
+                           const LFA_Ego_Data_t *pEgoData)
+{
+    if(!pLaneData || !pEgoData)
+    {
+        return 0.0f;
+    }
+
+    float steerOut = 0.0f;
+    if(lfaMode == LFA_MODE_LOW_SPEED)
+    {
+        steerOut = steeringAnglePID;
+    }
+    else
+    {
+        steerOut = steeringAngleStanley;
+    }
+
+    return shape_steer_output(steerOut, pLaneData, pEgoData);
+}
+
+/* ----------------------------------------------------------------------------
+ * lfa_init_state
+ * ---------------------------------------------------------------------------*/
+void lfa_init_state(LFA_State_t *pState)
+{
+    if(!pState)
+        return;
+
+    memset(pState, 0, sizeof(*pState));
+    pState->Prev_Mode      = LFA_MODE_LOW_SPEED;
+    pState->High_Speed_Law = LFA_HS_LAW_STANLEY;
+
+    /* Stanley 테이블 생성 (최초 1회, 오차 초과 시 내부적으로 정확한 법칙 사용) */
+    (void)StanleyLut_Init();
+}
+
+/* ----------------------------------------------------------------------------
+ * lfa_parse_high_speed_law / lfa_high_speed_law_name
+ * ---------------------------------------------------------------------------*/
+static const char *const s_hsLawNames[] = { "stanley", "pursuit" };
+
+int lfa_parse_high_speed_law(const char *pName, LFA_High_Speed_Law_e *pLaw)
+{
+    if(!pName || !pLaw)
+        return -1;
+
+    for(int i = 0; i < (int)(sizeof(s_hsLawNames) / sizeof(s_hsLawNames[0])); i++)
+    {
+        if(strcmp(pName, s_hsLawNames[i]) == 0)
+        {
+            *pLaw = (LFA_High_Speed_Law_e)i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *lfa_high_speed_law_name(LFA_High_Speed_Law_e law)
+{
+    return (law == LFA_HS_LAW_PURE_PURSUIT) ? s_hsLawNames[1] : s_hsLawNames[0];
+}
+
+void lfa_get_default_state(LFA_State_t *pState)
+{
+    if(pState)
+        *pState = s_lfaState;
+}
+
+void lfa_set_default_state(const LFA_State_t *pState)
+{
+    if(pState)
+        s_lfaState = *pState;
+}
+
+/* ----------------------------------------------------------------------------
+ * lfa_calculate_steer
+ *  - 활성 모드의 제어 법칙만 계산 (PID 또는 고속 법칙: Stanley / Pure Pursuit)
+ *  - 고속 -> PID 전환 시 적분항 역산:
+ *    다음 PID 출력 = Kp*e + Ki*(I + e*dt) + Kd*0 이 직전 조향각과 같도록 I 설정
+ *  - 첫 주기(초기화 직후) PID: 이전 오차를 현재 오차로 시드, 적분 0 (미분 킥 Kd*e/dt 방지)
+ * ---------------------------------------------------------------------------*/
+float lfa_calculate_steer(LFA_State_t          *pState,
+                          LFA_Mode_e            lfaMode,
+                          const LFA_Ego_Data_t *pEgoData,
+                          const Lane_Data_LS_t *pLaneData,
+                          float                 deltaTime)
+{
+    if(!pState || !pEgoData || !pLaneData || deltaTime <= 0.0f)
+        return 0.0f;
+
+    float steerRaw = 0.0f;
+    if(lfaMode == LFA_MODE_LOW_SPEED)
+    {
+        const int firstCycle = (pState->Is_Initialized == 0);
+        if(firstCycle || (pState->Prev_Mode != LFA_MODE_LOW_SPEED))
+        {
+            float error = low_speed_pid_error(pLaneData);
+            PID_Gains_t g;
+            low_speed_pid_gains(pEgoData, pLaneData, &g);
+
+            pState->Pid_Integral = 0.0f;
+            if(!firstCycle && (g.Ki > 1e-6f))
+            {
+                float iTerm = pState->Prev_Steer_Raw - (g.Kp * error);
+                if(iTerm >  LFA_MAX_STEERING_ANGLE) iTerm =  LFA_MAX_STEERING_ANGLE;
+                if(iTerm < -LFA_MAX_STEERING_ANGLE) iTerm = -LFA_MAX_STEERING_ANGLE;
+                pState->Pid_Integral = (iTerm / g.Ki) - (error * deltaTime);
+            }
+            pState->Pid_Prev_Error = error;
+        }
+        steerRaw = low_speed_pid_step(pState, pEgoData, pLaneData, deltaTime);
+    }
+    else if(pState->High_Speed_Law == LFA_HS_LAW_PURE_PURSUIT)
+    {
+        steerRaw = calculate_steer_in_high_speed_pure_pursuit(pEgoData, pLaneData);
+    }
+    else
+    {
+        steerRaw = calculate_steer_in_high_speed_stanley(pEgoData, pLaneData);
+    }
+
+    pState->Prev_Mode      = lfaMode;
+    pState->Prev_Steer_Raw = steerRaw;
+    pState->Is_Initialized = 1;
+
+    return shape_steer_output(steerRaw, pLaneData, pEgoData);
+}
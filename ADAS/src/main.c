@@ -1,102 +1,432 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
 #include <stdio.h>
-#include "adas_shared.h"
-#include "ego_vehicle_estimation.h"
-#include "lane_selection.h"
-#include "target_selection.h"
-#include "acc.h"
-#include "aeb.h"
-#include "lfa.h"
-#include "arbitration.h"
-
-int main(void)
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "adas_runtime.h"
+#include "adas_pipelined.h"
+#include "sensor_ingest.h"
+#include "shm_transport.h"
+#include "cycle_log.h"
+#include "adas_telemetry.h"
+#include "adas_trace.h"
+#include "adas_time.h"
+
+/*
+ * 사용법: adas_main [-p 주기(ms)] [-n 주기 수(0=Ctrl+C까지)] [-r SCHED_FIFO 우선순위]
+ *                   [-c CPU 번호] [-m (mlockall)] [-b 단계 예산(us)]
+ *                   [-P (인지/제어 2코어 파이프라인)] [-C 제어 스레드 CPU 번호]
+ *                   [-w 태스크 그래프 워커 수] [-W 워커 시작 CPU 번호]
+ *                   [-s (센서 드라이버 스레드 -> SPSC 큐/메일박스 입력)]
+ *                   [-x shm 이름 (시뮬레이터 공유 메모리 프레임을 복사 없이 입력)]
+ *                   [-l 기록 파일 (주기별 입력/출력 바이너리 기록)]
+ *                   [-t N (텔레메트리: 이상/모드 전환 이벤트 + N 주기마다 제어 출력, 0 = 이벤트만)]
+ *                   [-T trace.json (단계별 추적 Chrome trace 내보내기, -DADAS_TRACE=1 빌드 필요)]
+ *                   [-H (단계별 지연 히스토그램: p50/p99/p99.99/최대)]
+ *                   [-e (단계별 성능 카운터: cycles/instructions/cache/branch miss, perf_event_open)]
+ *                   [-L 고속 LFA 조향 법칙 (stanley | pursuit, 기본 stanley)]
+ *  - -P 에서 -c 는 인지 스레드 CPU, -p 0 은 쉬지 않고 실행 (처리량 측정)
+ *  - -x 는 순차/태스크 그래프 런타임 전용 (생산자 예: tools/shm_stub_producer.c)
+ *  - -H 는 순차/태스크 그래프 런타임 전용, -e 는 순차 런타임 전용 (카운터를 못 열면 경고만)
+ *  - -t 출력은 저우선순위 스레드가 stdout 에 기록 (루프 스레드는 링 기록만)
+ */
+
+/* 가상의 입력 시나리오 (선행차 / 보행자 / 원거리 차량) */
+typedef struct
 {
-    /* 가상의 입력 */
-    TimeData_t timeData = { .Current_Time=0.0f };
-    GPSData_t  gpsData  = { .GPS_Velocity_X=10.0f, .GPS_Velocity_Y=0.0f, .GPS_Timestamp=0.0f };
-    IMUData_t  imuData  = { .Linear_Acceleration_X=0.0f, .Linear_Acceleration_Y=0.0f, .Yaw_Rate=0.0f };
-    EgoData_t  egoData;
-    EgoEstimationKFState_t kfState;
-    EgoEstimation_Init(&kfState);
-
-    LaneData_t laneData = {
-        .Lane_Type=LANE_TYPE_STRAIGHT,
-        .Lane_Curvature=0.0f,
-        .Next_Lane_Curvature=0.0f,
-        .Lane_Offset=0.0f,
-        .Lane_Heading=0.0f,
-        .Lane_Width=3.5f,
-        .Lane_Change_Status=LANE_CHANGE_KEEP
-    };
-    LaneSelectOutput_t laneSelOut;
-
-    /* object list */
-    ObjectData_t objList[3] = {
-        { .Object_ID=1, .Object_Type=OBJTYPE_CAR, .Position_X=30.0f, .Position_Y=0.5f, 
-          .Distance=30.0f, .Velocity_X=8.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING },
-        { .Object_ID=2, .Object_Type=OBJTYPE_PEDESTRIAN, .Position_X=25.0f, .Position_Y=2.0f,
-          .Distance=26.0f, .Velocity_X=1.0f, .Heading=10.0f, .Object_Status=OBJSTAT_MOVING },
-        { .Object_ID=3, .Object_Type=OBJTYPE_CAR, .Position_X=100.0f, .Position_Y=-0.5f,
-          .Distance=100.0f, .Velocity_X=12.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING }
+    float        Ego_Speed;   /* [m/s] */
+    ObjectData_t Init_Objects[3];
+} DemoScenario_t;
+
+static AdasRuntime_t      s_runtime;
+static AdasPipelined_t    s_pipelined;
+static AdasSensorIngest_t s_ingest;
+static AdasShmTransport_t s_shm;
+static AdasCycleLog_t     s_log;
+static AdasTelemetry_t    s_telem;
+static AdasTelemChannel_t *s_telemCh;
+static AdasMetrics_t      s_metrics;
+static AdasPerf_t         s_perf;
+static uint64_t           s_telemEvery;
+static volatile int       s_driverStop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    AdasRuntime_RequestStop(&s_runtime);
+    AdasPipelined_RequestStop(&s_pipelined);
+}
+
+static int demo_input(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    const DemoScenario_t *pScn = (const DemoScenario_t *)pUser;
+    float t = pIn->Time.Current_Time * 0.001f;   /* [s] */
+    (void)cycle;
+
+    pIn->Gps.GPS_Velocity_X = pScn->Ego_Speed;
+    pIn->Gps.GPS_Velocity_Y = 0.0f;
+    pIn->Gps.GPS_Timestamp  = pIn->Time.Current_Time;
+    pIn->Imu.Linear_Acceleration_X = 0.0f;
+    pIn->Imu.Linear_Acceleration_Y = 0.0f;
+    pIn->Imu.Yaw_Rate              = 0.0f;
+
+    pIn->Lane.Lane_Type            = LANE_TYPE_STRAIGHT;
+    pIn->Lane.Lane_Curvature       = 0.0f;
+    pIn->Lane.Next_Lane_Curvature  = 0.0f;
+    pIn->Lane.Lane_Offset          = 0.0f;
+    pIn->Lane.Lane_Heading         = 0.0f;
+    pIn->Lane.Lane_Width           = 3.5f;
+    pIn->Lane.Lane_Change_Status   = LANE_CHANGE_KEEP;
+    pIn->Lane.Lane_Curve_Direction = 0;
+
+    /* 객체는 상대속도로 접근, 5m 까지 가까워지면 초기 위치로 재배치 */
+    pIn->Object_Count = 3;
+    for(int i = 0; i < 3; i++)
+    {
+        ObjectData_t obj = pScn->Init_Objects[i];
+        float closing = (pScn->Ego_Speed - obj.Velocity_X) * t;
+        float span    = obj.Distance - 5.0f;
+        if(closing > 0.0f && span > 0.0f)
+        {
+            closing = fmodf(closing, span);
+        }
+        obj.Position_X -= closing;
+        obj.Distance   -= closing;
+        pIn->Objects[i] = obj;
+    }
+    return 0;
+}
+
+/* -t : 제어 출력 이벤트 (루프/제어 스레드에서 호출 -> 링 기록만) */
+static void telem_output(void *pUser, uint64_t cycle, const AdasFrameOutput_t *pOut)
+{
+    (void)pUser;
+    if((s_telemEvery == 0) || ((cycle % s_telemEvery) != 0))
+        return;
+
+    uint64_t args[6] = { cycle,
+                         AdasTelemetry_F(pOut->Control.throttle), AdasTelemetry_F(pOut->Control.brake),
+                         AdasTelemetry_F(pOut->Control.steer),    AdasTelemetry_F(pOut->Accel_Acc),
+                         AdasTelemetry_F(pOut->Decel_Aeb) };
+    AdasTelemetry_Emit(s_telemCh, ADAS_TELEM_EV_CONTROL, 6, args);
+}
+
+/* -l 무한 실행 시 기록 용량 (10ms 주기 5분) */
+#define LOG_DEFAULT_CAPACITY  30000ULL
+#define LOG_SNAPSHOT_FREE_RUN 100u   /* -p 0 일 때 스냅샷 간격 [레코드] */
+
+/* 가상 센서 드라이버: IMU 2ms / GPS 10ms / 객체 목록 20ms 주기로 게시 */
+#define DRIVER_TICK_NS     (2ULL * ADAS_NS_PER_MS)
+#define DRIVER_GPS_TICKS   5
+#define DRIVER_OBJ_TICKS   10
+
+static void *sensor_driver(void *pArg)
+{
+    DemoScenario_t  *pScn    = (DemoScenario_t *)pArg;
+    AdasFrameInput_t frame;
+    uint64_t         release = AdasTime_NowNs();
+
+    memset(&frame, 0, sizeof(frame));
+    for(uint64_t tick = 0; !s_driverStop; tick++)
+    {
+        frame.Time.Current_Time = (float)(tick * DRIVER_TICK_NS) / (float)ADAS_NS_PER_MS;
+        demo_input(pScn, tick, &frame);
+
+        AdasIngest_PushImu(&s_ingest, &frame.Imu);
+        if((tick % DRIVER_GPS_TICKS) == 0)
+            AdasIngest_PushGps(&s_ingest, &frame.Gps);
+        if((tick % DRIVER_OBJ_TICKS) == 0)
+            AdasIngest_PushObjects(&s_ingest, frame.Objects, frame.Object_Count);
+
+        release += DRIVER_TICK_NS;
+        AdasTime_SleepUntilNs(release);
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Cycle_Limit = 100;   /* 기본 1초 (10ms x 100) */
+
+    int pipelined  = 0;
+    int controlCpu = -1;
+    int useIngest  = 0;
+    const char *shmName = NULL;
+    const char *logPath = NULL;
+    int useTelem = 0;
+    const char *tracePath = NULL;
+    int useMetrics = 0;
+    int usePerf = 0;
+    LFA_High_Speed_Law_e hsLaw = LFA_HS_LAW_STANLEY;
+    int opt;
+    while((opt = getopt(argc, argv, "p:n:r:c:mb:PC:w:W:sx:l:t:T:HeL:")) != -1)
+    {
+        switch(opt)
+        {
+        case 'p': cfg.Period_Ns   = (uint64_t)(atof(optarg) * (double)ADAS_NS_PER_MS); break;
+        case 'n': cfg.Cycle_Limit = strtoull(optarg, NULL, 10); break;
+        case 'r': cfg.Rt_Priority = atoi(optarg); break;
+        case 'c': cfg.Cpu_Id      = atoi(optarg); break;
+        case 'm': cfg.Lock_Memory = 1; break;
+        case 'b':
+            for(int s = 0; s < ADAS_STAGE_COUNT; s++)
+                cfg.Stage_Budget_Ns[s] = (uint64_t)(atof(optarg) * (double)ADAS_NS_PER_US);
+            break;
+        case 'P': pipelined  = 1; break;
+        case 'C': controlCpu = atoi(optarg); break;
+        case 'w': cfg.Worker_Count    = atoi(optarg); break;
+        case 'W': cfg.Worker_Cpu_Base = atoi(optarg); break;
+        case 's': useIngest = 1; break;
+        case 'x': shmName   = optarg; break;
+        case 'l': logPath   = optarg; break;
+        case 't': useTelem  = 1; s_telemEvery = strtoull(optarg, NULL, 10); break;
+        case 'T': tracePath = optarg; break;
+        case 'H': useMetrics = 1; break;
+        case 'e': usePerf    = 1; break;
+        case 'L':
+            if(lfa_parse_high_speed_law(optarg, &hsLaw) != 0)
+            {
+                fprintf(stderr, "unknown LFA law: %s (stanley | pursuit)\n", optarg);
+                return 1;
+            }
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-p period_ms] [-n cycles] [-r fifo_prio] [-c cpu] [-m] [-b stage_budget_us] [-P] [-C control_cpu] [-w workers] [-W worker_cpu] [-s] [-x shm_name] [-l log_file] [-t every_n] [-T trace_json] [-H] [-e] [-L stanley|pursuit]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    DemoScenario_t scn = {
+        .Ego_Speed = 10.0f,
+        .Init_Objects = {
+            { .Object_ID=1, .Object_Type=OBJTYPE_CAR, .Position_X=30.0f, .Position_Y=0.5f,
+              .Distance=30.0f, .Velocity_X=8.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING },
+            { .Object_ID=2, .Object_Type=OBJTYPE_PEDESTRIAN, .Position_X=25.0f, .Position_Y=2.0f,
+              .Distance=26.0f, .Velocity_X=1.0f, .Heading=10.0f, .Object_Status=OBJSTAT_MOVING },
+            { .Object_ID=3, .Object_Type=OBJTYPE_CAR, .Position_X=100.0f, .Position_Y=-0.5f,
+              .Distance=100.0f, .Velocity_X=12.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING }
+        }
     };
-    FilteredObject_t fList[3];
-    PredictedObject_t pList[3];
-
-    ACC_Target_t accTarget;
-    AEB_Target_t aebTarget;
-
-    /* 모의 루프 한번 */
-    /* 1) EgoEstimation_Update */
-    timeData.Current_Time= 10.0f; /* ms */
-    EgoEstimation_Update(&timeData, &gpsData, &imuData, &egoData, &kfState);
-
-    /* 2) LaneSelection */
-    LaneSelection_Compute(&laneData, &egoData, &laneSelOut);
-
-    /* 3) TargetSelection */
-    int fcount = select_target_from_object_list(objList, 3, &egoData, &laneSelOut,
-                                                fList, 3);
-    int pcount = predict_object_future_path(fList, fcount, &laneData, &laneSelOut,
-                                            pList, 3);
-    select_targets_for_acc_aeb(&egoData, pList, pcount, &laneSelOut,
-                               &accTarget, &aebTarget);
-
-    /* 4) ACC */
-    ACC_Mode_e accMode = ACC_ModeSelection(&accTarget, &egoData, &laneSelOut);
-    float dt=0.01f; /* 10ms */
-    float accDist= ACC_CalcAccel_Distance(&accTarget, &egoData, dt);
-    float accSpeed=ACC_CalcAccel_Speed(&egoData, &laneSelOut, dt);
-    float accelACC= ACC_OutputSelection(accMode, accDist, accSpeed);
-
-    /* 5) AEB */
-    float ttc=0.0f, ttcBrake=0.0f, ttcAlert=0.0f, relSp=0.0f;
-    AEB_CalcTTC(&egoData, &aebTarget, &ttc, &ttcBrake, &ttcAlert, &relSp);
-    AEB_Mode_e aebMode = AEB_ModeSelection(ttc, ttcBrake, ttcAlert, &aebTarget, &egoData);
-    float decelAEB= AEB_CalcDecel(aebMode, ttc, ttcBrake);
-
-    /* 6) LFA */
-    LFA_Mode_e lfaMode= LFA_ModeSelection(&egoData);
-    float steerPid= LFA_CalcSteer_LowSpeedPID(&laneSelOut, dt);
-    float steerStan= LFA_CalcSteer_HighSpeedStanley(&egoData, &laneSelOut);
-    float steerLFA= LFA_OutputSelection(lfaMode, steerPid, steerStan, &laneSelOut, &egoData);
-
-    /* 7) Arbitration */
-    VehicleControl_t ctrl;
-    Arbitration_ComputeControl(accelACC, decelAEB, steerLFA, aebMode, &ctrl);
+
+    signal(SIGINT,  on_signal);
+    signal(SIGTERM, on_signal);
+
+    /* -s : 입력은 센서 드라이버 스레드 -> 큐/메일박스 (차선은 시나리오 값 고정) */
+    AdasInputFn_t pfnInput = demo_input;
+    void         *pInUser  = &scn;
+    pthread_t     driver;
+    if(useIngest)
+    {
+        AdasIngest_Init(&s_ingest, NULL);
+        pfnInput = AdasIngest_InputFn;
+        pInUser  = &s_ingest;
+        if(pthread_create(&driver, NULL, sensor_driver, &scn) != 0)
+        {
+            fprintf(stderr, "sensor driver thread failed\n");
+            return 1;
+        }
+    }
+
+    /* -x : 입력은 시뮬레이터 공유 메모리 링 (프레임을 그 자리에서 사용) */
+    if(shmName)
+    {
+        if(pipelined || useIngest)
+        {
+            fprintf(stderr, "-x cannot be combined with -P or -s\n");
+            return 1;
+        }
+        int rc = AdasShm_Open(&s_shm, shmName);
+        if(rc != 0)
+        {
+            fprintf(stderr, "shm open failed: %s (%s)\n", shmName,
+                    (rc == ADAS_SHM_ERR_LAYOUT) ? "layout mismatch" : "not found");
+            return 1;
+        }
+        pInUser = &s_shm;
+    }
+
+    /* -l : 용량 = 실행 주기 수 (무한 실행이면 기본 용량, 초과분은 버림), 스냅샷은 1초마다 */
+    if(logPath)
+    {
+        uint64_t capacity = (cfg.Cycle_Limit != 0) ? cfg.Cycle_Limit : LOG_DEFAULT_CAPACITY;
+        uint32_t snapEvery = (cfg.Period_Ns != 0) ? (uint32_t)(ADAS_NS_PER_SEC / cfg.Period_Ns) : LOG_SNAPSHOT_FREE_RUN;
+        if(snapEvery == 0) snapEvery = 1;
+        if(AdasCycleLog_Create(&s_log, logPath, capacity, snapEvery) != 0)
+        {
+            fprintf(stderr, "log create failed: %s\n", logPath);
+            return 1;
+        }
+    }
+
+    /* -t : 루프 스레드 채널 1개 (파이프라인 모드는 제어 스레드), 출력 스레드는 RT 설정 전에 생성 */
+    AdasOutputFn_t pfnOutput = NULL;
+    if(useTelem)
+    {
+        AdasTelemetry_Init(&s_telem, stdout);
+        s_telemCh = AdasTelemetry_AddChannel(&s_telem, pipelined ? "control" : "loop");
+        if(!s_telemCh || (AdasTelemetry_Start(&s_telem, -1) != 0))
+        {
+            fprintf(stderr, "telemetry start failed\n");
+            return 1;
+        }
+        pfnOutput = telem_output;
+    }
+
+    const AdasFrameOutput_t *pOut;
+    int rtFail;
+
+    if(pipelined)
+    {
+        AdasPipelinedConfig_t plCfg;
+        AdasPipelined_DefaultConfig(&plCfg);
+        plCfg.Period_Ns      = cfg.Period_Ns;
+        plCfg.Cycle_Limit    = cfg.Cycle_Limit;
+        plCfg.Rt_Priority    = cfg.Rt_Priority;
+        plCfg.Perception_Cpu = cfg.Cpu_Id;
+        plCfg.Control_Cpu    = controlCpu;
+        plCfg.Lock_Memory    = cfg.Lock_Memory;
+        if(useMetrics)
+            fprintf(stderr, "warning: -H is ignored with -P\n");
+        if(usePerf)
+            fprintf(stderr, "warning: -e is ignored with -P\n");
+
+        if(AdasPipelined_Init(&s_pipelined, &plCfg, pfnInput, pfnOutput, pInUser) != 0)
+        {
+            fprintf(stderr, "invalid pipelined config\n");
+            return 1;
+        }
+        s_pipelined.Pipeline.Lfa.High_Speed_Law = hsLaw;
+        demo_input(&scn, 0, &s_pipelined.Input);
+        if(logPath)
+            AdasPipelined_SetLog(&s_pipelined, &s_log);
+        if(AdasPipelined_Run(&s_pipelined) != 0)
+        {
+            fprintf(stderr, "pipelined run failed\n");
+            return 1;
+        }
+        rtFail = s_pipelined.Stats.Rt_Failed;
+        pOut   = &s_pipelined.Output;
+    }
+    else
+    {
+        if(AdasRuntime_Init(&s_runtime, &cfg, pfnInput, pfnOutput, pInUser) != 0)
+        {
+            fprintf(stderr, "invalid runtime config\n");
+            return 1;
+        }
+        s_runtime.Pipeline.Lfa.High_Speed_Law = hsLaw;
+        demo_input(&scn, 0, &s_runtime.Input);
+        if(shmName)
+            AdasRuntime_SetInputRef(&s_runtime, AdasShm_InputRefFn, AdasShm_InputCheckFn);
+        if(logPath)
+            AdasRuntime_SetLog(&s_runtime, &s_log);
+        if(useTelem)
+            AdasRuntime_SetTelemetry(&s_runtime, s_telemCh);
+        if(useMetrics)
+        {
+            AdasMetrics_Init(&s_metrics);
+            AdasRuntime_SetMetrics(&s_runtime, &s_metrics);
+        }
+        if(usePerf)
+        {
+            if(cfg.Worker_Count > 0)
+                fprintf(stderr, "warning: -e is ignored with -w\n");
+            else if(AdasPerf_Open(&s_perf) == 0)
+                fprintf(stderr, "warning: perf counters unavailable\n");
+            AdasRuntime_SetPerf(&s_runtime, &s_perf);
+        }
+        rtFail = AdasRuntime_ApplyRtSettings(&cfg);
+        AdasRuntime_Run(&s_runtime);
+        pOut = &s_runtime.Output;
+    }
+
+    if(useIngest)
+    {
+        s_driverStop = 1;
+        pthread_join(driver, NULL);
+    }
+
+    if(useTelem)
+    {
+        AdasTelemetry_Stop(&s_telem);
+        printf("---- Telemetry ----\n");
+        printf("Written=%llu, Dropped=%llu\n",
+               (unsigned long long)s_telem.Written, (unsigned long long)AdasTelemetry_Dropped(&s_telem));
+    }
+
+    if(tracePath)
+    {
+        if(!ADAS_TRACE)
+            fprintf(stderr, "warning: built without -DADAS_TRACE=1, trace is empty\n");
+        long events = AdasTrace_ExportChrome(tracePath);
+        printf("---- Trace (%s) ----\n", tracePath);
+        printf("Events=%ld, Overwritten=%llu\n", events, (unsigned long long)AdasTrace_Overwritten());
+    }
+
+    if(logPath)
+    {
+        printf("---- Log (%s) ----\n", logPath);
+        printf("Records=%llu, Snapshots=%llu, Dropped=%llu, RecordSize=%zu B, SnapshotSize=%zu B\n",
+               (unsigned long long)AdasCycleLog_Count(&s_log),
+               (unsigned long long)s_log.Snapshot_Count,
+               (unsigned long long)s_log.pHeader->Dropped,
+               sizeof(AdasCycleRecord_t), sizeof(AdasSnapshot_t));
+        AdasCycleLog_Close(&s_log);
+    }
+
+    if(shmName)
+    {
+        printf("---- Shm (%s) ----\n", shmName);
+        printf("Read=%llu, Skipped=%llu, Torn=%llu, Retries=%llu\n",
+               (unsigned long long)s_shm.Stats.Frames_Read,
+               (unsigned long long)s_shm.Stats.Frames_Skipped,
+               (unsigned long long)s_shm.Stats.Torn_Reads,
+               (unsigned long long)s_shm.Stats.Retries);
+        AdasShm_Close(&s_shm, 0);
+    }
+
+    if(rtFail & ADAS_RT_FAIL_MLOCK)    fprintf(stderr, "warning: mlockall failed\n");
+    if(rtFail & ADAS_RT_FAIL_AFFINITY) fprintf(stderr, "warning: CPU affinity failed\n");
+    if(rtFail & ADAS_RT_FAIL_SCHED)    fprintf(stderr, "warning: SCHED_FIFO failed (need CAP_SYS_NICE)\n");
 
     printf("---- EgoData ----\n");
-    printf("VelX=%.2f, Heading=%.2f\n", egoData.Ego_Velocity_X, egoData.Ego_Heading);
+    printf("VelX=%.2f, Heading=%.2f\n", pOut->Ego.Ego_Velocity_X, pOut->Ego.Ego_Heading);
 
     printf("---- ACC Output ----\n");
-    printf("ACC Mode=%d, ACC Accel=%.2f\n",(int)accMode, accelACC);
+    printf("ACC Mode=%d, ACC Accel=%.2f\n", (int)pOut->Acc_Mode, pOut->Accel_Acc);
 
     printf("---- AEB Output ----\n");
-    printf("AEB Mode=%d, Decel=%.2f, TTC=%.2f\n",(int)aebMode,decelAEB,ttc);
+    printf("AEB Mode=%d, Decel=%.2f, TTC=%.2f\n", (int)pOut->Aeb_Mode, pOut->Decel_Aeb, pOut->Ttc.TTC);
 
     printf("---- LFA Output ----\n");
-    printf("LFA Mode=%d, Steer=%.2f deg\n",(int)lfaMode, steerLFA);
+    printf("LFA Mode=%d, Steer=%.2f deg\n", (int)pOut->Lfa_Mode, pOut->Steer_Lfa);
 
     printf("---- Arbitration Final ----\n");
-    printf("Throttle=%.2f, Brake=%.2f, Steer=%.2f\n", ctrl.throttle, ctrl.brake, ctrl.steer);
+    printf("Throttle=%.2f, Brake=%.2f, Steer=%.2f\n", pOut->Control.throttle, pOut->Control.brake, pOut->Control.steer);
+
+    if(pipelined)
+        AdasPipelined_PrintStats(&s_pipelined);
+    else
+    {
+        AdasRuntime_PrintStats(&s_runtime);
+        if(useMetrics)
+            AdasMetrics_Print(&s_metrics);
+        if(usePerf && (cfg.Worker_Count == 0))
+        {
+            AdasPerf_Print(&s_perf);
+            AdasPerf_Close(&s_perf);
+        }
+        AdasRuntime_Destroy(&s_runtime);
+    }
+    if(useIngest)
+        AdasIngest_PrintStats(&s_ingest);
 
     return 0;
 }
@@ -0,0 +1,649 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* pthread */
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "scenario_batch.h"
+#include "vehicle_sim.h"
+#include "adas_pipeline.h"
+#include "adas_time.h"
+
+/* 묶음 최대 실행 수 (차량 배치 묶음 폭) */
+#define SCN_BLOCK_MAX        8
+
+/* 차폭 [m] (차선 이탈 / 같은 차로 판정) */
+#define SCN_CAR_WIDTH        1.9f
+
+/* 끼어들기: 선행차 속도 = 자차 - 이 값 (최소 SCN_CUT_IN_MIN_SPEED), 차로 진입 시간 [s] */
+#define SCN_CUT_IN_DELTA_V   5.0f
+#define SCN_CUT_IN_MIN_SPEED 3.0f
+#define SCN_CUT_IN_TIME      2.0f
+
+/* 정지-출발: 정속 / 정차 시간 [s], 출발 가속도 [m/s^2] */
+#define SCN_SNG_CRUISE_S     3.0f
+#define SCN_SNG_HOLD_S       3.0f
+#define SCN_SNG_ACCEL        1.5f
+
+/* 곡선: 선행차 속도 = 자차 초기 속도 * 이 값 */
+#define SCN_CURVE_LEAD_RATIO 0.9f
+
+static const char *const s_typeNames[SCENARIO_TYPE_COUNT] = {
+    "cut-in", "stop-and-go", "curve"
+};
+
+static const char *const s_kpiNames[SCENARIO_KPI_COUNT] = {
+    "min_ttc_s", "max_decel", "max_jerk", "lane_rms_m", "aeb_activations"
+};
+
+/* ----------------------------------------------------------------------------
+ * 실행별 상태 (묶음 칸마다 1개)
+ * ---------------------------------------------------------------------------*/
+typedef enum
+{
+    SNG_CRUISE = 0,
+    SNG_BRAKE,
+    SNG_HOLD,
+    SNG_ACCEL
+} SngPhase_e;
+
+typedef struct
+{
+    AdasPipeline_t     Pipe;
+    AdasFrameInput_t   In;
+    AdasFrameOutput_t  Out;
+    ScenarioInstance_t Inst;
+    ScenarioResult_t   Result;
+
+    /* 선행차 스크립트 */
+    int   Cut_In_Started;
+    int   Phase;
+    float Phase_Time;
+
+    /* KPI 누적 */
+    float Prev_Vx;
+    float Prev_Accel;
+    double Offset_Sq_Sum;
+    int   Samples;
+    int   Prev_Aeb_Brake;
+    int   Done;                      /* 추돌 이후 집계 중단 */
+} ScnRun_t;
+
+typedef struct
+{
+    VehicleSimFleet_t Fleet;
+    ScnRun_t          Runs[SCN_BLOCK_MAX];
+} ScnBlock_t;
+
+/* ----------------------------------------------------------------------------
+ * 이름 / 설정 / 격자
+ * ---------------------------------------------------------------------------*/
+const char *ScenarioBatch_TypeName(ScenarioType_e type)
+{
+    return ((unsigned)type < SCENARIO_TYPE_COUNT) ? s_typeNames[type] : "?";
+}
+
+const char *ScenarioBatch_KpiName(ScenarioKpi_e kpi)
+{
+    return ((unsigned)kpi < SCENARIO_KPI_COUNT) ? s_kpiNames[kpi] : "?";
+}
+
+void ScenarioBatch_DefaultConfig(ScenarioBatchConfig_t *pConfig)
+{
+    if(!pConfig)
+        return;
+
+    memset(pConfig, 0, sizeof(*pConfig));
+    pConfig->Delta_Time   = 0.01f;
+    pConfig->Duration     = 20.0f;
+    pConfig->Thread_Count = 1;
+    pConfig->Batch_Size   = SCN_BLOCK_MAX;
+}
+
+int64_t ScenarioGrid_Count(const ScenarioGrid_t *pGrid)
+{
+    if(!pGrid || (pGrid->Ego_Speed.Count <= 0) || (pGrid->Lead_Gap.Count <= 0) || (pGrid->Param.Count <= 0))
+        return 0;
+
+    return (int64_t)pGrid->Ego_Speed.Count * (int64_t)pGrid->Lead_Gap.Count * (int64_t)pGrid->Param.Count;
+}
+
+static float axis_value(const ScenarioAxis_t *pAxis, int i)
+{
+    if(pAxis->Count <= 1)
+        return pAxis->Min;
+    return pAxis->Min + ((pAxis->Max - pAxis->Min) * (float)i / (float)(pAxis->Count - 1));
+}
+
+int ScenarioGrid_Instance(const ScenarioGrid_t *pGrid, int64_t index, ScenarioInstance_t *pInst)
+{
+    int64_t count = ScenarioGrid_Count(pGrid);
+    if(!pInst || (index < 0) || (index >= count))
+        return -1;
+
+    int iParam = (int)(index % pGrid->Param.Count);
+    index /= pGrid->Param.Count;
+    int iGap   = (int)(index % pGrid->Lead_Gap.Count);
+    int iSpeed = (int)(index / pGrid->Lead_Gap.Count);
+
+    pInst->Type      = pGrid->Type;
+    pInst->Ego_Speed = axis_value(&pGrid->Ego_Speed, iSpeed);
+    pInst->Lead_Gap  = axis_value(&pGrid->Lead_Gap, iGap);
+    pInst->Param     = axis_value(&pGrid->Param, iParam);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * ScenarioStat (Welford / Chan)
+ * ---------------------------------------------------------------------------*/
+void ScenarioStat_Init(ScenarioStat_t *pStat)
+{
+    if(!pStat)
+        return;
+
+    memset(pStat, 0, sizeof(*pStat));
+    pStat->Min = INFINITY;
+    pStat->Max = -INFINITY;
+    pStat->Sketch.Min_Ns = UINT64_MAX;
+}
+
+void ScenarioStat_Add(ScenarioStat_t *pStat, double value)
+{
+    if(!pStat)
+        return;
+
+    pStat->Count++;
+    double d = value - pStat->Mean;
+    pStat->Mean += d / (double)pStat->Count;
+    pStat->M2   += d * (value - pStat->Mean);
+    if(value < pStat->Min) pStat->Min = value;
+    if(value > pStat->Max) pStat->Max = value;
+
+    double scaled = value * SCENARIO_STAT_SCALE;
+    AdasHist_Record(&pStat->Sketch, (scaled > 0.0) ? (uint64_t)(scaled + 0.5) : 0u);
+}
+
+void ScenarioStat_Merge(ScenarioStat_t *pDst, const ScenarioStat_t *pSrc)
+{
+    if(!pDst || !pSrc || (pSrc->Count == 0))
+        return;
+
+    double n1 = (double)pDst->Count;
+    double n2 = (double)pSrc->Count;
+    double n  = n1 + n2;
+    double d  = pSrc->Mean - pDst->Mean;
+
+    pDst->Mean  += d * (n2 / n);
+    pDst->M2    += pSrc->M2 + (d * d * n1 * n2 / n);
+    pDst->Count += pSrc->Count;
+    if(pSrc->Min < pDst->Min) pDst->Min = pSrc->Min;
+    if(pSrc->Max > pDst->Max) pDst->Max = pSrc->Max;
+    AdasHist_Merge(&pDst->Sketch, &pSrc->Sketch);
+}
+
+double ScenarioStat_Stddev(const ScenarioStat_t *pStat)
+{
+    if(!pStat || (pStat->Count < 2))
+        return 0.0;
+    return sqrt(pStat->M2 / (double)(pStat->Count - 1));
+}
+
+double ScenarioStat_Quantile(const ScenarioStat_t *pStat, double percentile)
+{
+    if(!pStat || (pStat->Count == 0))
+        return 0.0;
+    return (double)AdasHist_Percentile(&pStat->Sketch, percentile) / SCENARIO_STAT_SCALE;
+}
+
+static void aggregate_init(ScenarioAggregate_t *pAgg)
+{
+    memset(pAgg, 0, sizeof(*pAgg));
+    for(int k = 0; k < SCENARIO_KPI_COUNT; k++)
+        ScenarioStat_Init(&pAgg->Kpi[k]);
+}
+
+static void aggregate_add(ScenarioAggregate_t *pAgg, const ScenarioResult_t *pRes)
+{
+    pAgg->Runs++;
+    pAgg->Collisions += (pRes->Collision != 0);
+    pAgg->Departures += (pRes->Lane_Departure != 0);
+    for(int k = 0; k < SCENARIO_KPI_COUNT; k++)
+        ScenarioStat_Add(&pAgg->Kpi[k], pRes->Kpi[k]);
+}
+
+static void aggregate_merge(ScenarioAggregate_t *pDst, const ScenarioAggregate_t *pSrc)
+{
+    pDst->Runs       += pSrc->Runs;
+    pDst->Collisions += pSrc->Collisions;
+    pDst->Departures += pSrc->Departures;
+    for(int k = 0; k < SCENARIO_KPI_COUNT; k++)
+        ScenarioStat_Merge(&pDst->Kpi[k], &pSrc->Kpi[k]);
+}
+
+/* ----------------------------------------------------------------------------
+ * 묶음 실행
+ * ---------------------------------------------------------------------------*/
+
+/* 실행 시작 상태: 선행차 배치, 파이프라인 초기화 (Ego 추정은 초기 속도로 시작) */
+static void run_setup(ScnBlock_t *pBlk, int lane, const ScenarioInstance_t *pInst, float dt)
+{
+    VehicleSimFleet_t *pF = &pBlk->Fleet;
+    ScnRun_t          *pR = &pBlk->Runs[lane];
+    VehicleSimInit_t   init;
+
+    memset(&init, 0, sizeof(init));
+    init.Speed    = pInst->Ego_Speed;
+    init.Lead_Gap = pInst->Lead_Gap;
+    switch(pInst->Type)
+    {
+        case SCENARIO_CUT_IN:
+            init.Lead_Speed  = fmaxf(pInst->Ego_Speed - SCN_CUT_IN_DELTA_V, SCN_CUT_IN_MIN_SPEED);
+            init.Lead_Offset = pF->Params.Lane_Width;
+            break;
+        case SCENARIO_STOP_AND_GO:
+            init.Lead_Speed  = pInst->Ego_Speed;
+            break;
+        case SCENARIO_CURVE:
+        default:
+            init.Lead_Speed     = pInst->Ego_Speed * SCN_CURVE_LEAD_RATIO;
+            init.Road_Curvature = (fabsf(pInst->Param) > 1.0f) ? (1.0f / pInst->Param) : 0.0f;
+            break;
+    }
+    VehicleSim_SetVehicle(pF, lane, &init);
+
+    memset(pR, 0, sizeof(*pR));
+    pR->Inst = *pInst;
+    AdasPipeline_Init(&pR->Pipe, dt);
+    pR->Pipe.Kf.X[0]           = pInst->Ego_Speed;
+    pR->Pipe.Kf.Prev_GPS_Vel_X = pInst->Ego_Speed;
+    pR->Prev_Vx = pInst->Ego_Speed;
+    pR->Result.Kpi[SCENARIO_KPI_MIN_TTC] = SCENARIO_TTC_MAX;
+}
+
+/* 선행차 스크립트 (Step 전, 선행차 속도 / 횡위치 갱신) */
+static void run_script(ScnBlock_t *pBlk, int lane, float dt)
+{
+    VehicleSimFleet_t *pF = &pBlk->Fleet;
+    ScnRun_t          *pR = &pBlk->Runs[lane];
+    if(pF->Lead_Speed[lane] < 0.0f)
+        return;
+
+    if(pR->Inst.Type == SCENARIO_CUT_IN)
+    {
+        if(!pR->Cut_In_Started && (VehicleSim_LeadGap(pF, lane) <= pR->Inst.Param))
+            pR->Cut_In_Started = 1;
+        if(pR->Cut_In_Started)
+        {
+            float step = pF->Params.Lane_Width * dt / SCN_CUT_IN_TIME;
+            pF->Lead_Offset[lane] = fmaxf(pF->Lead_Offset[lane] - step, 0.0f);
+        }
+    }
+    else if(pR->Inst.Type == SCENARIO_STOP_AND_GO)
+    {
+        float v = pF->Lead_Speed[lane];
+        pR->Phase_Time += dt;
+        switch(pR->Phase)
+        {
+            case SNG_CRUISE:
+                if(pR->Phase_Time >= SCN_SNG_CRUISE_S) { pR->Phase = SNG_BRAKE; pR->Phase_Time = 0.0f; }
+                break;
+            case SNG_BRAKE:
+                v = fmaxf(v - (pR->Inst.Param * dt), 0.0f);
+                if(v <= 0.0f) { pR->Phase = SNG_HOLD; pR->Phase_Time = 0.0f; }
+                break;
+            case SNG_HOLD:
+                if(pR->Phase_Time >= SCN_SNG_HOLD_S) { pR->Phase = SNG_ACCEL; pR->Phase_Time = 0.0f; }
+                break;
+            case SNG_ACCEL:
+            default:
+                v = fminf(v + (SCN_SNG_ACCEL * dt), pR->Inst.Ego_Speed);
+                if(v >= pR->Inst.Ego_Speed) { pR->Phase = SNG_CRUISE; pR->Phase_Time = 0.0f; }
+                break;
+        }
+        pF->Lead_Speed[lane] = v;
+    }
+}
+
+/* KPI 누적 (Step 후) */
+static void run_measure(ScnBlock_t *pBlk, int lane, float dt, float laneLimit)
+{
+    VehicleSimFleet_t *pF = &pBlk->Fleet;
+    ScnRun_t          *pR = &pBlk->Runs[lane];
+    ScenarioResult_t  *pRes = &pR->Result;
+    if(pR->Done)
+        return;
+
+    float vx = pF->Vx[lane];
+    float a  = (vx - pR->Prev_Vx) / dt;
+    if(pR->Samples > 0)
+    {
+        float jerk = fabsf(a - pR->Prev_Accel) / dt;
+        if(jerk > pRes->Kpi[SCENARIO_KPI_MAX_JERK]) pRes->Kpi[SCENARIO_KPI_MAX_JERK] = jerk;
+    }
+    if(-a > pRes->Kpi[SCENARIO_KPI_MAX_DECEL]) pRes->Kpi[SCENARIO_KPI_MAX_DECEL] = -a;
+    pR->Prev_Vx    = vx;
+    pR->Prev_Accel = a;
+
+    float offset;
+    VehicleSim_LanePose(pF, lane, &offset, NULL, NULL);
+    pR->Offset_Sq_Sum += (double)offset * (double)offset;
+    pR->Samples++;
+    if(fabsf(offset) > laneLimit)
+        pRes->Lane_Departure = 1;
+
+    int brake = (pR->Out.Aeb_Mode == AEB_MODE_BRAKE);
+    if(brake && !pR->Prev_Aeb_Brake)
+        pRes->Kpi[SCENARIO_KPI_AEB_ACTIVATIONS] += 1.0f;
+    pR->Prev_Aeb_Brake = brake;
+
+    /* 같은 차로 선행차: TTC / 추돌 */
+    float gap = VehicleSim_LeadGap(pF, lane);
+    if(isfinite(gap) && (fabsf(pF->Lead_Offset[lane] - offset) < SCN_CAR_WIDTH))
+    {
+        float closing = vx - pF->Lead_Speed[lane];
+        if(gap <= 0.0f)
+        {
+            pRes->Collision = 1;
+            pRes->Kpi[SCENARIO_KPI_MIN_TTC] = 0.0f;
+            pR->Done = 1;
+        }
+        else if(closing > 0.0f)
+        {
+            float ttc = gap / closing;
+            if(ttc < pRes->Kpi[SCENARIO_KPI_MIN_TTC]) pRes->Kpi[SCENARIO_KPI_MIN_TTC] = ttc;
+        }
+    }
+}
+
+/* 묶음 실행 (pBlk->Fleet 은 SCN_BLOCK_MAX 대로 생성된 것) */
+static void block_run(ScnBlock_t *pBlk, const ScenarioInstance_t *pInst, int count,
+                      const ScenarioBatchConfig_t *pConfig)
+{
+    VehicleSimFleet_t *pF = &pBlk->Fleet;
+    const float dt = pConfig->Delta_Time;
+    const float laneLimit = 0.5f * (pF->Params.Lane_Width - SCN_CAR_WIDTH);
+    const int   steps = (int)ceilf(pConfig->Duration / dt);
+
+    /* 빈 칸은 정지 차량 (적분은 하지만 센서/파이프라인 없음) */
+    VehicleSimInit_t idle;
+    memset(&idle, 0, sizeof(idle));
+    for(int l = count; l < SCN_BLOCK_MAX; l++)
+        VehicleSim_SetVehicle(pF, l, &idle);
+    for(int l = 0; l < count; l++)
+        run_setup(pBlk, l, &pInst[l], dt);
+    pF->Time  = 0.0;
+    pF->Steps = 0;
+
+    for(int k = 0; k < steps; k++)
+    {
+        for(int l = 0; l < count; l++)
+        {
+            ScnRun_t *pR = &pBlk->Runs[l];
+            run_script(pBlk, l, dt);
+            VehicleSim_Sense(pF, l, &pR->In);
+            AdasPipeline_Step(&pR->Pipe, &pR->In, &pR->Out);
+            VehicleSim_ApplyControl(pF, l, &pR->Out.Control);
+        }
+        VehicleSim_Step(pF, dt);
+        for(int l = 0; l < count; l++)
+            run_measure(pBlk, l, dt, laneLimit);
+    }
+
+    for(int l = 0; l < count; l++)
+    {
+        ScnRun_t *pR = &pBlk->Runs[l];
+        pR->Result.Kpi[SCENARIO_KPI_LANE_RMS] =
+            (pR->Samples > 0) ? (float)sqrt(pR->Offset_Sq_Sum / (double)pR->Samples) : 0.0f;
+    }
+}
+
+static ScnBlock_t *block_create(void)
+{
+    ScnBlock_t *pBlk = (ScnBlock_t *)calloc(1, sizeof(ScnBlock_t));
+    if(pBlk && (VehicleSim_Init(&pBlk->Fleet, SCN_BLOCK_MAX, NULL) != 0))
+    {
+        free(pBlk);
+        pBlk = NULL;
+    }
+    return pBlk;
+}
+
+static void block_destroy(ScnBlock_t *pBlk)
+{
+    if(!pBlk)
+        return;
+    VehicleSim_Destroy(&pBlk->Fleet);
+    free(pBlk);
+}
+
+static int config_valid(const ScenarioBatchConfig_t *pConfig)
+{
+    return pConfig && (pConfig->Delta_Time > 0.0f) && (pConfig->Duration > 0.0f) &&
+           (pConfig->Thread_Count >= 1) && (pConfig->Thread_Count <= SCENARIO_BATCH_MAX_THREADS) &&
+           (pConfig->Batch_Size >= 1) && (pConfig->Batch_Size <= SCN_BLOCK_MAX);
+}
+
+int ScenarioBatch_RunBlock(const ScenarioInstance_t *pInst, int count,
+                           const ScenarioBatchConfig_t *pConfig, ScenarioResult_t *pResults)
+{
+    if(!pInst || !pResults || (count < 1) || (count > SCN_BLOCK_MAX) || !config_valid(pConfig))
+        return -1;
+
+    ScnBlock_t *pBlk = block_create();
+    if(!pBlk)
+        return -1;
+
+    block_run(pBlk, pInst, count, pConfig);
+    for(int l = 0; l < count; l++)
+        pResults[l] = pBlk->Runs[l].Result;
+    block_destroy(pBlk);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * 작업 훔치기 스레드 풀
+ *  - 전체 실행 번호 [0, Total) 을 스레드 수로 균등 분할해 시작
+ *  - 소유자: 자기 구간 앞에서 Batch_Size 개씩, 도둑: 다른 구간 뒤쪽 절반
+ *  - 구간은 줄어들거나 나뉘기만 함 -> 모든 구간이 비어 보이면 종료해도 남은 일은
+ *    가져간 스레드가 처리 (작업 유실 없음)
+ * ---------------------------------------------------------------------------*/
+typedef struct ScnPool_s ScnPool_t;
+
+typedef struct
+{
+    pthread_mutex_t     Lock;
+    int64_t             Begin;
+    int64_t             End;
+    ScnPool_t          *pPool;
+    int                 Id;
+    pthread_t           Thread;
+    uint64_t            Steals;
+    uint64_t            Runs;
+    ScenarioAggregate_t Agg[SCENARIO_TYPE_COUNT];
+} ScnWorker_t;
+
+struct ScnPool_s
+{
+    const ScenarioGrid_t        *pGrids;
+    int                          Grid_Count;
+    int64_t                      Grid_Base[SCENARIO_BATCH_MAX_GRIDS];
+    const ScenarioBatchConfig_t *pConfig;
+    ScnWorker_t                 *pWorkers;
+    int                          Worker_Count;
+};
+
+/* 전체 번호 -> 격자 / 격자 내 번호 */
+static int pool_instance(const ScnPool_t *pPool, int64_t index, ScenarioInstance_t *pInst)
+{
+    for(int g = pPool->Grid_Count - 1; g >= 0; g--)
+    {
+        if(index >= pPool->Grid_Base[g])
+            return ScenarioGrid_Instance(&pPool->pGrids[g], index - pPool->Grid_Base[g], pInst);
+    }
+    return -1;
+}
+
+/* 자기 구간 앞에서 최대 n 개 */
+static int64_t worker_take(ScnWorker_t *pW, int n, int64_t *pFirst)
+{
+    pthread_mutex_lock(&pW->Lock);
+    int64_t avail = pW->End - pW->Begin;
+    int64_t take  = (avail < n) ? avail : n;
+    *pFirst    = pW->Begin;
+    pW->Begin += take;
+    pthread_mutex_unlock(&pW->Lock);
+    return take;
+}
+
+/* 다른 스레드 구간 뒤쪽 절반 훔치기 (성공 1) */
+static int worker_steal(ScnWorker_t *pW)
+{
+    ScnPool_t *pPool = pW->pPool;
+    for(int k = 1; k < pPool->Worker_Count; k++)
+    {
+        ScnWorker_t *pV = &pPool->pWorkers[(pW->Id + k) % pPool->Worker_Count];
+        int64_t first = 0, last = 0;
+
+        pthread_mutex_lock(&pV->Lock);
+        int64_t avail = pV->End - pV->Begin;
+        if(avail > 0)
+        {
+            first   = pV->Begin + (avail / 2);
+            last    = pV->End;
+            pV->End = first;
+        }
+        pthread_mutex_unlock(&pV->Lock);
+
+        if(last > first)
+        {
+            pthread_mutex_lock(&pW->Lock);
+            pW->Begin = first;
+            pW->End   = last;
+            pthread_mutex_unlock(&pW->Lock);
+            pW->Steals++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *worker_main(void *pArg)
+{
+    ScnWorker_t *pW = (ScnWorker_t *)pArg;
+    ScnPool_t   *pPool = pW->pPool;
+    const ScenarioBatchConfig_t *pConfig = pPool->pConfig;
+    ScnBlock_t  *pBlk = block_create();
+    if(!pBlk)
+        return NULL;   /* 남은 구간은 다른 스레드가 훔쳐 처리, 못 하면 Run 실패 */
+
+    ScenarioInstance_t inst[SCN_BLOCK_MAX];
+    for(;;)
+    {
+        int64_t first;
+        int64_t n = worker_take(pW, pConfig->Batch_Size, &first);
+        if(n == 0)
+        {
+            if(worker_steal(pW))
+                continue;
+            break;
+        }
+
+        for(int l = 0; l < (int)n; l++)
+            pool_instance(pPool, first + l, &inst[l]);
+        block_run(pBlk, inst, (int)n, pConfig);
+
+        for(int l = 0; l < (int)n; l++)
+        {
+            const ScenarioResult_t *pRes = &pBlk->Runs[l].Result;
+            aggregate_add(&pW->Agg[inst[l].Type], pRes);
+            if(pConfig->pfnResult)
+                pConfig->pfnResult(pConfig->pUser, first + l, &inst[l], pRes);
+        }
+        pW->Runs += (uint64_t)n;
+    }
+
+    block_destroy(pBlk);
+    return NULL;
+}
+
+int ScenarioBatch_Run(const ScenarioGrid_t *pGrids, int gridCount, const ScenarioBatchConfig_t *pConfig,
+                      ScenarioAggregate_t *pAgg, ScenarioBatchStats_t *pStats)
+{
+    ScnPool_t pool;
+    memset(&pool, 0, sizeof(pool));
+    if(!pGrids || !pAgg || (gridCount < 1) || (gridCount > SCENARIO_BATCH_MAX_GRIDS) ||
+       !config_valid(pConfig))
+        return -1;
+
+    int64_t total = 0;
+    for(int g = 0; g < gridCount; g++)
+    {
+        if((unsigned)pGrids[g].Type >= SCENARIO_TYPE_COUNT)
+            return -1;
+        pool.Grid_Base[g] = total;
+        total += ScenarioGrid_Count(&pGrids[g]);
+    }
+
+    for(int t = 0; t < SCENARIO_TYPE_COUNT; t++)
+        aggregate_init(&pAgg[t]);
+    if(pStats)
+        memset(pStats, 0, sizeof(*pStats));
+
+    int workers = pConfig->Thread_Count;
+    pool.pGrids       = pGrids;
+    pool.Grid_Count   = gridCount;
+    pool.pConfig      = pConfig;
+    pool.Worker_Count = workers;
+    pool.pWorkers     = (ScnWorker_t *)calloc((size_t)workers, sizeof(ScnWorker_t));
+    if(!pool.pWorkers)
+        return -1;
+
+    for(int w = 0; w < workers; w++)
+    {
+        ScnWorker_t *pW = &pool.pWorkers[w];
+        pthread_mutex_init(&pW->Lock, NULL);
+        pW->pPool = &pool;
+        pW->Id    = w;
+        pW->Begin = total * w / workers;
+        pW->End   = total * (w + 1) / workers;
+        for(int t = 0; t < SCENARIO_TYPE_COUNT; t++)
+            aggregate_init(&pW->Agg[t]);
+    }
+
+    uint64_t t0 = AdasTime_NowNs();
+    int started = 0;
+    for(; started < workers; started++)
+    {
+        if(pthread_create(&pool.pWorkers[started].Thread, NULL, worker_main, &pool.pWorkers[started]) != 0)
+            break;
+    }
+    for(int w = 0; w < started; w++)
+        pthread_join(pool.pWorkers[w].Thread, NULL);
+    uint64_t wallNs = AdasTime_NowNs() - t0;
+
+    /* 생성 실패 / 배치 할당 실패 스레드 몫은 다른 스레드가 훔쳐 처리, 남았으면 실패 */
+    int64_t runs = 0;
+    for(int w = 0; w < workers; w++)
+    {
+        ScnWorker_t *pW = &pool.pWorkers[w];
+        runs += (int64_t)pW->Runs;
+        for(int t = 0; t < SCENARIO_TYPE_COUNT; t++)
+            aggregate_merge(&pAgg[t], &pW->Agg[t]);
+        if(pStats)
+        {
+            pStats->Steals += pW->Steals;
+            if(w < SCENARIO_BATCH_MAX_THREADS)
+                pStats->Thread_Runs[w] = pW->Runs;
+        }
+        pthread_mutex_destroy(&pW->Lock);
+    }
+    if(pStats)
+    {
+        pStats->Runs    = runs;
+        pStats->Wall_Ns = wallNs;
+    }
+    free(pool.pWorkers);
+
+    return (runs == total) ? 0 : -1;
+}
@@ -0,0 +1,259 @@
+#include <string.h>
+#include <math.h>
+#include "sensor_fault.h"
+#include "adas_rng.h"
+#include "adas_math.h"
+
+/* 한 번에 처리할 샘플 수 (Philox 배치 폭) */
+#define SF_CHUNK            64
+
+/* 샘플당 Philox 블록: 0 = 잡음, 1 = 스파이크, 2 = 유실 / 지연, 바이어스 매듭 = 15 (카운터 ctr1 상위 4 bit) */
+#define SF_BLOCK_NOISE      0u
+#define SF_BLOCK_SPIKE      1u
+#define SF_BLOCK_TIMING     2u
+#define SF_BLOCK_BIAS       15u
+#define SF_BLOCK_SHIFT      28
+#define SF_LOW28_MASK       0x0FFFFFFFu
+
+/* 센서별 사용 채널 수 */
+static const int s_channelCount[SENSOR_FAULT_SENSOR_COUNT] = { 2, 3 };
+
+void SensorFault_DefaultConfig(SensorFaultConfig_t *pConfig)
+{
+    if(!pConfig)
+        return;
+
+    memset(pConfig, 0, sizeof(*pConfig));
+    pConfig->Seed = 1u;
+
+    SensorFaultSensorConfig_t *pGps = &pConfig->Sensor[SENSOR_FAULT_GPS];
+    pGps->Period_Ms      = 100.0f;
+    pGps->Bias_Period_Ms = 2000.0f;
+    pGps->Dropout_Prob   = 0.02f;
+    pGps->Latency_Ms     = 20.0f;
+    pGps->Jitter_Ms      = 10.0f;
+    pGps->Late_Prob      = 0.01f;
+    pGps->Late_Max_Ms    = 250.0f;
+    for(int c = 0; c < 2; c++)
+    {
+        pGps->Channel[c].Noise_Sigma     = 0.1f;
+        pGps->Channel[c].Bias_Sigma      = 0.05f;
+        pGps->Channel[c].Spike_Prob      = 0.005f;
+        pGps->Channel[c].Spike_Amplitude = 15.0f;    /* > MAX_SENSOR_NOISE_GPSVEL */
+    }
+
+    SensorFaultSensorConfig_t *pImu = &pConfig->Sensor[SENSOR_FAULT_IMU];
+    pImu->Period_Ms      = 10.0f;
+    pImu->Bias_Period_Ms = 2000.0f;
+    pImu->Dropout_Prob   = 0.001f;
+    pImu->Latency_Ms     = 2.0f;
+    pImu->Jitter_Ms      = 1.0f;
+    pImu->Late_Prob      = 0.001f;
+    pImu->Late_Max_Ms    = 30.0f;
+    for(int c = 0; c < 2; c++)
+    {
+        pImu->Channel[c].Noise_Sigma     = 0.05f;
+        pImu->Channel[c].Bias_Sigma      = 0.02f;
+        pImu->Channel[c].Spike_Prob      = 0.001f;
+        pImu->Channel[c].Spike_Amplitude = 5.0f;     /* > MAX_SENSOR_NOISE_ACCEL */
+    }
+    pImu->Channel[2].Noise_Sigma     = 0.2f;
+    pImu->Channel[2].Bias_Sigma      = 0.1f;
+    pImu->Channel[2].Spike_Prob      = 0.001f;
+    pImu->Channel[2].Spike_Amplitude = 50.0f;        /* > MAX_SENSOR_NOISE_YAWRATE */
+}
+
+/* ----------------------------------------------------------------------------
+ * 난수 변환
+ * ---------------------------------------------------------------------------*/
+static inline float u32_to_unit(uint32_t x)
+{
+    return (float)(x >> 8) * (1.0f / 16777216.0f);          /* [0, 1) */
+}
+
+/* Box-Muller: 32 bit 2 개 -> 표준 정규 2 개 */
+static inline void box_muller(uint32_t a, uint32_t b, float *pZ0, float *pZ1)
+{
+    float u1 = (float)((a >> 8) + 1u) * (1.0f / 16777216.0f); /* (0, 1] */
+    float r  = sqrtf(-2.0f * logf(u1));
+    float s, c;
+
+    AdasMath_SinCosF((2.0f * ADAS_MATH_PI) * u32_to_unit(b), &s, &c);
+    *pZ0 = r * c;
+    *pZ1 = r * s;
+}
+
+/* 바이어스 매듭 k 의 채널별 N(0, 1) 값 */
+static void bias_knot(const uint32_t key[2], uint32_t ctr2, uint32_t ctr3, int64_t knot, float pZ[4])
+{
+    uint32_t ctr[4] = {
+        (uint32_t)(uint64_t)knot,
+        ((uint32_t)((uint64_t)knot >> 32) & SF_LOW28_MASK) | (SF_BLOCK_BIAS << SF_BLOCK_SHIFT),
+        ctr2, ctr3
+    };
+    uint32_t r[4];
+
+    AdasRng_Philox4x32(ctr, key, r);
+    box_muller(r[0], r[1], &pZ[0], &pZ[1]);
+    box_muller(r[2], r[3], &pZ[2], &pZ[3]);
+}
+
+/* ----------------------------------------------------------------------------
+ * SensorFault_Apply
+ * ---------------------------------------------------------------------------*/
+int SensorFault_Apply(const SensorFaultConfig_t *pConfig, SensorFaultSensor_e sensor, uint64_t stream,
+                      SensorSample_t *pSamples, int count)
+{
+    if(!pConfig || ((unsigned)sensor >= SENSOR_FAULT_SENSOR_COUNT) || (stream > SENSOR_FAULT_STREAM_MAX) ||
+       (!pSamples && (count > 0)) || (count < 0))
+        return -1;
+
+    const SensorFaultSensorConfig_t *pS = &pConfig->Sensor[sensor];
+    if(!(pS->Period_Ms > 0.0f))
+        return -1;
+
+    const int      channels = s_channelCount[sensor];
+    const uint32_t key[2]   = { (uint32_t)pConfig->Seed, (uint32_t)(pConfig->Seed >> 32) };
+    const uint32_t ctr2     = (uint32_t)stream;
+    const uint32_t ctr3     = ((uint32_t)(stream >> 32) & SF_LOW28_MASK) | ((uint32_t)sensor << SF_BLOCK_SHIFT);
+    const int      useBias  = (pS->Bias_Period_Ms > 0.0f);
+
+    uint32_t c0[SF_CHUNK], c1[SF_CHUNK], c1b[SF_CHUNK];
+    uint32_t rn[4][SF_CHUNK], rs[4][SF_CHUNK], rt[4][SF_CHUNK];
+    int64_t  knotCached = INT64_MIN;
+    float    knotA[4] = { 0.0f }, knotB[4] = { 0.0f };
+
+    for(int base = 0; base < count; base += SF_CHUNK)
+    {
+        int n = ((count - base) < SF_CHUNK) ? (count - base) : SF_CHUNK;
+        SensorSample_t *pChunk = &pSamples[base];
+
+        for(int i = 0; i < n; i++)
+        {
+            c0[i] = (uint32_t)pChunk[i].Index;
+            c1[i] = (uint32_t)(pChunk[i].Index >> 32) & SF_LOW28_MASK;
+        }
+        for(int i = 0; i < n; i++) c1b[i] = c1[i] | (SF_BLOCK_NOISE << SF_BLOCK_SHIFT);
+        AdasRng_Philox4x32_Batch(c0, c1b, ctr2, ctr3, key, n, rn[0], rn[1], rn[2], rn[3]);
+        for(int i = 0; i < n; i++) c1b[i] = c1[i] | (SF_BLOCK_SPIKE << SF_BLOCK_SHIFT);
+        AdasRng_Philox4x32_Batch(c0, c1b, ctr2, ctr3, key, n, rs[0], rs[1], rs[2], rs[3]);
+        for(int i = 0; i < n; i++) c1b[i] = c1[i] | (SF_BLOCK_TIMING << SF_BLOCK_SHIFT);
+        AdasRng_Philox4x32_Batch(c0, c1b, ctr2, ctr3, key, n, rt[0], rt[1], rt[2], rt[3]);
+
+        for(int i = 0; i < n; i++)
+        {
+            SensorSample_t *p = &pChunk[i];
+            double tMeas = (double)p->Index * (double)pS->Period_Ms;
+            float  z[4];
+
+            box_muller(rn[0][i], rn[1][i], &z[0], &z[1]);
+            box_muller(rn[2][i], rn[3][i], &z[2], &z[3]);
+
+            /* 바이어스: 매듭 k, k + 1 선형 보간 (연속 샘플은 같은 매듭 재사용) */
+            float bias[4] = { 0.0f };
+            if(useBias)
+            {
+                double kt   = tMeas / (double)pS->Bias_Period_Ms;
+                int64_t k   = (int64_t)floor(kt);
+                float frac  = (float)(kt - (double)k);
+                if(k != knotCached)
+                {
+                    if(k == (knotCached + 1))
+                        memcpy(knotA, knotB, sizeof(knotA));
+                    else
+                        bias_knot(key, ctr2, ctr3, k, knotA);
+                    bias_knot(key, ctr2, ctr3, k + 1, knotB);
+                    knotCached = k;
+                }
+                for(int c = 0; c < channels; c++)
+                    bias[c] = knotA[c] + (frac * (knotB[c] - knotA[c]));
+            }
+
+            p->Spike_Mask = 0u;
+            for(int c = 0; c < channels; c++)
+            {
+                const SensorFaultChannel_t *pC = &pS->Channel[c];
+                float v = p->Value[c] + (pC->Noise_Sigma * z[c]) + (pC->Bias_Sigma * bias[c]);
+                if(u32_to_unit(rs[c][i]) < pC->Spike_Prob)
+                {
+                    v += ((rs[3][i] >> c) & 1u) ? pC->Spike_Amplitude : -pC->Spike_Amplitude;
+                    p->Spike_Mask |= (uint8_t)(1u << c);
+                }
+                p->Value[c] = v;
+            }
+
+            float delay = pS->Latency_Ms + (pS->Jitter_Ms * ((2.0f * u32_to_unit(rt[1][i])) - 1.0f));
+            delay = (delay > 0.0f) ? delay : 0.0f;
+            p->Late = (uint8_t)(u32_to_unit(rt[2][i]) < pS->Late_Prob);
+            if(p->Late)
+                delay += pS->Late_Max_Ms * u32_to_unit(rt[3][i]);
+
+            p->Measure_Time = tMeas;
+            p->Arrival_Time = tMeas + (double)delay;
+            p->Dropped      = (uint8_t)(u32_to_unit(rt[0][i]) < pS->Dropout_Prob);
+        }
+    }
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * 도착 순 전달
+ * ---------------------------------------------------------------------------*/
+void SensorFault_SortByArrival(SensorSample_t *pSamples, int count)
+{
+    if(!pSamples)
+        return;
+
+    /* 삽입 정렬: 늦은 도착 샘플만 뒤로 이동 (지터 < 주기이면 이동 거의 없음) */
+    for(int i = 1; i < count; i++)
+    {
+        if(!(pSamples[i].Arrival_Time < pSamples[i - 1].Arrival_Time))
+            continue;
+
+        SensorSample_t s = pSamples[i];
+        int j = i - 1;
+        while((j >= 0) && (s.Arrival_Time < pSamples[j].Arrival_Time))
+        {
+            pSamples[j + 1] = pSamples[j];
+            j--;
+        }
+        pSamples[j + 1] = s;
+    }
+}
+
+const SensorSample_t *SensorFault_Latest(const SensorSample_t *pSorted, int count, int *pCursor,
+                                         double now, const SensorSample_t *pPrev)
+{
+    if(!pSorted || !pCursor)
+        return pPrev;
+
+    int i = *pCursor;
+    while((i < count) && (pSorted[i].Arrival_Time <= now))
+    {
+        if(!pSorted[i].Dropped)
+            pPrev = &pSorted[i];
+        i++;
+    }
+    *pCursor = i;
+    return pPrev;
+}
+
+void SensorFault_ToGps(const SensorSample_t *pSample, GPSData_t *pGps)
+{
+    if(!pSample || !pGps)
+        return;
+
+    pGps->GPS_Velocity_X = pSample->Value[0];
+    pGps->GPS_Velocity_Y = pSample->Value[1];
+    pGps->GPS_Timestamp  = (float)pSample->Measure_Time;
+}
+
+void SensorFault_ToImu(const SensorSample_t *pSample, IMUData_t *pImu)
+{
+    if(!pSample || !pImu)
+        return;
+
+    pImu->Linear_Acceleration_X = pSample->Value[0];
+    pImu->Linear_Acceleration_Y = pSample->Value[1];
+    pImu->Yaw_Rate              = pSample->Value[2];
+}
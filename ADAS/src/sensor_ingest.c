@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <string.h>
+#include "sensor_ingest.h"
+#include "adas_time.h"
+
+/* 모든 샘플 구조체는 Stamp_Ns 가 첫 멤버 */
+typedef struct
+{
+    uint64_t Stamp_Ns;
+} SampleHead_t;
+
+static int channel_init(AdasIngestChannel_t *pCh, AdasIngestMode_e mode,
+                        void *pRing, uint32_t capacity, void *pSlots, uint32_t elemSize)
+{
+    memset(pCh, 0, sizeof(*pCh));
+    pCh->Mode = mode;
+    if(mode == ADAS_INGEST_MODE_QUEUE)
+        return SpscQueue_Init(&pCh->Queue, pRing, elemSize, capacity);
+    return TripleBuffer_Init(&pCh->Mailbox, pSlots, elemSize);
+}
+
+/* 생산자: 작성할 슬롯 (QUEUE: 링 슬롯, MAILBOX: 쓰기 슬롯) -> 직접 작성 후 channel_commit
+ * @return NULL : 큐 가득 참 */
+static void *channel_slot(AdasIngestChannel_t *pCh)
+{
+    if(pCh->Mode == ADAS_INGEST_MODE_QUEUE)
+        return SpscQueue_WriteSlot(&pCh->Queue);
+    return TripleBuffer_WriteSlot(&pCh->Mailbox);
+}
+
+/* 생산자: 게시 시각을 찍어 게시 */
+static void channel_commit(AdasIngestChannel_t *pCh, void *pSample)
+{
+    ((SampleHead_t *)pSample)->Stamp_Ns = AdasTime_NowNs();
+
+    if(pCh->Mode == ADAS_INGEST_MODE_QUEUE)
+        SpscQueue_Commit(&pCh->Queue);
+    else
+        TripleBuffer_Publish(&pCh->Mailbox);
+}
+
+/* 생산자: 게시 시도 횟수 (가득 차서 버린 샘플 포함) */
+static void channel_count(AdasIngestChannel_t *pCh)
+{
+    __atomic_store_n(&pCh->Published, pCh->Published + 1, __ATOMIC_RELAXED);
+}
+
+/* 소비자: 채널 비우기 -> pBatch 에 수신 샘플, 반환 = 개수 */
+static uint32_t channel_drain(AdasIngestChannel_t *pCh, void *pBatch, uint32_t capacity,
+                              uint32_t elemSize, uint64_t nowNs)
+{
+    uint32_t n = 0;
+
+    if(pCh->Mode == ADAS_INGEST_MODE_QUEUE)
+    {
+        n = SpscQueue_PopBatch(&pCh->Queue, pBatch, capacity);
+    }
+    else if(TripleBuffer_Acquire(&pCh->Mailbox))
+    {
+        memcpy(pBatch, TripleBuffer_ReadSlot(&pCh->Mailbox), elemSize);
+        n = 1;
+    }
+
+    AdasIngestStats_t *pSt = &pCh->Stats;
+    for(uint32_t i = 0; i < n; i++)
+    {
+        uint64_t stamp = ((const SampleHead_t *)((const unsigned char *)pBatch + (size_t)i * elemSize))->Stamp_Ns;
+        uint64_t age   = (nowNs > stamp) ? (nowNs - stamp) : 0;
+        pSt->Handoff_Total_Ns += age;
+        if(age > pSt->Handoff_Max_Ns) pSt->Handoff_Max_Ns = age;
+    }
+    pSt->Received += n;
+    if(n > pSt->Max_Batch) pSt->Max_Batch = n;
+
+    uint64_t published = __atomic_load_n(&pCh->Published, __ATOMIC_RELAXED);
+    pSt->Lost = (published > pSt->Received) ? (published - pSt->Received) : 0;
+    return n;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasIngest_Init
+ * ---------------------------------------------------------------------------*/
+int AdasIngest_Init(AdasSensorIngest_t *pIngest, const AdasIngestMode_e *pModes)
+{
+    static const AdasIngestMode_e s_defaultModes[ADAS_SENSOR_COUNT] = {
+        ADAS_INGEST_MODE_QUEUE, ADAS_INGEST_MODE_QUEUE, ADAS_INGEST_MODE_MAILBOX
+    };
+
+    if(!pIngest)
+        return -1;
+    if(!pModes)
+        pModes = s_defaultModes;
+
+    int rc = 0;
+    rc |= channel_init(&pIngest->Channel[ADAS_SENSOR_GPS], pModes[ADAS_SENSOR_GPS],
+                       pIngest->Gps_Ring, ADAS_INGEST_GPS_CAPACITY, pIngest->Gps_Slots, sizeof(AdasGpsSample_t));
+    rc |= channel_init(&pIngest->Channel[ADAS_SENSOR_IMU], pModes[ADAS_SENSOR_IMU],
+                       pIngest->Imu_Ring, ADAS_INGEST_IMU_CAPACITY, pIngest->Imu_Slots, sizeof(AdasImuSample_t));
+    rc |= channel_init(&pIngest->Channel[ADAS_SENSOR_OBJECTS], pModes[ADAS_SENSOR_OBJECTS],
+                       pIngest->Obj_Ring, ADAS_INGEST_OBJ_CAPACITY, pIngest->Obj_Slots, sizeof(AdasObjectList_t));
+    return (rc != 0) ? -1 : 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * 생산자 API : 슬롯에 직접 작성 (중간 복사 없음)
+ * ---------------------------------------------------------------------------*/
+int AdasIngest_PushGps(AdasSensorIngest_t *pIngest, const GPSData_t *pGps)
+{
+    if(!pIngest || !pGps)
+        return -1;
+
+    AdasIngestChannel_t *pCh = &pIngest->Channel[ADAS_SENSOR_GPS];
+    channel_count(pCh);
+    AdasGpsSample_t *pS = (AdasGpsSample_t *)channel_slot(pCh);
+    if(!pS)
+        return -1;
+
+    pS->Data = *pGps;
+    channel_commit(pCh, pS);
+    return 0;
+}
+
+int AdasIngest_PushImu(AdasSensorIngest_t *pIngest, const IMUData_t *pImu)
+{
+    if(!pIngest || !pImu)
+        return -1;
+
+    AdasIngestChannel_t *pCh = &pIngest->Channel[ADAS_SENSOR_IMU];
+    channel_count(pCh);
+    AdasImuSample_t *pS = (AdasImuSample_t *)channel_slot(pCh);
+    if(!pS)
+        return -1;
+
+    pS->Data = *pImu;
+    channel_commit(pCh, pS);
+    return 0;
+}
+
+int AdasIngest_PushObjects(AdasSensorIngest_t *pIngest, const ObjectData_t *pObjs, int objCount)
+{
+    if(!pIngest || (!pObjs && objCount > 0) || objCount < 0)
+        return -1;
+    if(objCount > ADAS_MAX_OBJECTS)
+        objCount = ADAS_MAX_OBJECTS;
+
+    AdasIngestChannel_t *pCh = &pIngest->Channel[ADAS_SENSOR_OBJECTS];
+    channel_count(pCh);
+    AdasObjectList_t *pS = (AdasObjectList_t *)channel_slot(pCh);
+    if(!pS)
+        return -1;
+
+    pS->Object_Count = objCount;
+    if(objCount > 0)
+        memcpy(pS->Objects, pObjs, sizeof(ObjectData_t) * (size_t)objCount);
+    channel_commit(pCh, pS);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasIngest_Drain
+ *  - 주기당 시각 1회 측정, 채널별 일괄 수신 후 마지막(최신) 샘플만 pIn 반영
+ * ---------------------------------------------------------------------------*/
+int AdasIngest_Drain(AdasSensorIngest_t *pIngest, AdasFrameInput_t *pIn)
+{
+    if(!pIngest || !pIn)
+        return -1;
+
+    uint64_t now     = AdasTime_NowNs();
+    int      updated = 0;
+    uint32_t n;
+
+    n = channel_drain(&pIngest->Channel[ADAS_SENSOR_GPS], pIngest->Gps_Batch,
+                      ADAS_INGEST_GPS_CAPACITY, sizeof(AdasGpsSample_t), now);
+    if(n > 0)
+    {
+        pIn->Gps = pIngest->Gps_Batch[n - 1].Data;
+        updated |= ADAS_INGEST_UPDATED(ADAS_SENSOR_GPS);
+    }
+
+    n = channel_drain(&pIngest->Channel[ADAS_SENSOR_IMU], pIngest->Imu_Batch,
+                      ADAS_INGEST_IMU_CAPACITY, sizeof(AdasImuSample_t), now);
+    if(n > 0)
+    {
+        pIn->Imu = pIngest->Imu_Batch[n - 1].Data;
+        updated |= ADAS_INGEST_UPDATED(ADAS_SENSOR_IMU);
+    }
+
+    n = channel_drain(&pIngest->Channel[ADAS_SENSOR_OBJECTS], pIngest->Obj_Batch,
+                      ADAS_INGEST_OBJ_CAPACITY, sizeof(AdasObjectList_t), now);
+    if(n > 0)
+    {
+        const AdasObjectList_t *pList = &pIngest->Obj_Batch[n - 1];
+        pIn->Object_Count = pList->Object_Count;
+        memcpy(pIn->Objects, pList->Objects, sizeof(ObjectData_t) * (size_t)pList->Object_Count);
+        updated |= ADAS_INGEST_UPDATED(ADAS_SENSOR_OBJECTS);
+    }
+
+    return updated;
+}
+
+int AdasIngest_InputFn(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    (void)cycle;
+    return (AdasIngest_Drain((AdasSensorIngest_t *)pUser, pIn) < 0) ? -1 : 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasIngest_PrintStats
+ * ---------------------------------------------------------------------------*/
+void AdasIngest_PrintStats(const AdasSensorIngest_t *pIngest)
+{
+    static const char *const s_names[ADAS_SENSOR_COUNT] = { "gps", "imu", "objects" };
+
+    if(!pIngest)
+        return;
+
+    printf("---- Sensor Ingest ----\n");
+    for(int c = 0; c < ADAS_SENSOR_COUNT; c++)
+    {
+        const AdasIngestChannel_t *pCh = &pIngest->Channel[c];
+        const AdasIngestStats_t   *pSt = &pCh->Stats;
+        uint64_t n = (pSt->Received > 0) ? pSt->Received : 1;
+
+        printf("  %-8s %-7s recv=%llu, lost=%llu, max_batch=%llu, handoff avg=%.2f us, max=%.2f us\n",
+               s_names[c], (pCh->Mode == ADAS_INGEST_MODE_QUEUE) ? "queue" : "mailbox",
+               (unsigned long long)pSt->Received,
+               (unsigned long long)pSt->Lost,
+               (unsigned long long)pSt->Max_Batch,
+               (double)pSt->Handoff_Total_Ns / (double)n / 1000.0,
+               (double)pSt->Handoff_Max_Ns / 1000.0);
+    }
+}
@@ -0,0 +1,277 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* shm_open, ftruncate */
+#endif
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "shm_transport.h"
+#include "adas_time.h"
+
+#define SHM_SLOT_MASK      (ADAS_SHM_RING_SLOTS - 1u)
+
+/* 최신 프레임이 작성 중/교체 중일 때 다시 읽는 횟수 상한 (생산자가 링을 계속 도는 경우 대비) */
+#define SHM_ACQUIRE_TRIES  4
+
+static void set_name(AdasShmTransport_t *pT, const char *name)
+{
+    strncpy(pT->Name, name ? name : ADAS_SHM_DEFAULT_NAME, ADAS_SHM_NAME_MAX - 1);
+    pT->Name[ADAS_SHM_NAME_MAX - 1] = '\0';
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_Create
+ *  - 헤더/슬롯 초기화 후 Magic 을 release 로 마지막에 기록
+ * ---------------------------------------------------------------------------*/
+int AdasShm_Create(AdasShmTransport_t *pT, const char *name)
+{
+    if(!pT)
+        return ADAS_SHM_ERR_ARG;
+
+    memset(pT, 0, sizeof(*pT));
+    pT->Fd = -1;
+    set_name(pT, name);
+
+    int fd = shm_open(pT->Name, O_CREAT | O_RDWR, 0600);
+    if(fd < 0)
+        return ADAS_SHM_ERR_ARG;
+
+    if(ftruncate(fd, (off_t)sizeof(AdasShmRegion_t)) != 0)
+    {
+        close(fd);
+        return ADAS_SHM_ERR_ARG;
+    }
+
+    void *pBase = mmap(NULL, sizeof(AdasShmRegion_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(pBase == MAP_FAILED)
+    {
+        close(fd);
+        return ADAS_SHM_ERR_ARG;
+    }
+
+    AdasShmRegion_t *pR = (AdasShmRegion_t *)pBase;
+    __atomic_store_n(&pR->Header.Magic, 0u, __ATOMIC_RELEASE);
+    memset(pR, 0, sizeof(*pR));
+    pR->Header.Version     = ADAS_SHM_VERSION;
+    pR->Header.Header_Size = (uint32_t)sizeof(AdasShmHeader_t);
+    pR->Header.Frame_Size  = (uint32_t)sizeof(AdasShmFrame_t);
+    pR->Header.Input_Size  = (uint32_t)sizeof(AdasFrameInput_t);
+    pR->Header.Slot_Count  = ADAS_SHM_RING_SLOTS;
+    pR->Header.Max_Objects = ADAS_MAX_OBJECTS;
+    __atomic_store_n(&pR->Header.Magic, ADAS_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    pT->Fd          = fd;
+    pT->pRegion     = pR;
+    pT->Is_Producer = 1;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_Open
+ * ---------------------------------------------------------------------------*/
+int AdasShm_Open(AdasShmTransport_t *pT, const char *name)
+{
+    if(!pT)
+        return ADAS_SHM_ERR_ARG;
+
+    memset(pT, 0, sizeof(*pT));
+    pT->Fd = -1;
+    set_name(pT, name);
+
+    int fd = shm_open(pT->Name, O_RDONLY, 0);
+    if(fd < 0)
+        return ADAS_SHM_ERR_ARG;
+
+    struct stat st;
+    if((fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(AdasShmRegion_t)))
+    {
+        close(fd);
+        return ADAS_SHM_ERR_LAYOUT;
+    }
+
+    void *pBase = mmap(NULL, sizeof(AdasShmRegion_t), PROT_READ, MAP_SHARED, fd, 0);
+    if(pBase == MAP_FAILED)
+    {
+        close(fd);
+        return ADAS_SHM_ERR_ARG;
+    }
+
+    const AdasShmHeader_t *pH = &((const AdasShmRegion_t *)pBase)->Header;
+    if((__atomic_load_n(&pH->Magic, __ATOMIC_ACQUIRE) != ADAS_SHM_MAGIC) ||
+       (pH->Version     != ADAS_SHM_VERSION) ||
+       (pH->Header_Size != sizeof(AdasShmHeader_t)) ||
+       (pH->Frame_Size  != sizeof(AdasShmFrame_t)) ||
+       (pH->Input_Size  != sizeof(AdasFrameInput_t)) ||
+       (pH->Slot_Count  != ADAS_SHM_RING_SLOTS) ||
+       (pH->Max_Objects != ADAS_MAX_OBJECTS))
+    {
+        munmap(pBase, sizeof(AdasShmRegion_t));
+        close(fd);
+        return ADAS_SHM_ERR_LAYOUT;
+    }
+
+    pT->Fd      = fd;
+    pT->pRegion = (AdasShmRegion_t *)pBase;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_Close
+ * ---------------------------------------------------------------------------*/
+void AdasShm_Close(AdasShmTransport_t *pT, int unlink)
+{
+    if(!pT)
+        return;
+
+    if(pT->pRegion)
+        munmap(pT->pRegion, sizeof(AdasShmRegion_t));
+    if(pT->Fd >= 0)
+        close(pT->Fd);
+    if(pT->Is_Producer && unlink)
+        shm_unlink(pT->Name);
+
+    pT->pRegion  = NULL;
+    pT->Fd       = -1;
+    pT->pWriting = NULL;
+    pT->pHeld    = NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_BeginWrite
+ *  - Seq 홀수 기록 후 release 펜스: 이후 데이터 쓰기가 홀수 Seq 보다 먼저 보이지 않음
+ * ---------------------------------------------------------------------------*/
+AdasShmFrame_t *AdasShm_BeginWrite(AdasShmTransport_t *pT)
+{
+    if(!pT || !pT->pRegion || !pT->Is_Producer)
+        return NULL;
+
+    uint64_t next = pT->pRegion->Header.Write_Index + 1;
+    AdasShmFrame_t *pF = &pT->pRegion->Frames[(next - 1) & SHM_SLOT_MASK];
+
+    __atomic_store_n(&pF->Seq, pF->Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&pF->Frame_Id, next, __ATOMIC_RELAXED);
+
+    pT->pWriting = pF;
+    return pF;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_EndWrite
+ *  - Seq 짝수(release) -> Write_Index(release) 순서로 게시
+ * ---------------------------------------------------------------------------*/
+uint64_t AdasShm_EndWrite(AdasShmTransport_t *pT)
+{
+    if(!pT || !pT->pWriting)
+        return 0;
+
+    AdasShmFrame_t *pF = pT->pWriting;
+    uint64_t id = pF->Frame_Id;
+    pF->Publish_Ns = AdasTime_NowNs();
+
+    __atomic_store_n(&pF->Seq, pF->Seq + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&pT->pRegion->Header.Write_Index, id, __ATOMIC_RELEASE);
+
+    pT->pWriting = NULL;
+    return id;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_AcquireLatest
+ *  - 최신 슬롯의 Seq 가 짝수이고 Frame_Id 가 일치하면 그 슬롯을 그대로 반환
+ *  - 작성 중(홀수)/이미 다음 바퀴(Frame_Id 불일치)면 Write_Index 다시 읽고 재시도
+ * ---------------------------------------------------------------------------*/
+int AdasShm_AcquireLatest(AdasShmTransport_t *pT, const AdasShmFrame_t **ppFrame, uint32_t *pSeq)
+{
+    if(!pT || !pT->pRegion || !ppFrame || !pSeq)
+        return ADAS_SHM_ERR_ARG;
+
+    const AdasShmRegion_t *pR = pT->pRegion;
+
+    for(int tries = 0; tries < SHM_ACQUIRE_TRIES; tries++)
+    {
+        uint64_t latest = __atomic_load_n(&pR->Header.Write_Index, __ATOMIC_ACQUIRE);
+        if(latest == 0 || latest == pT->Last_Frame_Id)
+            return 0;
+
+        const AdasShmFrame_t *pF = &pR->Frames[(latest - 1) & SHM_SLOT_MASK];
+        uint32_t seq = __atomic_load_n(&pF->Seq, __ATOMIC_ACQUIRE);
+        uint64_t id  = __atomic_load_n(&pF->Frame_Id, __ATOMIC_RELAXED);
+        if(((seq & 1u) != 0) || (id != latest))
+        {
+            pT->Stats.Retries++;
+            continue;
+        }
+
+        if(pT->Last_Frame_Id != 0)
+            pT->Stats.Frames_Skipped += latest - pT->Last_Frame_Id - 1;
+        pT->Last_Frame_Id = latest;
+        pT->Stats.Frames_Read++;
+
+        *ppFrame = pF;
+        *pSeq    = seq;
+        return 1;
+    }
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_Validate
+ *  - acquire 펜스: 앞선 프레임 데이터 읽기가 Seq 재확인 뒤로 밀리지 않음
+ * ---------------------------------------------------------------------------*/
+int AdasShm_Validate(AdasShmTransport_t *pT, const AdasShmFrame_t *pFrame, uint32_t seq)
+{
+    if(!pT || !pFrame)
+        return 0;
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if(__atomic_load_n(&pFrame->Seq, __ATOMIC_RELAXED) == seq)
+        return 1;
+
+    pT->Stats.Torn_Reads++;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_InputRefFn
+ *  - 새 프레임만 전달, 없으면 NULL (같은 프레임을 다시 주면 추정기가 같은 측정을 두 번 적분)
+ * ---------------------------------------------------------------------------*/
+int AdasShm_InputRefFn(void *pUser, uint64_t cycle, const AdasFrameInput_t **ppIn)
+{
+    AdasShmTransport_t *pT = (AdasShmTransport_t *)pUser;
+    (void)cycle;
+
+    if(!pT || !ppIn)
+        return -1;
+
+    const AdasShmFrame_t *pF;
+    uint32_t seq;
+    if(AdasShm_AcquireLatest(pT, &pF, &seq) == 1)
+    {
+        pT->pHeld    = pF;
+        pT->Held_Seq = seq;
+    }
+    else
+    {
+        pT->pHeld = NULL;
+    }
+
+    *ppIn = pT->pHeld ? &pT->pHeld->Input : NULL;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * AdasShm_InputCheckFn
+ *  - 이번 주기에 전달한 프레임을 처리 후 재확인 (덮어쓰였으면 런타임이 출력 폐기)
+ * ---------------------------------------------------------------------------*/
+int AdasShm_InputCheckFn(void *pUser, uint64_t cycle, const AdasFrameInput_t *pIn)
+{
+    AdasShmTransport_t *pT = (AdasShmTransport_t *)pUser;
+    (void)cycle;
+
+    if(!pT || !pT->pHeld || (pIn != &pT->pHeld->Input))
+        return 0;
+
+    return AdasShm_Validate(pT, pT->pHeld, pT->Held_Seq);
+}
@@ -0,0 +1,298 @@
+#include <stddef.h>
+#include "sim_clock.h"
+
+#define SIM_SLOT_MASK  ((uint64_t)(SIM_CLOCK_SLOTS - 1))
+
+/* ----------------------------------------------------------------------------
+ * 리스트
+ * ---------------------------------------------------------------------------*/
+static inline void list_init(SimLink_t *pHead)
+{
+    pHead->pNext = pHead;
+    pHead->pPrev = pHead;
+}
+
+static inline int list_empty(const SimLink_t *pHead)
+{
+    return pHead->pNext == pHead;
+}
+
+static inline void list_insert_after(SimLink_t *pPos, SimLink_t *pNode)
+{
+    pNode->pPrev        = pPos;
+    pNode->pNext        = pPos->pNext;
+    pPos->pNext->pPrev  = pNode;
+    pPos->pNext         = pNode;
+}
+
+static inline void list_unlink(SimLink_t *pNode)
+{
+    pNode->pPrev->pNext = pNode->pNext;
+    pNode->pNext->pPrev = pNode->pPrev;
+    pNode->pNext = pNode;
+    pNode->pPrev = pNode;
+}
+
+/* pSrc 전체를 pDst(빈 리스트) 로 이동 */
+static inline void list_move_all(SimLink_t *pSrc, SimLink_t *pDst)
+{
+    if(list_empty(pSrc))
+    {
+        list_init(pDst);
+        return;
+    }
+    pDst->pNext        = pSrc->pNext;
+    pDst->pPrev        = pSrc->pPrev;
+    pDst->pNext->pPrev = pDst;
+    pDst->pPrev->pNext = pDst;
+    list_init(pSrc);
+}
+
+static inline SimTimer_t *link_to_timer(SimLink_t *pLink)
+{
+    return (SimTimer_t *)(void *)pLink;    /* Link = 첫 멤버 */
+}
+
+/* 동시각 정렬 키 비교: a 가 b 보다 늦게 실행되어야 하면 1 */
+static inline int fires_after(const SimTimer_t *pA, const SimTimer_t *pB)
+{
+    return (pA->Priority > pB->Priority) || ((pA->Priority == pB->Priority) && (pA->Seq > pB->Seq));
+}
+
+/* ----------------------------------------------------------------------------
+ * 휠 배치
+ * ---------------------------------------------------------------------------*/
+static inline int digit(SimTime_t t, int level)
+{
+    return (int)((t >> (level * SIM_CLOCK_SLOT_BITS)) & SIM_SLOT_MASK);
+}
+
+static void wheel_insert(SimClock_t *pClock, SimTimer_t *pTimer)
+{
+    uint64_t diff  = pTimer->Expires ^ pClock->Now;
+    int      level = diff ? ((63 - __builtin_clzll(diff)) / SIM_CLOCK_SLOT_BITS) : 0;
+    int      slot  = digit(pTimer->Expires, level);
+    SimLink_t *pHead = &pClock->Wheel[level][slot];
+
+    if(level == 0)
+    {
+        /* 1 단 슬롯 = 같은 시각: (Priority, Seq) 순 정렬 삽입 (보통 뒤에서 바로 멈춤) */
+        SimLink_t *pPos = pHead->pPrev;
+        while((pPos != pHead) && fires_after(link_to_timer(pPos), pTimer))
+            pPos = pPos->pPrev;
+        list_insert_after(pPos, &pTimer->Link);
+    }
+    else
+    {
+        list_insert_after(pHead->pPrev, &pTimer->Link);
+    }
+    pTimer->Bucket = (uint16_t)((level * SIM_CLOCK_SLOTS) + slot);
+    pClock->Pending[level] |= (1ull << slot);
+}
+
+static void wheel_remove(SimClock_t *pClock, SimTimer_t *pTimer)
+{
+    list_unlink(&pTimer->Link);
+    if(pTimer->Bucket != SIM_CLOCK_BUCKET_FIRING)
+    {
+        int level = pTimer->Bucket / SIM_CLOCK_SLOTS;
+        int slot  = pTimer->Bucket % SIM_CLOCK_SLOTS;
+        if(list_empty(&pClock->Wheel[level][slot]))
+            pClock->Pending[level] &= ~(1ull << slot);
+    }
+}
+
+/* 시계가 상위 단 슬롯 경계에 도달: 그 슬롯 타이머를 현재 시각 기준으로 다시 배치 (높은 단부터) */
+static void cascade(SimClock_t *pClock)
+{
+    for(int level = SIM_CLOCK_LEVELS - 1; level > 0; level--)
+    {
+        int slot = digit(pClock->Now, level);
+        if(!(pClock->Pending[level] & (1ull << slot)))
+            continue;
+
+        SimLink_t list;
+        list_move_all(&pClock->Wheel[level][slot], &list);
+        pClock->Pending[level] &= ~(1ull << slot);
+        while(!list_empty(&list))
+        {
+            SimTimer_t *pTimer = link_to_timer(list.pNext);
+            list_unlink(&pTimer->Link);
+            wheel_insert(pClock, pTimer);
+            pClock->Cascaded++;
+        }
+    }
+}
+
+/* 현재 시각 1 단 슬롯을 묶음 단위로 실행 (콜백이 현재 시각에 새로 예약하면 다음 묶음) */
+static uint64_t fire_now(SimClock_t *pClock)
+{
+    const int slot = digit(pClock->Now, 0);
+    SimLink_t *pHead = &pClock->Wheel[0][slot];
+    uint64_t fired = 0;
+
+    while(!list_empty(pHead) && !pClock->Stop)
+    {
+        list_move_all(pHead, &pClock->Firing);
+        pClock->Pending[0] &= ~(1ull << slot);
+        for(SimLink_t *p = pClock->Firing.pNext; p != &pClock->Firing; p = p->pNext)
+            link_to_timer(p)->Bucket = SIM_CLOCK_BUCKET_FIRING;
+
+        while(!list_empty(&pClock->Firing))
+        {
+            SimTimer_t *pTimer = link_to_timer(pClock->Firing.pNext);
+            list_unlink(&pTimer->Link);
+            pTimer->Armed = 0u;
+            pClock->Armed--;
+
+            /* 주기 타이머는 콜백 전에 재예약 (콜백에서 취소 / 변경 가능) */
+            if((pTimer->Period > 0u) && (pTimer->Expires <= (UINT64_MAX - pTimer->Period)))
+                (void)SimClock_ScheduleAt(pClock, pTimer, pTimer->Expires + pTimer->Period, pTimer->Period);
+
+            fired++;
+            pClock->Fired++;
+            if(pTimer->Fn)
+                pTimer->Fn(pClock, pTimer, pTimer->pUser);
+        }
+    }
+    return fired;
+}
+
+/* ----------------------------------------------------------------------------
+ * API
+ * ---------------------------------------------------------------------------*/
+void SimClock_Init(SimClock_t *pClock, SimTime_t start)
+{
+    if(!pClock)
+        return;
+
+    pClock->Now  = start;
+    pClock->Seq  = 0u;
+    pClock->Stop = 0;
+    for(int level = 0; level < SIM_CLOCK_LEVELS; level++)
+    {
+        pClock->Pending[level] = 0u;
+        for(int slot = 0; slot < SIM_CLOCK_SLOTS; slot++)
+            list_init(&pClock->Wheel[level][slot]);
+    }
+    list_init(&pClock->Firing);
+    pClock->Fired    = 0u;
+    pClock->Cascaded = 0u;
+    pClock->Armed    = 0u;
+}
+
+void SimTimer_Init(SimTimer_t *pTimer, SimEventFn_t fn, void *pUser, int32_t priority)
+{
+    if(!pTimer)
+        return;
+
+    list_init(&pTimer->Link);
+    pTimer->Expires  = 0u;
+    pTimer->Period   = 0u;
+    pTimer->Seq      = 0u;
+    pTimer->Priority = priority;
+    pTimer->Bucket   = 0u;
+    pTimer->Armed    = 0u;
+    pTimer->Fn       = fn;
+    pTimer->pUser    = pUser;
+}
+
+int SimClock_ScheduleAt(SimClock_t *pClock, SimTimer_t *pTimer, SimTime_t when, SimTime_t period)
+{
+    if(!pClock || !pTimer || (when < pClock->Now))
+        return -1;
+
+    if(pTimer->Armed)
+        SimClock_Cancel(pClock, pTimer);
+
+    pTimer->Expires = when;
+    pTimer->Period  = period;
+    pTimer->Seq     = pClock->Seq++;
+    pTimer->Armed   = 1u;
+    pClock->Armed++;
+    wheel_insert(pClock, pTimer);
+    return 0;
+}
+
+int SimClock_ScheduleIn(SimClock_t *pClock, SimTimer_t *pTimer, SimTime_t delay, SimTime_t period)
+{
+    if(!pClock || (delay > (UINT64_MAX - pClock->Now)))
+        return -1;
+
+    return SimClock_ScheduleAt(pClock, pTimer, pClock->Now + delay, period);
+}
+
+void SimClock_Cancel(SimClock_t *pClock, SimTimer_t *pTimer)
+{
+    if(!pClock || !pTimer || !pTimer->Armed)
+        return;
+
+    wheel_remove(pClock, pTimer);
+    pTimer->Armed = 0u;
+    pClock->Armed--;
+}
+
+int SimClock_NextWake(const SimClock_t *pClock, SimTime_t *pWhen)
+{
+    if(!pClock || !pWhen)
+        return -1;
+
+    /* 하위 단 후보 시각 < 상위 단 후보 시각 -> 처음 찾은 단이 최소 */
+    for(int level = 0; level < SIM_CLOCK_LEVELS; level++)
+    {
+        const int shift = level * SIM_CLOCK_SLOT_BITS;
+        const int cur   = digit(pClock->Now, level);
+        uint64_t  mask;
+
+        if(level == 0)
+            mask = pClock->Pending[0] & (~0ull << cur);
+        else
+            mask = (cur == (SIM_CLOCK_SLOTS - 1)) ? 0u : (pClock->Pending[level] & (~0ull << (cur + 1)));
+        if(!mask)
+            continue;
+
+        const int      slot  = __builtin_ctzll(mask);
+        const int      upper = shift + SIM_CLOCK_SLOT_BITS;
+        const SimTime_t base = (upper >= 64) ? 0u : ((pClock->Now >> upper) << upper);
+        *pWhen = base | ((SimTime_t)slot << shift);
+        return 0;
+    }
+    return -1;
+}
+
+/* end 까지 실행, oneBatch 이면 이벤트를 실행한 첫 시각에서 멈춤 */
+static uint64_t run(SimClock_t *pClock, SimTime_t end, int oneBatch)
+{
+    uint64_t fired = 0;
+    SimTime_t when;
+
+    pClock->Stop = 0;
+    while(!pClock->Stop && (SimClock_NextWake(pClock, &when) == 0) && (when <= end))
+    {
+        pClock->Now = when;
+        cascade(pClock);
+        uint64_t n = fire_now(pClock);
+        fired += n;
+        if(oneBatch && (n > 0u))
+            break;
+    }
+    if(!pClock->Stop && !oneBatch && (pClock->Now < end))
+        pClock->Now = end;
+    return fired;
+}
+
+uint64_t SimClock_RunUntil(SimClock_t *pClock, SimTime_t end)
+{
+    if(!pClock)
+        return 0u;
+
+    return run(pClock, end, 0);
+}
+
+uint64_t SimClock_Step(SimClock_t *pClock)
+{
+    if(!pClock)
+        return 0u;
+
+    return run(pClock, UINT64_MAX, 1);
+}
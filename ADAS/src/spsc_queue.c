@@ -0,0 +1,109 @@
+#include <string.h>
+#include "spsc_queue.h"
+
+/* ----------------------------------------------------------------------------
+ * SpscQueue_Init
+ * ---------------------------------------------------------------------------*/
+int SpscQueue_Init(SpscQueue_t *pQ, void *pStorage, uint32_t elemSize, uint32_t capacity)
+{
+    if(!pQ || !pStorage || elemSize == 0 || capacity < 2 || (capacity & (capacity - 1)) != 0)
+        return -1;
+
+    memset(pQ, 0, sizeof(*pQ));
+    pQ->pBuf      = (unsigned char *)pStorage;
+    pQ->Elem_Size = elemSize;
+    pQ->Mask      = capacity - 1;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * SpscQueue_WriteSlot
+ *  - 캐시된 Tail 로 가득 참 판단 -> 가득 차 보일 때만 실제 Tail 다시 읽음
+ * ---------------------------------------------------------------------------*/
+void *SpscQueue_WriteSlot(SpscQueue_t *pQ)
+{
+    if(!pQ)
+        return NULL;
+
+    uint32_t head = pQ->Head;
+    if((head - pQ->Tail_Cache) > pQ->Mask)
+    {
+        pQ->Tail_Cache = __atomic_load_n(&pQ->Tail, __ATOMIC_ACQUIRE);
+        if((head - pQ->Tail_Cache) > pQ->Mask)
+        {
+            pQ->Dropped++;
+            return NULL;
+        }
+    }
+    return pQ->pBuf + ((size_t)(head & pQ->Mask) * pQ->Elem_Size);
+}
+
+/* release: 슬롯 작성이 Head 갱신보다 먼저 보이도록 */
+void SpscQueue_Commit(SpscQueue_t *pQ)
+{
+    if(pQ)
+        __atomic_store_n(&pQ->Head, pQ->Head + 1, __ATOMIC_RELEASE);
+}
+
+int SpscQueue_Push(SpscQueue_t *pQ, const void *pElem)
+{
+    if(!pElem)
+        return -1;
+
+    void *pSlot = SpscQueue_WriteSlot(pQ);
+    if(!pSlot)
+        return -1;
+
+    memcpy(pSlot, pElem, pQ->Elem_Size);
+    SpscQueue_Commit(pQ);
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * SpscQueue_PopBatch
+ *  - 캐시된 Head 로 부족하면 실제 Head 다시 읽음
+ *  - 링 끝에서 나뉘면 memcpy 2회, Tail 은 마지막에 한 번만 갱신
+ * ---------------------------------------------------------------------------*/
+uint32_t SpscQueue_PopBatch(SpscQueue_t *pQ, void *pOut, uint32_t maxCount)
+{
+    if(!pQ || !pOut || maxCount == 0)
+        return 0;
+
+    uint32_t tail  = pQ->Tail;
+    uint32_t avail = pQ->Head_Cache - tail;
+    if(avail < maxCount)
+    {
+        pQ->Head_Cache = __atomic_load_n(&pQ->Head, __ATOMIC_ACQUIRE);
+        avail = pQ->Head_Cache - tail;
+    }
+    if(avail == 0)
+        return 0;
+
+    uint32_t n     = (avail < maxCount) ? avail : maxCount;
+    uint32_t start = tail & pQ->Mask;
+    uint32_t first = (pQ->Mask + 1) - start;
+    if(first > n) first = n;
+
+    memcpy(pOut, pQ->pBuf + ((size_t)start * pQ->Elem_Size), (size_t)first * pQ->Elem_Size);
+    if(n > first)
+        memcpy((unsigned char *)pOut + ((size_t)first * pQ->Elem_Size), pQ->pBuf,
+               (size_t)(n - first) * pQ->Elem_Size);
+
+    __atomic_store_n(&pQ->Tail, tail + n, __ATOMIC_RELEASE);
+    return n;
+}
+
+uint32_t SpscQueue_Count(const SpscQueue_t *pQ)
+{
+    if(!pQ)
+        return 0;
+    uint32_t head = __atomic_load_n(&pQ->Head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&pQ->Tail, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+uint32_t SpscQueue_Capacity(const SpscQueue_t *pQ)
+{
+    return pQ ? (pQ->Mask + 1) : 0;
+}
@@ -0,0 +1,224 @@
+#include <math.h>
+#include <pthread.h>
+#include "stanley_lut.h"
+#include "interp_table.h"
+#include "adas_math.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define STANLEY_LUT_USE_SSE2 1
+#else
+#define STANLEY_LUT_USE_SSE2 0
+#endif
+
+/*─────────────────────────────
+  테이블: X = cte [m], Y = 1/vx [s/m], 값 = 보정각 [°]
+  - 배치: s_lutData[y][x] (interp_table.h 규칙)
+─────────────────────────────*/
+#define LUT_INV_VX_MIN  (1.0f / STANLEY_LUT_VX_MAX)
+#define LUT_INV_VX_MAX  (1.0f / STANLEY_LUT_VX_MIN)
+
+static float           s_lutData[STANLEY_LUT_VX_COUNT * STANLEY_LUT_CTE_COUNT];
+static InterpTable2D_t s_lutTable;
+static pthread_once_t  s_lutOnce      = PTHREAD_ONCE_INIT;
+static int             s_lutActive    = 0;       /* __atomic: 테이블 작성 후 release 로 게시 */
+static float           s_lutMaxErrDeg = -1.0f;   /* __atomic */
+
+/* 테이블 사용 여부 (acquire: 1 이면 s_lutData / s_lutTable 작성 완료가 보임) */
+static inline int lut_active(void)
+{
+    return __atomic_load_n(&s_lutActive, __ATOMIC_ACQUIRE);
+}
+
+/* 정확한 제어 법칙 (테이블 밖 / 비활성 시) */
+static float exact_offset_deg(float cte, float vx)
+{
+    return AdasMath_AtanF((LFA_STANLEY_GAIN * cte) / vx) * ADAS_MATH_RAD2DEG;
+}
+
+/* 테이블 생성 기준값 (double libm) */
+static float reference_offset_deg(double cte, double invVx)
+{
+    return (float)(atan((double)LFA_STANLEY_GAIN * cte * invVx) * (180.0 / M_PI));
+}
+
+static inline int in_table_range(float cte, float vx)
+{
+    return (cte >= STANLEY_LUT_CTE_MIN) & (cte <= STANLEY_LUT_CTE_MAX) &
+           (vx  >= STANLEY_LUT_VX_MIN)  & (vx  <= STANLEY_LUT_VX_MAX);
+}
+
+static inline float clamp_steer(float steer)
+{
+    return fminf(fmaxf(steer, -LFA_MAX_STEERING_ANGLE), LFA_MAX_STEERING_ANGLE);
+}
+
+/* ----------------------------------------------------------------------------
+ * build_lut
+ *  - 격자점 값 생성 후, 셀 중간점(가로/세로/대각)에서 보간 오차 실측
+ *  - pthread_once 로 1회만 실행 (병렬 재생 / 배치 워커의 동시 lfa_init_state 안전)
+ * ---------------------------------------------------------------------------*/
+static void build_lut(void)
+{
+    const double cteStep = (double)(STANLEY_LUT_CTE_MAX - STANLEY_LUT_CTE_MIN) / (STANLEY_LUT_CTE_COUNT - 1);
+    const double invStep = (double)(LUT_INV_VX_MAX - LUT_INV_VX_MIN) / (STANLEY_LUT_VX_COUNT - 1);
+
+    for(int iy = 0; iy < STANLEY_LUT_VX_COUNT; iy++)
+    {
+        for(int ix = 0; ix < STANLEY_LUT_CTE_COUNT; ix++)
+        {
+            s_lutData[iy * STANLEY_LUT_CTE_COUNT + ix] =
+                reference_offset_deg(STANLEY_LUT_CTE_MIN + ix * cteStep, LUT_INV_VX_MIN + iy * invStep);
+        }
+    }
+
+    s_lutTable.X_Min      = STANLEY_LUT_CTE_MIN;
+    s_lutTable.X_Inv_Step = (float)(1.0 / cteStep);
+    s_lutTable.X_Count    = STANLEY_LUT_CTE_COUNT;
+    s_lutTable.Y_Min      = LUT_INV_VX_MIN;
+    s_lutTable.Y_Inv_Step = (float)(1.0 / invStep);
+    s_lutTable.Y_Count    = STANLEY_LUT_VX_COUNT;
+    s_lutTable.Channels   = 1;
+    s_lutTable.pData      = s_lutData;
+
+    float maxErr = 0.0f;
+    for(int iy = 0; iy < (2 * STANLEY_LUT_VX_COUNT) - 1; iy++)
+    {
+        for(int ix = 0; ix < (2 * STANLEY_LUT_CTE_COUNT) - 1; ix++)
+        {
+            double cte   = STANLEY_LUT_CTE_MIN + (ix * 0.5) * cteStep;
+            double invVx = LUT_INV_VX_MIN + (iy * 0.5) * invStep;
+            float  lut   = InterpTable2D_Eval(&s_lutTable, (float)cte, (float)invVx);
+            float  err   = fabsf(lut - reference_offset_deg(cte, invVx));
+            if(err > maxErr) maxErr = err;
+        }
+    }
+
+    __atomic_store(&s_lutMaxErrDeg, &maxErr, __ATOMIC_RELEASE);
+    __atomic_store_n(&s_lutActive, (maxErr <= STANLEY_LUT_MAX_ERR_DEG), __ATOMIC_RELEASE);
+}
+
+int StanleyLut_Init(void)
+{
+    (void)pthread_once(&s_lutOnce, build_lut);
+    return lut_active() ? 0 : -1;
+}
+
+int StanleyLut_IsActive(void)
+{
+    return lut_active();
+}
+
+float StanleyLut_MeasuredMaxErrDeg(void)
+{
+    float maxErr;
+    __atomic_load(&s_lutMaxErrDeg, &maxErr, __ATOMIC_ACQUIRE);
+    return maxErr;
+}
+
+/* ----------------------------------------------------------------------------
+ * StanleyLut_OffsetDeg
+ * ---------------------------------------------------------------------------*/
+float StanleyLut_OffsetDeg(float cte, float vx)
+{
+    if(vx < 0.1f) vx = 0.1f; // 분모 보호
+
+    if(lut_active() && in_table_range(cte, vx))
+    {
+        return InterpTable2D_Eval(&s_lutTable, cte, 1.0f / vx);
+    }
+
+    return exact_offset_deg(cte, vx);
+}
+
+/*─────────────────────────────
+  SSE2 4-lane: 인덱스/가중치/보간은 벡터, 격자점 4개 로드만 스칼라 (SSE2에 gather 없음)
+─────────────────────────────*/
+#if STANLEY_LUT_USE_SSE2
+static inline __m128 sse_lut_offset(__m128 cte, __m128 invVx)
+{
+    const __m128 zero = _mm_setzero_ps();
+
+    __m128 fx = _mm_mul_ps(_mm_sub_ps(cte, _mm_set1_ps(s_lutTable.X_Min)), _mm_set1_ps(s_lutTable.X_Inv_Step));
+    __m128 fy = _mm_mul_ps(_mm_sub_ps(invVx, _mm_set1_ps(s_lutTable.Y_Min)), _mm_set1_ps(s_lutTable.Y_Inv_Step));
+    fx = _mm_min_ps(_mm_max_ps(fx, zero), _mm_set1_ps((float)(STANLEY_LUT_CTE_COUNT - 1)));
+    fy = _mm_min_ps(_mm_max_ps(fy, zero), _mm_set1_ps((float)(STANLEY_LUT_VX_COUNT - 1)));
+
+    /* 하위 격자 인덱스 (마지막 셀은 t = 1 로 처리) */
+    __m128 ix = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fx)), _mm_set1_ps((float)(STANLEY_LUT_CTE_COUNT - 2)));
+    __m128 iy = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fy)), _mm_set1_ps((float)(STANLEY_LUT_VX_COUNT - 2)));
+    __m128 tx = _mm_sub_ps(fx, ix);
+    __m128 ty = _mm_sub_ps(fy, iy);
+
+    int idx[4];
+    _mm_storeu_si128((__m128i *)idx,
+                     _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(iy, _mm_set1_ps((float)STANLEY_LUT_CTE_COUNT)), ix)));
+
+    const float *d = s_lutData;
+    const int    w = STANLEY_LUT_CTE_COUNT;
+    __m128 v00 = _mm_setr_ps(d[idx[0]],         d[idx[1]],         d[idx[2]],         d[idx[3]]);
+    __m128 v01 = _mm_setr_ps(d[idx[0] + 1],     d[idx[1] + 1],     d[idx[2] + 1],     d[idx[3] + 1]);
+    __m128 v10 = _mm_setr_ps(d[idx[0] + w],     d[idx[1] + w],     d[idx[2] + w],     d[idx[3] + w]);
+    __m128 v11 = _mm_setr_ps(d[idx[0] + w + 1], d[idx[1] + w + 1], d[idx[2] + w + 1], d[idx[3] + w + 1]);
+
+    __m128 a = _mm_add_ps(v00, _mm_mul_ps(tx, _mm_sub_ps(v01, v00)));
+    __m128 b = _mm_add_ps(v10, _mm_mul_ps(tx, _mm_sub_ps(v11, v10)));
+    return _mm_add_ps(a, _mm_mul_ps(ty, _mm_sub_ps(b, a)));
+}
+#endif /* STANLEY_LUT_USE_SSE2 */
+
+/* ----------------------------------------------------------------------------
+ * StanleyLut_Steer_Batch
+ * ---------------------------------------------------------------------------*/
+void StanleyLut_Steer_Batch(const float *pHeadingErr,
+                            const float *pCte,
+                            const float *pVx,
+                            float       *pOutDeg,
+                            int          count)
+{
+    if(!pHeadingErr || !pCte || !pVx || !pOutDeg || count <= 0)
+        return;
+
+    int i = 0;
+#if STANLEY_LUT_USE_SSE2
+    if(lut_active())
+    {
+        const __m128 cteMin = _mm_set1_ps(STANLEY_LUT_CTE_MIN);
+        const __m128 cteMax = _mm_set1_ps(STANLEY_LUT_CTE_MAX);
+        const __m128 vxMin  = _mm_set1_ps(STANLEY_LUT_VX_MIN);
+        const __m128 vxMax  = _mm_set1_ps(STANLEY_LUT_VX_MAX);
+        const __m128 steerMax = _mm_set1_ps(LFA_MAX_STEERING_ANGLE);
+
+        for(; i + 4 <= count; i += 4)
+        {
+            __m128 cte = _mm_loadu_ps(&pCte[i]);
+            __m128 vx  = _mm_max_ps(_mm_loadu_ps(&pVx[i]), _mm_set1_ps(0.1f));
+
+            /* NaN 은 비교 결과 false -> 범위 밖 처리 */
+            __m128 inRange = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(cte, cteMin), _mm_cmple_ps(cte, cteMax)),
+                                        _mm_and_ps(_mm_cmpge_ps(vx, vxMin),   _mm_cmple_ps(vx, vxMax)));
+
+            __m128 offset = sse_lut_offset(cte, _mm_div_ps(_mm_set1_ps(1.0f), vx));
+            __m128 steer  = _mm_add_ps(_mm_loadu_ps(&pHeadingErr[i]), offset);
+            steer = _mm_min_ps(_mm_max_ps(steer, _mm_sub_ps(_mm_setzero_ps(), steerMax)), steerMax);
+            _mm_storeu_ps(&pOutDeg[i], steer);
+
+            int mask = _mm_movemask_ps(inRange);
+            if(mask != 0xF)
+            {
+                for(int k = 0; k < 4; k++)
+                {
+                    if(!(mask & (1 << k)))
+                    {
+                        pOutDeg[i + k] = clamp_steer(pHeadingErr[i + k] + StanleyLut_OffsetDeg(pCte[i + k], pVx[i + k]));
+                    }
+                }
+            }
+        }
+    }
+#endif
+    for(; i < count; i++)
+    {
+        pOutDeg[i] = clamp_steer(pHeadingErr[i] + StanleyLut_OffsetDeg(pCte[i], pVx[i]));
+    }
+}
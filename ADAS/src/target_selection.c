@@ -3,15 +3,14 @@
 #include <stdio.h>
 
 #include "target_selection.h"
+#include "adas_math.h"
 
 /* ----------------------------------------------------------------
- * 내부 유틸: heading 정규화 (±180°)
+ * 내부 유틸: heading 정규화 (±180°), 입력 크기와 무관하게 O(1)
  * ---------------------------------------------------------------*/
 static float normalize_heading(float hdg)
 {
-    while (hdg > 180.0f)   hdg -= 360.0f;
-    while (hdg < -180.0f)  hdg += 360.0f;
-    return hdg;
+    return AdasMath_WrapDeg180(hdg);
 }
 
 /*======================================================================
@@ -42,6 +41,15 @@ int select_target_from_object_list(const ObjectData_t *pObjList,
         Adjusted_Lateral_Threshold += fabsf(pLsData->LS_Heading_Error) * Heading_Error_Coeff;
     }
 
+    /* 곡선 차로 거리 보정 계수: Heading_Error는 객체와 무관 -> 루프 밖에서 1회 계산 */
+    float Curve_Distance_Scale = 1.0f;
+    if (pLsData->LS_Is_Curved_Lane) {
+        float c = AdasMath_CosF(pLsData->LS_Heading_Error * ADAS_MATH_DEG2RAD);
+        if (fabsf(c) > 1.0e-3f) {
+            Curve_Distance_Scale = 1.0f / c;
+        }
+    }
+
     for (int i = 0; i < objCount; i++)
     {
         if (filteredIndex >= maxFilteredCount) 
@@ -62,10 +70,7 @@ int select_target_from_object_list(const ObjectData_t *pObjList,
 
         /* 3) 상태 분류 */
         float Relative_Velocity = obj->Velocity_X - pEgoData->Ego_Velocity_X;
-        float Heading_Difference = fabsf(obj->Heading - pEgoData->Ego_Heading);
-        if (Heading_Difference > 180.0f) {
-            Heading_Difference = 360.0f - Heading_Difference;
-        }
+        float Heading_Difference = fabsf(normalize_heading(obj->Heading - pEgoData->Ego_Heading));
 
         ObjectStatus_e finalStatus = obj->Object_Status; /* 우선은 입력된 값으로 초기 */
 
@@ -86,14 +91,7 @@ int select_target_from_object_list(const ObjectData_t *pObjList,
         }
 
         /* 4) 곡선 차로 => 거리 보정 */
-        float Adjusted_Object_Distance = obj->Distance;
-        if (pLsData->LS_Is_Curved_Lane) {
-            float he_rad = pLsData->LS_Heading_Error * (float)M_PI / 180.0f;
-            float c = cosf(he_rad);
-            if (fabsf(c) > 1.0e-3f) {
-                Adjusted_Object_Distance = obj->Distance / c;
-            }
-        }
+        float Adjusted_Object_Distance = obj->Distance * Curve_Distance_Scale;
 
         /* 5) 셀 번호 부여 (Base_CellNumber) */
         int Base_CellNumber = 1;
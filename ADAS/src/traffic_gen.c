@@ -0,0 +1,210 @@
+#include <string.h>
+#include <math.h>
+#include "traffic_gen.h"
+#include "adas_rng.h"
+#include "adas_math.h"
+
+/* 보행자: 가장 오른쪽 차로 가장자리에서 바깥쪽 [m], 보행 / 횡단 속도 [m/s] */
+#define TG_PED_EDGE_MIN     0.5f
+#define TG_PED_EDGE_MAX     2.5f
+#define TG_PED_SPEED_MAX    1.5f
+#define TG_PED_CROSS_RATE   0.3f
+
+/* 자전거: 차로 가장자리 안쪽 [m], 속도 [m/s] */
+#define TG_BIKE_EDGE        0.6f
+#define TG_BIKE_SPEED_MIN   3.0f
+#define TG_BIKE_SPEED_MAX   8.0f
+
+/* 차량 / 이륜차: 차로 중심 횡 흔들림 [m], 이륜차 평균 속도 가산 [m/s], 종가속도 범위 ± [m/s^2] */
+#define TG_LANE_WANDER      0.3f
+#define TG_MOTO_SPEED_BIAS  2.0f
+#define TG_ACCEL_MAX        1.0f
+
+/* 끼어들기: 차로 경계 쪽 치우침 [m], 횡속도 [m/s] (Target Selection 판단 기준 0.2 이상) */
+#define TG_CUT_IN_SHIFT_MAX 1.0f
+#define TG_CUT_IN_VY_MIN    0.5f
+#define TG_CUT_IN_VY_MAX    1.5f
+
+/* 구간 길이 [km] 환산 */
+#define TG_M_PER_KM         1000.0f
+
+void TrafficGen_DefaultConfig(TrafficGenConfig_t *pConfig)
+{
+    if(!pConfig)
+        return;
+
+    memset(pConfig, 0, sizeof(*pConfig));
+    pConfig->Seed                = 1u;
+    pConfig->Density             = 40.0f;
+    pConfig->Lane_Count          = 3;
+    pConfig->Ego_Lane            = 1;
+    pConfig->Oncoming_Lane_Count = 2;
+    pConfig->Lane_Width          = 3.5f;
+    pConfig->Range_Ahead         = 200.0f;
+    pConfig->Range_Behind        = 50.0f;
+    pConfig->Ego_Speed           = 20.0f;
+    pConfig->Speed_Sigma         = 3.0f;
+    pConfig->Type_Mix[OBJTYPE_CAR]        = 0.85f;
+    pConfig->Type_Mix[OBJTYPE_PEDESTRIAN] = 0.05f;
+    pConfig->Type_Mix[OBJTYPE_BICYCLE]    = 0.05f;
+    pConfig->Type_Mix[OBJTYPE_MOTORCYCLE] = 0.05f;
+    pConfig->Cut_In_Rate         = 0.1f;
+    pConfig->Oncoming_Rate       = 0.2f;
+    pConfig->Stopped_Rate        = 0.05f;
+    pConfig->Pos_Noise           = 0.2f;
+    pConfig->Vel_Noise           = 0.3f;
+    pConfig->Heading_Noise       = 1.0f;
+}
+
+static float mix_sum(const TrafficGenConfig_t *pConfig)
+{
+    float sum = 0.0f;
+    for(int t = 0; t < TRAFFIC_GEN_TYPE_COUNT; t++)
+    {
+        if(pConfig->Type_Mix[t] < 0.0f)
+            return -1.0f;
+        sum += pConfig->Type_Mix[t];
+    }
+    return sum;
+}
+
+int TrafficGen_Count(const TrafficGenConfig_t *pConfig)
+{
+    if(!pConfig || (pConfig->Lane_Count < 1) || (pConfig->Ego_Lane < 0) ||
+       (pConfig->Ego_Lane >= pConfig->Lane_Count) || (pConfig->Oncoming_Lane_Count < 0) ||
+       !(pConfig->Lane_Width > 0.0f) || (pConfig->Range_Behind < 0.0f) ||
+       !((pConfig->Range_Ahead + pConfig->Range_Behind) > 0.0f) || !(mix_sum(pConfig) > 0.0f))
+        return -1;
+
+    if(pConfig->Object_Count > 0)
+        return pConfig->Object_Count;
+    if(!(pConfig->Density >= 0.0f))
+        return -1;
+
+    float lanes  = (float)(pConfig->Lane_Count + pConfig->Oncoming_Lane_Count);
+    float km     = (pConfig->Range_Ahead + pConfig->Range_Behind) / TG_M_PER_KM;
+    float count  = rintf(pConfig->Density * lanes * km);
+    return (count < (float)INT32_MAX) ? (int)count : INT32_MAX;
+}
+
+/* 가중치 누적 분포에서 종류 선택 */
+static ObjectType_e pick_type(AdasRng_t *pRng, const float *pCdf)
+{
+    float u = AdasRng_UniformF(pRng);
+    int t = 0;
+    while((t < (TRAFFIC_GEN_TYPE_COUNT - 1)) && (u >= pCdf[t]))
+        t++;
+    return (ObjectType_e)t;
+}
+
+int TrafficGen_Generate(const TrafficGenConfig_t *pConfig, uint64_t frame,
+                        ObjectData_t *pObjs, int capacity)
+{
+    int count = TrafficGen_Count(pConfig);
+    if((count < 0) || !pObjs || (capacity < 0))
+        return -1;
+    if(count > capacity)
+        count = capacity;
+
+    const TrafficGenConfig_t *c = pConfig;
+    const float w       = c->Lane_Width;
+    const float rightY  = -((float)(c->Lane_Count - 1 - c->Ego_Lane) + 0.5f) * w;   /* 오른쪽 도로 끝 */
+    const int   onLanes = c->Oncoming_Lane_Count;
+
+    float cdf[TRAFFIC_GEN_TYPE_COUNT];
+    float sum = mix_sum(c), acc = 0.0f;
+    for(int t = 0; t < TRAFFIC_GEN_TYPE_COUNT; t++)
+    {
+        acc += c->Type_Mix[t] / sum;
+        cdf[t] = acc;
+    }
+
+    AdasRng_t rng;
+    AdasRng_Seed(&rng, c->Seed, frame);
+
+    for(int i = 0; i < count; i++)
+    {
+        ObjectData_t *o = &pObjs[i];
+        ObjectType_e type = pick_type(&rng, cdf);
+        float x  = AdasRng_RangeF(&rng, -c->Range_Behind, c->Range_Ahead);
+        float y, vx, vy = 0.0f, ax = 0.0f, heading = 0.0f;
+        ObjectStatus_e status = OBJSTAT_MOVING;
+        float n0 = AdasRng_NormalFastF(&rng);
+        float n1 = AdasRng_NormalFastF(&rng);
+        float n2 = AdasRng_NormalFastF(&rng);
+        float n3 = AdasRng_NormalFastF(&rng);
+        float n4 = AdasRng_NormalFastF(&rng);
+        float n5 = AdasRng_NormalFastF(&rng);
+
+        if(type == OBJTYPE_PEDESTRIAN)
+        {
+            y  = rightY - AdasRng_RangeF(&rng, TG_PED_EDGE_MIN, TG_PED_EDGE_MAX);
+            vx = 0.0f;
+            if(AdasRng_Chance(&rng, TG_PED_CROSS_RATE))
+            {
+                vy      = AdasRng_RangeF(&rng, 0.5f, TG_PED_SPEED_MAX);   /* 도로 쪽으로 횡단 */
+                heading = 90.0f;
+            }
+            else
+            {
+                vx = AdasRng_RangeF(&rng, -TG_PED_SPEED_MAX, TG_PED_SPEED_MAX);
+                heading = (vx < 0.0f) ? 180.0f : 0.0f;
+            }
+        }
+        else if(type == OBJTYPE_BICYCLE)
+        {
+            y  = rightY + TG_BIKE_EDGE + (0.5f * TG_LANE_WANDER * n5);
+            vx = AdasRng_RangeF(&rng, TG_BIKE_SPEED_MIN, TG_BIKE_SPEED_MAX);
+        }
+        else
+        {
+            float mean = c->Ego_Speed + ((type == OBJTYPE_MOTORCYCLE) ? TG_MOTO_SPEED_BIAS : 0.0f);
+            vx = fmaxf(mean + (c->Speed_Sigma * n5), 0.0f);
+            ax = AdasRng_RangeF(&rng, -TG_ACCEL_MAX, TG_ACCEL_MAX);
+
+            if((onLanes > 0) && AdasRng_Chance(&rng, c->Oncoming_Rate))
+            {
+                int lane = (int)(AdasRng_UniformF(&rng) * (float)onLanes);
+                y       = ((float)(c->Ego_Lane + 1 + lane) * w) +
+                          (TG_LANE_WANDER * AdasRng_RangeF(&rng, -1.0f, 1.0f));
+                vx      = -vx;
+                ax      = -ax;
+                heading = 180.0f;
+                status  = OBJSTAT_ONCOMING;
+            }
+            else
+            {
+                int lane = (int)(AdasRng_UniformF(&rng) * (float)c->Lane_Count);
+                int rel  = c->Ego_Lane - lane;                /* + = 자차 왼쪽 */
+                y = ((float)rel * w) + (TG_LANE_WANDER * AdasRng_RangeF(&rng, -1.0f, 1.0f));
+
+                if(((rel == 1) || (rel == -1)) && AdasRng_Chance(&rng, c->Cut_In_Rate))
+                {
+                    float toward = (rel > 0) ? -1.0f : 1.0f;  /* 자차 차로 쪽 */
+                    y  += toward * AdasRng_RangeF(&rng, 0.0f, TG_CUT_IN_SHIFT_MAX);
+                    vy  = toward * AdasRng_RangeF(&rng, TG_CUT_IN_VY_MIN, TG_CUT_IN_VY_MAX);
+                    heading = atanf(vy / fmaxf(vx, 1.0f)) * ADAS_MATH_RAD2DEG;
+                }
+            }
+        }
+
+        if((status != OBJSTAT_ONCOMING) && AdasRng_Chance(&rng, c->Stopped_Rate))
+        {
+            vx = vy = ax = 0.0f;
+            status = OBJSTAT_STOPPED;
+        }
+
+        memset(o, 0, sizeof(*o));
+        o->Object_ID     = i + 1;
+        o->Object_Type   = type;
+        o->Position_X    = x + (c->Pos_Noise * n0);
+        o->Position_Y    = y + (c->Pos_Noise * n1);
+        o->Velocity_X    = vx + (c->Vel_Noise * n2);
+        o->Velocity_Y    = vy + (c->Vel_Noise * n3);
+        o->Accel_X       = ax;
+        o->Heading       = AdasMath_WrapDeg180(heading + (c->Heading_Noise * n4));
+        o->Distance      = sqrtf((o->Position_X * o->Position_X) + (o->Position_Y * o->Position_Y));
+        o->Object_Status = status;
+    }
+    return count;
+}
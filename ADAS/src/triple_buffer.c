@@ -0,0 +1,76 @@
+#include <string.h>
+#include "triple_buffer.h"
+
+#define TB_INDEX_MASK  0x3u
+#define TB_FRESH_BIT   0x4u
+
+/* ----------------------------------------------------------------------------
+ * TripleBuffer_Init
+ *  - 초기 배치: 쓰기=0, middle=1, 읽기=2
+ * ---------------------------------------------------------------------------*/
+int TripleBuffer_Init(TripleBuffer_t *pTb, void *pStorage, size_t slotSize)
+{
+    if(!pTb || !pStorage || slotSize == 0)
+        return -1;
+
+    memset(pTb, 0, sizeof(*pTb));
+    pTb->pSlots    = (unsigned char *)pStorage;
+    pTb->Slot_Size = slotSize;
+    pTb->Write_Idx = 0;
+    pTb->Read_Idx  = 2;
+    __atomic_store_n(&pTb->State, 1u, __ATOMIC_RELEASE);
+    return 0;
+}
+
+void *TripleBuffer_WriteSlot(TripleBuffer_t *pTb)
+{
+    if(!pTb)
+        return NULL;
+    return pTb->pSlots + (pTb->Write_Idx * pTb->Slot_Size);
+}
+
+/* ----------------------------------------------------------------------------
+ * TripleBuffer_Publish
+ *  - 쓰기 슬롯을 middle 로 내놓고(fresh 표시) 이전 middle 을 새 쓰기 슬롯으로
+ *  - release: 슬롯 내용 쓰기가 소비자에게 먼저 보이도록
+ * ---------------------------------------------------------------------------*/
+void TripleBuffer_Publish(TripleBuffer_t *pTb)
+{
+    if(!pTb)
+        return;
+
+    unsigned prev = __atomic_exchange_n(&pTb->State, pTb->Write_Idx | TB_FRESH_BIT, __ATOMIC_ACQ_REL);
+    pTb->Write_Idx = prev & TB_INDEX_MASK;
+}
+
+/* ----------------------------------------------------------------------------
+ * TripleBuffer_Acquire
+ *  - fresh 일 때만 읽기 슬롯과 middle 교환 (fresh 해제)
+ *  - 확인~교환 사이에 생산자가 게시해도 exchange 가 최신 middle 을 가져옴
+ * ---------------------------------------------------------------------------*/
+int TripleBuffer_Acquire(TripleBuffer_t *pTb)
+{
+    if(!pTb)
+        return 0;
+
+    if(!(__atomic_load_n(&pTb->State, __ATOMIC_RELAXED) & TB_FRESH_BIT))
+        return 0;
+
+    unsigned prev = __atomic_exchange_n(&pTb->State, pTb->Read_Idx, __ATOMIC_ACQ_REL);
+    pTb->Read_Idx = prev & TB_INDEX_MASK;
+    return 1;
+}
+
+void *TripleBuffer_ReadSlot(TripleBuffer_t *pTb)
+{
+    if(!pTb)
+        return NULL;
+    return pTb->pSlots + (pTb->Read_Idx * pTb->Slot_Size);
+}
+
+int TripleBuffer_HasFresh(const TripleBuffer_t *pTb)
+{
+    if(!pTb)
+        return 0;
+    return (__atomic_load_n(&pTb->State, __ATOMIC_ACQUIRE) & TB_FRESH_BIT) ? 1 : 0;
+}
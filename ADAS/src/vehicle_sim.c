@@ -0,0 +1,487 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "vehicle_sim.h"
+#include "adas_math.h"
+
+/* 묶음 차량 수 (배열 길이 단위, SSE 2벡터 / AVX 1벡터) / 정렬 [B] */
+#define SIM_LANES       8
+#define SIM_ALIGN       64
+#define SIM_ARRAY_COUNT 14
+
+/* 기구학 구간: 횡속도/요레이트가 기구학 값을 추종하는 시정수 [s] */
+#define SIM_KIN_TAU     0.05f
+
+/* 정지 판정 이득 [s/m]: 감속 항 = 감속 * clamp(vx * 이득, 0, 1) (0.1 m/s 이하에서 감쇄) */
+#define SIM_STOP_GAIN  10.0f
+
+/* 슬립각 계산 최소 속도 [m/s] (Blend_Speed_Lo 이하는 어차피 기구학) */
+#define SIM_MIN_SLIP_SPEED  1.0f
+
+/* 직선 도로로 보는 곡률 [1/m] */
+#define SIM_STRAIGHT_CURVATURE  1.0e-6f
+
+/* ----------------------------------------------------------------------------
+ * 상태 / 계수 (스텝 루프 내부 전용)
+ *  - 상태 8개 항목은 할당 블록 앞쪽 8개 배열 (항목 f 의 차량 i = pBlock[f * Capacity + i])
+ *  - 적분은 SIM_LANES 대 묶음(SimBlock_t)으로: sin/cos 은 AdasMath 배치(SSE2),
+ *    나머지는 묶음 내 고정 길이 루프 (지역 배열 -> 별칭 없음, 분기 없음)
+ * ---------------------------------------------------------------------------*/
+typedef enum
+{
+    SIM_X = 0, SIM_Y, SIM_PSI, SIM_VX, SIM_VY, SIM_R, SIM_ACCEL, SIM_DELTA,
+    SIM_STATE_COUNT
+} SimField_e;
+
+typedef struct
+{
+    float F[SIM_STATE_COUNT][SIM_LANES];
+} SimBlock_t;
+
+typedef struct
+{
+    float Lf, Lr, Inv_L, Lr_Over_L;
+    float Cf_Over_M, Cr_Over_M, Lf_Cf_Over_Iz, Lr_Cr_Over_Iz;
+    float Inv_Accel_Tau, Inv_Steer_Tau;
+    float Rolling, Drag;
+    float Blend_Lo, Inv_Blend_Span, Dynamic;
+} SimCoef_t;
+
+static inline float clamp01(float x)
+{
+    x = (x < 0.0f) ? 0.0f : x;
+    return (x > 1.0f) ? 1.0f : x;
+}
+
+/*
+ * 비교 없는 max / 0~1 제한 (fabsf = 부호 비트 마스크)
+ *  - 비교/fmaxf 는 -ftrapping-math(기본) 에서 if-conversion 불가 -> 루프 벡터화 실패
+ */
+static inline float max_nc(float a, float b)
+{
+    return 0.5f * (a + b + fabsf(a - b));
+}
+
+static inline float clamp01_nc(float x)
+{
+    return 0.5f * (1.0f + fabsf(x) - fabsf(x - 1.0f));
+}
+
+static void make_coef(const VehicleSimParams_t *pP, SimCoef_t *pC)
+{
+    float L    = pP->Lf + pP->Lr;
+    float span = pP->Blend_Speed_Hi - pP->Blend_Speed_Lo;
+
+    pC->Lf             = pP->Lf;
+    pC->Lr             = pP->Lr;
+    pC->Inv_L          = 1.0f / L;
+    pC->Lr_Over_L      = pP->Lr / L;
+    pC->Cf_Over_M      = pP->Cf / pP->Mass;
+    pC->Cr_Over_M      = pP->Cr / pP->Mass;
+    pC->Lf_Cf_Over_Iz  = pP->Lf * pP->Cf / pP->Yaw_Inertia;
+    pC->Lr_Cr_Over_Iz  = pP->Lr * pP->Cr / pP->Yaw_Inertia;
+    pC->Inv_Accel_Tau  = 1.0f / pP->Accel_Tau;
+    pC->Inv_Steer_Tau  = 1.0f / pP->Steer_Tau;
+    pC->Rolling        = pP->Rolling_Accel;
+    pC->Drag           = pP->Drag_Coeff;
+    pC->Blend_Lo       = pP->Blend_Speed_Lo;
+    pC->Inv_Blend_Span = (span > 0.0f) ? (1.0f / span) : 1.0e6f;
+    pC->Dynamic        = (pP->Model == VEHICLE_SIM_DYNAMIC) ? 1.0f : 0.0f;
+}
+
+/* ----------------------------------------------------------------------------
+ * 상태 미분 (묶음 단위)
+ *  - w = 동역학 비중 (KINEMATIC = 0, DYNAMIC = 저속 0 -> 고속 1)
+ *  - 종방향: vx' = a+ + (a- - 구름 - 공기)*정지 감쇄 + w*(r*vy - Fyf*sin(δ)/m)
+ *  - 동역학: 선형 타이어 Fy = C*α, α_f = δ - (vy + Lf*r)/vx, α_r = -(vy - Lr*r)/vx
+ *  - 기구학: vy -> vx*Lr/L*tan(δ), r -> vx*tan(δ)/L 로 SIM_KIN_TAU 추종
+ *  - 액추에이터: a' = (a_cmd - a)/τa, δ' = (δ_cmd - δ)/τs
+ * ---------------------------------------------------------------------------*/
+static void sim_deriv(const SimBlock_t *restrict pS, const float *restrict pAccelCmd,
+                      const float *restrict pDeltaCmd, const SimCoef_t *restrict pC,
+                      SimBlock_t *restrict pD)
+{
+    float sp[SIM_LANES], cp[SIM_LANES], sd[SIM_LANES], cd[SIM_LANES];
+    AdasMath_SinCosF_Batch(pS->F[SIM_PSI], sp, cp, SIM_LANES);
+    AdasMath_SinCosF_Batch(pS->F[SIM_DELTA], sd, cd, SIM_LANES);
+
+    for(int l = 0; l < SIM_LANES; l++)
+    {
+        float vx = pS->F[SIM_VX][l];
+        float vy = pS->F[SIM_VY][l];
+        float r  = pS->F[SIM_R][l];
+        float dl = pS->F[SIM_DELTA][l];
+
+        float w = clamp01_nc((vx - pC->Blend_Lo) * pC->Inv_Blend_Span) * pC->Dynamic;
+
+        /* 동역학 */
+        float vxs  = max_nc(vx, SIM_MIN_SLIP_SPEED);
+        float invV = 1.0f / vxs;
+        float af   = dl - ((vy + pC->Lf * r) * invV);
+        float ar   = -(vy - pC->Lr * r) * invV;
+        float fyfM = pC->Cf_Over_M * af;     /* Fyf / m */
+        float fyrM = pC->Cr_Over_M * ar;     /* Fyr / m */
+        float vyDotDyn = (fyfM * cd[l]) + fyrM - (r * vx);
+        float rDotDyn  = (pC->Lf_Cf_Over_Iz * af * cd[l]) - (pC->Lr_Cr_Over_Iz * ar);
+
+        /* 기구학 */
+        float tanD     = sd[l] / cd[l];
+        float vyDotKin = ((vx * pC->Lr_Over_L * tanD) - vy) * (1.0f / SIM_KIN_TAU);
+        float rDotKin  = ((vx * pC->Inv_L * tanD) - r) * (1.0f / SIM_KIN_TAU);
+
+        /* 종방향 */
+        float resist = pC->Rolling + (pC->Drag * vx * vx);
+
+        /* 감속(제동 + 저항)은 정지 근처에서 소멸 -> 후진 없음 (RK4 중간 단계 포함) */
+        float moving = clamp01_nc(vx * SIM_STOP_GAIN);
+        float aPos   = max_nc(pS->F[SIM_ACCEL][l], 0.0f);
+        float aNeg   = pS->F[SIM_ACCEL][l] - aPos;
+        float vxp    = max_nc(vx, 0.0f);
+
+        pD->F[SIM_X][l]     = (vxp * cp[l]) - (vy * sp[l]);
+        pD->F[SIM_Y][l]     = (vxp * sp[l]) + (vy * cp[l]);
+        pD->F[SIM_PSI][l]   = r;
+        pD->F[SIM_VX][l]    = aPos + ((aNeg - resist) * moving) + (w * ((r * vy) - (fyfM * sd[l])));
+        pD->F[SIM_VY][l]    = (w * vyDotDyn) + ((1.0f - w) * vyDotKin);
+        pD->F[SIM_R][l]     = (w * rDotDyn) + ((1.0f - w) * rDotKin);
+        pD->F[SIM_ACCEL][l] = (pAccelCmd[l] - pS->F[SIM_ACCEL][l]) * pC->Inv_Accel_Tau;
+        pD->F[SIM_DELTA][l] = (pDeltaCmd[l] - dl) * pC->Inv_Steer_Tau;
+    }
+}
+
+/* out = s + h * d */
+static void sim_axpy(const SimBlock_t *pS, const SimBlock_t *pD, float h, SimBlock_t *pOut)
+{
+    const float *s = &pS->F[0][0];
+    const float *d = &pD->F[0][0];
+    float       *o = &pOut->F[0][0];
+    for(int j = 0; j < SIM_STATE_COUNT * SIM_LANES; j++)
+        o[j] = s[j] + (h * d[j]);
+}
+
+/* 고전 RK4 1스텝 (명령은 스텝 동안 유지) */
+static void sim_rk4(SimBlock_t *pS, const float *pAccelCmd, const float *pDeltaCmd,
+                    const SimCoef_t *pC, float h)
+{
+    SimBlock_t k1, k2, k3, k4, tmp;
+
+    sim_deriv(pS, pAccelCmd, pDeltaCmd, pC, &k1);
+    sim_axpy(pS, &k1, 0.5f * h, &tmp);
+    sim_deriv(&tmp, pAccelCmd, pDeltaCmd, pC, &k2);
+    sim_axpy(pS, &k2, 0.5f * h, &tmp);
+    sim_deriv(&tmp, pAccelCmd, pDeltaCmd, pC, &k3);
+    sim_axpy(pS, &k3, h, &tmp);
+    sim_deriv(&tmp, pAccelCmd, pDeltaCmd, pC, &k4);
+
+    const float h6 = h * (1.0f / 6.0f);
+    const float *d1 = &k1.F[0][0];
+    const float *d2 = &k2.F[0][0];
+    const float *d3 = &k3.F[0][0];
+    const float *d4 = &k4.F[0][0];
+    float       *s  = &pS->F[0][0];
+    for(int j = 0; j < SIM_STATE_COUNT * SIM_LANES; j++)
+        s[j] += h6 * (d1[j] + (2.0f * (d2[j] + d3[j])) + d4[j]);
+
+    /* 후진 없음 (정지 중 제동 명령은 속도 0 유지) */
+    for(int l = 0; l < SIM_LANES; l++)
+        pS->F[SIM_VX][l] = max_nc(pS->F[SIM_VX][l], 0.0f);
+}
+
+/* 차량 base ~ base + SIM_LANES - 1 상태 복사 (lanes < SIM_LANES 면 나머지 0) */
+static void load_block(const VehicleSimFleet_t *pF, int base, int lanes, SimBlock_t *pBlk)
+{
+    const float *pState = (const float *)pF->pBlock;
+    memset(pBlk, 0, sizeof(*pBlk));
+    for(int f = 0; f < SIM_STATE_COUNT; f++)
+        memcpy(pBlk->F[f], pState + ((size_t)f * (size_t)pF->Capacity) + base, (size_t)lanes * sizeof(float));
+}
+
+static void store_block(VehicleSimFleet_t *pF, int base, const SimBlock_t *pBlk)
+{
+    float *pState = (float *)pF->pBlock;
+    for(int f = 0; f < SIM_STATE_COUNT; f++)
+        memcpy(pState + ((size_t)f * (size_t)pF->Capacity) + base, pBlk->F[f], sizeof(pBlk->F[f]));
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_DefaultParams
+ * ---------------------------------------------------------------------------*/
+void VehicleSim_DefaultParams(VehicleSimParams_t *pParams)
+{
+    if(!pParams)
+        return;
+
+    memset(pParams, 0, sizeof(*pParams));
+    pParams->Model           = VEHICLE_SIM_DYNAMIC;
+    pParams->Mass            = 1500.0f;
+    pParams->Yaw_Inertia     = 2250.0f;
+    pParams->Lf              = 1.3f;
+    pParams->Lr              = 1.6f;     /* 축간 거리 2.9m (LFA_PP_WHEELBASE) */
+    pParams->Cf              = 80000.0f;
+    pParams->Cr              = 80000.0f;
+    pParams->Max_Accel       = 10.0f;
+    pParams->Max_Decel       = 10.0f;
+    pParams->Accel_Tau       = 0.3f;
+    pParams->Steer_Tau       = 0.1f;
+    pParams->Max_Wheel_Angle = 70.0f;    /* CARLA 기본 차량 max_steer_angle */
+    pParams->Rolling_Accel   = 0.1f;
+    pParams->Drag_Coeff      = 2.8e-4f;  /* 0.5 * 1.2 * 0.7 / 1500 */
+    pParams->Blend_Speed_Lo  = 3.0f;
+    pParams->Blend_Speed_Hi  = 6.0f;
+    pParams->Lane_Width      = 3.5f;
+    pParams->Substeps        = 1;
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_Init / Destroy
+ * ---------------------------------------------------------------------------*/
+int VehicleSim_Init(VehicleSimFleet_t *pFleet, int count, const VehicleSimParams_t *pParams)
+{
+    if(!pFleet || count <= 0)
+        return -1;
+
+    VehicleSimParams_t params;
+    if(pParams)
+        params = *pParams;
+    else
+        VehicleSim_DefaultParams(&params);
+
+    if((params.Mass <= 0.0f) || (params.Yaw_Inertia <= 0.0f) || (params.Lf <= 0.0f) || (params.Lr <= 0.0f) ||
+       (params.Accel_Tau <= 0.0f) || (params.Steer_Tau <= 0.0f) || (params.Substeps < 1))
+        return -1;
+
+    memset(pFleet, 0, sizeof(*pFleet));
+    int capacity = (count + SIM_LANES - 1) / SIM_LANES * SIM_LANES;
+    size_t bytes = (size_t)capacity * sizeof(float) * SIM_ARRAY_COUNT;   /* capacity 8 배수 -> bytes 32 배수 */
+    bytes = (bytes + SIM_ALIGN - 1) / SIM_ALIGN * SIM_ALIGN;
+
+    float *pBase = (float *)aligned_alloc(SIM_ALIGN, bytes);
+    if(!pBase)
+        return -1;
+    memset(pBase, 0, bytes);
+
+    float **ppArrays[SIM_ARRAY_COUNT] = {
+        &pFleet->X, &pFleet->Y, &pFleet->Psi, &pFleet->Vx, &pFleet->Vy, &pFleet->R,
+        &pFleet->Accel, &pFleet->Delta, &pFleet->Accel_Cmd, &pFleet->Delta_Cmd,
+        &pFleet->Road_Curvature, &pFleet->Lead_S, &pFleet->Lead_Speed, &pFleet->Lead_Offset
+    };
+    for(int a = 0; a < SIM_ARRAY_COUNT; a++)
+        *ppArrays[a] = pBase + ((size_t)a * (size_t)capacity);
+
+    pFleet->Count    = count;
+    pFleet->Capacity = capacity;
+    pFleet->Params   = params;
+    pFleet->pBlock   = pBase;
+    for(int i = 0; i < capacity; i++)
+        pFleet->Lead_Speed[i] = -1.0f;
+    return 0;
+}
+
+void VehicleSim_Destroy(VehicleSimFleet_t *pFleet)
+{
+    if(!pFleet)
+        return;
+    free(pFleet->pBlock);
+    memset(pFleet, 0, sizeof(*pFleet));
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_SetVehicle
+ *  - 도로 시작점(원점, 중심선 방향 = x)에서 횡위치만큼 좌측
+ * ---------------------------------------------------------------------------*/
+int VehicleSim_SetVehicle(VehicleSimFleet_t *pFleet, int index, const VehicleSimInit_t *pInit)
+{
+    if(!pFleet || !pInit || (index < 0) || (index >= pFleet->Count))
+        return -1;
+
+    pFleet->X[index]     = 0.0f;
+    pFleet->Y[index]     = pInit->Lane_Offset;
+    pFleet->Psi[index]   = pInit->Heading * ADAS_MATH_DEG2RAD;
+    pFleet->Vx[index]    = (pInit->Speed > 0.0f) ? pInit->Speed : 0.0f;
+    pFleet->Vy[index]    = 0.0f;
+    pFleet->R[index]     = 0.0f;
+    pFleet->Accel[index] = 0.0f;
+    pFleet->Delta[index] = 0.0f;
+    pFleet->Accel_Cmd[index] = 0.0f;
+    pFleet->Delta_Cmd[index] = 0.0f;
+    pFleet->Road_Curvature[index] = pInit->Road_Curvature;
+    pFleet->Lead_S[index]     = (pInit->Lead_Gap > 0.0f) ? pInit->Lead_Gap : 0.0f;
+    pFleet->Lead_Speed[index] = (pInit->Lead_Gap > 0.0f) ? fmaxf(pInit->Lead_Speed, 0.0f) : -1.0f;
+    pFleet->Lead_Offset[index] = pInit->Lead_Offset;
+    return 0;
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_ApplyControl
+ * ---------------------------------------------------------------------------*/
+void VehicleSim_ApplyControl(VehicleSimFleet_t *pFleet, int index, const VehicleControl_t *pControl)
+{
+    if(!pFleet || !pControl || (index < 0) || (index >= pFleet->Count))
+        return;
+
+    const VehicleSimParams_t *pP = &pFleet->Params;
+    float throttle = clamp01(pControl->throttle);
+    float brake    = clamp01(pControl->brake);
+    float steer    = fminf(fmaxf(pControl->steer, -1.0f), 1.0f);
+
+    pFleet->Accel_Cmd[index] = (throttle * pP->Max_Accel) - (brake * pP->Max_Decel);
+    pFleet->Delta_Cmd[index] = -steer * pP->Max_Wheel_Angle * ADAS_MATH_DEG2RAD;
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_Step
+ *  - 차량 간 의존 없음 -> SIM_LANES 대 묶음을 지역 배열로 복사해 적분 후 되돌림
+ * ---------------------------------------------------------------------------*/
+void VehicleSim_Step(VehicleSimFleet_t *pFleet, float dt)
+{
+    if(!pFleet || !pFleet->pBlock || (dt <= 0.0f))
+        return;
+
+    SimCoef_t c;
+    make_coef(&pFleet->Params, &c);
+
+    const int   n = pFleet->Capacity;
+    const int   substeps = pFleet->Params.Substeps;
+    const float h = dt / (float)substeps;
+
+    /* Capacity 까지 실행 (패딩 차량은 정지 상태 유지, 꼬리 처리 불필요) */
+    for(int k = 0; k < substeps; k++)
+    {
+        for(int base = 0; base < n; base += SIM_LANES)
+        {
+            SimBlock_t blk;
+            load_block(pFleet, base, SIM_LANES, &blk);
+            sim_rk4(&blk, &pFleet->Accel_Cmd[base], &pFleet->Delta_Cmd[base], &c, h);
+            store_block(pFleet, base, &blk);
+        }
+    }
+
+    /* 선행차: 도로를 따라 Lead_Speed 로 이동 (없으면 속도 < 0 -> 0 으로 제한해 위치 유지) */
+    for(int i = 0; i < n; i++)
+        pFleet->Lead_S[i] += dt * ((pFleet->Lead_Speed[i] > 0.0f) ? pFleet->Lead_Speed[i] : 0.0f);
+
+    pFleet->Time += (double)dt;
+    pFleet->Steps++;
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_LanePose
+ *  - 직선: 횡위치 = y, 도로 방향 0, 중심선 위치 = x
+ *  - 원호 (중심 (0, 1/k)): 도로 방향 θ = 중심 기준 위치 각, 중심선 위치 = θ / k,
+ *    횡위치 = 1/k - sign(k) * 중심까지 거리
+ * ---------------------------------------------------------------------------*/
+void VehicleSim_LanePose(const VehicleSimFleet_t *pFleet, int index,
+                         float *pOffset, float *pRoadHeading, float *pStation)
+{
+    float offset = 0.0f, theta = 0.0f, station = 0.0f;
+
+    if(pFleet && (index >= 0) && (index < pFleet->Count))
+    {
+        float x = pFleet->X[index];
+        float y = pFleet->Y[index];
+        float k = pFleet->Road_Curvature[index];
+
+        if(fabsf(k) < SIM_STRAIGHT_CURVATURE)
+        {
+            offset  = y;
+            theta   = 0.0f;
+            station = x;
+        }
+        else
+        {
+            float radius = 1.0f / k;
+            float sgn    = (k > 0.0f) ? 1.0f : -1.0f;
+            theta   = atan2f(sgn * x, sgn * (radius - y));
+            offset  = radius - (sgn * hypotf(x, y - radius));
+            station = theta / k;
+        }
+    }
+
+    if(pOffset)      *pOffset      = offset;
+    if(pRoadHeading) *pRoadHeading = theta;
+    if(pStation)     *pStation     = station;
+}
+
+float VehicleSim_LeadGap(const VehicleSimFleet_t *pFleet, int index)
+{
+    if(!pFleet || (index < 0) || (index >= pFleet->Count) || (pFleet->Lead_Speed[index] < 0.0f))
+        return INFINITY;
+
+    float station;
+    VehicleSim_LanePose(pFleet, index, NULL, NULL, &station);
+    return pFleet->Lead_S[index] - station;
+}
+
+/* ----------------------------------------------------------------------------
+ * VehicleSim_Sense
+ * ---------------------------------------------------------------------------*/
+int VehicleSim_Sense(const VehicleSimFleet_t *pFleet, int index, AdasFrameInput_t *pIn)
+{
+    if(!pFleet || !pIn || (index < 0) || (index >= pFleet->Count))
+        return -1;
+
+    SimCoef_t c;
+    make_coef(&pFleet->Params, &c);
+
+    /* 해당 차량만 묶음 0번 칸에 올려 미분 계산 (가속도 = 속도 미분) */
+    SimBlock_t s, d;
+    float aCmd[SIM_LANES] = { 0.0f };
+    float dCmd[SIM_LANES] = { 0.0f };
+    aCmd[0] = pFleet->Accel_Cmd[index];
+    dCmd[0] = pFleet->Delta_Cmd[index];
+    load_block(pFleet, index, 1, &s);
+    sim_deriv(&s, aCmd, dCmd, &c, &d);
+
+    float vx = s.F[SIM_VX][0];
+    float vy = s.F[SIM_VY][0];
+    float r  = s.F[SIM_R][0];
+    float nowMs  = (float)(pFleet->Time * 1000.0);
+
+    float offset, theta, station;
+    VehicleSim_LanePose(pFleet, index, &offset, &theta, &station);
+    float relHeading = AdasMath_WrapDeg180((s.F[SIM_PSI][0] - theta) * ADAS_MATH_RAD2DEG) * ADAS_MATH_DEG2RAD;
+    float k = pFleet->Road_Curvature[index];
+
+    pIn->Time.Current_Time = nowMs;
+
+    pIn->Gps.GPS_Velocity_X = vx;
+    pIn->Gps.GPS_Velocity_Y = vy;
+    pIn->Gps.GPS_Timestamp  = nowMs;
+
+    pIn->Imu.Linear_Acceleration_X = d.F[SIM_VX][0] - (r * vy);
+    pIn->Imu.Linear_Acceleration_Y = d.F[SIM_VY][0] + (r * vx);
+    pIn->Imu.Yaw_Rate              = r * ADAS_MATH_RAD2DEG;
+
+    int curved = (fabsf(k) >= SIM_STRAIGHT_CURVATURE);
+    pIn->Lane.Lane_Type            = curved ? LANE_TYPE_CURVE : LANE_TYPE_STRAIGHT;
+    pIn->Lane.Lane_Curvature       = curved ? (1.0f / fabsf(k)) : 0.0f;
+    pIn->Lane.Next_Lane_Curvature  = pIn->Lane.Lane_Curvature;
+    pIn->Lane.Lane_Offset          = offset;
+    pIn->Lane.Lane_Heading         = theta * ADAS_MATH_RAD2DEG;
+    pIn->Lane.Lane_Width           = pFleet->Params.Lane_Width;
+    pIn->Lane.Lane_Change_Status   = LANE_CHANGE_KEEP;
+    pIn->Lane.Lane_Curve_Direction = curved ? ((k > 0.0f) ? -1 : 1) : 0;
+
+    /* 선행차: 도로 좌표 (중심선 거리, 횡) -> 자차 기준 좌표 (근사: 중심선 거리를 직선 거리로 사용) */
+    pIn->Object_Count = 0;
+    if(pFleet->Lead_Speed[index] >= 0.0f)
+    {
+        float ds = pFleet->Lead_S[index] - station;
+        float dl = pFleet->Lead_Offset[index] - offset;
+        float sh, ch;
+        AdasMath_SinCosF(relHeading, &sh, &ch);
+
+        ObjectData_t *pObj = &pIn->Objects[0];
+        memset(pObj, 0, sizeof(*pObj));
+        pObj->Object_ID     = VEHICLE_SIM_LEAD_ID;
+        pObj->Object_Type   = OBJTYPE_CAR;
+        pObj->Position_X    = (ds * ch) + (dl * sh);
+        pObj->Position_Y    = (dl * ch) - (ds * sh);
+        pObj->Velocity_X    = pFleet->Lead_Speed[index];
+        pObj->Heading       = -relHeading * ADAS_MATH_RAD2DEG;
+        pObj->Distance      = hypotf(pObj->Position_X, pObj->Position_Y);
+        pObj->Object_Status = (pFleet->Lead_Speed[index] > 0.1f) ? OBJSTAT_MOVING : OBJSTAT_STOPPED;
+        pIn->Object_Count   = 1;
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+// adas_bench_stats_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+extern "C" {
+  #include "adas_bench_stats.h"
+}
+
+/*
+테스트 항목:
+1. 요약 통계: 중앙값(홀수/짝수), MAD, p99(최근접 순위), 이상치 1개에 중앙값/MAD 영향 작음
+2. Mann-Whitney: 완전 분리 3 vs 3 정확 p = 1/20, 같은 분포는 유의하지 않음, 동순위/대표본은 정규 근사
+3. 입출력: Google Benchmark JSON(반복 + 집계, us 단위) 읽기, 기준값 CSV 저장/읽기 왕복
+4. 비교 판정: 유의 + 임계 초과 = 회귀, 임계 이하 = 같음, 빨라짐, 표본 부족, 한쪽 누락
+*/
+
+static std::string temp_path(const char *name) {
+    return std::string("/tmp/adas_bench_stats_test_") + name;
+}
+
+static void fill(AdasBenchSeries_t *s, const char *name, double base, double step, int n) {
+    std::snprintf(s->Name, sizeof(s->Name), "%s", name);
+    s->Count = n;
+    for (int i = 0; i < n; i++) s->Samples_Ns[i] = base + step * (double)((i * 7) % n);
+}
+
+// Test 1: 요약 통계
+TEST(AdasBenchStatsTest, SummaryIsRobust) {
+    const double odd[] = { 5, 1, 3, 2, 4 };
+    AdasBenchSummary_t s;
+    ASSERT_EQ(AdasBenchStats_Summarize(odd, 5, &s), 0);
+    EXPECT_DOUBLE_EQ(s.Median_Ns, 3.0);
+    EXPECT_DOUBLE_EQ(s.Mad_Ns, 1.0);
+    EXPECT_DOUBLE_EQ(s.P99_Ns, 5.0);
+    EXPECT_DOUBLE_EQ(s.Min_Ns, 1.0);
+
+    const double even[] = { 10, 20, 30, 40 };
+    ASSERT_EQ(AdasBenchStats_Summarize(even, 4, &s), 0);
+    EXPECT_DOUBLE_EQ(s.Median_Ns, 25.0);
+    EXPECT_DOUBLE_EQ(s.Mad_Ns, 10.0);
+
+    // 이상치: 평균은 크게 변하지만 중앙값/MAD 는 거의 그대로
+    const double noisy[] = { 100, 101, 99, 100, 102, 98, 100, 5000 };
+    ASSERT_EQ(AdasBenchStats_Summarize(noisy, 8, &s), 0);
+    EXPECT_DOUBLE_EQ(s.Median_Ns, 100.0);
+    EXPECT_LE(s.Mad_Ns, 1.5);
+    EXPECT_DOUBLE_EQ(s.P99_Ns, 5000.0);
+
+    EXPECT_EQ(AdasBenchStats_Summarize(nullptr, 3, &s), -1);
+    EXPECT_EQ(AdasBenchStats_Summarize(odd, 0, &s), -1);
+}
+
+// Test 2: Mann-Whitney
+TEST(AdasBenchStatsTest, MannWhitneyExactAndApproximate) {
+    const double a[] = { 1, 2, 3 };
+    const double b[] = { 4, 5, 6 };
+    EXPECT_NEAR(AdasBenchStats_MannWhitneyGreater(a, 3, b, 3), 1.0 / 20.0, 1e-12);
+    EXPECT_NEAR(AdasBenchStats_MannWhitneyGreater(b, 3, a, 3), 1.0, 1e-12);
+
+    // 정확 분포: 4 vs 4, U_B = 15 (한 쌍만 역전) -> P(U >= 15) = 2/70
+    const double a4[] = { 1, 2, 3, 5 };
+    const double b4[] = { 4, 6, 7, 8 };
+    EXPECT_NEAR(AdasBenchStats_MannWhitneyGreater(a4, 4, b4, 4), 2.0 / 70.0, 1e-12);
+
+    // 같은 분포 (교차 배치) -> 유의하지 않음
+    double x[10], y[10];
+    for (int i = 0; i < 10; i++) { x[i] = 100.0 + 2.0 * i; y[i] = 101.0 + 2.0 * i; }
+    double p = AdasBenchStats_MannWhitneyGreater(x, 10, y, 10);
+    EXPECT_GT(p, 0.2);
+    EXPECT_LT(p, 0.8);
+
+    // 동순위 있음 -> 정규 근사, 완전 분리면 매우 작음
+    double t0[30], t1[30];
+    for (int i = 0; i < 30; i++) { t0[i] = 100.0 + (i % 3); t1[i] = 110.0 + (i % 3); }
+    EXPECT_LT(AdasBenchStats_MannWhitneyGreater(t0, 30, t1, 30), 1e-6);
+    EXPECT_GT(AdasBenchStats_MannWhitneyGreater(t1, 30, t0, 30), 0.999);
+
+    // 모두 같은 값 -> 1
+    EXPECT_DOUBLE_EQ(AdasBenchStats_MannWhitneyGreater(t0, 1, t0, 1), 1.0);
+    EXPECT_DOUBLE_EQ(AdasBenchStats_MannWhitneyGreater(nullptr, 3, b, 3), 1.0);
+}
+
+// Test 3: 입출력
+TEST(AdasBenchStatsTest, LoadsGbenchJsonAndRoundTripsBaseline) {
+    static AdasBenchSet_t set;
+    static AdasBenchSet_t loaded;
+    std::string json = temp_path("run.json");
+    std::string csv  = temp_path("base.csv");
+
+    FILE *fp = std::fopen(json.c_str(), "w");
+    ASSERT_NE(fp, nullptr);
+    std::fprintf(fp,
+        "{\n  \"context\": {\"date\": \"x\", \"caches\": [{\"type\": \"Data\"}]},\n"
+        "  \"benchmarks\": [\n"
+        "    {\"name\": \"BM_A/objects:8\", \"run_name\": \"BM_A/objects:8\", \"run_type\": \"iteration\","
+        " \"repetitions\": 2, \"real_time\": 1.5, \"cpu_time\": 1.25, \"time_unit\": \"us\"},\n"
+        "    {\"name\": \"BM_A/objects:8\", \"run_name\": \"BM_A/objects:8\", \"run_type\": \"iteration\","
+        " \"repetitions\": 2, \"real_time\": 1.75, \"cpu_time\": 1.5, \"time_unit\": \"us\"},\n"
+        "    {\"name\": \"BM_A/objects:8_mean\", \"run_name\": \"BM_A/objects:8\", \"run_type\": \"aggregate\","
+        " \"aggregate_name\": \"mean\", \"real_time\": 9.0, \"cpu_time\": 9.0, \"time_unit\": \"us\"},\n"
+        "    {\"name\": \"BM_B\", \"real_time\": 42.0, \"cpu_time\": 40.0, \"time_unit\": \"ns\","
+        " \"label\": \"{not an object}\"}\n"
+        "  ]\n}\n");
+    std::fclose(fp);
+
+    ASSERT_EQ(AdasBench_LoadGbenchJson(json.c_str(), ADAS_BENCH_METRIC_CPU, &set), 0);
+    ASSERT_EQ(set.Count, 2);
+    const AdasBenchSeries_t *a = AdasBench_Find(&set, "BM_A/objects:8");
+    ASSERT_NE(a, nullptr);
+    ASSERT_EQ(a->Count, 2);                       // 집계 항목 제외
+    EXPECT_DOUBLE_EQ(a->Samples_Ns[0], 1250.0);   // us -> ns
+    EXPECT_DOUBLE_EQ(a->Samples_Ns[1], 1500.0);
+    const AdasBenchSeries_t *b = AdasBench_Find(&set, "BM_B");
+    ASSERT_NE(b, nullptr);
+    EXPECT_DOUBLE_EQ(b->Samples_Ns[0], 40.0);
+
+    ASSERT_EQ(AdasBench_LoadGbenchJson(json.c_str(), ADAS_BENCH_METRIC_REAL, &set), 0);
+    EXPECT_DOUBLE_EQ(AdasBench_Find(&set, "BM_A/objects:8")->Samples_Ns[1], 1750.0);
+
+    ASSERT_EQ(AdasBench_SaveBaseline(csv.c_str(), &set), 0);
+    ASSERT_EQ(AdasBench_LoadBaseline(csv.c_str(), &loaded), 0);
+    ASSERT_EQ(loaded.Count, set.Count);
+    for (int i = 0; i < set.Count; i++) {
+        EXPECT_STREQ(loaded.Series[i].Name, set.Series[i].Name);
+        ASSERT_EQ(loaded.Series[i].Count, set.Series[i].Count);
+        for (int k = 0; k < set.Series[i].Count; k++)
+            EXPECT_DOUBLE_EQ(loaded.Series[i].Samples_Ns[k], set.Series[i].Samples_Ns[k]);
+    }
+
+    EXPECT_EQ(AdasBench_LoadGbenchJson("/nonexistent/x.json", ADAS_BENCH_METRIC_CPU, &set), -1);
+    EXPECT_EQ(AdasBench_LoadBaseline(json.c_str(), &loaded), -1);   // 헤더 불일치
+    std::remove(json.c_str());
+    std::remove(csv.c_str());
+}
+
+// Test 4: 비교 판정
+TEST(AdasBenchStatsTest, CompareVerdicts) {
+    static AdasBenchSet_t base;
+    static AdasBenchSet_t cur;
+    base.Count = 5;
+    cur.Count  = 5;
+    fill(&base.Series[0], "BM_Slow/8", 1000.0, 5.0, 10);
+    fill(&cur.Series[0],  "BM_Slow/8", 1200.0, 5.0, 10);   // +20%
+    fill(&base.Series[1], "BM_Noise", 1000.0, 5.0, 10);
+    fill(&cur.Series[1],  "BM_Noise", 1020.0, 5.0, 10);    // +2% (유의해도 임계 이하)
+    fill(&base.Series[2], "BM_Fast", 1000.0, 5.0, 10);
+    fill(&cur.Series[2],  "BM_Fast", 700.0, 5.0, 10);      // -30%
+    fill(&base.Series[3], "BM_Few", 1000.0, 5.0, 3);
+    fill(&cur.Series[3],  "BM_Few", 2000.0, 5.0, 3);       // 표본 부족
+    fill(&base.Series[4], "BM_Gone", 1000.0, 5.0, 10);
+    fill(&cur.Series[4],  "BM_New", 1000.0, 5.0, 10);
+
+    AdasBenchCompare_t r[8];
+    int n = AdasBench_Compare(&base, &cur, 0.01, 5.0, r, 8);
+    ASSERT_EQ(n, 6);
+    EXPECT_EQ(r[0].Verdict, ADAS_BENCH_REGRESSION);
+    EXPECT_NEAR(r[0].Delta_Pct, 20.0, 1.0);
+    EXPECT_LT(r[0].P_Slower, 0.01);
+    EXPECT_EQ(r[1].Verdict, ADAS_BENCH_SAME);
+    EXPECT_EQ(r[2].Verdict, ADAS_BENCH_IMPROVEMENT);
+    EXPECT_EQ(r[3].Verdict, ADAS_BENCH_INSUFFICIENT);
+    EXPECT_EQ(r[4].Verdict, ADAS_BENCH_MISSING);
+    EXPECT_STREQ(r[4].Name, "BM_Gone");
+    EXPECT_EQ(r[5].Verdict, ADAS_BENCH_MISSING);
+    EXPECT_STREQ(r[5].Name, "BM_New");
+    EXPECT_STREQ(AdasBench_VerdictName(ADAS_BENCH_REGRESSION), "REGRESSION");
+
+    // 임계값 낮추면 +2% 도 회귀 (표본이 완전히 분리되어 유의)
+    AdasBench_CompareSeries(&base.Series[1], &cur.Series[1], 0.01, 1.0, &r[0]);
+    EXPECT_EQ(r[0].Verdict, ADAS_BENCH_REGRESSION);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+// adas_math_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+extern "C" {
+  #include "adas_math.h"
+}
+
+/*
+테스트 항목:
+1. 각도 정규화: 기존 while 루프 결과와 동일, 큰 입력/Inf에서도 즉시 반환
+2. atan: 전 구간 최대 오차 ADAS_MATH_ATAN_MAX_ERR 이내
+3. sin/cos: |x| <= ADAS_MATH_TRIG_EXACT_LIMIT 에서 최대 오차 ADAS_MATH_SINCOS_MAX_ERR 이내
+4. 배치(SIMD) 결과 = 스칼라 결과
+*/
+
+static float WrapByLoop(float hdg)
+{
+    while (hdg > 180.0f)  hdg -= 360.0f;
+    while (hdg < -180.0f) hdg += 360.0f;
+    return hdg;
+}
+
+// Test 1: 정규화
+TEST(AdasMathTest, WrapDeg180) {
+    for (float d = -1080.0f; d <= 1080.0f; d += 0.37f) {
+        float w = AdasMath_WrapDeg180(d);
+        EXPECT_LE(std::fabs(w), 180.0f);
+        /* ±180 경계는 어느 쪽도 유효 */
+        float diff = std::fabs(w - WrapByLoop(d));
+        EXPECT_TRUE(diff < 1e-3f || std::fabs(diff - 360.0f) < 1e-3f) << "d=" << d;
+    }
+
+    /* 반복 루프였다면 수백만 회 / 무한 루프가 되는 입력 */
+    EXPECT_NEAR(AdasMath_WrapDeg180(720000.0f + 90.0f), 90.0f, 1e-2f);
+    EXPECT_LE(std::fabs(AdasMath_WrapDeg180(-ADAS_MATH_WRAP_EXACT_LIMIT)), 180.0f);
+    EXPECT_TRUE(std::isnan(AdasMath_WrapDeg180(INFINITY)));
+}
+
+// Test 2: atan 오차
+TEST(AdasMathTest, AtanMaxError) {
+    double maxErr = 0.0;
+    for (double x = -100.0; x <= 100.0; x += 0.001) {
+        maxErr = std::fmax(maxErr, std::fabs(AdasMath_AtanF((float)x) - std::atan((double)(float)x)));
+    }
+    std::cout << "[AtanMaxError] maxErr=" << maxErr << "\n";
+    EXPECT_LE(maxErr, ADAS_MATH_ATAN_MAX_ERR);
+    EXPECT_NEAR(AdasMath_AtanF(INFINITY),  ADAS_MATH_HALF_PI, 1e-6f);
+    EXPECT_NEAR(AdasMath_AtanF(-1.0e30f), -ADAS_MATH_HALF_PI, 1e-6f);
+}
+
+// Test 3: sin/cos 오차
+TEST(AdasMathTest, SinCosMaxError) {
+    double maxErr = 0.0;
+    for (double x = -ADAS_MATH_TRIG_EXACT_LIMIT; x <= ADAS_MATH_TRIG_EXACT_LIMIT; x += 0.0137) {
+        float  xf = (float)x;
+        float  s, c;
+        AdasMath_SinCosF(xf, &s, &c);
+        maxErr = std::fmax(maxErr, std::fabs(s - std::sin((double)xf)));
+        maxErr = std::fmax(maxErr, std::fabs(c - std::cos((double)xf)));
+    }
+    std::cout << "[SinCosMaxError] maxErr=" << maxErr << "\n";
+    EXPECT_LE(maxErr, ADAS_MATH_SINCOS_MAX_ERR);
+
+    /* 범위 밖 / NaN: 유한 값 반환 */
+    EXPECT_TRUE(std::isfinite(AdasMath_CosF(1.0e30f)));
+    EXPECT_TRUE(std::isfinite(AdasMath_SinF(NAN)));
+}
+
+// Test 4: 배치 = 스칼라
+TEST(AdasMathTest, BatchMatchesScalar) {
+    std::vector<float> in;
+    for (int i = 0; i < 1003; i++) {
+        in.push_back((i - 501) * 0.731f);
+    }
+    const int n = (int)in.size();
+    std::vector<float> w(n), a(n), s(n), c(n);
+
+    AdasMath_WrapDeg180_Batch(in.data(), w.data(), n);
+    AdasMath_AtanF_Batch(in.data(), a.data(), n);
+    AdasMath_SinCosF_Batch(in.data(), s.data(), c.data(), n);
+
+    for (int i = 0; i < n; i++) {
+        float ss, cc;
+        AdasMath_SinCosF(in[i], &ss, &cc);
+        EXPECT_NEAR(w[i], AdasMath_WrapDeg180(in[i]), 1e-4f);
+        EXPECT_NEAR(a[i], AdasMath_AtanF(in[i]), 1e-6f);
+        EXPECT_NEAR(s[i], ss, 1e-6f);
+        EXPECT_NEAR(c[i], cc, 1e-6f);
+    }
+
+    /* in-place */
+    std::vector<float> ip = in;
+    AdasMath_WrapDeg180_Batch(ip.data(), ip.data(), n);
+    EXPECT_NEAR(ip[7], w[7], 1e-6f);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
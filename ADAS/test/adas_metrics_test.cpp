@@ -0,0 +1,215 @@
+// adas_metrics_test.cpp
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+extern "C" {
+  #include "adas_metrics.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 버킷 계산: 값이 자기 버킷 [하한, 상한] 안, 버킷 폭 / 하한 <= 1/32, 버킷 번호 단조 증가, 최대값 초과는 마지막 버킷
+2. 백분위수/요약: 알려진 분포에서 p50/p99/p99.99/최대/평균이 버킷 오차 안, 빈 히스토그램은 0
+3. 찢김 없는 복사: 기록 스레드가 계속 기록하는 동안 Snapshot 한 복사본의 Count = 버킷 합, Sum/Max 일관
+4. 런타임 연결: 7단계 + 파이프라인 + Target 내부 3단계 + 기상 지연/완료 시간 Count = 주기 수, 해제 후에는 기록 안 됨
+5. 인스턴스별 대상: 두 파이프라인을 동시에 실행해도 Target 내부 단계는 각자 지정한 대상에만 기록
+*/
+
+static uint64_t bucket_sum(const AdasLatencyHist_t *pHist) {
+    uint64_t n = 0;
+    for (uint32_t b = 0; b < ADAS_HIST_BUCKETS; b++) n += pHist->Buckets[b];
+    return n;
+}
+
+// Test 1: 버킷 계산
+TEST(AdasMetricsTest, BucketMappingBoundsRelativeError) {
+    uint32_t prev = 0;
+    for (uint64_t v = 0; v < (1ULL << 22); v += 1 + (v >> 6)) {
+        uint32_t b = AdasHist_BucketOf(v);
+        ASSERT_LT(b, ADAS_HIST_BUCKETS);
+        ASSERT_GE(b, prev) << "v=" << v;
+        ASSERT_LE(AdasHist_BucketLow(b), v);
+        ASSERT_GE(AdasHist_BucketHigh(b), v);
+        prev = b;
+    }
+
+    for (uint32_t b = 2 * ADAS_HIST_SUB_COUNT; b < ADAS_HIST_BUCKETS; b++) {
+        uint64_t lo = AdasHist_BucketLow(b);
+        uint64_t hi = AdasHist_BucketHigh(b);
+        EXPECT_EQ(AdasHist_BucketOf(lo), b);
+        EXPECT_EQ(AdasHist_BucketOf(hi), b);
+        EXPECT_LE((double)(hi - lo + 1) / (double)lo, 1.0 / ADAS_HIST_SUB_COUNT + 1e-12);
+        EXPECT_EQ(AdasHist_BucketLow(b), AdasHist_BucketHigh(b - 1) + 1);
+    }
+
+    EXPECT_EQ(AdasHist_BucketOf(ADAS_HIST_MAX_VALUE), ADAS_HIST_BUCKETS - 1);
+    EXPECT_EQ(AdasHist_BucketOf(UINT64_MAX), ADAS_HIST_BUCKETS - 1);
+    EXPECT_EQ(AdasHist_BucketHigh(ADAS_HIST_BUCKETS - 1), ADAS_HIST_MAX_VALUE);
+}
+
+// Test 2: 백분위수/요약
+TEST(AdasMetricsTest, PercentilesAndSummary) {
+    static AdasLatencyHist_t hist;
+    AdasHist_Reset(&hist);
+
+    AdasLatencySummary_t s;
+    AdasHist_Summarize(&hist, &s);
+    EXPECT_EQ(s.Count, 0u);
+    EXPECT_EQ(AdasHist_Percentile(&hist, 99.0), 0u);
+
+    // 1 ~ 100000 ns 균등 + 꼬리 1개 (5ms)
+    uint64_t sum = 0;
+    for (uint64_t v = 1; v <= 100000; v++) {
+        AdasHist_Record(&hist, v);
+        sum += v;
+    }
+    AdasHist_Record(&hist, 5000000);
+    sum += 5000000;
+
+    AdasHist_Summarize(&hist, &s);
+    EXPECT_EQ(s.Count, 100001u);
+    EXPECT_EQ(s.Min_Ns, 1u);
+    EXPECT_EQ(s.Max_Ns, 5000000u);
+    EXPECT_DOUBLE_EQ(s.Mean_Ns, (double)sum / 100001.0);
+
+    const double tol = 1.0 / ADAS_HIST_SUB_COUNT;
+    EXPECT_NEAR((double)s.P50_Ns, 50001.0, 50001.0 * tol);
+    EXPECT_NEAR((double)s.P99_Ns, 99001.0, 99001.0 * tol);
+    EXPECT_GE(s.P50_Ns, 50001u);              // 버킷 상한 -> 과소 추정 없음
+    EXPECT_GE(s.P9999_Ns, 99991u);
+    EXPECT_LE(s.P9999_Ns, 100000u + (uint64_t)(100000 * tol));
+    EXPECT_EQ(AdasHist_Percentile(&hist, 100.0), 5000000u);
+
+    AdasHist_Reset(&hist);
+    EXPECT_EQ(hist.Count, 0u);
+    EXPECT_EQ(bucket_sum(&hist), 0u);
+    EXPECT_EQ(hist.Seq & 1u, 0u);
+}
+
+// Test 3: 찢김 없는 복사 (기록 스레드 1개 + 진단 스레드)
+TEST(AdasMetricsTest, SnapshotNeverTorn) {
+    static AdasLatencyHist_t hist;
+    static AdasLatencyHist_t snap;
+    AdasHist_Reset(&hist);
+
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        uint64_t v = 1;
+        while (!stop.load(std::memory_order_relaxed)) {
+            AdasHist_Record(&hist, v);
+            v = (v * 7 + 13) % 1000003;
+        }
+    });
+
+    int ok = 0;
+    uint64_t prevCount = 0;
+    const uint64_t deadline = AdasTime_NowNs() + 300 * ADAS_NS_PER_MS;
+    while (AdasTime_NowNs() < deadline) {
+        if (AdasHist_Snapshot(&hist, &snap) != 0) continue;
+        ok++;
+        ASSERT_EQ(snap.Seq & 1u, 0u);
+        ASSERT_EQ(snap.Count, bucket_sum(&snap));
+        ASSERT_GE(snap.Count, prevCount);
+        if (snap.Count > 0) {
+            ASSERT_LE(snap.Min_Ns, snap.Max_Ns);
+            ASSERT_LE(snap.Sum_Ns, snap.Count * snap.Max_Ns);
+            ASSERT_GE(snap.Sum_Ns, snap.Count * snap.Min_Ns);
+            ASSERT_LE(AdasHist_Percentile(&snap, 99.99), snap.Max_Ns);
+        }
+        prevCount = snap.Count;
+    }
+    stop = true;
+    writer.join();
+
+    EXPECT_GT(ok, 0);
+    ASSERT_EQ(AdasHist_Snapshot(&hist, &snap), 0);
+    EXPECT_EQ(snap.Count, bucket_sum(&snap));
+    EXPECT_EQ(AdasHist_Snapshot(nullptr, &snap), -1);
+}
+
+// Test 4: 런타임 연결
+TEST(AdasMetricsTest, RuntimeRecordsEveryStage) {
+    static AdasRuntime_t rt;
+    static AdasMetrics_t metrics;
+    static AdasMetrics_t snap;
+    AdasMetrics_Init(&metrics);
+
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 40;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, NULL, NULL, NULL), 0);
+    AdasRuntime_SetMetrics(&rt, &metrics);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+
+    ASSERT_EQ(AdasMetrics_Snapshot(&metrics, &snap), 0);
+    for (int m = 0; m < ADAS_METRIC_COUNT; m++) {
+        EXPECT_EQ(snap.Hist[m].Count, 40u) << AdasMetrics_Name((AdasMetric_e)m);
+        EXPECT_EQ(bucket_sum(&snap.Hist[m]), 40u);
+    }
+    // 파이프라인 전체 >= 각 단계, Target 내부 단계 <= Target 전체
+    for (int s = 0; s < ADAS_STAGE_COUNT; s++)
+        EXPECT_GE(snap.Hist[ADAS_METRIC_PIPELINE].Sum_Ns, snap.Hist[s].Sum_Ns);
+    EXPECT_LE(snap.Hist[ADAS_METRIC_TARGET_FILTER].Sum_Ns, snap.Hist[ADAS_METRIC_TARGET].Sum_Ns);
+    // 완료 시간(release 기준) >= 기상 지연 + 파이프라인, 마감 초과 없으면 주기 이하
+    EXPECT_GE(snap.Hist[ADAS_METRIC_RESPONSE].Sum_Ns,
+              snap.Hist[ADAS_METRIC_WAKE].Sum_Ns + snap.Hist[ADAS_METRIC_PIPELINE].Sum_Ns);
+    if (rt.Stats.Deadline_Misses == 0) {
+        EXPECT_LE(snap.Hist[ADAS_METRIC_RESPONSE].Max_Ns, cfg.Period_Ns);
+    }
+    EXPECT_STREQ(AdasMetrics_Name(ADAS_METRIC_TARGET_PREDICT), "tgt_predict");
+    EXPECT_STREQ(AdasMetrics_Name(ADAS_METRIC_COUNT), "?");
+
+    // 해제 후에는 Target 내부 단계도 기록 안 됨
+    AdasRuntime_SetMetrics(&rt, NULL);
+    rt.Config.Cycle_Limit = 50;
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    EXPECT_EQ(metrics.Hist[ADAS_METRIC_TARGET_SELECT].Count, 40u);
+    EXPECT_EQ(metrics.Hist[ADAS_METRIC_PIPELINE].Count, 40u);
+
+    AdasRuntime_Destroy(&rt);
+}
+
+// Test 5: 인스턴스별 대상
+TEST(AdasMetricsTest, PerPipelineTargetSink) {
+    static AdasPipeline_t pA, pB, pC;
+    static AdasMetrics_t  mA, mB;
+    AdasMetrics_Init(&mA);
+    AdasMetrics_Init(&mB);
+    ASSERT_EQ(AdasPipeline_Init(&pA, 0.01f), 0);
+    ASSERT_EQ(AdasPipeline_Init(&pB, 0.01f), 0);
+    ASSERT_EQ(AdasPipeline_Init(&pC, 0.01f), 0);
+    EXPECT_EQ(pA.pMetrics, nullptr);   // 기본 = 기록 안 함
+    AdasPipeline_SetMetrics(&pA, &mA);
+    AdasPipeline_SetMetrics(&pB, &mB);
+
+    auto run = [](AdasPipeline_t *pPipe, int cycles) {
+        AdasFrameInput_t  in  = {};
+        AdasFrameOutput_t out = {};
+        for (int k = 1; k <= cycles; k++) {
+            in.Time.Current_Time = 10.0f * (float)k;
+            AdasPipeline_Step(pPipe, &in, &out);
+        }
+    };
+    std::thread tA(run, &pA, 30);
+    std::thread tB(run, &pB, 70);
+    std::thread tC(run, &pC, 50);
+    tA.join();
+    tB.join();
+    tC.join();
+
+    for (int m = ADAS_METRIC_TARGET_FILTER; m <= ADAS_METRIC_TARGET_SELECT; m++) {
+        EXPECT_EQ(mA.Hist[m].Count, 30u) << AdasMetrics_Name((AdasMetric_e)m);
+        EXPECT_EQ(mB.Hist[m].Count, 70u) << AdasMetrics_Name((AdasMetric_e)m);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+// adas_perf_test.cpp
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+extern "C" {
+  #include "adas_perf.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 단계 누적: 전/후 차이의 합계/최대, 계수 시간이 늘지 않은 구간은 버림, 다중화 구간 계수
+2. 카운터 읽기: 열린 카운터는 단조 증가, 새 메모리 접근 시 page fault 증가 (사용 불가 환경은 건너뜀)
+3. 사용 불가: 열지 않은 상태에서 Read 실패, 런타임은 그대로 동작하고 누적 없음
+4. 런타임 연결: 순차 실행에서 단계마다 주기 수만큼 표본 (사용 불가 환경은 건너뜀)
+5. 문맥 전환: sleep 으로 CPU 를 내주면 ctx_switches 증가 (커널 모드 이벤트라 계수되어야 함)
+*/
+
+// Test 1: 단계 누적
+TEST(AdasPerfTest, AddStageAccumulatesDeltas) {
+    static AdasPerf_t perf;
+    std::memset(&perf, 0, sizeof(perf));
+
+    AdasPerfSample_t a = {}, b = {};
+    a.Time_Enabled = 100; a.Time_Running = 100;
+    b.Time_Enabled = 200; b.Time_Running = 200;
+    a.Value[ADAS_PERF_CYCLES] = 1000; b.Value[ADAS_PERF_CYCLES] = 1500;
+    a.Value[ADAS_PERF_INSTRUCTIONS] = 10; b.Value[ADAS_PERF_INSTRUCTIONS] = 810;
+    AdasPerf_AddStage(&perf, ADAS_STAGE_TARGET, &a, &b);
+
+    AdasPerfSample_t c = b;
+    c.Time_Enabled = 400; c.Time_Running = 300;           // 다중화
+    c.Value[ADAS_PERF_CYCLES] = 1700;
+    AdasPerf_AddStage(&perf, ADAS_STAGE_TARGET, &b, &c);
+
+    AdasPerf_AddStage(&perf, ADAS_STAGE_TARGET, &c, &c);  // 계수 안 됨 -> 버림
+    AdasPerf_AddStage(&perf, ADAS_STAGE_COUNT, &a, &b);   // 범위 밖 -> 무시
+
+    const AdasPerfStageStats_t &st = perf.Stage[ADAS_STAGE_TARGET];
+    EXPECT_EQ(st.Samples, 2u);
+    EXPECT_EQ(st.Total[ADAS_PERF_CYCLES], 700u);
+    EXPECT_EQ(st.Max[ADAS_PERF_CYCLES], 500u);
+    EXPECT_EQ(st.Total[ADAS_PERF_INSTRUCTIONS], 800u);
+    EXPECT_EQ(perf.Multiplexed, 1u);
+    EXPECT_EQ(perf.Not_Running, 1u);
+
+    AdasPerf_Reset(&perf);
+    EXPECT_EQ(perf.Stage[ADAS_STAGE_TARGET].Samples, 0u);
+    EXPECT_EQ(perf.Multiplexed, 0u);
+    EXPECT_STREQ(AdasPerf_CounterName(ADAS_PERF_BRANCH_MISS), "branch_miss");
+    EXPECT_STREQ(AdasPerf_CounterName(ADAS_PERF_COUNTER_COUNT), "?");
+}
+
+// Test 2: 카운터 읽기
+TEST(AdasPerfTest, OpenedCountersAreMonotonic) {
+    static AdasPerf_t perf;
+    int opened = AdasPerf_Open(&perf);
+    ASSERT_GE(opened, 0);
+    if (opened == 0) GTEST_SKIP() << "perf_event_open unavailable";
+
+    AdasPerfSample_t s0, s1;
+    ASSERT_EQ(AdasPerf_Read(&perf, &s0), 0);
+
+    const size_t bytes = 64u * 4096u;
+    volatile char *p = (volatile char *)std::malloc(bytes);
+    ASSERT_NE(p, nullptr);
+    for (size_t i = 0; i < bytes; i += 4096) p[i] = (char)i;
+    std::free((void *)p);
+
+    ASSERT_EQ(AdasPerf_Read(&perf, &s1), 0);
+    EXPECT_GE(s1.Time_Enabled, s0.Time_Enabled);
+    for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++) {
+        if (!AdasPerf_IsAvailable(&perf, (AdasPerfCounter_e)c)) {
+            EXPECT_EQ(s1.Value[c], 0u);
+            continue;
+        }
+        EXPECT_GE(s1.Value[c], s0.Value[c]) << AdasPerf_CounterName((AdasPerfCounter_e)c);
+    }
+    if (AdasPerf_IsAvailable(&perf, ADAS_PERF_PAGE_FAULTS)) {
+        EXPECT_GT(s1.Value[ADAS_PERF_PAGE_FAULTS], s0.Value[ADAS_PERF_PAGE_FAULTS]);
+    }
+    if (AdasPerf_IsAvailable(&perf, ADAS_PERF_INSTRUCTIONS)) {
+        EXPECT_GT(s1.Value[ADAS_PERF_INSTRUCTIONS], s0.Value[ADAS_PERF_INSTRUCTIONS]);
+    }
+
+    AdasPerf_Close(&perf);
+    AdasPerf_Close(&perf);   // 중복 호출
+    EXPECT_EQ(AdasPerf_Read(&perf, &s1), -1);
+}
+
+// Test 3: 사용 불가 -> 런타임 그대로
+TEST(AdasPerfTest, UnavailableDegradesGracefully) {
+    static AdasRuntime_t rt;
+    static AdasPerf_t perf;
+    std::memset(&perf, 0, sizeof(perf));
+    perf.Leader_Fd = -1;
+    for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++) perf.Fd[c] = -1;
+
+    AdasPerfSample_t s;
+    EXPECT_EQ(AdasPerf_Read(&perf, &s), -1);
+    EXPECT_EQ(AdasPerf_Open(nullptr), -1);
+    EXPECT_EQ(AdasPerf_IsAvailable(&perf, ADAS_PERF_CYCLES), 0);
+
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 10;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, NULL, NULL, NULL), 0);
+    AdasRuntime_SetPerf(&rt, &perf);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    EXPECT_EQ(rt.Stats.Cycles, 10u);
+    for (int st = 0; st < ADAS_STAGE_COUNT; st++)
+        EXPECT_EQ(perf.Stage[st].Samples, 0u);
+    AdasRuntime_Destroy(&rt);
+}
+
+// Test 4: 런타임 연결
+TEST(AdasPerfTest, RuntimeAttributesEveryStage) {
+    static AdasRuntime_t rt;
+    static AdasPerf_t perf;
+    if (AdasPerf_Open(&perf) == 0) GTEST_SKIP() << "perf_event_open unavailable";
+
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 20;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, NULL, NULL, NULL), 0);
+    AdasRuntime_SetPerf(&rt, &perf);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+
+    uint64_t samples = 0;
+    for (int st = 0; st < ADAS_STAGE_COUNT; st++) {
+        EXPECT_LE(perf.Stage[st].Samples, 20u) << AdasPipeline_StageName((AdasStage_e)st);
+        samples += perf.Stage[st].Samples;
+        for (int c = 0; c < ADAS_PERF_COUNTER_COUNT; c++)
+            EXPECT_LE(perf.Stage[st].Max[c], perf.Stage[st].Total[c]);
+    }
+    EXPECT_EQ(samples + perf.Not_Running, 20u * ADAS_STAGE_COUNT);
+    if (AdasPerf_IsAvailable(&perf, ADAS_PERF_INSTRUCTIONS)) {
+        EXPECT_GT(perf.Stage[ADAS_STAGE_TARGET].Total[ADAS_PERF_INSTRUCTIONS], 0u);
+    }
+
+    AdasPerf_Close(&perf);
+    AdasRuntime_Destroy(&rt);
+}
+
+// Test 5: 문맥 전환 계수
+TEST(AdasPerfTest, SleepCountsContextSwitches) {
+    static AdasPerf_t perf;
+    if (AdasPerf_Open(&perf) == 0) GTEST_SKIP() << "perf_event_open unavailable";
+    if (!AdasPerf_IsAvailable(&perf, ADAS_PERF_CTX_SWITCHES)) {
+        AdasPerf_Close(&perf);
+        GTEST_SKIP() << "ctx_switches unavailable";
+    }
+
+    AdasPerfSample_t s0, s1;
+    ASSERT_EQ(AdasPerf_Read(&perf, &s0), 0);
+    const struct timespec ts = { 0, 200 * 1000 };   // 200 µs
+    for (int i = 0; i < 10; i++) nanosleep(&ts, nullptr);
+    ASSERT_EQ(AdasPerf_Read(&perf, &s1), 0);
+
+    // sleep 마다 최소 1회 전환
+    EXPECT_GE(s1.Value[ADAS_PERF_CTX_SWITCHES] - s0.Value[ADAS_PERF_CTX_SWITCHES], 10u);
+    AdasPerf_Close(&perf);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
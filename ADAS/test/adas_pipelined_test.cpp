@@ -0,0 +1,178 @@
+// adas_pipelined_test.cpp
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <thread>
+
+extern "C" {
+  #include "adas_pipelined.h"
+  #include "triple_buffer.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 3중 버퍼: 게시 전 Acquire 없음, 여러 번 게시 시 최신값만 수신, 읽기 슬롯 보호
+2. 3중 버퍼 동시 실행: 소비자가 받은 슬롯은 항상 일관(찢어지지 않음) + 순번 단조 증가
+3. 파이프라인 모드: 게시 = 처리 + 유실, 제어 결과 = 순차 실행 결과 (유실 없을 때)
+4. 입력 콜백 종료 / 쉬지 않는(free-run) 모드 종료
+*/
+
+struct Payload {
+    uint64_t Seq;
+    uint64_t Words[32];
+};
+
+static void FillInput(AdasFrameInput_t *pIn)
+{
+    float now = pIn->Time.Current_Time;
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Time.Current_Time   = now;
+    pIn->Gps.GPS_Timestamp   = now;
+    pIn->Gps.GPS_Velocity_X  = 20.0f;
+    pIn->Lane.Lane_Width     = 3.5f;
+    pIn->Object_Count        = 1;
+    pIn->Objects[0].Object_ID     = 1;
+    pIn->Objects[0].Position_X    = 40.0f;
+    pIn->Objects[0].Distance      = 40.0f;
+    pIn->Objects[0].Velocity_X    = 18.0f;
+    pIn->Objects[0].Object_Status = OBJSTAT_MOVING;
+}
+
+static int TestInput(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    (void)pUser; (void)cycle;
+    FillInput(pIn);
+    return 0;
+}
+
+static int StopAtSeven(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    (void)pUser;
+    FillInput(pIn);
+    return (cycle >= 7) ? -1 : 0;
+}
+
+// Test 1: 3중 버퍼 기본 동작
+TEST(TripleBufferTest, LatestValueSemantics) {
+    Payload slots[TRIPLE_BUFFER_SLOTS] = {};
+    TripleBuffer_t tb;
+    ASSERT_EQ(TripleBuffer_Init(&tb, slots, sizeof(Payload)), 0);
+    EXPECT_EQ(TripleBuffer_Init(&tb, NULL, sizeof(Payload)), -1);
+
+    EXPECT_EQ(TripleBuffer_Acquire(&tb), 0);
+
+    for (uint64_t s = 1; s <= 3; s++) {
+        ((Payload *)TripleBuffer_WriteSlot(&tb))->Seq = s;
+        TripleBuffer_Publish(&tb);
+    }
+    EXPECT_EQ(TripleBuffer_HasFresh(&tb), 1);
+    ASSERT_EQ(TripleBuffer_Acquire(&tb), 1);
+    Payload *pRead = (Payload *)TripleBuffer_ReadSlot(&tb);
+    EXPECT_EQ(pRead->Seq, 3u);
+    EXPECT_EQ(TripleBuffer_Acquire(&tb), 0);
+
+    // 소비자가 읽는 동안 생산자가 계속 게시해도 읽기 슬롯은 그대로
+    for (uint64_t s = 4; s <= 10; s++) {
+        EXPECT_NE(TripleBuffer_WriteSlot(&tb), (void *)pRead);
+        ((Payload *)TripleBuffer_WriteSlot(&tb))->Seq = s;
+        TripleBuffer_Publish(&tb);
+    }
+    EXPECT_EQ(pRead->Seq, 3u);
+    ASSERT_EQ(TripleBuffer_Acquire(&tb), 1);
+    EXPECT_EQ(((Payload *)TripleBuffer_ReadSlot(&tb))->Seq, 10u);
+}
+
+// Test 2: 동시 생산/소비
+TEST(TripleBufferTest, ConcurrentConsistency) {
+    static Payload slots[TRIPLE_BUFFER_SLOTS];
+    TripleBuffer_t tb;
+    ASSERT_EQ(TripleBuffer_Init(&tb, slots, sizeof(Payload)), 0);
+
+    const uint64_t N = 200000;
+    std::thread producer([&] {
+        for (uint64_t s = 1; s <= N; s++) {
+            Payload *p = (Payload *)TripleBuffer_WriteSlot(&tb);
+            p->Seq = s;
+            for (auto &w : p->Words) w = s;
+            TripleBuffer_Publish(&tb);
+        }
+    });
+
+    uint64_t last = 0, received = 0, torn = 0;
+    while (last < N) {
+        if (!TripleBuffer_Acquire(&tb)) { std::this_thread::yield(); continue; }
+        const Payload *p = (const Payload *)TripleBuffer_ReadSlot(&tb);
+        for (auto w : p->Words) torn += (w != p->Seq);
+        EXPECT_GT(p->Seq, last);
+        last = p->Seq;
+        received++;
+    }
+    producer.join();
+
+    EXPECT_EQ(torn, 0u);
+    EXPECT_EQ(last, N);
+    EXPECT_GE(received, 1u);
+}
+
+// Test 3: 파이프라인 모드 vs 순차 실행
+TEST(AdasPipelinedTest, MatchesSequentialPipeline) {
+    static AdasPipelined_t pl;
+    AdasPipelinedConfig_t cfg;
+    AdasPipelined_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 2 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 20;
+
+    ASSERT_EQ(AdasPipelined_Init(&pl, &cfg, TestInput, NULL, NULL), 0);
+    ASSERT_EQ(AdasPipelined_Run(&pl), 0);
+
+    const AdasPipelinedStats_t *pSt = &pl.Stats;
+    EXPECT_EQ(pSt->Frames_Published, 20u);
+    EXPECT_EQ(pSt->Frames_Processed + pSt->Frames_Dropped, pSt->Frames_Published);
+    EXPECT_GE(pSt->Latency_Max_Ns, pSt->Handoff_Max_Ns);
+    EXPECT_EQ(pl.Output.Acc_Target.ACC_Target_ID, 1);
+
+    if (pSt->Frames_Dropped == 0) {
+        static AdasPipeline_t    seq;
+        static AdasFrameInput_t  in;
+        static AdasFrameOutput_t out;
+        memset(&in, 0, sizeof(in));
+        memset(&out, 0, sizeof(out));
+        ASSERT_EQ(AdasPipeline_Init(&seq, 0.002f), 0);
+        for (int k = 0; k < 20; k++) {
+            in.Time.Current_Time = 2.0f * k;
+            FillInput(&in);
+            AdasPipeline_Step(&seq, &in, &out);
+        }
+        EXPECT_FLOAT_EQ(pl.Output.Accel_Acc, out.Accel_Acc);
+        EXPECT_FLOAT_EQ(pl.Output.Control.throttle, out.Control.throttle);
+        EXPECT_FLOAT_EQ(pl.Output.Control.brake, out.Control.brake);
+    }
+    AdasPipelined_PrintStats(&pl);
+}
+
+// Test 4: 입력 콜백 종료 + free-run
+TEST(AdasPipelinedTest, StopAndFreeRun) {
+    static AdasPipelined_t pl;
+    AdasPipelinedConfig_t cfg;
+    AdasPipelined_DefaultConfig(&cfg);
+    cfg.Period_Ns = 1 * ADAS_NS_PER_MS;
+
+    ASSERT_EQ(AdasPipelined_Init(&pl, &cfg, StopAtSeven, NULL, NULL), 0);
+    ASSERT_EQ(AdasPipelined_Run(&pl), 0);
+    EXPECT_EQ(pl.Stats.Frames_Published, 7u);
+    EXPECT_GE(pl.Stats.Frames_Processed, 1u);
+
+    cfg.Period_Ns   = 0;
+    cfg.Cycle_Limit = 500;
+    ASSERT_EQ(AdasPipelined_Init(&pl, &cfg, TestInput, NULL, NULL), 0);
+    ASSERT_EQ(AdasPipelined_Run(&pl), 0);
+    EXPECT_EQ(pl.Stats.Frames_Published, 500u);
+    EXPECT_EQ(pl.Stats.Frames_Processed + pl.Stats.Frames_Dropped, 500u);
+    EXPECT_EQ(pl.Stats.Deadline_Misses, 0u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
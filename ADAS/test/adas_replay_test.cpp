@@ -0,0 +1,224 @@
+// adas_replay_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+extern "C" {
+  #include "adas_replay.h"
+  #include "cycle_log.h"
+}
+
+/*
+테스트 항목:
+1. 설정 검사: 스레드 수/경계 0 은 인자 오류, 빈 로그는 0 레코드
+2. 순차 재생: 기록과 비트 단위 일치, 처리량 계측
+3. 구간 병렬 재생: 경계 단위 분할, 워밍업이 충분하면 전 구간 일치, 첫 구간은 항상 일치,
+   스냅샷 로그는 워밍업 없이 경계에서 복원 -> 전 구간 일치
+4. 불일치 검출: 제어 주기 변경 -> 제어 항목 불일치, 변조 레코드 -> 해당 번호/항목 보고
+*/
+
+static const int   kRecords = 1200;
+static const float kDt      = 0.01f;
+
+static std::string log_path(const char *tag) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "/tmp/adas_replay_%s_%d.bin", tag, (int)getpid());
+    return buf;
+}
+
+// 선행차 접근 + 곡률 변화 시나리오를 실행하며 기록 (tamperIdx 레코드는 조향 변조)
+static void record_scenario(const std::string &path, int tamperIdx = -1, uint32_t snapEvery = 0) {
+    static AdasFrameInput_t in;
+    static AdasFrameOutput_t out;
+    AdasPipeline_t pipe;
+    AdasCycleLog_t log;
+
+    memset(&in, 0, sizeof(in));
+    memset(&out, 0, sizeof(out));
+    ASSERT_EQ(AdasPipeline_Init(&pipe, kDt), 0);
+    ASSERT_EQ(AdasCycleLog_Create(&log, path.c_str(), kRecords, snapEvery), 0);
+
+    for (int k = 0; k < kRecords; k++) {
+        float t = k * kDt;
+        in.Time.Current_Time = t * 1000.0f;
+        in.Gps.GPS_Velocity_X = 20.0f + 2.0f * sinf(0.5f * t);
+        in.Gps.GPS_Timestamp = in.Time.Current_Time;
+        in.Imu.Linear_Acceleration_X = cosf(0.5f * t);
+        in.Imu.Yaw_Rate = 0.02f * sinf(0.3f * t);
+        in.Lane.Lane_Type = LANE_TYPE_STRAIGHT;
+        in.Lane.Lane_Width = 3.5f;
+        in.Lane.Lane_Offset = 0.3f * sinf(0.7f * t);
+        in.Lane.Lane_Curvature = 0.001f * sinf(0.2f * t);
+        in.Object_Count = 1;
+        in.Objects[0].Object_ID = 1;
+        in.Objects[0].Object_Type = OBJTYPE_CAR;
+        in.Objects[0].Object_Status = OBJSTAT_MOVING;
+        in.Objects[0].Distance = 40.0f - fmodf(3.0f * t, 30.0f);
+        in.Objects[0].Position_X = in.Objects[0].Distance;
+        in.Objects[0].Velocity_X = 17.0f;
+
+        AdasPipeline_Step(&pipe, &in, &out);
+        if (k == tamperIdx) {
+            AdasFrameOutput_t bad = out;
+            bad.Control.steer += 0.001f;
+            ASSERT_EQ(AdasCycleLog_Append(&log, (uint64_t)k, &in, &bad, &pipe), 0);
+        } else {
+            ASSERT_EQ(AdasCycleLog_Append(&log, (uint64_t)k, &in, &out, &pipe), 0);
+        }
+    }
+    AdasCycleLog_Close(&log);
+}
+
+static AdasReplayResult_t s_result;
+
+// Test 1: 설정 검사
+TEST(AdasReplayTest, ConfigValidation) {
+    AdasReplayConfig_t cfg;
+    AdasReplay_DefaultConfig(&cfg);
+    EXPECT_EQ(cfg.Thread_Count, 1);
+    EXPECT_FLOAT_EQ(cfg.Delta_Time, 0.01f);
+
+    AdasCycleLog_t empty;
+    std::string path = log_path("empty");
+    ASSERT_EQ(AdasCycleLog_Create(&empty, path.c_str(), 1, 0), 0);
+    AdasCycleLog_Close(&empty);
+    ASSERT_EQ(AdasCycleLog_OpenRead(&empty, path.c_str()), 0);
+
+    EXPECT_EQ(AdasReplay_Run(&empty, &cfg, &s_result), 0);
+    EXPECT_EQ(s_result.Records, 0u);
+    EXPECT_EQ(AdasReplay_Run(NULL, &cfg, &s_result), -1);
+
+    cfg.Thread_Count = 0;
+    EXPECT_EQ(AdasReplay_Run(&empty, &cfg, &s_result), -1);
+    cfg.Thread_Count = 1;
+    cfg.Checkpoint_Interval = 0;
+    EXPECT_EQ(AdasReplay_Run(&empty, &cfg, &s_result), -1);
+
+    AdasCycleLog_Close(&empty);
+    unlink(path.c_str());
+}
+
+// Test 2: 순차 재생 비트 단위 일치
+TEST(AdasReplayTest, SequentialReplayIsBitExact) {
+    std::string path = log_path("seq");
+    record_scenario(path);
+
+    AdasCycleLog_t log;
+    ASSERT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), 0);
+    AdasReplayConfig_t cfg;
+    AdasReplay_DefaultConfig(&cfg);
+
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    EXPECT_EQ(s_result.Shard_Count, 1);
+    EXPECT_EQ(s_result.Records, (uint64_t)kRecords);
+    EXPECT_EQ(s_result.Cycles_Run, (uint64_t)kRecords);
+    EXPECT_EQ(s_result.Mismatches, 0u);
+    EXPECT_EQ(s_result.First_Mismatch, ADAS_REPLAY_NO_MISMATCH);
+    EXPECT_GT(s_result.Cycles_Per_Sec, 0.0);
+    AdasReplay_PrintResult(&s_result);
+
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+}
+
+// Test 3: 구간 병렬 재생
+TEST(AdasReplayTest, ShardedReplayAtCheckpoints) {
+    std::string path = log_path("shard");
+    record_scenario(path);
+
+    AdasCycleLog_t log;
+    ASSERT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), 0);
+    AdasReplayConfig_t cfg;
+    AdasReplay_DefaultConfig(&cfg);
+    cfg.Thread_Count = 4;
+    cfg.Checkpoint_Interval = 250;
+    cfg.Warmup_Cycles = kRecords;   // 모든 구간이 0부터 상태 재구성
+
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    ASSERT_EQ(s_result.Shard_Count, 4);
+    uint64_t covered = 0;
+    for (int k = 0; k < s_result.Shard_Count; k++) {
+        const AdasReplayShard_t *pSh = &s_result.Shards[k];
+        EXPECT_EQ(pSh->First % cfg.Checkpoint_Interval, 0u);
+        EXPECT_EQ(pSh->First, covered);
+        EXPECT_EQ(pSh->Start, 0u);
+        covered = pSh->End;
+    }
+    EXPECT_EQ(covered, (uint64_t)kRecords);
+    EXPECT_GT(s_result.Cycles_Run, (uint64_t)kRecords);
+    EXPECT_EQ(s_result.Mismatches, 0u);
+
+    // 워밍업 없음: 첫 구간은 순차와 동일
+    cfg.Warmup_Cycles = 0;
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    EXPECT_EQ(s_result.Cycles_Run, (uint64_t)kRecords);
+    EXPECT_EQ(s_result.Shards[0].Mismatches, 0u);
+
+    // 스레드 수 > 블록 수 -> 블록 수만큼만 분할
+    cfg.Thread_Count = 16;
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    EXPECT_EQ(s_result.Shard_Count, 5);
+    EXPECT_EQ(s_result.Restored_Shards, 0);
+
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+
+    // 100 레코드마다 스냅샷: 경계 250 -> 300 으로 올림, 워밍업 없이 복원
+    record_scenario(path, -1, 100);
+    ASSERT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), 0);
+    cfg.Thread_Count = 4;
+    cfg.Warmup_Cycles = kRecords;   // 복원 구간에는 쓰이지 않음
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    ASSERT_EQ(s_result.Shard_Count, 4);
+    EXPECT_EQ(s_result.Restored_Shards, 3);
+    for (int k = 1; k < s_result.Shard_Count; k++) {
+        EXPECT_EQ(s_result.Shards[k].First % 300, 0u);
+        EXPECT_EQ(s_result.Shards[k].Start, s_result.Shards[k].First);
+    }
+    EXPECT_EQ(s_result.Cycles_Run, (uint64_t)kRecords);
+    EXPECT_EQ(s_result.Mismatches, 0u);
+    AdasReplay_PrintResult(&s_result);
+
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+}
+
+// Test 4: 불일치 검출
+TEST(AdasReplayTest, DetectsMismatches) {
+    std::string path = log_path("diff");
+    const int tamperIdx = 700;
+    record_scenario(path, tamperIdx);
+
+    AdasCycleLog_t log;
+    ASSERT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), 0);
+    AdasReplayConfig_t cfg;
+    AdasReplay_DefaultConfig(&cfg);
+    cfg.Thread_Count = 2;
+    cfg.Checkpoint_Interval = 100;
+    cfg.Warmup_Cycles = kRecords;
+
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    EXPECT_EQ(s_result.Mismatches, 1u);
+    EXPECT_EQ(s_result.First_Mismatch, (uint64_t)tamperIdx);
+    EXPECT_EQ(s_result.Field_Mismatches[ADAS_REPLAY_FIELD_CONTROL], 1u);
+    EXPECT_EQ(s_result.Field_Mismatches[ADAS_REPLAY_FIELD_EGO], 0u);
+
+    // 제어 주기가 다르면 (= 제어기 변경) 적분 상태가 달라져 불일치
+    cfg.Delta_Time = 0.02f;
+    ASSERT_EQ(AdasReplay_Run(&log, &cfg, &s_result), 0);
+    EXPECT_GT(s_result.Mismatches, 1u);
+    EXPECT_GT(s_result.Field_Mismatches[ADAS_REPLAY_FIELD_CONTROL], 0u);
+    AdasReplay_PrintResult(&s_result);
+
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
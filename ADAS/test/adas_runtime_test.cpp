@@ -0,0 +1,148 @@
+// adas_runtime_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <time.h>
+
+extern "C" {
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 파이프라인: Step 결과 = RunStage 7단계 순차 실행 결과
+2. 고정 주기 루프: Cycle_Limit 만큼 실행, 논리 시각 = cycle * period, 총 소요 시간 ≈ N * period
+3. 단계 예산 초과 / 주기 마감 초과 계측
+4. 입력 콜백 종료 요청 -> 루프 종료
+*/
+
+static void FillInput(AdasFrameInput_t *pIn)
+{
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Gps.GPS_Velocity_X  = 20.0f;
+    pIn->Lane.Lane_Width     = 3.5f;
+    pIn->Object_Count        = 1;
+    pIn->Objects[0].Object_ID     = 1;
+    pIn->Objects[0].Position_X    = 40.0f;
+    pIn->Objects[0].Distance      = 40.0f;
+    pIn->Objects[0].Velocity_X    = 18.0f;
+    pIn->Objects[0].Object_Status = OBJSTAT_MOVING;
+}
+
+static int TestInput(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    float *pTimes = (float *)pUser;
+    float now = pIn->Time.Current_Time;
+    FillInput(pIn);
+    pIn->Time.Current_Time  = now;
+    pIn->Gps.GPS_Timestamp  = now;
+    if (pTimes && cycle < 16) pTimes[cycle] = now;
+    return 0;
+}
+
+static void SlowOutput(void *pUser, uint64_t cycle, const AdasFrameOutput_t *pOut)
+{
+    (void)pUser; (void)pOut;
+    if (cycle == 2) {
+        struct timespec ts = { 0, 3500000 };   /* 3.5 ms */
+        nanosleep(&ts, NULL);
+    }
+}
+
+static int StopAtFive(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    (void)pUser;
+    FillInput(pIn);
+    return (cycle >= 5) ? -1 : 0;
+}
+
+// Test 1: Step = RunStage 순차
+TEST(AdasRuntimeTest, StepMatchesStageSequence) {
+    AdasFrameInput_t in;
+    FillInput(&in);
+    in.Time.Current_Time = 10.0f;
+    in.Gps.GPS_Timestamp = 10.0f;
+
+    static AdasPipeline_t    pA, pB;
+    static AdasFrameOutput_t oA, oB;
+    memset(&oA, 0, sizeof(oA));
+    memset(&oB, 0, sizeof(oB));
+    ASSERT_EQ(AdasPipeline_Init(&pA, 0.01f), 0);
+    ASSERT_EQ(AdasPipeline_Init(&pB, 0.01f), 0);
+
+    ASSERT_EQ(AdasPipeline_Step(&pA, &in, &oA), 0);
+    for (int s = 0; s < ADAS_STAGE_COUNT; s++) {
+        ASSERT_EQ(AdasPipeline_RunStage(&pB, (AdasStage_e)s, &in, &oB), 0);
+    }
+    EXPECT_FLOAT_EQ(oA.Accel_Acc, oB.Accel_Acc);
+    EXPECT_FLOAT_EQ(oA.Control.throttle, oB.Control.throttle);
+    EXPECT_EQ(oA.Acc_Target.ACC_Target_ID, 1);
+    EXPECT_EQ(AdasPipeline_RunStage(&pB, ADAS_STAGE_COUNT, &in, &oB), -1);
+}
+
+// Test 2: 고정 주기
+TEST(AdasRuntimeTest, FixedRateLoop) {
+    static AdasRuntime_t rt;
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 2 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 16;
+
+    float times[16] = {};
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, TestInput, NULL, times), 0);
+
+    uint64_t t0 = AdasTime_NowNs();
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    uint64_t elapsed = AdasTime_NowNs() - t0;
+
+    EXPECT_EQ(rt.Stats.Cycles, 16u);
+    EXPECT_GE(elapsed, 16 * cfg.Period_Ns);
+    // 논리 시각 = release 인덱스 x 주기 (마감 초과로 건너뛴 release 는 그만큼 증가)
+    EXPECT_FLOAT_EQ(times[0], 0.0f);
+    for (int i = 1; i < 16; i++) {
+        float step = times[i] - times[i - 1];
+        EXPECT_GE(step, 2.0f);
+        EXPECT_FLOAT_EQ(fmodf(step, 2.0f), 0.0f);
+    }
+    EXPECT_FLOAT_EQ(times[15], 2.0f * (15 + rt.Stats.Skipped_Periods));
+    std::cout << "[FixedRateLoop] wake max=" << rt.Stats.Wake_Latency_Max_Ns / 1000.0 << " us\n";
+}
+
+// Test 3: 예산 초과 / 마감 초과
+TEST(AdasRuntimeTest, OverrunAndDeadlineMiss) {
+    static AdasRuntime_t rt;
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 6;
+    cfg.Stage_Budget_Ns[ADAS_STAGE_TARGET] = 1;   /* 항상 초과 */
+
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, TestInput, SlowOutput, NULL), 0);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+
+    EXPECT_EQ(rt.Stats.Stage_Overruns[ADAS_STAGE_TARGET], 6u);
+    EXPECT_EQ(rt.Stats.Stage_Overruns[ADAS_STAGE_ACC], 0u);
+    EXPECT_GE(rt.Stats.Deadline_Misses, 1u);
+    EXPECT_GE(rt.Stats.Skipped_Periods, 3u);
+    EXPECT_GE(rt.Stats.Cycle_Max_Ns, 3500000u);
+}
+
+// Test 4: 입력 콜백 종료
+TEST(AdasRuntimeTest, InputCallbackStops) {
+    static AdasRuntime_t rt;
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns = 1 * ADAS_NS_PER_MS;
+
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, StopAtFive, NULL, NULL), 0);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    EXPECT_EQ(rt.Stats.Cycles, 5u);
+    EXPECT_EQ(rt.Stats.Pipeline_Runs, 5u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
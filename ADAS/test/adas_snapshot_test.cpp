@@ -0,0 +1,170 @@
+// adas_snapshot_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+  #include "adas_snapshot.h"
+  #include "adas_time.h"
+  #include "acc.h"
+}
+
+/*
+테스트 항목:
+1. 캡처/검증: Magic/Version/Size 기록, 다른 버전/크기 스냅샷은 복원 거부 (상태 변경 없음), 시간 기록 대상은 캡처/복원 제외
+2. 중간 복원: 스냅샷에서 이어 실행한 출력 = 끊김 없이 실행한 출력 (비트 단위)
+3. 기본 인스턴스(acc.c 전역 PID) 상태: 캡처 후 RestoreDefaults 로 되돌리면 같은 결과
+4. POD/비용: 바이트 복사본으로 복원 가능, 캡처+복원 1 us 미만
+*/
+
+static void scenario_input(AdasFrameInput_t *pIn, int k) {
+    float t = 0.01f * k;
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Time.Current_Time = t * 1000.0f;
+    pIn->Gps.GPS_Velocity_X = 18.0f + 3.0f * sinf(0.4f * t);
+    pIn->Gps.GPS_Timestamp = pIn->Time.Current_Time;
+    pIn->Imu.Linear_Acceleration_X = 1.2f * cosf(0.4f * t);
+    pIn->Imu.Yaw_Rate = 0.03f * sinf(0.2f * t);
+    pIn->Lane.Lane_Type = LANE_TYPE_STRAIGHT;
+    pIn->Lane.Lane_Width = 3.5f;
+    pIn->Lane.Lane_Offset = 0.4f * sinf(0.5f * t);
+    pIn->Object_Count = 1;
+    pIn->Objects[0].Object_ID = 1;
+    pIn->Objects[0].Object_Type = OBJTYPE_CAR;
+    pIn->Objects[0].Object_Status = OBJSTAT_MOVING;
+    pIn->Objects[0].Distance = 35.0f - fmodf(2.0f * t, 25.0f);
+    pIn->Objects[0].Position_X = pIn->Objects[0].Distance;
+    pIn->Objects[0].Velocity_X = 16.0f;
+}
+
+// Test 1: 캡처/검증
+TEST(AdasSnapshotTest, CaptureAndVersionCheck) {
+    AdasPipeline_t pipe, other;
+    AdasSnapshot_t snap;
+    ASSERT_EQ(AdasPipeline_Init(&pipe, 0.01f), 0);
+
+    EXPECT_EQ(AdasSnapshot_Capture(NULL, &pipe, 0), ADAS_SNAPSHOT_ERR_ARG);
+    ASSERT_EQ(AdasSnapshot_Capture(&snap, &pipe, 42), 0);
+    EXPECT_EQ(snap.Magic, ADAS_SNAPSHOT_MAGIC);
+    EXPECT_EQ(snap.Size, sizeof(AdasSnapshot_t));
+    EXPECT_EQ(snap.Cycle, 42u);
+    EXPECT_EQ(AdasSnapshot_Validate(&snap), 0);
+
+    ASSERT_EQ(AdasPipeline_Init(&other, 0.02f), 0);
+    AdasSnapshot_t bad = snap;
+    bad.Version = ADAS_SNAPSHOT_VERSION + 1;
+    EXPECT_EQ(AdasSnapshot_Restore(&bad, &other), ADAS_SNAPSHOT_ERR_VERSION);
+    bad = snap;
+    bad.Size -= 4;
+    EXPECT_EQ(AdasSnapshot_Restore(&bad, &other), ADAS_SNAPSHOT_ERR_VERSION);
+    EXPECT_EQ(AdasSnapshot_RestoreDefaults(&bad), ADAS_SNAPSHOT_ERR_VERSION);
+    EXPECT_FLOAT_EQ(other.Delta_Time, 0.02f);   // 거부 시 변경 없음
+
+    ASSERT_EQ(AdasSnapshot_Restore(&snap, &other), 0);
+    EXPECT_FLOAT_EQ(other.Delta_Time, 0.01f);
+    EXPECT_EQ(AdasSnapshot_Restore(&snap, NULL), ADAS_SNAPSHOT_ERR_ARG);
+
+    // 시간 기록 대상은 캡처하지 않고, 복원 시 대상 인스턴스 값 유지
+    static AdasMetrics_t mA, mB;
+    AdasPipeline_SetMetrics(&pipe, &mA);
+    AdasPipeline_SetMetrics(&other, &mB);
+    ASSERT_EQ(AdasSnapshot_Capture(&snap, &pipe, 43), 0);
+    EXPECT_EQ(snap.Pipeline.pMetrics, nullptr);
+    ASSERT_EQ(AdasSnapshot_Restore(&snap, &other), 0);
+    EXPECT_EQ(other.pMetrics, &mB);
+}
+
+// Test 2: 중간 복원 = 연속 실행
+TEST(AdasSnapshotTest, RestoreMidRunIsBitExact) {
+    static AdasFrameInput_t in;
+    static AdasFrameOutput_t outA, outB;
+    AdasPipeline_t pipeA, pipeB;
+    AdasSnapshot_t snap;
+    const int split = 300, total = 700;
+
+    memset(&outA, 0, sizeof(outA));
+    ASSERT_EQ(AdasPipeline_Init(&pipeA, 0.01f), 0);
+    for (int k = 0; k < split; k++) {
+        scenario_input(&in, k);
+        AdasPipeline_Step(&pipeA, &in, &outA);
+    }
+    ASSERT_EQ(AdasSnapshot_Capture(&snap, &pipeA, split), 0);
+
+    // 다른 상태의 파이프라인에 복원 후 같은 입력으로 진행
+    ASSERT_EQ(AdasPipeline_Init(&pipeB, 0.01f), 0);
+    ASSERT_EQ(AdasSnapshot_Restore(&snap, &pipeB), 0);
+    memset(&outB, 0, sizeof(outB));
+
+    int diffs = 0;
+    for (int k = split; k < total; k++) {
+        scenario_input(&in, k);
+        AdasPipeline_Step(&pipeA, &in, &outA);
+        AdasPipeline_Step(&pipeB, &in, &outB);
+        diffs += memcmp(&outA.Ego, &outB.Ego, sizeof(outA.Ego)) != 0;
+        diffs += memcmp(&outA.Control, &outB.Control, sizeof(outA.Control)) != 0;
+        diffs += memcmp(&outA.Accel_Acc, &outB.Accel_Acc, sizeof(float)) != 0;
+        diffs += memcmp(&outA.Steer_Lfa, &outB.Steer_Lfa, sizeof(float)) != 0;
+    }
+    EXPECT_EQ(diffs, 0);
+    EXPECT_EQ(memcmp(&pipeA, &pipeB, sizeof(pipeA)), 0);
+}
+
+// Test 3: acc.c 기본 인스턴스 상태
+TEST(AdasSnapshotTest, DefaultInstanceStateRoundTrip) {
+    ACC_Ego_Data_t ego = { 15.0f, 0.0f };
+    Lane_Data_t lane = {};
+    AdasPipeline_t pipe;
+    AdasSnapshot_t snap;
+    ASSERT_EQ(AdasPipeline_Init(&pipe, 0.01f), 0);
+
+    for (int i = 0; i < 20; i++) calculate_accel_for_speed_pid(&ego, &lane, 0.01f);
+    ASSERT_EQ(AdasSnapshot_Capture(&snap, &pipe, 0), 0);
+
+    float expect[5];
+    for (int i = 0; i < 5; i++) expect[i] = calculate_accel_for_speed_pid(&ego, &lane, 0.01f);
+
+    // 적분이 더 쌓인 상태 -> 스냅샷 시점으로 되돌림
+    for (int i = 0; i < 50; i++) calculate_accel_for_speed_pid(&ego, &lane, 0.01f);
+    ASSERT_EQ(AdasSnapshot_RestoreDefaults(&snap), 0);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(calculate_accel_for_speed_pid(&ego, &lane, 0.01f), expect[i]);
+    }
+}
+
+// Test 4: POD 복사 + 비용
+TEST(AdasSnapshotTest, PodCopyAndCost) {
+    static AdasFrameInput_t in;
+    static AdasFrameOutput_t out;
+    AdasPipeline_t pipe, restored;
+    AdasSnapshot_t snap, copy;
+    ASSERT_EQ(AdasPipeline_Init(&pipe, 0.01f), 0);
+    for (int k = 0; k < 50; k++) {
+        scenario_input(&in, k);
+        AdasPipeline_Step(&pipe, &in, &out);
+    }
+
+    ASSERT_EQ(AdasSnapshot_Capture(&snap, &pipe, 50), 0);
+    std::vector<unsigned char> bytes(sizeof(snap));
+    memcpy(bytes.data(), &snap, sizeof(snap));
+    memcpy(&copy, bytes.data(), sizeof(copy));
+    ASSERT_EQ(AdasPipeline_Init(&restored, 0.02f), 0);
+    ASSERT_EQ(AdasSnapshot_Restore(&copy, &restored), 0);
+    EXPECT_EQ(memcmp(&restored, &pipe, sizeof(pipe)), 0);
+
+    const int N = 10000;
+    uint64_t t0 = AdasTime_NowNs();
+    for (int i = 0; i < N; i++) {
+        AdasSnapshot_Capture(&snap, &pipe, (uint64_t)i);
+        AdasSnapshot_Restore(&snap, &restored);
+    }
+    uint64_t avgNs = (AdasTime_NowNs() - t0) / N;
+    std::cout << "[PodCopyAndCost] size=" << sizeof(AdasSnapshot_t) << " B, capture+restore=" << avgNs << " ns\n";
+    EXPECT_LT(avgNs, ADAS_NS_PER_US);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+// adas_task_graph_test.cpp
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <time.h>
+
+extern "C" {
+  #include "adas_task_graph.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 의존성 계산: Target -> ACC/AEB, LFA 는 Target 과 독립, ACC/AEB/LFA 상호 독립, Arbitration 은 전부에 의존
+2. 태스크 그래프 실행 결과 = 순차 실행 결과 (워커 2개, 50 주기)
+3. 독립 태스크 동시 실행: 5ms 태스크 3개 + join, 워커 2개 -> 순차 합(15ms)보다 짧음
+4. 런타임 Worker_Count 설정으로 고정 주기 루프 실행 + 종료
+*/
+
+static void FillInput(AdasFrameInput_t *pIn, float now)
+{
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Time.Current_Time   = now;
+    pIn->Gps.GPS_Timestamp   = now;
+    pIn->Gps.GPS_Velocity_X  = 20.0f;
+    pIn->Lane.Lane_Width     = 3.5f;
+    pIn->Lane.Lane_Offset    = 0.3f;
+    pIn->Lane.Lane_Heading   = 1.0f;
+    pIn->Object_Count        = 2;
+    pIn->Objects[0].Object_ID     = 1;
+    pIn->Objects[0].Position_X    = 40.0f - 0.05f * now;
+    pIn->Objects[0].Distance      = 40.0f - 0.05f * now;
+    pIn->Objects[0].Velocity_X    = 15.0f;
+    pIn->Objects[0].Object_Status = OBJSTAT_MOVING;
+    pIn->Objects[1].Object_ID     = 2;
+    pIn->Objects[1].Object_Type   = OBJTYPE_PEDESTRIAN;
+    pIn->Objects[1].Position_X    = 25.0f;
+    pIn->Objects[1].Position_Y    = 1.0f;
+    pIn->Objects[1].Distance      = 25.0f;
+    pIn->Objects[1].Object_Status = OBJSTAT_MOVING;
+}
+
+static void SleepTask(void *pCtx, int arg)
+{
+    (void)pCtx;
+    struct timespec ts = { 0, (long)arg * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+static void NopTask(void *pCtx, int arg)
+{
+    (void)pCtx; (void)arg;
+}
+
+static int ConstInput(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    (void)pUser; (void)cycle;
+    FillInput(pIn, pIn->Time.Current_Time);
+    return 0;
+}
+
+// Test 1: 의존성
+TEST(AdasTaskGraphTest, PipelineDependencies) {
+    static AdasTaskGraph_t g;
+    ASSERT_EQ(AdasPipeline_BuildGraph(&g), 0);
+    EXPECT_EQ(g.Task_Count, ADAS_STAGE_COUNT);
+
+    EXPECT_TRUE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_ACC, ADAS_STAGE_TARGET));
+    EXPECT_TRUE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_AEB, ADAS_STAGE_TARGET));
+    EXPECT_TRUE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_LFA, ADAS_STAGE_EGO));
+    EXPECT_FALSE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_LFA, ADAS_STAGE_TARGET));
+    EXPECT_FALSE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_AEB, ADAS_STAGE_ACC));
+    EXPECT_FALSE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_LFA, ADAS_STAGE_AEB));
+    for (int s = 0; s < ADAS_STAGE_ARBITRATION; s++) {
+        EXPECT_TRUE(AdasTaskGraph_DependsOn(&g, ADAS_STAGE_ARBITRATION, s));
+    }
+
+    AdasTaskDesc_t bad = { "bad", NULL, 0, 0, 0 };
+    EXPECT_EQ(AdasTaskGraph_Build(&g, &bad, 1), -1);
+    EXPECT_EQ(AdasTaskGraph_Build(&g, &bad, ADAS_TASK_GRAPH_MAX_TASKS + 1), -1);
+}
+
+// Test 2: 결과 동일성
+TEST(AdasTaskGraphTest, MatchesSequentialStep) {
+    static AdasTaskGraph_t   g;
+    static AdasPipeline_t    pSeq, pPar;
+    static AdasFrameInput_t  in;
+    static AdasFrameOutput_t oSeq, oPar;
+    memset(&oSeq, 0, sizeof(oSeq));
+    memset(&oPar, 0, sizeof(oPar));
+
+    ASSERT_EQ(AdasPipeline_BuildGraph(&g), 0);
+    ASSERT_EQ(AdasTaskGraph_Start(&g, 2, -1, 0), 0);
+    ASSERT_EQ(AdasPipeline_Init(&pSeq, 0.01f), 0);
+    ASSERT_EQ(AdasPipeline_Init(&pPar, 0.01f), 0);
+
+    for (int k = 0; k < 50; k++) {
+        FillInput(&in, 10.0f * k);
+        ASSERT_EQ(AdasPipeline_Step(&pSeq, &in, &oSeq), 0);
+        ASSERT_EQ(AdasPipeline_StepGraph(&g, &pPar, &in, &oPar), 0);
+        ASSERT_EQ(oSeq.Accel_Acc, oPar.Accel_Acc) << "cycle " << k;
+        ASSERT_EQ(oSeq.Decel_Aeb, oPar.Decel_Aeb) << "cycle " << k;
+        ASSERT_EQ(oSeq.Steer_Lfa, oPar.Steer_Lfa) << "cycle " << k;
+        ASSERT_EQ(oSeq.Control.throttle, oPar.Control.throttle) << "cycle " << k;
+        ASSERT_EQ(oSeq.Control.brake, oPar.Control.brake) << "cycle " << k;
+    }
+    AdasTaskGraph_Stop(&g);
+    EXPECT_EQ(g.Started, 0);
+}
+
+// Test 3: 독립 태스크 동시 실행
+TEST(AdasTaskGraphTest, IndependentTasksOverlap) {
+    static AdasTaskGraph_t g;
+    enum { A = 1u << 0, B = 1u << 1, C = 1u << 2 };
+    const AdasTaskDesc_t tasks[] = {
+        { "a",    SleepTask, 5, 0,         A },
+        { "b",    SleepTask, 5, 0,         B },
+        { "c",    SleepTask, 5, 0,         C },
+        { "join", NopTask,   0, A | B | C, 0 },
+    };
+    ASSERT_EQ(AdasTaskGraph_Build(&g, tasks, 4), 0);
+    EXPECT_FALSE(AdasTaskGraph_DependsOn(&g, 1, 0));
+    EXPECT_TRUE(AdasTaskGraph_DependsOn(&g, 3, 2));
+    ASSERT_EQ(AdasTaskGraph_Start(&g, 2, -1, 0), 0);
+
+    uint64_t t0 = AdasTime_NowNs();
+    ASSERT_EQ(AdasTaskGraph_Run(&g, NULL), 0);
+    uint64_t elapsed = AdasTime_NowNs() - t0;
+
+    int usedWorker = 0;
+    for (int t = 0; t < 3; t++) usedWorker |= (g.Task_Thread[t] != ADAS_TASK_GRAPH_CALLER);
+    EXPECT_TRUE(usedWorker);
+    EXPECT_LT(elapsed, 13 * ADAS_NS_PER_MS);
+    std::cout << "[IndependentTasksOverlap] 3 x 5ms on 3 threads: " << elapsed / 1000.0 << " us\n";
+    AdasTaskGraph_Stop(&g);
+}
+
+// Test 4: 런타임 통합
+TEST(AdasTaskGraphTest, RuntimeWithWorkers) {
+    static AdasRuntime_t rt;
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns    = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit  = 10;
+    cfg.Worker_Count = 2;
+
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, ConstInput, NULL, NULL), 0);
+    EXPECT_EQ(rt.Graph.Worker_Count, 2);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    EXPECT_EQ(rt.Stats.Cycles, 10u);
+    EXPECT_GT(rt.Stats.Pipeline_Max_Ns, 0u);
+    EXPECT_EQ(rt.Output.Acc_Target.ACC_Target_ID, 1);
+    AdasRuntime_Destroy(&rt);
+    EXPECT_EQ(rt.Graph.Started, 0);
+
+    cfg.Worker_Count = ADAS_TASK_GRAPH_MAX_WORKERS + 1;
+    EXPECT_EQ(AdasRuntime_Init(&rt, &cfg, ConstInput, NULL, NULL), -1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
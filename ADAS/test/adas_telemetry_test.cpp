@@ -0,0 +1,213 @@
+// adas_telemetry_test.cpp
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+extern "C" {
+  #include "adas_telemetry.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 서식화: 이벤트 표 서식에 원시 인자 적용 (음수 정수/실수/부족한 인자 = 0, 미정의 이벤트 "?")
+2. 링 가득 참: 대기 없이 Emit 실패 + Dropped 증가, 비우면 "dropped" 줄 + 나머지 레코드 순서대로 출력
+3. 기록 비용: 출력 스레드 동작 중 Emit 평균 수백 ns 미만, 기록 수 = 출력 + 버림
+4. 런타임 연결: 단계 예산 초과 / 모드 전환이 이벤트로 기록되고 Stop 시 모두 출력
+*/
+
+static std::string read_all(FILE *fp) {
+    std::string text;
+    char buf[512];
+    fflush(fp);
+    rewind(fp);
+    while (fgets(buf, sizeof(buf), fp)) text += buf;
+    return text;
+}
+
+static size_t count_of(const std::string &text, const char *needle) {
+    size_t n = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) n++;
+    return n;
+}
+
+// Test 1: 서식화
+TEST(AdasTelemetryTest, FormatsRawArguments) {
+    static AdasTelemetry_t telem;
+    ASSERT_EQ(AdasTelemetry_Init(&telem, NULL), 0);
+    AdasTelemChannel_t *pCh = AdasTelemetry_AddChannel(&telem, "loop");
+    ASSERT_NE(pCh, nullptr);
+
+    AdasTelemRecord_t rec = {};
+    rec.Stamp_Ns = telem.Start_Ns + 1500 * ADAS_NS_PER_US;
+    rec.Event = ADAS_TELEM_EV_DEADLINE_MISS;
+    rec.Arg_Count = 3;
+    rec.Args[0] = 7;
+    rec.Args[1] = AdasTelemetry_F(12.5);
+    rec.Args[2] = 2;
+
+    char line[256];
+    int len = AdasTelemetry_Format(&telem, pCh, &rec, line, sizeof(line));
+    EXPECT_EQ(len, (int)strlen(line));
+    EXPECT_NE(strstr(line, "0.001500"), nullptr) << line;
+    EXPECT_NE(strstr(line, "loop"), nullptr) << line;
+    EXPECT_NE(strstr(line, "deadline_miss  cycle=7 busy=12.5 us skipped=2"), nullptr) << line;
+
+    // 음수 정수 + 부족한 인자 (ttc = 0)
+    rec.Event = ADAS_TELEM_EV_AEB_MODE;
+    rec.Arg_Count = 3;
+    rec.Args[0] = 40;
+    rec.Args[1] = AdasTelemetry_I(-1);
+    rec.Args[2] = 2;
+    AdasTelemetry_Format(&telem, pCh, &rec, line, sizeof(line));
+    EXPECT_NE(strstr(line, "cycle=40 -1 -> 2 ttc=0.00 s"), nullptr) << line;
+
+    // 작은 버퍼: 잘려도 '\0' 종료
+    char small[20];
+    len = AdasTelemetry_Format(&telem, pCh, &rec, small, sizeof(small));
+    EXPECT_EQ(len, 19);
+    EXPECT_EQ(strlen(small), 19u);
+
+    rec.Event = 999;
+    AdasTelemetry_Format(&telem, pCh, &rec, line, sizeof(line));
+    EXPECT_NE(strstr(line, " ? "), nullptr) << line;
+    EXPECT_STREQ(AdasTelemetry_EventName(ADAS_TELEM_EV_CONTROL), "control");
+
+    EXPECT_EQ(AdasTelemetry_Emit(NULL, 0, 0, NULL), -1);
+    EXPECT_EQ(AdasTelemetry_Emit(pCh, 0, 1, NULL), -1);
+}
+
+// Test 2: 링 가득 참 -> 버림 + 표시
+TEST(AdasTelemetryTest, OverflowDropsAndReports) {
+    static AdasTelemetry_t telem;
+    FILE *fp = tmpfile();
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(AdasTelemetry_Init(&telem, fp), 0);
+    AdasTelemChannel_t *pCh = AdasTelemetry_AddChannel(&telem, "loop");
+    ASSERT_NE(pCh, nullptr);
+
+    const int extra = 10;
+    int failed = 0;
+    for (uint64_t i = 0; i < ADAS_TELEM_RING_CAPACITY + extra; i++) {
+        uint64_t args[1] = { i };
+        if (AdasTelemetry_Emit(pCh, ADAS_TELEM_EV_INPUT_MISSING, 1, args) != 0) failed++;
+    }
+    EXPECT_EQ(failed, extra);
+    EXPECT_EQ(AdasTelemetry_Dropped(&telem), (uint64_t)extra);
+
+    EXPECT_EQ(AdasTelemetry_Drain(&telem), (uint32_t)ADAS_TELEM_RING_CAPACITY);
+    EXPECT_EQ(telem.Written, (uint64_t)ADAS_TELEM_RING_CAPACITY);
+
+    std::string text = read_all(fp);
+    EXPECT_EQ(count_of(text, "input_missing"), (size_t)ADAS_TELEM_RING_CAPACITY);
+    EXPECT_EQ(count_of(text, "dropped        count=10\n"), 1u);
+    // 순서 보존: 첫 레코드 cycle=0, 마지막 cycle=CAPACITY-1
+    EXPECT_NE(text.find("cycle=0\n"), std::string::npos);
+    EXPECT_NE(text.find("cycle=" + std::to_string(ADAS_TELEM_RING_CAPACITY - 1) + "\n"), std::string::npos);
+    EXPECT_EQ(text.find("cycle=" + std::to_string(ADAS_TELEM_RING_CAPACITY) + "\n"), std::string::npos);
+
+    // 비운 뒤에는 다시 기록 가능, 이미 표시한 버림은 다시 표시 안 함
+    uint64_t args[1] = { 5000 };
+    EXPECT_EQ(AdasTelemetry_Emit(pCh, ADAS_TELEM_EV_INPUT_MISSING, 1, args), 0);
+    EXPECT_EQ(AdasTelemetry_Drain(&telem), 1u);
+    EXPECT_EQ(count_of(read_all(fp), "dropped"), 1u);
+    fclose(fp);
+}
+
+// Test 3: 출력 스레드 동작 중 기록 비용
+TEST(AdasTelemetryTest, EmitCostWithWriterThread) {
+    static AdasTelemetry_t telem;
+    FILE *fp = tmpfile();
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(AdasTelemetry_Init(&telem, fp), 0);
+    AdasTelemChannel_t *pCh = AdasTelemetry_AddChannel(&telem, "loop");
+    ASSERT_NE(pCh, nullptr);
+    ASSERT_EQ(AdasTelemetry_Start(&telem, -1), 0);
+    EXPECT_EQ(AdasTelemetry_AddChannel(&telem, "late"), nullptr);   // 시작 후 추가 불가
+    EXPECT_EQ(AdasTelemetry_Drain(&telem), 0u);                     // 출력 스레드가 소비자
+
+    // 제어 루프처럼 묶음 사이 휴면 (링 용량 이내로 기록)
+    const int bursts = 50, perBurst = 200;
+    uint64_t emitNs = 0;
+    for (int b = 0; b < bursts; b++) {
+        uint64_t t0 = AdasTime_NowNs();
+        for (int i = 0; i < perBurst; i++) {
+            uint64_t args[6] = { (uint64_t)(b * perBurst + i), AdasTelemetry_F(0.5), AdasTelemetry_F(0.0),
+                                 AdasTelemetry_F(-1.25), AdasTelemetry_F(0.8), AdasTelemetry_F(0.0) };
+            AdasTelemetry_Emit(pCh, ADAS_TELEM_EV_CONTROL, 6, args);
+        }
+        emitNs += AdasTime_NowNs() - t0;
+        AdasTime_SleepUntilNs(AdasTime_NowNs() + 2 * ADAS_NS_PER_MS);
+    }
+    AdasTelemetry_Stop(&telem);
+
+    const uint64_t total = (uint64_t)bursts * perBurst;
+    uint64_t avgNs = emitNs / total;
+    std::cout << "[EmitCostWithWriterThread] emit avg=" << avgNs << " ns, written=" << telem.Written
+              << ", dropped=" << AdasTelemetry_Dropped(&telem) << "\n";
+    EXPECT_LT(avgNs, 500u);
+    EXPECT_EQ(telem.Written + AdasTelemetry_Dropped(&telem), total);
+    EXPECT_EQ(count_of(read_all(fp), "control"), (size_t)telem.Written);
+    fclose(fp);
+}
+
+// 정지 차량 8m 앞, 자차 8 m/s (GPS 스파이크 임계 이내) -> AEB 모드 전환
+static int approach_input(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn) {
+    (void)pUser;
+    (void)cycle;
+    pIn->Gps.GPS_Velocity_X = 8.0f;
+    pIn->Gps.GPS_Timestamp = pIn->Time.Current_Time;
+    pIn->Lane.Lane_Type = LANE_TYPE_STRAIGHT;
+    pIn->Lane.Lane_Width = 3.5f;
+    pIn->Object_Count = 1;
+    pIn->Objects[0].Object_ID = 1;
+    pIn->Objects[0].Object_Type = OBJTYPE_CAR;
+    pIn->Objects[0].Object_Status = OBJSTAT_STOPPED;
+    pIn->Objects[0].Position_X = 8.0f;
+    pIn->Objects[0].Distance = 8.0f;
+    pIn->Objects[0].Velocity_X = 0.0f;
+    return 0;
+}
+
+// Test 4: 런타임 연결
+TEST(AdasTelemetryTest, RuntimeEmitsOverrunsAndModeChanges) {
+    static AdasTelemetry_t telem;
+    static AdasRuntime_t rt;
+    FILE *fp = tmpfile();
+    ASSERT_NE(fp, nullptr);
+    ASSERT_EQ(AdasTelemetry_Init(&telem, fp), 0);
+    AdasTelemChannel_t *pCh = AdasTelemetry_AddChannel(&telem, "loop");
+    ASSERT_NE(pCh, nullptr);
+    ASSERT_EQ(AdasTelemetry_Start(&telem, -1), 0);
+
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns = 2 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 30;
+    cfg.Stage_Budget_Ns[ADAS_STAGE_EGO] = 1;   // 매 주기 초과
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, approach_input, NULL, NULL), 0);
+
+    AdasRuntime_SetTelemetry(&rt, pCh);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    AdasTelemetry_Stop(&telem);
+
+    std::string text = read_all(fp);
+    EXPECT_EQ(count_of(text, "stage_overrun"), (size_t)rt.Stats.Stage_Overruns[ADAS_STAGE_EGO]);
+    EXPECT_EQ(rt.Stats.Stage_Overruns[ADAS_STAGE_EGO], 30u);
+    EXPECT_EQ(count_of(text, "deadline_miss"), (size_t)rt.Stats.Deadline_Misses);
+    ASSERT_EQ(rt.Output.Aeb_Mode, AEB_MODE_ALERT);
+    EXPECT_NE(text.find("aeb_mode       cycle="), std::string::npos) << text;
+    EXPECT_NE(text.find("0 -> 1 ttc="), std::string::npos) << text;
+    EXPECT_GE(count_of(text, "acc_mode"), 1u) << text;
+    EXPECT_EQ(AdasTelemetry_Dropped(&telem), 0u);
+    AdasRuntime_Destroy(&rt);
+    fclose(fp);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
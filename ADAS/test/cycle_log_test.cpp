@@ -0,0 +1,205 @@
+// cycle_log_test.cpp
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+extern "C" {
+  #include "cycle_log.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 생성/열기: 용량 0 / 없는 파일은 ERR_ARG, 헤더 버전 불일치는 ERR_LAYOUT
+2. 기록 -> 재생 왕복: 입력/단계 출력 필드 보존, 닫을 때 파일 크기 = 헤더 + 레코드 수
+3. 용량 초과: ERR_FULL + Dropped 증가, 주기당 기록 시간 수 us 미만, 생성 시 pre-touch -> 기록 중 page fault 없음
+4. 런타임 연결: 주기마다 1 레코드, Cycle 연속, 마지막 레코드 = 최종 출력,
+   간격마다 상태 스냅샷 (별도 구역, 닫은 파일 = 헤더 + 레코드 + 스냅샷)
+*/
+
+static std::string log_path(const char *tag) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "/tmp/adas_cycle_log_%s_%d.bin", tag, (int)getpid());
+    return buf;
+}
+
+static void make_frame(AdasFrameInput_t *pIn, AdasFrameOutput_t *pOut, int k) {
+    memset(pIn, 0, sizeof(*pIn));
+    memset(pOut, 0, sizeof(*pOut));
+    pIn->Time.Current_Time = 10.0f * k;
+    pIn->Gps.GPS_Velocity_X = 10.0f + k;
+    pIn->Lane.Lane_Width = 3.5f;
+    pIn->Object_Count = 2;
+    pIn->Objects[0].Object_ID = 100 + k;
+    pIn->Objects[1].Distance = 30.0f - k;
+    pIn->Objects[5].Object_ID = 999;   // Object_Count 밖 -> 기록 안 됨
+
+    pOut->Ego.Ego_Velocity_X = 9.5f + k;
+    pOut->Acc_Mode = ACC_MODE_DISTANCE;
+    pOut->Accel_Acc = -0.5f * k;
+    pOut->Aeb_Mode = AEB_MODE_NORMAL;
+    pOut->Steer_Lfa = 0.1f * k;
+    pOut->Control.throttle = 0.01f * k;
+}
+
+// Test 1: 생성/열기 + 레이아웃 검증
+TEST(CycleLogTest, CreateOpenValidatesLayout) {
+    std::string path = log_path("open");
+    AdasCycleLog_t log;
+
+    EXPECT_EQ(AdasCycleLog_Create(&log, path.c_str(), 0, 0), ADAS_CYCLE_LOG_ERR_ARG);
+    unlink(path.c_str());
+    EXPECT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), ADAS_CYCLE_LOG_ERR_ARG);
+
+    ASSERT_EQ(AdasCycleLog_Create(&log, path.c_str(), 4, 0), 0);
+    EXPECT_EQ(log.pHeader->Record_Size, sizeof(AdasCycleRecord_t));
+    log.pHeader->Version = ADAS_CYCLE_LOG_VERSION + 1;   // 다른 버전 흉내
+    AdasCycleLog_Close(&log);
+
+    EXPECT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), ADAS_CYCLE_LOG_ERR_LAYOUT);
+    EXPECT_EQ(AdasCycleLog_Count(&log), 0u);
+    EXPECT_EQ(AdasCycleLog_Get(&log, 0), nullptr);
+    unlink(path.c_str());
+}
+
+// Test 2: 기록 -> 재생 왕복
+TEST(CycleLogTest, RoundTripPreservesFields) {
+    std::string path = log_path("rt");
+    AdasCycleLog_t log;
+    static AdasFrameInput_t in;
+    static AdasFrameOutput_t out;
+
+    ASSERT_EQ(AdasCycleLog_Create(&log, path.c_str(), 100, 0), 0);
+    for (int k = 0; k < 5; k++) {
+        make_frame(&in, &out, k);
+        ASSERT_EQ(AdasCycleLog_Append(&log, (uint64_t)k, &in, &out, NULL), 0);
+    }
+    EXPECT_EQ(log.pHeader->Record_Count, 5u);
+    AdasCycleLog_Close(&log);
+
+    struct stat st;
+    ASSERT_EQ(stat(path.c_str(), &st), 0);
+    EXPECT_EQ((size_t)st.st_size, sizeof(AdasCycleLogHeader_t) + 5 * sizeof(AdasCycleRecord_t));
+
+    ASSERT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), 0);
+    ASSERT_EQ(AdasCycleLog_Count(&log), 5u);
+    EXPECT_EQ(AdasCycleLog_Get(&log, 5), nullptr);
+
+    uint64_t prevStamp = 0;
+    for (int k = 0; k < 5; k++) {
+        const AdasCycleRecord_t *pRec = AdasCycleLog_Get(&log, (uint64_t)k);
+        ASSERT_NE(pRec, nullptr);
+        EXPECT_EQ(pRec->Cycle, (uint64_t)k);
+        EXPECT_GE(pRec->Stamp_Ns, prevStamp);
+        prevStamp = pRec->Stamp_Ns;
+        EXPECT_FLOAT_EQ(pRec->Input.Time.Current_Time, 10.0f * k);
+        EXPECT_FLOAT_EQ(pRec->Input.Gps.GPS_Velocity_X, 10.0f + k);
+        EXPECT_EQ(pRec->Input.Object_Count, 2);
+        EXPECT_EQ(pRec->Input.Objects[0].Object_ID, 100 + k);
+        EXPECT_FLOAT_EQ(pRec->Input.Objects[1].Distance, 30.0f - k);
+        EXPECT_EQ(pRec->Input.Objects[5].Object_ID, 0);
+        EXPECT_FLOAT_EQ(pRec->Ego.Ego_Velocity_X, 9.5f + k);
+        EXPECT_EQ(pRec->Acc_Mode, (int32_t)ACC_MODE_DISTANCE);
+        EXPECT_FLOAT_EQ(pRec->Accel_Acc, -0.5f * k);
+        EXPECT_FLOAT_EQ(pRec->Steer_Lfa, 0.1f * k);
+        EXPECT_FLOAT_EQ(pRec->Control.throttle, 0.01f * k);
+    }
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+}
+
+// Test 3: 용량 초과 + 기록 비용
+TEST(CycleLogTest, FullLogDropsAndAppendIsCheap) {
+    std::string path = log_path("full");
+    AdasCycleLog_t log;
+    static AdasFrameInput_t in;
+    static AdasFrameOutput_t out;
+    make_frame(&in, &out, 1);
+    in.Object_Count = ADAS_MAX_OBJECTS;   // 최대 크기 레코드
+
+    const int N = 2000;
+    ASSERT_EQ(AdasCycleLog_Create(&log, path.c_str(), N, 0), 0);
+    struct rusage ru0, ru1;
+    getrusage(RUSAGE_SELF, &ru0);
+    uint64_t t0 = AdasTime_NowNs();
+    for (int k = 0; k < N; k++) ASSERT_EQ(AdasCycleLog_Append(&log, (uint64_t)k, &in, &out, NULL), 0);
+    uint64_t avgNs = (AdasTime_NowNs() - t0) / N;
+    getrusage(RUSAGE_SELF, &ru1);
+    EXPECT_LT(avgNs, 5 * ADAS_NS_PER_US);
+    // 레코드 영역 약 (N x 레코드 크기 / 4 KiB) 페이지 -> 생성 시 모두 쓰기 접근 완료
+    EXPECT_LT(ru1.ru_minflt - ru0.ru_minflt, 16) << "pages=" << (N * sizeof(AdasCycleRecord_t)) / 4096;
+
+    EXPECT_EQ(AdasCycleLog_Append(&log, N, &in, &out, NULL), ADAS_CYCLE_LOG_ERR_FULL);
+    EXPECT_EQ(AdasCycleLog_Append(&log, N + 1, &in, &out, NULL), ADAS_CYCLE_LOG_ERR_FULL);
+    EXPECT_EQ(log.pHeader->Dropped, 2u);
+    EXPECT_EQ(AdasCycleLog_Count(&log), (uint64_t)N);
+    EXPECT_EQ(AdasCycleLog_Append(NULL, 0, &in, &out, NULL), ADAS_CYCLE_LOG_ERR_ARG);
+
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+}
+
+// Test 4: 런타임 연결
+TEST(CycleLogTest, RuntimeRecordsEveryCycle) {
+    std::string path = log_path("runtime");
+    static AdasCycleLog_t log;
+    static AdasRuntime_t rt;
+
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 40;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, NULL, NULL, NULL), 0);
+    rt.Input.Gps.GPS_Velocity_X = 15.0f;
+    rt.Input.Lane.Lane_Width = 3.5f;
+
+    ASSERT_EQ(AdasCycleLog_Create(&log, path.c_str(), cfg.Cycle_Limit, 10), 0);
+    AdasRuntime_SetLog(&rt, &log);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+    AdasCycleLog_Close(&log);
+
+    ASSERT_EQ(AdasCycleLog_OpenRead(&log, path.c_str()), 0);
+    ASSERT_EQ(AdasCycleLog_Count(&log), 40u);
+    for (uint64_t i = 0; i < 40; i++) EXPECT_EQ(AdasCycleLog_Get(&log, i)->Cycle, i);
+
+    const AdasCycleRecord_t *pLast = AdasCycleLog_Get(&log, 39);
+    EXPECT_FLOAT_EQ(pLast->Input.Gps.GPS_Velocity_X, 15.0f);
+    EXPECT_FLOAT_EQ(pLast->Ego.Ego_Velocity_X, rt.Output.Ego.Ego_Velocity_X);
+    EXPECT_FLOAT_EQ(pLast->Control.throttle, rt.Output.Control.throttle);
+    EXPECT_EQ(pLast->Acc_Mode, (int32_t)rt.Output.Acc_Mode);
+
+    // 10 레코드마다 처리 후 상태 스냅샷 (레코드 밖 별도 구역)
+    for (uint64_t i = 0; i < 40; i++) {
+        const AdasCycleRecord_t *pRec = AdasCycleLog_Get(&log, i);
+        bool snap = ((i + 1) % 10 == 0);
+        EXPECT_EQ(pRec->Has_Snapshot, snap ? 1 : 0);
+        const AdasSnapshot_t *pSnap = AdasCycleLog_GetSnapshot(&log, i);
+        ASSERT_EQ(pSnap != nullptr, snap) << "record " << i;
+        if (snap) {
+            EXPECT_EQ(AdasSnapshot_Validate(pSnap), 0);
+            EXPECT_EQ(pSnap->Cycle, i + 1);
+        }
+    }
+    const AdasSnapshot_t *pLastSnap = AdasCycleLog_GetSnapshot(&log, 39);
+    EXPECT_EQ(memcmp(&pLastSnap->Pipeline, &rt.Pipeline, sizeof(rt.Pipeline)), 0);
+    EXPECT_EQ(log.Snapshot_Count, 4u);
+
+    struct stat st;
+    ASSERT_EQ(stat(path.c_str(), &st), 0);
+    EXPECT_EQ((size_t)st.st_size,
+              sizeof(AdasCycleLogHeader_t) + 40 * sizeof(AdasCycleRecord_t) + 4 * sizeof(AdasSnapshot_t));
+
+    AdasCycleLog_Close(&log);
+    unlink(path.c_str());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,155 @@
+// gain_schedule_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+  #include "gain_schedule.h"
+}
+
+/*
+테스트 항목:
+1. 기본 테이블: 설계서 고정 게인과 동일한 값 반환
+2. 쌍선형 보간: 격자점 사이 값이 선형 보간되는지, Install 은 데이터 복사, NaN/Inf 테이블 거부
+3. 범위 밖 / NaN 입력: 가장자리 값으로 포화
+4. blob 로드: 정상 blob 설치, 형식 오류 / NaN·Inf blob은 거부하고 기존 테이블 유지
+*/
+
+class GainScheduleTest : public ::testing::Test {
+protected:
+    void SetUp() override    { GainSchedule_ResetDefaults(); }
+    void TearDown() override { GainSchedule_ResetDefaults(); }
+};
+
+// Test 1: 기본 테이블 = 고정 게인
+TEST_F(GainScheduleTest, DefaultTablesMatchFixedGains) {
+    PID_Gains_t g;
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, 22.22f, 0.0f, &g);
+    EXPECT_FLOAT_EQ(g.Kp, 0.5f);
+    EXPECT_FLOAT_EQ(g.Ki, 0.1f);
+    EXPECT_FLOAT_EQ(g.Kd, 0.05f);
+
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_DISTANCE, 13.0f, 0.0f, &g);
+    EXPECT_FLOAT_EQ(g.Kp, 0.4f);
+    EXPECT_FLOAT_EQ(g.Ki, 0.05f);
+    EXPECT_FLOAT_EQ(g.Kd, 0.1f);
+
+    GainSchedule_GetPidGains(GAIN_SCHED_LFA_LOW_SPEED, 8.0f, 1.0f / 300.0f, &g);
+    EXPECT_FLOAT_EQ(g.Kp, 0.1f);
+    EXPECT_FLOAT_EQ(g.Ki, 0.01f);
+    EXPECT_FLOAT_EQ(g.Kd, 0.005f);
+}
+
+// Test 2: 2D 쌍선형 보간
+TEST_F(GainScheduleTest, BilinearInterpolation) {
+    /* 2x2 격자: Kp = x + 10*y, Ki = 1, Kd = 0 */
+    static const float data[2 * 2 * 3] = {
+        0.0f,  1.0f, 0.0f,   1.0f,  1.0f, 0.0f,
+        10.0f, 1.0f, 0.0f,   11.0f, 1.0f, 0.0f
+    };
+    InterpTable2D_t tbl = { 0.0f, 1.0f, 2, 0.0f, 1.0f, 2, 3, data };
+    ASSERT_EQ(GainSchedule_Install(GAIN_SCHED_LFA_LOW_SPEED, &tbl), 0);
+
+    PID_Gains_t g;
+    GainSchedule_GetPidGains(GAIN_SCHED_LFA_LOW_SPEED, 0.25f, 0.5f, &g);
+    EXPECT_NEAR(g.Kp, 0.25f + 5.0f, 1e-5f);
+    EXPECT_NEAR(g.Ki, 1.0f, 1e-6f);
+
+    /* 설치 시 복사: 원본 버퍼를 바꿔도 설치된 테이블 유지 */
+    float scratch[2 * 2 * 3];
+    std::memcpy(scratch, data, sizeof(scratch));
+    InterpTable2D_t tmp = { 0.0f, 1.0f, 2, 0.0f, 1.0f, 2, 3, scratch };
+    ASSERT_EQ(GainSchedule_Install(GAIN_SCHED_LFA_LOW_SPEED, &tmp), 0);
+    std::memset(scratch, 0xFF, sizeof(scratch));
+    GainSchedule_GetPidGains(GAIN_SCHED_LFA_LOW_SPEED, 0.25f, 0.5f, &g);
+    EXPECT_NEAR(g.Kp, 0.25f + 5.0f, 1e-5f);
+
+    /* NaN/Inf 게인 / 축 값 -> 거부, 기존 테이블 유지 */
+    std::memcpy(scratch, data, sizeof(scratch));
+    scratch[4] = NAN;
+    EXPECT_EQ(GainSchedule_Install(GAIN_SCHED_LFA_LOW_SPEED, &tmp), -1);
+    std::memcpy(scratch, data, sizeof(scratch));
+    tmp.X_Min = INFINITY;
+    EXPECT_EQ(GainSchedule_Install(GAIN_SCHED_LFA_LOW_SPEED, &tmp), -1);
+    GainSchedule_GetPidGains(GAIN_SCHED_LFA_LOW_SPEED, 0.25f, 0.5f, &g);
+    EXPECT_NEAR(g.Kp, 0.25f + 5.0f, 1e-5f);
+}
+
+// Test 3: 범위 밖 / NaN 포화
+TEST_F(GainScheduleTest, OutOfRangeClamps) {
+    static const float data[3 * 3] = {
+        1.0f, 0.0f, 0.0f,   2.0f, 0.0f, 0.0f,   3.0f, 0.0f, 0.0f
+    };
+    InterpTable2D_t tbl = { 0.0f, 0.1f, 3, 0.0f, 1.0f, 1, 3, data };
+    ASSERT_EQ(GainSchedule_Install(GAIN_SCHED_ACC_SPEED, &tbl), 0);
+
+    PID_Gains_t g;
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, -5.0f, 0.0f, &g);
+    EXPECT_FLOAT_EQ(g.Kp, 1.0f);
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, 500.0f, 0.0f, &g);
+    EXPECT_FLOAT_EQ(g.Kp, 3.0f);
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, NAN, 0.0f, &g);
+    EXPECT_FLOAT_EQ(g.Kp, 1.0f);
+}
+
+static std::vector<unsigned char> MakeBlob(uint16_t id, float kp0, float kp1)
+{
+    GainScheduleBlobHeader_t hdr = { GAIN_SCHEDULE_BLOB_MAGIC, GAIN_SCHEDULE_BLOB_VERSION, 1 };
+    GainScheduleBlobTable_t  tbl = { id, 2, 1, 0, 0.0f, 20.0f, 0.0f, 1.0f };
+    float data[6] = { kp0, 0.2f, 0.03f, kp1, 0.2f, 0.03f };
+
+    std::vector<unsigned char> blob(sizeof(hdr) + sizeof(tbl) + sizeof(data));
+    std::memcpy(blob.data(), &hdr, sizeof(hdr));
+    std::memcpy(blob.data() + sizeof(hdr), &tbl, sizeof(tbl));
+    std::memcpy(blob.data() + sizeof(hdr) + sizeof(tbl), data, sizeof(data));
+    return blob;
+}
+
+// Test 4: blob 로드
+TEST_F(GainScheduleTest, LoadBlob) {
+    std::vector<unsigned char> blob = MakeBlob(GAIN_SCHED_ACC_SPEED, 1.0f, 0.2f);
+    EXPECT_EQ(GainSchedule_LoadBlob(blob.data(), blob.size()), 1);
+
+    PID_Gains_t g;
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, 10.0f, 0.0f, &g);
+    EXPECT_NEAR(g.Kp, 0.6f, 1e-5f);
+    EXPECT_NEAR(g.Ki, 0.2f, 1e-6f);
+
+    /* 잘린 blob -> 거부, 기존 테이블 유지 */
+    std::vector<unsigned char> bad = MakeBlob(GAIN_SCHED_ACC_SPEED, 5.0f, 5.0f);
+    EXPECT_LT(GainSchedule_LoadBlob(bad.data(), bad.size() - 4), 0);
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, 10.0f, 0.0f, &g);
+    EXPECT_NEAR(g.Kp, 0.6f, 1e-5f);
+
+    /* 잘못된 id -> 거부 */
+    std::vector<unsigned char> badId = MakeBlob(GAIN_SCHED_COUNT, 1.0f, 1.0f);
+    EXPECT_LT(GainSchedule_LoadBlob(badId.data(), badId.size()), 0);
+
+    /* NaN / Inf 게인 -> 거부 */
+    std::vector<unsigned char> nanGain = MakeBlob(GAIN_SCHED_ACC_SPEED, NAN, 1.0f);
+    EXPECT_LT(GainSchedule_LoadBlob(nanGain.data(), nanGain.size()), 0);
+    std::vector<unsigned char> infGain = MakeBlob(GAIN_SCHED_ACC_SPEED, 1.0f, INFINITY);
+    EXPECT_LT(GainSchedule_LoadBlob(infGain.data(), infGain.size()), 0);
+
+    /* NaN 축 최소값 / 역수가 Inf 가 되는 간격 -> 거부 */
+    GainScheduleBlobTable_t tbl;
+    std::vector<unsigned char> badAxis = MakeBlob(GAIN_SCHED_ACC_SPEED, 1.0f, 1.0f);
+    std::memcpy(&tbl, badAxis.data() + sizeof(GainScheduleBlobHeader_t), sizeof(tbl));
+    tbl.X_Min = NAN;
+    std::memcpy(badAxis.data() + sizeof(GainScheduleBlobHeader_t), &tbl, sizeof(tbl));
+    EXPECT_LT(GainSchedule_LoadBlob(badAxis.data(), badAxis.size()), 0);
+    tbl.X_Min  = 0.0f;
+    tbl.X_Step = 1e-40f;
+    std::memcpy(badAxis.data() + sizeof(GainScheduleBlobHeader_t), &tbl, sizeof(tbl));
+    EXPECT_LT(GainSchedule_LoadBlob(badAxis.data(), badAxis.size()), 0);
+
+    GainSchedule_GetPidGains(GAIN_SCHED_ACC_SPEED, 10.0f, 0.0f, &g);
+    EXPECT_NEAR(g.Kp, 0.6f, 1e-5f);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,124 @@
+// lfa_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+extern "C" {
+  #include "lfa.h"
+}
+
+/*
+테스트 항목:
+1. look-ahead: 속도에 따라 증가, 급곡선 preview 시 단축
+2. 정상 상태 원 주행: 오차 0 이면 Pure Pursuit 조향 = 기구학 조향 atan(L/R)
+3. 다음 구간 곡률 preview: 곡선 진입 전 미리 조향
+4. 모드 디스패치: High_Speed_Law 에 따라 Stanley / Pure Pursuit 선택
+5. 첫 주기 PID: 초기화 직후 이전 오차를 시드 -> 미분 킥 없음 (= 이전 오차가 이미 같은 상태의 출력), 적분 = e*dt
+*/
+
+static Lane_Data_LS_t MakeLane(float radius, float nextRadius, int dir)
+{
+    Lane_Data_LS_t l = {};
+    l.LS_Is_Within_Lane      = 1;
+    l.LS_Lane_Curvature      = radius;
+    l.LS_Next_Lane_Curvature = nextRadius;
+    l.LS_Curve_Direction     = dir;
+    return l;
+}
+
+// Test 1: look-ahead 스케줄
+TEST(LfaTest, LookaheadScheduledBySpeedAndCurve) {
+    Lane_Data_LS_t straight = MakeLane(0.0f, 0.0f, 0);
+    float ld10 = lfa_pure_pursuit_lookahead(10.0f, &straight);
+    float ld30 = lfa_pure_pursuit_lookahead(30.0f, &straight);
+    EXPECT_NEAR(ld10, 9.0f, 1e-4f);
+    EXPECT_GT(ld30, ld10);
+
+    Lane_Data_LS_t tight = MakeLane(100.0f, 100.0f, 1);
+    float ldTight = lfa_pure_pursuit_lookahead(30.0f, &tight);
+    EXPECT_LT(ldTight, ld30);
+    EXPECT_LE(0.5f * (1.0f / 100.0f) * ldTight * ldTight, LFA_PP_MAX_CURVE_OFFSET + 1e-3f);
+}
+
+// Test 2: 원 주행 정상 상태
+TEST(LfaTest, PurePursuitSteadyStateOnCircle) {
+    LFA_Ego_Data_t ego = { 25.0f, 0.0f, 0.0f };
+    const float R = 400.0f;
+
+    Lane_Data_LS_t right = MakeLane(R, R, 1);
+    float expected = std::atan(LFA_PP_WHEELBASE / R) * 180.0f / (float)M_PI;
+    float steer    = calculate_steer_in_high_speed_pure_pursuit(&ego, &right);
+    std::cout << "[PurePursuitSteadyStateOnCircle] steer=" << steer << ", kinematic=" << expected << "\n";
+    EXPECT_NEAR(steer, expected, 0.02f * expected);
+
+    Lane_Data_LS_t left = MakeLane(R, R, -1);
+    EXPECT_NEAR(calculate_steer_in_high_speed_pure_pursuit(&ego, &left), -steer, 1e-5f);
+
+    Lane_Data_LS_t straight = MakeLane(0.0f, 0.0f, 0);
+    EXPECT_NEAR(calculate_steer_in_high_speed_pure_pursuit(&ego, &straight), 0.0f, 1e-6f);
+}
+
+// Test 3: 다음 곡률 preview
+TEST(LfaTest, PreviewOfNextCurvature) {
+    LFA_Ego_Data_t ego = { 25.0f, 0.0f, 0.0f };
+
+    Lane_Data_LS_t entering = MakeLane(0.0f, 300.0f, 1);   /* 직선 -> 우곡선 */
+    Lane_Data_LS_t curve    = MakeLane(300.0f, 300.0f, 1);
+    float sEntering = calculate_steer_in_high_speed_pure_pursuit(&ego, &entering);
+    float sCurve    = calculate_steer_in_high_speed_pure_pursuit(&ego, &curve);
+    EXPECT_GT(sEntering, 0.0f);
+    EXPECT_LT(sEntering, sCurve);
+
+    /* 오차 부호 규칙은 Stanley 와 동일 */
+    Lane_Data_LS_t offset = MakeLane(0.0f, 0.0f, 0);
+    offset.LS_Lane_Offset = 0.5f;
+    EXPECT_GT(calculate_steer_in_high_speed_pure_pursuit(&ego, &offset), 0.0f);
+    EXPECT_GT(calculate_steer_in_high_speed_stanley(&ego, &offset), 0.0f);
+}
+
+// Test 4: 고속 법칙 디스패치
+TEST(LfaTest, HighSpeedLawDispatch) {
+    LFA_Ego_Data_t ego  = { 25.0f, 0.0f, 0.0f };
+    Lane_Data_LS_t lane = MakeLane(0.0f, 0.0f, 0);
+    lane.LS_Lane_Offset   = 0.4f;
+    lane.LS_Heading_Error = 1.0f;
+
+    LFA_State_t st;
+    lfa_init_state(&st);
+    EXPECT_EQ(st.High_Speed_Law, LFA_HS_LAW_STANLEY);
+    EXPECT_FLOAT_EQ(lfa_calculate_steer(&st, LFA_MODE_HIGH_SPEED, &ego, &lane, 0.01f),
+                    calculate_steer_in_high_speed_stanley(&ego, &lane));
+
+    st.High_Speed_Law = LFA_HS_LAW_PURE_PURSUIT;
+    EXPECT_FLOAT_EQ(lfa_calculate_steer(&st, LFA_MODE_HIGH_SPEED, &ego, &lane, 0.01f),
+                    calculate_steer_in_high_speed_pure_pursuit(&ego, &lane));
+}
+
+// Test 5: 첫 주기 PID 시드
+TEST(LfaTest, FirstPidCycleIsSeeded) {
+    LFA_Ego_Data_t ego = { 5.0f, 0.0f, 0.0f };
+    Lane_Data_LS_t lane = MakeLane(0.0f, 0.0f, 0);
+    lane.LS_Lane_Offset   = 0.4f;
+    lane.LS_Heading_Error = 1.5f;
+    const float e  = 0.4f + 1.5f;
+    const float dt = 0.01f;
+
+    LFA_State_t fresh;
+    lfa_init_state(&fresh);
+    lfa_calculate_steer(&fresh, LFA_MODE_LOW_SPEED, &ego, &lane, dt);
+    EXPECT_FLOAT_EQ(fresh.Pid_Prev_Error, e);
+    EXPECT_NEAR(fresh.Pid_Integral, e * dt, 1e-6f);
+
+    // 기준: 이전 오차가 이미 e 인 진행 중 상태 -> 미분항 0, 출력 = Kp*e + Ki*e*dt
+    LFA_State_t seeded;
+    lfa_init_state(&seeded);
+    seeded.Is_Initialized = 1;
+    seeded.Pid_Prev_Error = e;
+    lfa_calculate_steer(&seeded, LFA_MODE_LOW_SPEED, &ego, &lane, dt);
+    EXPECT_NEAR(fresh.Prev_Steer_Raw, seeded.Prev_Steer_Raw, 1e-4f);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
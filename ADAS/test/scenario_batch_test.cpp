@@ -0,0 +1,210 @@
+// scenario_batch_test.cpp
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+extern "C" {
+  #include "scenario_batch.h"
+}
+
+/*
+테스트 항목:
+1. 격자: 실행 수 = 축 Count 곱, 번호 -> 조건 (Param 축이 가장 빨리 변함, Count = 1 축은 Min), 범위 밖 -1
+2. 스트리밍 통계: Welford 평균/표준편차 정확, 분위수 상대 오차 3% 이내, 두 부분 합치기 = 전체
+3. 묶음 실행: 같은 조건은 묶음 위치와 무관하게 같은 결과, 곡선(선행차 없음) TTC = 상한, 끼어들기 TTC 감소
+4. 스레드 풀: 모든 실행 1회씩 콜백, 스레드 수와 무관하게 같은 집계 (개수/최소/최대/추돌)
+*/
+
+static ScenarioGrid_t MakeGrid(ScenarioType_e type, int nSpeed, int nGap, int nParam)
+{
+    ScenarioGrid_t g;
+    g.Type      = type;
+    g.Ego_Speed = { 10.0f, 20.0f, nSpeed };
+    g.Lead_Gap  = { 20.0f, 60.0f, nGap };
+    switch (type) {
+        case SCENARIO_CUT_IN:      g.Param = { 10.0f, 30.0f, nParam };    break;
+        case SCENARIO_STOP_AND_GO: g.Param = { 2.0f, 6.0f, nParam };      break;
+        default:                   g.Param = { 200.0f, 800.0f, nParam };  break;
+    }
+    return g;
+}
+
+// Test 1: 격자 번호 <-> 조건
+TEST(ScenarioBatchTest, GridEnumeration) {
+    ScenarioGrid_t g = MakeGrid(SCENARIO_CUT_IN, 3, 5, 2);
+    ASSERT_EQ(ScenarioGrid_Count(&g), 30);
+
+    ScenarioInstance_t inst;
+    ASSERT_EQ(ScenarioGrid_Instance(&g, 0, &inst), 0);
+    EXPECT_EQ(inst.Type, SCENARIO_CUT_IN);
+    EXPECT_FLOAT_EQ(inst.Ego_Speed, 10.0f);
+    EXPECT_FLOAT_EQ(inst.Lead_Gap, 20.0f);
+    EXPECT_FLOAT_EQ(inst.Param, 10.0f);
+
+    ASSERT_EQ(ScenarioGrid_Instance(&g, 1, &inst), 0);      // Param 먼저
+    EXPECT_FLOAT_EQ(inst.Param, 30.0f);
+    EXPECT_FLOAT_EQ(inst.Lead_Gap, 20.0f);
+    ASSERT_EQ(ScenarioGrid_Instance(&g, 2, &inst), 0);      // 다음 간격
+    EXPECT_FLOAT_EQ(inst.Param, 10.0f);
+    EXPECT_FLOAT_EQ(inst.Lead_Gap, 30.0f);
+    ASSERT_EQ(ScenarioGrid_Instance(&g, 29, &inst), 0);
+    EXPECT_FLOAT_EQ(inst.Ego_Speed, 20.0f);
+    EXPECT_FLOAT_EQ(inst.Lead_Gap, 60.0f);
+    EXPECT_FLOAT_EQ(inst.Param, 30.0f);
+    EXPECT_EQ(ScenarioGrid_Instance(&g, 30, &inst), -1);
+    EXPECT_EQ(ScenarioGrid_Instance(&g, -1, &inst), -1);
+
+    ScenarioGrid_t one = MakeGrid(SCENARIO_CURVE, 1, 1, 1);
+    ASSERT_EQ(ScenarioGrid_Count(&one), 1);
+    ASSERT_EQ(ScenarioGrid_Instance(&one, 0, &inst), 0);
+    EXPECT_FLOAT_EQ(inst.Param, 200.0f);
+    one.Param.Count = 0;
+    EXPECT_EQ(ScenarioGrid_Count(&one), 0);
+}
+
+// Test 2: Welford / 분위수 / 합치기
+TEST(ScenarioBatchTest, StreamingStatsMergeExactly) {
+    static ScenarioStat_t all, lo, hi;
+    ScenarioStat_Init(&all);
+    ScenarioStat_Init(&lo);
+    ScenarioStat_Init(&hi);
+    for (int i = 1; i <= 1000; i++) {
+        double v = 0.01 * i;              // 0.01 ~ 10
+        ScenarioStat_Add(&all, v);
+        ScenarioStat_Add((i <= 300) ? &lo : &hi, v);
+    }
+
+    EXPECT_EQ(all.Count, 1000u);
+    EXPECT_NEAR(all.Mean, 5.005, 1e-9);
+    // 1..1000 표본 분산 = n(n+1)/12 -> *0.01^2
+    EXPECT_NEAR(ScenarioStat_Stddev(&all), 0.01 * std::sqrt(1000.0 * 1001.0 / 12.0), 1e-9);
+    EXPECT_DOUBLE_EQ(all.Min, 0.01);
+    EXPECT_DOUBLE_EQ(all.Max, 10.0);
+    EXPECT_NEAR(ScenarioStat_Quantile(&all, 50.0), 5.0, 5.0 * 0.035);
+    EXPECT_NEAR(ScenarioStat_Quantile(&all, 99.0), 9.9, 9.9 * 0.035);
+    EXPECT_DOUBLE_EQ(ScenarioStat_Quantile(&all, 100.0), 10.0);
+
+    ScenarioStat_Merge(&lo, &hi);
+    EXPECT_EQ(lo.Count, all.Count);
+    EXPECT_NEAR(lo.Mean, all.Mean, 1e-12);
+    EXPECT_NEAR(ScenarioStat_Stddev(&lo), ScenarioStat_Stddev(&all), 1e-9);
+    EXPECT_DOUBLE_EQ(lo.Min, all.Min);
+    EXPECT_DOUBLE_EQ(lo.Max, all.Max);
+    EXPECT_DOUBLE_EQ(ScenarioStat_Quantile(&lo, 90.0), ScenarioStat_Quantile(&all, 90.0));
+
+    // 빈 통계 합치기 / 빈 통계 값
+    ScenarioStat_t empty;
+    ScenarioStat_Init(&empty);
+    ScenarioStat_Merge(&lo, &empty);
+    EXPECT_EQ(lo.Count, all.Count);
+    EXPECT_DOUBLE_EQ(ScenarioStat_Quantile(&empty, 50.0), 0.0);
+    EXPECT_DOUBLE_EQ(ScenarioStat_Stddev(&empty), 0.0);
+}
+
+// Test 3: 묶음 실행
+TEST(ScenarioBatchTest, BlockResultsIndependentOfPlacement) {
+    ScenarioBatchConfig_t cfg;
+    ScenarioBatch_DefaultConfig(&cfg);
+    cfg.Duration = 8.0f;
+
+    ScenarioInstance_t curve  = { SCENARIO_CURVE, 15.0f, 0.0f, 400.0f };
+    ScenarioInstance_t cutIn  = { SCENARIO_CUT_IN, 20.0f, 40.0f, 25.0f };
+    ScenarioInstance_t sng    = { SCENARIO_STOP_AND_GO, 15.0f, 30.0f, 4.0f };
+
+    ScenarioResult_t single;
+    ASSERT_EQ(ScenarioBatch_RunBlock(&cutIn, 1, &cfg, &single), 0);
+
+    ScenarioInstance_t mix[8] = { curve, sng, curve, sng, curve, cutIn, sng, curve };
+    ScenarioResult_t res[8];
+    ASSERT_EQ(ScenarioBatch_RunBlock(mix, 8, &cfg, res), 0);
+
+    for (int k = 0; k < SCENARIO_KPI_COUNT; k++) {
+        EXPECT_EQ(res[5].Kpi[k], single.Kpi[k]) << ScenarioBatch_KpiName((ScenarioKpi_e)k);
+        EXPECT_EQ(res[0].Kpi[k], res[7].Kpi[k]);
+        EXPECT_EQ(res[1].Kpi[k], res[6].Kpi[k]);
+    }
+    EXPECT_EQ(res[5].Collision, single.Collision);
+
+    // 곡선, 선행차 없음: TTC 상한, AEB 없음
+    EXPECT_FLOAT_EQ(res[0].Kpi[SCENARIO_KPI_MIN_TTC], SCENARIO_TTC_MAX);
+    EXPECT_FLOAT_EQ(res[0].Kpi[SCENARIO_KPI_AEB_ACTIVATIONS], 0.0f);
+    EXPECT_EQ(res[0].Collision, 0);
+    EXPECT_GT(res[0].Kpi[SCENARIO_KPI_LANE_RMS], 0.0f);
+
+    // 끼어들기: 느린 차가 앞에 들어옴 -> TTC 유한
+    EXPECT_LT(single.Kpi[SCENARIO_KPI_MIN_TTC], SCENARIO_TTC_MAX);
+    EXPECT_GT(single.Kpi[SCENARIO_KPI_MAX_JERK], 0.0f);
+
+    EXPECT_EQ(ScenarioBatch_RunBlock(mix, 9, &cfg, res), -1);
+    cfg.Delta_Time = 0.0f;
+    EXPECT_EQ(ScenarioBatch_RunBlock(mix, 1, &cfg, res), -1);
+}
+
+// Test 4: 작업 훔치기 스레드 풀
+struct Seen {
+    std::vector<std::atomic<int>> *pHits;
+};
+
+static void OnResult(void *pUser, int64_t index, const ScenarioInstance_t *, const ScenarioResult_t *) {
+    Seen *s = static_cast<Seen *>(pUser);
+    (*s->pHits)[(size_t)index].fetch_add(1);
+}
+
+TEST(ScenarioBatchTest, ThreadPoolCoversEveryRunOnce) {
+    static ScenarioAggregate_t agg1[SCENARIO_TYPE_COUNT];
+    static ScenarioAggregate_t agg4[SCENARIO_TYPE_COUNT];
+    static ScenarioBatchStats_t stats;
+
+    ScenarioGrid_t grids[3] = {
+        MakeGrid(SCENARIO_CUT_IN, 2, 3, 2),        // 12
+        MakeGrid(SCENARIO_STOP_AND_GO, 2, 2, 2),   // 8
+        MakeGrid(SCENARIO_CURVE, 3, 1, 3)          // 9
+    };
+    const int64_t total = 29;
+
+    ScenarioBatchConfig_t cfg;
+    ScenarioBatch_DefaultConfig(&cfg);
+    cfg.Duration   = 3.0f;
+    cfg.Batch_Size = 2;
+    ASSERT_EQ(ScenarioBatch_Run(grids, 3, &cfg, agg1, nullptr), 0);
+
+    std::vector<std::atomic<int>> hits((size_t)total);
+    Seen seen = { &hits };
+    cfg.Thread_Count = 4;
+    cfg.pfnResult    = OnResult;
+    cfg.pUser        = &seen;
+    ASSERT_EQ(ScenarioBatch_Run(grids, 3, &cfg, agg4, &stats), 0);
+
+    EXPECT_EQ(stats.Runs, total);
+    uint64_t perThread = 0;
+    for (int w = 0; w < 4; w++) perThread += stats.Thread_Runs[w];
+    EXPECT_EQ(perThread, (uint64_t)total);
+    for (int64_t i = 0; i < total; i++) EXPECT_EQ(hits[(size_t)i].load(), 1) << i;
+
+    EXPECT_EQ(agg4[SCENARIO_CUT_IN].Runs, 12u);
+    EXPECT_EQ(agg4[SCENARIO_STOP_AND_GO].Runs, 8u);
+    EXPECT_EQ(agg4[SCENARIO_CURVE].Runs, 9u);
+    for (int t = 0; t < SCENARIO_TYPE_COUNT; t++) {
+        EXPECT_EQ(agg4[t].Runs, agg1[t].Runs);
+        EXPECT_EQ(agg4[t].Collisions, agg1[t].Collisions);
+        EXPECT_EQ(agg4[t].Departures, agg1[t].Departures);
+        for (int k = 0; k < SCENARIO_KPI_COUNT; k++) {
+            EXPECT_EQ(agg4[t].Kpi[k].Count, agg1[t].Kpi[k].Count);
+            EXPECT_DOUBLE_EQ(agg4[t].Kpi[k].Min, agg1[t].Kpi[k].Min);
+            EXPECT_DOUBLE_EQ(agg4[t].Kpi[k].Max, agg1[t].Kpi[k].Max);
+            EXPECT_NEAR(agg4[t].Kpi[k].Mean, agg1[t].Kpi[k].Mean, 1e-6 * (1.0 + std::fabs(agg1[t].Kpi[k].Mean)));
+            EXPECT_DOUBLE_EQ(ScenarioStat_Quantile(&agg4[t].Kpi[k], 50.0), ScenarioStat_Quantile(&agg1[t].Kpi[k], 50.0));
+        }
+    }
+
+    EXPECT_EQ(ScenarioBatch_Run(grids, 0, &cfg, agg4, nullptr), -1);
+    cfg.Thread_Count = SCENARIO_BATCH_MAX_THREADS + 1;
+    EXPECT_EQ(ScenarioBatch_Run(grids, 3, &cfg, agg4, nullptr), -1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
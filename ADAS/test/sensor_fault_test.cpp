@@ -0,0 +1,287 @@
+// sensor_fault_test.cpp
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+  #include "sensor_fault.h"
+  #include "adas_rng.h"
+  #include "ego_vehicle_estimation.h"
+}
+
+/*
+테스트 항목:
+1. Philox4x32-10: Random123 기준 벡터 일치, 배치(SIMD) = 스칼라
+2. 카운터 기반: 분할 / 순서와 무관하게 같은 결과, stream 이 다르면 다른 결과, 열화 0 이면 참값 그대로
+3. 통계: 잡음 표준편차, 스파이크 / 유실 비율, 지연 범위, 늦은 도착 -> 순서 뒤바뀜, 바이어스 연속성
+4. Ego 추정기: 스파이크 GPS/IMU 거부, 지연 > 50 ms GPS 는 갱신 안 함
+5. 장시간 시각: 10 h 이후에도 sub-ms 지연 / 도착 순서 유지
+*/
+
+static std::vector<SensorSample_t> MakeSamples(int count, float v0, float v1, float v2)
+{
+    std::vector<SensorSample_t> s((size_t)count);
+    for (int i = 0; i < count; i++) {
+        std::memset(&s[(size_t)i], 0, sizeof(SensorSample_t));
+        s[(size_t)i].Index    = (uint64_t)i;
+        s[(size_t)i].Value[0] = v0;
+        s[(size_t)i].Value[1] = v1;
+        s[(size_t)i].Value[2] = v2;
+    }
+    return s;
+}
+
+static SensorFaultConfig_t CleanConfig()
+{
+    SensorFaultConfig_t cfg;
+    std::memset(&cfg, 0, sizeof(cfg));
+    cfg.Seed = 7;
+    cfg.Sensor[SENSOR_FAULT_GPS].Period_Ms = 100.0f;
+    cfg.Sensor[SENSOR_FAULT_IMU].Period_Ms = 10.0f;
+    return cfg;
+}
+
+// Test 1: Philox 기준 벡터 / 배치
+TEST(SensorFaultTest, PhiloxKnownAnswerAndBatch) {
+    const uint32_t ctr[3][4] = {
+        { 0u, 0u, 0u, 0u },
+        { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+        { 0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u } };
+    const uint32_t key[3][2] = { { 0u, 0u }, { 0xFFFFFFFFu, 0xFFFFFFFFu }, { 0xA4093822u, 0x299F31D0u } };
+    const uint32_t expect[3][4] = {
+        { 0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u },
+        { 0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu },
+        { 0xD16CFE09u, 0x94FDCCEBu, 0x5001E420u, 0x24126EA1u } };
+    for (int t = 0; t < 3; t++) {
+        uint32_t out[4];
+        AdasRng_Philox4x32(ctr[t], key[t], out);
+        for (int w = 0; w < 4; w++) EXPECT_EQ(out[w], expect[t][w]) << t << "/" << w;
+    }
+
+    const int n = 13;
+    uint32_t c0[n], c1[n], o[4][n];
+    for (int i = 0; i < n; i++) { c0[i] = 0x9E3779B9u * (uint32_t)i; c1[i] = (uint32_t)i << 28; }
+    AdasRng_Philox4x32_Batch(c0, c1, 5u, 9u, key[2], n, o[0], o[1], o[2], o[3]);
+    for (int i = 0; i < n; i++) {
+        uint32_t cc[4] = { c0[i], c1[i], 5u, 9u }, out[4];
+        AdasRng_Philox4x32(cc, key[2], out);
+        for (int w = 0; w < 4; w++) EXPECT_EQ(o[w][i], out[w]) << i;
+    }
+}
+
+// Test 2: 분할 / 순서 무관, 열화 0
+TEST(SensorFaultTest, CounterBasedReplay) {
+    SensorFaultConfig_t cfg;
+    SensorFault_DefaultConfig(&cfg);
+
+    std::vector<SensorSample_t> whole = MakeSamples(1000, 0.1f, -0.2f, 1.0f);
+    ASSERT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_IMU, 42, whole.data(), 1000), 0);
+
+    // 역순 배열을 37 개씩 나눠 처리 -> 같은 Index 는 같은 결과
+    std::vector<SensorSample_t> parts = MakeSamples(1000, 0.1f, -0.2f, 1.0f);
+    std::reverse(parts.begin(), parts.end());
+    for (int b = 0; b < 1000; b += 37)
+        ASSERT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_IMU, 42, &parts[(size_t)b], std::min(37, 1000 - b)), 0);
+    for (const SensorSample_t &p : parts)
+        EXPECT_EQ(std::memcmp(&p, &whole[(size_t)p.Index], sizeof(SensorSample_t)), 0) << p.Index;
+
+    std::vector<SensorSample_t> other = MakeSamples(1000, 0.1f, -0.2f, 1.0f);
+    ASSERT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_IMU, 43, other.data(), 1000), 0);
+    int same = 0;
+    for (int i = 0; i < 1000; i++) same += (other[(size_t)i].Value[0] == whole[(size_t)i].Value[0]);
+    EXPECT_LT(same, 10);
+
+    // 열화 0: 값 / 시각 그대로
+    SensorFaultConfig_t clean = CleanConfig();
+    std::vector<SensorSample_t> c = MakeSamples(100, 20.0f, 0.5f, 0.0f);
+    ASSERT_EQ(SensorFault_Apply(&clean, SENSOR_FAULT_GPS, 0, c.data(), 100), 0);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_FLOAT_EQ(c[(size_t)i].Value[0], 20.0f);
+        EXPECT_FLOAT_EQ(c[(size_t)i].Value[1], 0.5f);
+        EXPECT_DOUBLE_EQ(c[(size_t)i].Measure_Time, 100.0 * (double)i);
+        EXPECT_DOUBLE_EQ(c[(size_t)i].Arrival_Time, c[(size_t)i].Measure_Time);
+        EXPECT_EQ(c[(size_t)i].Dropped, 0);
+    }
+
+    EXPECT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_SENSOR_COUNT, 0, c.data(), 100), -1);
+    EXPECT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_GPS, SENSOR_FAULT_STREAM_MAX + 1, c.data(), 100), -1);
+    EXPECT_EQ(SensorFault_Apply(nullptr, SENSOR_FAULT_GPS, 0, c.data(), 100), -1);
+}
+
+// Test 3: 통계
+TEST(SensorFaultTest, FaultStatisticsMatchConfig) {
+    const int n = 200000;
+    SensorFaultConfig_t cfg = CleanConfig();
+    SensorFaultSensorConfig_t &imu = cfg.Sensor[SENSOR_FAULT_IMU];
+    imu.Channel[0].Noise_Sigma     = 0.5f;
+    imu.Channel[1].Spike_Prob      = 0.01f;
+    imu.Channel[1].Spike_Amplitude = 5.0f;
+    imu.Dropout_Prob = 0.02f;
+    imu.Latency_Ms   = 5.0f;
+    imu.Jitter_Ms    = 2.0f;
+    imu.Late_Prob    = 0.01f;
+    imu.Late_Max_Ms  = 40.0f;
+
+    std::vector<SensorSample_t> s = MakeSamples(n, 0.0f, 0.0f, 0.0f);
+    ASSERT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_IMU, 1, s.data(), n), 0);
+
+    double sq = 0.0;
+    int spikes = 0, drops = 0, late = 0;
+    for (const SensorSample_t &p : s) {
+        sq += (double)p.Value[0] * p.Value[0];
+        if (p.Spike_Mask & 2u) {
+            spikes++;
+            EXPECT_FLOAT_EQ(std::fabs(p.Value[1]), 5.0f);
+        } else {
+            EXPECT_FLOAT_EQ(p.Value[1], 0.0f);
+        }
+        EXPECT_EQ(p.Spike_Mask & 5u, 0u);
+        EXPECT_FLOAT_EQ(p.Value[2], 0.0f);
+        drops += p.Dropped;
+        double delay = p.Arrival_Time - p.Measure_Time;
+        if (p.Late) {
+            late++;
+            EXPECT_LE(delay, 5.0f + 2.0f + 40.0f + 0.01f);
+        } else {
+            EXPECT_GE(delay, 3.0f - 0.01f);
+            EXPECT_LE(delay, 7.0f + 0.01f);
+        }
+    }
+    EXPECT_NEAR(std::sqrt(sq / n), 0.5, 0.005);
+    EXPECT_NEAR((double)spikes / n, 0.01, 0.001);
+    EXPECT_NEAR((double)drops / n, 0.02, 0.0015);
+    EXPECT_NEAR((double)late / n, 0.01, 0.001);
+
+    // 도착 순 정렬: 늦은 샘플 뒤에 측정 시각이 역전된 샘플 존재
+    SensorFault_SortByArrival(s.data(), n);
+    int reordered = 0;
+    for (int i = 1; i < n; i++) {
+        ASSERT_GE(s[(size_t)i].Arrival_Time, s[(size_t)i - 1].Arrival_Time);
+        reordered += (s[(size_t)i].Measure_Time < s[(size_t)i - 1].Measure_Time);
+    }
+    EXPECT_GT(reordered, late / 2);
+
+    // 바이어스만: 샘플 간 변화는 작고 (연속), 분산 = Bias_Sigma^2 * 2/3 (매듭 사이 보간 평균)
+    SensorFaultConfig_t bias = CleanConfig();
+    bias.Sensor[SENSOR_FAULT_IMU].Bias_Period_Ms = 1000.0f;
+    bias.Sensor[SENSOR_FAULT_IMU].Channel[2].Bias_Sigma = 0.3f;
+    std::vector<SensorSample_t> b = MakeSamples(n, 0.0f, 0.0f, 0.0f);
+    ASSERT_EQ(SensorFault_Apply(&bias, SENSOR_FAULT_IMU, 1, b.data(), n), 0);
+    double bsq = 0.0;
+    float maxStep = 0.0f;
+    for (int i = 0; i < n; i++) {
+        bsq += (double)b[(size_t)i].Value[2] * b[(size_t)i].Value[2];
+        if (i > 0) maxStep = std::fmax(maxStep, std::fabs(b[(size_t)i].Value[2] - b[(size_t)i - 1].Value[2]));
+    }
+    EXPECT_NEAR(std::sqrt(bsq / n), 0.3 * std::sqrt(2.0 / 3.0), 0.3 * 0.1);
+    EXPECT_LT(maxStep, 0.3f * 6.0f / 100.0f);      // 매듭 차이 (< 6σ) / 매듭당 100 샘플
+}
+
+// Test 4: Ego 추정기 스파이크 / 타임스탬프 검사
+struct EstimatorRun {
+    float Max_Err;             // 3 초 이후 |Vx - 참값| 최대
+    float Max_Accel;           // |Ego_Acceleration_X| 최대
+    float Final_Prev_Gps;      // 마지막으로 채택된 GPS 속도
+};
+
+static EstimatorRun RunEstimator(const SensorFaultConfig_t &cfg, float truthVx, float initVx)
+{
+    const int ticks = 1000;                            // 10 ms x 1000
+    std::vector<SensorSample_t> gps = MakeSamples(ticks / 10 + 5, truthVx, 0.0f, 0.0f);
+    std::vector<SensorSample_t> imu = MakeSamples(ticks + 5, 0.0f, 0.0f, 0.0f);
+    SensorFault_Apply(&cfg, SENSOR_FAULT_GPS, 3, gps.data(), (int)gps.size());
+    SensorFault_Apply(&cfg, SENSOR_FAULT_IMU, 3, imu.data(), (int)imu.size());
+    SensorFault_SortByArrival(gps.data(), (int)gps.size());
+    SensorFault_SortByArrival(imu.data(), (int)imu.size());
+
+    EgoVehicleKFState_t kf;
+    InitEgoVehicleKFState(&kf);
+    kf.X[0]           = initVx;
+    kf.Prev_GPS_Vel_X = initVx;
+
+    EstimatorRun r = { 0.0f, 0.0f, 0.0f };
+    const SensorSample_t *pGps = nullptr, *pImu = nullptr;
+    int gc = 0, ic = 0;
+    for (int k = 1; k <= ticks; k++) {
+        float now = 10.0f * (float)k;
+        pGps = SensorFault_Latest(gps.data(), (int)gps.size(), &gc, now, pGps);
+        pImu = SensorFault_Latest(imu.data(), (int)imu.size(), &ic, now, pImu);
+
+        TimeData_t t = { now };
+        GPSData_t  g = { 0.0f, 0.0f, -1.0e6f };        // 아직 없음 = 유효 시간 밖
+        IMUData_t  m = { 0.0f, 0.0f, 0.0f };
+        if (pGps) SensorFault_ToGps(pGps, &g);
+        if (pImu) SensorFault_ToImu(pImu, &m);
+        EgoData_t ego;
+        EgoVehicleEstimation(&t, &g, &m, &ego, &kf);
+
+        if (k > 300) r.Max_Err = std::fmax(r.Max_Err, std::fabs(ego.Ego_Velocity_X - truthVx));
+        r.Max_Accel = std::fmax(r.Max_Accel, std::fabs(ego.Ego_Acceleration_X));
+    }
+    r.Final_Prev_Gps = kf.Prev_GPS_Vel_X;
+    return r;
+}
+
+TEST(SensorFaultTest, EstimatorRejectsSpikesAndStaleGps) {
+    // 스파이크만 (GPS 15 m/s, IMU 5 m/s^2 -> 임계값 10 / 3 초과): 전부 거부
+    SensorFaultConfig_t cfg = CleanConfig();
+    cfg.Sensor[SENSOR_FAULT_GPS].Latency_Ms = 20.0f;
+    cfg.Sensor[SENSOR_FAULT_GPS].Channel[0].Spike_Prob      = 0.2f;
+    cfg.Sensor[SENSOR_FAULT_GPS].Channel[0].Spike_Amplitude = 15.0f;
+    cfg.Sensor[SENSOR_FAULT_IMU].Channel[0].Spike_Prob      = 0.05f;
+    cfg.Sensor[SENSOR_FAULT_IMU].Channel[0].Spike_Amplitude = 5.0f;
+
+    EstimatorRun spiky = RunEstimator(cfg, 20.0f, 15.0f);
+    EXPECT_LT(spiky.Max_Err, 0.5f);
+    EXPECT_LT(spiky.Max_Accel, 1.0f);              // 채택된 IMU 스파이크는 X[2] 에 누적 (>= 5) -> 없음
+    EXPECT_FLOAT_EQ(spiky.Final_Prev_Gps, 20.0f);
+
+    // GPS 지연 80 ms > 유효 시간 50 ms: GPS 갱신 없음 -> 초기 속도 유지
+    SensorFaultConfig_t stale = CleanConfig();
+    stale.Sensor[SENSOR_FAULT_GPS].Latency_Ms = 80.0f;
+    EstimatorRun r = RunEstimator(stale, 20.0f, 15.0f);
+    EXPECT_FLOAT_EQ(r.Final_Prev_Gps, 15.0f);
+    EXPECT_GT(r.Max_Err, 4.9f);
+
+    // 지연 30 ms: 갱신 -> 참값 수렴
+    stale.Sensor[SENSOR_FAULT_GPS].Latency_Ms = 30.0f;
+    r = RunEstimator(stale, 20.0f, 15.0f);
+    EXPECT_FLOAT_EQ(r.Final_Prev_Gps, 20.0f);
+    EXPECT_LT(r.Max_Err, 0.5f);
+}
+
+// Test 5: 장시간 시각 (float ms 는 ~4.6 h 이후 ulp > 1 ms)
+TEST(SensorFaultTest, SubMsDelaySurvivesLongRuns) {
+    const uint64_t base = 3600000u;                    // IMU 10 ms x 3.6e6 = 10 h
+    const int n = 1000;
+    SensorFaultConfig_t cfg = CleanConfig();
+    cfg.Sensor[SENSOR_FAULT_IMU].Latency_Ms = 0.3f;
+    cfg.Sensor[SENSOR_FAULT_IMU].Jitter_Ms  = 0.2f;
+
+    std::vector<SensorSample_t> s = MakeSamples(n, 0.0f, 0.0f, 0.0f);
+    for (int i = 0; i < n; i++)
+        s[(size_t)i].Index = base + (uint64_t)i;
+    ASSERT_EQ(SensorFault_Apply(&cfg, SENSOR_FAULT_IMU, 0, s.data(), n), 0);
+
+    for (int i = 0; i < n; i++) {
+        const SensorSample_t &p = s[(size_t)i];
+        EXPECT_DOUBLE_EQ(p.Measure_Time, 10.0 * (double)(base + (uint64_t)i));
+        double delay = p.Arrival_Time - p.Measure_Time;
+        EXPECT_GE(delay, 0.1 - 1e-6);
+        EXPECT_LE(delay, 0.5 + 1e-6);
+    }
+
+    // 측정 직후 0.05 ms 에는 아직 도착 전, 0.6 ms 후에는 도착
+    int cursor = 0;
+    const double t0 = s[0].Measure_Time;
+    EXPECT_EQ(SensorFault_Latest(s.data(), n, &cursor, t0 + 0.05, nullptr), nullptr);
+    EXPECT_EQ(SensorFault_Latest(s.data(), n, &cursor, t0 + 0.6, nullptr), &s[0]);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
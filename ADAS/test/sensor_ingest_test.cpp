@@ -0,0 +1,157 @@
+// sensor_ingest_test.cpp
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+extern "C" {
+  #include "sensor_ingest.h"
+  #include "spsc_queue.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. SPSC 큐: 용량 검사, 가득 참 -> Dropped, 링 경계를 넘는 일괄 꺼내기 순서
+2. SPSC 큐 동시 실행: 생산자/소비자 스레드, 유실/순서 오류 없음
+3. 센서 입력: QUEUE 는 전체 샘플 일괄 수신 + 최신값 반영, MAILBOX 는 최신값만 (덮어쓴 수 = Lost)
+4. 런타임 입력 콜백 연결: 드라이버 스레드 게시 -> 주기마다 Drain, 게시 = 수신 + 유실, 전달 지연 < 주기
+*/
+
+static AdasSensorIngest_t s_ingest;
+
+// Test 1: SPSC 기본
+TEST(SensorIngestTest, SpscQueueBasics) {
+    SpscQueue_t q;
+    uint32_t storage[8];
+    EXPECT_EQ(SpscQueue_Init(&q, storage, sizeof(uint32_t), 6), -1);
+    ASSERT_EQ(SpscQueue_Init(&q, storage, sizeof(uint32_t), 8), 0);
+    EXPECT_EQ(SpscQueue_Capacity(&q), 8u);
+
+    uint32_t out[8];
+    EXPECT_EQ(SpscQueue_PopBatch(&q, out, 8), 0u);
+
+    for (uint32_t v = 0; v < 8; v++) ASSERT_EQ(SpscQueue_Push(&q, &v), 0);
+    uint32_t extra = 99;
+    EXPECT_EQ(SpscQueue_Push(&q, &extra), -1);
+    EXPECT_EQ(q.Dropped, 1u);
+    EXPECT_EQ(SpscQueue_Count(&q), 8u);
+
+    ASSERT_EQ(SpscQueue_PopBatch(&q, out, 5), 5u);
+    for (uint32_t v = 8; v < 13; v++) ASSERT_EQ(SpscQueue_Push(&q, &v), 0);   // 링 경계 넘김
+
+    ASSERT_EQ(SpscQueue_PopBatch(&q, out, 8), 8u);
+    for (uint32_t i = 0; i < 8; i++) EXPECT_EQ(out[i], 5 + i);
+    EXPECT_EQ(SpscQueue_Count(&q), 0u);
+}
+
+// Test 2: SPSC 동시 실행
+TEST(SensorIngestTest, SpscQueueConcurrent) {
+    static SpscQueue_t q;
+    static uint64_t storage[64];
+    ASSERT_EQ(SpscQueue_Init(&q, storage, sizeof(uint64_t), 64), 0);
+
+    const uint64_t N = 500000;
+    std::thread producer([&] {
+        for (uint64_t v = 1; v <= N; v++) {
+            while (SpscQueue_Push(&q, &v) != 0) std::this_thread::yield();
+        }
+    });
+
+    uint64_t expect = 1, errors = 0, batch[7];
+    while (expect <= N) {
+        uint32_t n = SpscQueue_PopBatch(&q, batch, 7);
+        if (n == 0) { std::this_thread::yield(); continue; }
+        for (uint32_t i = 0; i < n; i++) errors += (batch[i] != expect++);
+    }
+    producer.join();
+    EXPECT_EQ(errors, 0u);
+    EXPECT_EQ(expect, N + 1);
+}
+
+// Test 3: QUEUE / MAILBOX 모드
+TEST(SensorIngestTest, QueueAndMailboxDrain) {
+    ASSERT_EQ(AdasIngest_Init(&s_ingest, NULL), 0);
+    EXPECT_EQ(s_ingest.Channel[ADAS_SENSOR_GPS].Mode, ADAS_INGEST_MODE_QUEUE);
+    EXPECT_EQ(s_ingest.Channel[ADAS_SENSOR_OBJECTS].Mode, ADAS_INGEST_MODE_MAILBOX);
+
+    for (int i = 1; i <= 3; i++) {
+        GPSData_t gps = { (float)i, 0.0f, 10.0f * i };
+        ASSERT_EQ(AdasIngest_PushGps(&s_ingest, &gps), 0);
+    }
+    for (int i = 1; i <= 5; i++) {
+        IMUData_t imu = { 0.1f * i, 0.0f, 0.0f };
+        ASSERT_EQ(AdasIngest_PushImu(&s_ingest, &imu), 0);
+    }
+    ObjectData_t objs[2] = {};
+    objs[0].Object_ID = 7;
+    ASSERT_EQ(AdasIngest_PushObjects(&s_ingest, objs, 2), 0);
+    objs[0].Object_ID = 8;
+    ASSERT_EQ(AdasIngest_PushObjects(&s_ingest, objs, 1), 0);
+
+    static AdasFrameInput_t in;
+    memset(&in, 0, sizeof(in));
+    int updated = AdasIngest_Drain(&s_ingest, &in);
+    EXPECT_EQ(updated, ADAS_INGEST_UPDATED(ADAS_SENSOR_GPS) | ADAS_INGEST_UPDATED(ADAS_SENSOR_IMU) |
+                       ADAS_INGEST_UPDATED(ADAS_SENSOR_OBJECTS));
+    EXPECT_FLOAT_EQ(in.Gps.GPS_Velocity_X, 3.0f);
+    EXPECT_FLOAT_EQ(in.Imu.Linear_Acceleration_X, 0.5f);
+    EXPECT_EQ(in.Object_Count, 1);
+    EXPECT_EQ(in.Objects[0].Object_ID, 8);
+    EXPECT_FLOAT_EQ(s_ingest.Gps_Batch[0].Data.GPS_Velocity_X, 1.0f);   // 전체 샘플 보존
+
+    EXPECT_EQ(s_ingest.Channel[ADAS_SENSOR_IMU].Stats.Max_Batch, 5u);
+    EXPECT_EQ(s_ingest.Channel[ADAS_SENSOR_IMU].Stats.Lost, 0u);
+    EXPECT_EQ(s_ingest.Channel[ADAS_SENSOR_OBJECTS].Stats.Received, 1u);
+    EXPECT_EQ(s_ingest.Channel[ADAS_SENSOR_OBJECTS].Stats.Lost, 1u);
+
+    // 새 샘플 없음 -> 이전 값 유지
+    EXPECT_EQ(AdasIngest_Drain(&s_ingest, &in), 0);
+    EXPECT_FLOAT_EQ(in.Gps.GPS_Velocity_X, 3.0f);
+    EXPECT_EQ(AdasIngest_Drain(NULL, &in), -1);
+}
+
+// Test 4: 런타임 연결
+TEST(SensorIngestTest, RuntimeDrainsDriverThread) {
+    ASSERT_EQ(AdasIngest_Init(&s_ingest, NULL), 0);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> pushed{0};
+    std::thread driver([&] {
+        uint64_t release = AdasTime_NowNs();
+        IMUData_t imu = {};
+        while (!stop.load()) {
+            imu.Linear_Acceleration_X += 0.001f;
+            AdasIngest_PushImu(&s_ingest, &imu);
+            pushed++;
+            release += 250 * ADAS_NS_PER_US;
+            AdasTime_SleepUntilNs(release);
+        }
+    });
+
+    static AdasRuntime_t rt;
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 2 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 20;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, AdasIngest_InputFn, NULL, &s_ingest), 0);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+
+    stop = true;
+    driver.join();
+    AdasIngest_Drain(&s_ingest, &rt.Input);
+
+    const AdasIngestStats_t *pSt = &s_ingest.Channel[ADAS_SENSOR_IMU].Stats;
+    EXPECT_EQ(pSt->Received + pSt->Lost, pushed.load());
+    EXPECT_EQ(pSt->Lost, 0u);
+    EXPECT_GT(pSt->Max_Batch, 1u);
+    EXPECT_GT(rt.Input.Imu.Linear_Acceleration_X, 0.0f);
+    AdasIngest_PrintStats(&s_ingest);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,257 @@
+// shm_transport_test.cpp
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+extern "C" {
+  #include "shm_transport.h"
+  #include "adas_runtime.h"
+  #include "adas_time.h"
+}
+
+/*
+테스트 항목:
+1. 생성/열기: 없는 이름은 ERR_ARG, 헤더 버전 불일치는 ERR_LAYOUT, 정상 열기는 읽기 전용 매핑
+2. 게시 -> 최신 프레임 획득: 슬롯 포인터가 매핑 영역 안 (복사 없음), 건너뛴 프레임 수, Validate 통과
+3. 덮어쓰기 검출: 획득 후 링 한 바퀴 이상 게시하면 Validate 실패 (Torn_Reads 증가)
+   어댑터: 새 프레임 없으면 NULL (재전달 없음), InputCheck 는 이번 주기 프레임 덮어쓰기 검출
+4. 런타임 참조 입력: 생산자 스레드 게시 -> 주기마다 최신 프레임을 그 자리에서 처리
+5. 런타임 재확인: 처리 중 덮어쓰인 주기는 출력 폐기 + 상태 복원 (Input_Torn), 새 프레임 없는 주기는 Input_Missing (Pipeline_Runs 제외)
+*/
+
+static std::string shm_name(const char *tag) {
+    char buf[ADAS_SHM_NAME_MAX];
+    snprintf(buf, sizeof(buf), "/adas_shm_test_%s_%d", tag, (int)getpid());
+    return buf;
+}
+
+static void publish(AdasShmTransport_t *pT, float timeMs, float speed) {
+    AdasShmFrame_t *pF = AdasShm_BeginWrite(pT);
+    ASSERT_NE(pF, nullptr);
+    pF->Input.Time.Current_Time = timeMs;
+    pF->Input.Gps.GPS_Velocity_X = speed;
+    pF->Input.Lane.Lane_Width = 3.5f;
+    pF->Input.Object_Count = 0;
+    AdasShm_EndWrite(pT);
+}
+
+// Test 1: 생성/열기 + 레이아웃 검증
+TEST(ShmTransportTest, CreateOpenValidatesLayout) {
+    std::string name = shm_name("open");
+    AdasShmTransport_t prod, cons;
+
+    EXPECT_EQ(AdasShm_Open(&cons, name.c_str()), ADAS_SHM_ERR_ARG);
+    ASSERT_EQ(AdasShm_Create(&prod, name.c_str()), 0);
+    EXPECT_EQ(prod.pRegion->Header.Magic, ADAS_SHM_MAGIC);
+    EXPECT_EQ(prod.pRegion->Header.Frame_Size, sizeof(AdasShmFrame_t));
+
+    // 다른 버전의 생산자 흉내
+    prod.pRegion->Header.Version = ADAS_SHM_VERSION + 1;
+    EXPECT_EQ(AdasShm_Open(&cons, name.c_str()), ADAS_SHM_ERR_LAYOUT);
+    prod.pRegion->Header.Version = ADAS_SHM_VERSION;
+
+    ASSERT_EQ(AdasShm_Open(&cons, name.c_str()), 0);
+    EXPECT_FALSE(cons.Is_Producer);
+    EXPECT_EQ(AdasShm_BeginWrite(&cons), nullptr);   // 소비자는 쓰기 불가
+
+    const AdasShmFrame_t *pF;
+    uint32_t seq;
+    EXPECT_EQ(AdasShm_AcquireLatest(&cons, &pF, &seq), 0);   // 아직 게시 없음
+
+    AdasShm_Close(&cons, 1);
+    AdasShm_Close(&prod, 1);
+    EXPECT_EQ(AdasShm_Open(&cons, name.c_str()), ADAS_SHM_ERR_ARG);   // unlink 확인
+}
+
+// Test 2: 최신 프레임을 복사 없이 획득
+TEST(ShmTransportTest, AcquireLatestInPlace) {
+    std::string name = shm_name("latest");
+    AdasShmTransport_t prod, cons;
+    ASSERT_EQ(AdasShm_Create(&prod, name.c_str()), 0);
+    ASSERT_EQ(AdasShm_Open(&cons, name.c_str()), 0);
+
+    for (int i = 1; i <= 3; i++) publish(&prod, 10.0f * i, (float)i);
+
+    const AdasShmFrame_t *pF = nullptr;
+    uint32_t seq = 0;
+    ASSERT_EQ(AdasShm_AcquireLatest(&cons, &pF, &seq), 1);
+    const char *pBase = (const char *)cons.pRegion;
+    EXPECT_GE((const char *)pF, pBase);
+    EXPECT_LT((const char *)pF, pBase + sizeof(AdasShmRegion_t));
+    EXPECT_EQ(pF->Frame_Id, 3u);
+    EXPECT_EQ(seq % 2, 0u);
+    EXPECT_FLOAT_EQ(pF->Input.Gps.GPS_Velocity_X, 3.0f);
+    EXPECT_EQ(AdasShm_Validate(&cons, pF, seq), 1);
+    EXPECT_EQ(AdasShm_AcquireLatest(&cons, &pF, &seq), 0);   // 새 프레임 없음
+
+    for (int i = 4; i <= 6; i++) publish(&prod, 10.0f * i, (float)i);
+    ASSERT_EQ(AdasShm_AcquireLatest(&cons, &pF, &seq), 1);
+    EXPECT_EQ(pF->Frame_Id, 6u);
+    EXPECT_EQ(cons.Stats.Frames_Read, 2u);
+    EXPECT_EQ(cons.Stats.Frames_Skipped, 2u);   // 4, 5
+
+    AdasShm_Close(&cons, 0);
+    AdasShm_Close(&prod, 1);
+}
+
+// Test 3: 사용 중 덮어쓰기 검출
+TEST(ShmTransportTest, DetectsOverwrittenFrame) {
+    std::string name = shm_name("torn");
+    AdasShmTransport_t prod, cons;
+    ASSERT_EQ(AdasShm_Create(&prod, name.c_str()), 0);
+    ASSERT_EQ(AdasShm_Open(&cons, name.c_str()), 0);
+
+    publish(&prod, 0.0f, 1.0f);
+    const AdasShmFrame_t *pF;
+    uint32_t seq;
+    ASSERT_EQ(AdasShm_AcquireLatest(&cons, &pF, &seq), 1);
+
+    // 슬롯 수 - 1 프레임까지는 유지
+    for (uint32_t i = 0; i < ADAS_SHM_RING_SLOTS - 1; i++) publish(&prod, 0.0f, 2.0f);
+    EXPECT_EQ(AdasShm_Validate(&cons, pF, seq), 1);
+
+    publish(&prod, 0.0f, 3.0f);   // 같은 슬롯 재사용
+    EXPECT_EQ(AdasShm_Validate(&cons, pF, seq), 0);
+    EXPECT_EQ(cons.Stats.Torn_Reads, 1u);
+
+    // 어댑터: 최신 프레임 전달 -> 새 프레임 없으면 NULL (같은 프레임 재전달 없음)
+    const AdasFrameInput_t *pIn = nullptr;
+    ASSERT_EQ(AdasShm_InputRefFn(&cons, 0, &pIn), 0);
+    ASSERT_NE(pIn, nullptr);
+    EXPECT_FLOAT_EQ(pIn->Gps.GPS_Velocity_X, 3.0f);
+    EXPECT_EQ(AdasShm_InputCheckFn(&cons, 0, pIn), 1);
+    ASSERT_EQ(AdasShm_InputRefFn(&cons, 1, &pIn), 0);
+    EXPECT_EQ(pIn, nullptr);
+    EXPECT_EQ(AdasShm_InputCheckFn(&cons, 1, pIn), 0);
+
+    // 처리 중 링 한 바퀴 게시 -> 재확인 실패
+    publish(&prod, 0.0f, 4.0f);
+    ASSERT_EQ(AdasShm_InputRefFn(&cons, 2, &pIn), 0);
+    ASSERT_NE(pIn, nullptr);
+    for (uint32_t i = 0; i < ADAS_SHM_RING_SLOTS; i++) publish(&prod, 0.0f, 5.0f);
+    EXPECT_EQ(AdasShm_InputCheckFn(&cons, 2, pIn), 0);
+    EXPECT_EQ(cons.Stats.Torn_Reads, 2u);
+
+    AdasShm_Close(&cons, 0);
+    AdasShm_Close(&prod, 1);
+}
+
+// Test 4: 런타임 참조 입력 연결
+TEST(ShmTransportTest, RuntimeConsumesFramesInPlace) {
+    std::string name = shm_name("rt");
+    static AdasShmTransport_t prod, cons;
+    ASSERT_EQ(AdasShm_Create(&prod, name.c_str()), 0);
+    ASSERT_EQ(AdasShm_Open(&cons, name.c_str()), 0);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> published{0};
+    std::thread producer([&] {
+        uint64_t release = AdasTime_NowNs();
+        for (uint64_t k = 0; !stop.load(); k++) {
+            AdasShmFrame_t *pF = AdasShm_BeginWrite(&prod);
+            memset(&pF->Input, 0, sizeof(pF->Input));
+            pF->Input.Time.Current_Time  = (float)k;
+            pF->Input.Gps.GPS_Velocity_X = 10.0f;
+            pF->Input.Lane.Lane_Width    = 3.5f;
+            AdasShm_EndWrite(&prod);
+            published++;
+            release += 1 * ADAS_NS_PER_MS;
+            AdasTime_SleepUntilNs(release);
+        }
+    });
+
+    static AdasRuntime_t rt;
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 2 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 30;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, NULL, NULL, &cons), 0);
+    AdasRuntime_SetInputRef(&rt, AdasShm_InputRefFn, AdasShm_InputCheckFn);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+
+    stop = true;
+    producer.join();
+
+    EXPECT_EQ(rt.Stats.Cycles, 30u);
+    EXPECT_LE(rt.Stats.Input_Missing, 1u);
+    EXPECT_GT(cons.Stats.Frames_Read, 20u);
+    EXPECT_LE(cons.Stats.Frames_Read + cons.Stats.Frames_Skipped, published.load());
+    EXPECT_GT(rt.Output.Ego.Ego_Velocity_X, 0.0f);
+
+    AdasRuntime_Destroy(&rt);
+    AdasShm_Close(&cons, 0);
+    AdasShm_Close(&prod, 1);
+}
+
+// Test 5: 재확인 실패 주기 폐기 / 새 프레임 없는 주기 건너뜀 (생산자 = 입력 콜백 안에서 동기 게시)
+struct TornCtx {
+    AdasShmTransport_t  Prod;
+    AdasShmTransport_t  Cons;
+    AdasRuntime_t      *pRt;
+    AdasPipeline_t      Before_Torn;
+    int                 Outputs[16];
+    int                 Restored;
+};
+
+static int TornInputRef(void *pUser, uint64_t cycle, const AdasFrameInput_t **ppIn) {
+    TornCtx *pC = (TornCtx *)pUser;
+    if ((cycle % 2) == 0)                  // 홀수 주기는 새 프레임 없음 (5 는 주기 4 에서 게시한 프레임)
+        publish(&pC->Prod, (float)cycle, 10.0f);
+    if (cycle == 5)                        // 직전 주기 (4, torn) 가 상태를 바꾸지 않았는지
+        pC->Restored = (std::memcmp(&pC->Before_Torn, &pC->pRt->Pipeline, sizeof(AdasPipeline_t)) == 0);
+    int rc = AdasShm_InputRefFn(&pC->Cons, cycle, ppIn);
+    if (cycle == 4) {                      // 처리 중 생산자가 링을 한 바퀴 도는 상황
+        pC->Before_Torn = pC->pRt->Pipeline;
+        for (uint32_t i = 0; i < ADAS_SHM_RING_SLOTS; i++) publish(&pC->Prod, 0.0f, 99.0f);
+    }
+    return rc;
+}
+
+static int TornInputCheck(void *pUser, uint64_t cycle, const AdasFrameInput_t *pIn) {
+    return AdasShm_InputCheckFn(&((TornCtx *)pUser)->Cons, cycle, pIn);
+}
+
+static void TornOutput(void *pUser, uint64_t cycle, const AdasFrameOutput_t *) {
+    ((TornCtx *)pUser)->Outputs[cycle]++;
+}
+
+TEST(ShmTransportTest, RuntimeDropsTornAndStaleCycles) {
+    std::string name = shm_name("recheck");
+    static TornCtx ctx;
+    static AdasRuntime_t rt;
+    std::memset(&ctx, 0, sizeof(ctx));
+    ctx.pRt = &rt;
+    ASSERT_EQ(AdasShm_Create(&ctx.Prod, name.c_str()), 0);
+    ASSERT_EQ(AdasShm_Open(&ctx.Cons, name.c_str()), 0);
+
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+    cfg.Period_Ns   = 1 * ADAS_NS_PER_MS;
+    cfg.Cycle_Limit = 10;
+    ASSERT_EQ(AdasRuntime_Init(&rt, &cfg, NULL, TornOutput, &ctx), 0);
+    AdasRuntime_SetInputRef(&rt, TornInputRef, TornInputCheck);
+    ASSERT_EQ(AdasRuntime_Run(&rt), 0);
+
+    EXPECT_EQ(rt.Stats.Cycles, 10u);
+    EXPECT_EQ(rt.Stats.Input_Missing, 4u);     // 1, 3, 7, 9
+    EXPECT_EQ(rt.Stats.Input_Torn, 1u);        // 4
+    EXPECT_EQ(rt.Stats.Pipeline_Runs, 6u);     // 입력 없는 주기 제외 (찢긴 4 는 실행 후 폐기)
+    EXPECT_EQ(ctx.Cons.Stats.Torn_Reads, 1u);
+    for (int c = 0; c < 10; c++)
+        EXPECT_EQ(ctx.Outputs[c], (((c % 2) == 0) != (c == 4 || c == 5)) ? 1 : 0) << "cycle " << c;
+    EXPECT_TRUE(ctx.Restored);
+
+    AdasRuntime_Destroy(&rt);
+    AdasShm_Close(&ctx.Cons, 0);
+    AdasShm_Close(&ctx.Prod, 1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,377 @@
+// sim_clock_test.cpp
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+  #include "sim_clock.h"
+  #include "adas_rng.h"
+  #include "ego_vehicle_estimation.h"
+}
+
+/*
+테스트 항목:
+1. 순서: 무작위 타이머 수천 개 (µs ~ 2^40 µs, 단 경계 carry 근처 시작) -> (시각, Priority, 예약 순) 정렬 순서와 동일
+2. 주기 / 콜백: 주기 타이머 드리프트 없음, 콜백에서 취소 / 재예약 / 현재 시각 예약, 인자 오류
+3. 실행 제어: Step 묶음 단위, RunUntil 경계 (end 포함, Now = end), SimClock_Stop, NextWake
+4. 다중 주기: GPS 100 ms + 전달 지연, IMU / 제어 10 ms, 액추에이터 지연 -> Ego 추정기 GPS 유효 비율
+*/
+
+struct FireLog {
+    std::vector<int>       Order;
+    std::vector<SimTime_t> Time;
+};
+
+struct Item {
+    SimTimer_t Timer;
+    int        Id;
+    FireLog   *pLog;
+};
+
+static void LogFire(SimClock_t *pClock, SimTimer_t *, void *pUser)
+{
+    Item *pItem = (Item *)pUser;
+    pItem->pLog->Order.push_back(pItem->Id);
+    pItem->pLog->Time.push_back(SimClock_Now(pClock));
+}
+
+// Test 1: 무작위 예약 -> 정렬 순서
+TEST(SimClockTest, FiresInTimePriorityScheduleOrder) {
+    const int N = 20000;
+    const SimTime_t start = (1ull << 42) - 777u;     // 상위 단 자리 올림 직전
+    SimClock_t *pClock = new SimClock_t;
+    SimClock_Init(pClock, start);
+
+    AdasRng_t rng;
+    AdasRng_Seed(&rng, 11u, 0u);
+    std::vector<Item> items((size_t)N);
+    std::vector<bool> cancelled((size_t)N, false);
+    FireLog log;
+    SimTime_t last = start;
+    for (int i = 0; i < N; i++) {
+        uint64_t r = AdasRng_Next64(&rng);
+        SimTime_t delay;
+        switch (r & 3u) {
+            case 0:  delay = (r >> 8) % 200u; break;                 // 같은 1 단 안 / 동시각 다수
+            case 1:  delay = (r >> 8) % 100000u; break;
+            case 2:  delay = (r >> 8) % (1ull << 30); break;
+            default: delay = (r >> 8) % (1ull << 40); break;
+        }
+        items[(size_t)i].Id   = i;
+        items[(size_t)i].pLog = &log;
+        SimTimer_Init(&items[(size_t)i].Timer, LogFire, &items[(size_t)i], (int32_t)((r >> 4) & 3u));
+        ASSERT_EQ(SimClock_ScheduleAt(pClock, &items[(size_t)i].Timer, start + delay, 0u), 0);
+        last = std::max(last, start + delay);
+    }
+    for (int i = 0; i < N; i += 9) {                 // 일부 취소
+        SimClock_Cancel(pClock, &items[(size_t)i].Timer);
+        cancelled[(size_t)i] = true;
+    }
+    EXPECT_EQ(pClock->Armed, (uint32_t)(N - (N + 8) / 9));
+
+    std::vector<int> expect;
+    for (int i = 0; i < N; i++)
+        if (!cancelled[(size_t)i]) expect.push_back(i);
+    std::stable_sort(expect.begin(), expect.end(), [&](int a, int b) {
+        const SimTimer_t &ta = items[(size_t)a].Timer, &tb = items[(size_t)b].Timer;
+        if (ta.Expires != tb.Expires) return ta.Expires < tb.Expires;
+        return ta.Priority < tb.Priority;            // 같으면 예약 순 (= 인덱스 순, stable)
+    });
+
+    EXPECT_EQ(SimClock_RunUntil(pClock, last), (uint64_t)expect.size());
+    ASSERT_EQ(log.Order.size(), expect.size());
+    EXPECT_EQ(log.Order, expect);
+    for (size_t k = 0; k < log.Order.size(); k++)
+        ASSERT_EQ(log.Time[k], items[(size_t)log.Order[k]].Timer.Expires) << k;
+    EXPECT_EQ(SimClock_Now(pClock), last);
+    EXPECT_EQ(pClock->Armed, 0u);
+    EXPECT_GT(pClock->Cascaded, 0u);
+
+    SimTime_t wake;
+    EXPECT_EQ(SimClock_NextWake(pClock, &wake), -1);
+    delete pClock;
+}
+
+// Test 2: 주기 타이머 / 콜백 안 예약 조작
+struct Chain {
+    SimTimer_t Timer;
+    SimTime_t  Delay;
+    std::vector<SimTime_t> Seen;
+};
+
+static void ChainFire(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Chain *pC = (Chain *)pUser;
+    pC->Seen.push_back(SimClock_Now(pClock));
+    if (pC->Delay < (1ull << 40)) {
+        pC->Delay *= 2u;
+        SimClock_ScheduleIn(pClock, pTimer, pC->Delay, 0u);
+    }
+}
+
+struct Killer {
+    SimTimer_t  Timer;
+    SimTimer_t *pVictim;
+    SimTimer_t *pNow;                                // 현재 시각으로 예약할 타이머
+};
+
+static void KillFire(SimClock_t *pClock, SimTimer_t *, void *pUser)
+{
+    Killer *pK = (Killer *)pUser;
+    SimClock_Cancel(pClock, pK->pVictim);
+    if (pK->pNow) SimClock_ScheduleIn(pClock, pK->pNow, 0u, 0u);
+}
+
+TEST(SimClockTest, PeriodicAndCallbackRescheduling) {
+    SimClock_t *pClock = new SimClock_t;
+    SimClock_Init(pClock, 0u);
+
+    // 10 ms 주기: 0 ~ 1 s 포함 101 회, 마지막 = 정확히 1 s (누적 오차 없음)
+    FireLog log;
+    Item tick = {};
+    tick.pLog = &log;
+    SimTimer_Init(&tick.Timer, LogFire, &tick, 0);
+    ASSERT_EQ(SimClock_ScheduleAt(pClock, &tick.Timer, 0u, 10u * SIM_US_PER_MS), 0);
+    EXPECT_EQ(SimClock_RunUntil(pClock, SIM_US_PER_SEC), 101u);
+    ASSERT_EQ(log.Time.size(), 101u);
+    for (size_t k = 0; k < log.Time.size(); k++)
+        EXPECT_EQ(log.Time[k], (SimTime_t)k * 10000u);
+    EXPECT_TRUE(tick.Timer.Armed);                   // 다음 주기 예약됨
+
+    // 1.5 s 에 취소 (Priority -1 -> 같은 시각 주기 타이머보다 먼저), 이어 현재 시각 예약 -> 같은 RunUntil 안에서 실행
+    Killer killer = {};
+    killer.pVictim = &tick.Timer;
+    FireLog lateLog;
+    Item late = {};
+    late.Id   = 7;
+    late.pLog = &lateLog;
+    SimTimer_Init(&late.Timer, LogFire, &late, -100);
+    killer.pNow = &late.Timer;
+    SimTimer_Init(&killer.Timer, KillFire, &killer, -1);
+    ASSERT_EQ(SimClock_ScheduleAt(pClock, &killer.Timer, 1500u * SIM_US_PER_MS, 0u), 0);
+    SimClock_RunUntil(pClock, 3u * SIM_US_PER_SEC);
+    EXPECT_EQ(log.Time.size(), 150u);                // 1.01 ~ 1.49 s 추가 49 회
+    EXPECT_EQ(log.Time.back(), 1490u * SIM_US_PER_MS);
+    EXPECT_FALSE(tick.Timer.Armed);
+    ASSERT_EQ(lateLog.Time.size(), 1u);              // Priority 가 낮아도 현재 묶음 다음
+    EXPECT_EQ(lateLog.Time[0], 1500u * SIM_US_PER_MS);
+
+    // 콜백 재예약: 지연 1, 2, 4 ... 2^40 µs (모든 단 통과)
+    Chain chain = {};
+    chain.Delay = 1u;
+    SimTimer_Init(&chain.Timer, ChainFire, &chain, 0);
+    const SimTime_t t0 = SimClock_Now(pClock);
+    ASSERT_EQ(SimClock_ScheduleIn(pClock, &chain.Timer, 1u, 0u), 0);
+    SimClock_RunUntil(pClock, UINT64_MAX - 1u);
+    ASSERT_EQ(chain.Seen.size(), 41u);
+    SimTime_t expectT = t0;
+    for (size_t k = 0; k < chain.Seen.size(); k++) {
+        expectT += (1ull << k);
+        EXPECT_EQ(chain.Seen[k], expectT) << k;
+    }
+    EXPECT_EQ(SimClock_Now(pClock), UINT64_MAX - 1u);
+
+    // 인자 오류
+    Item past = {};
+    SimTimer_Init(&past.Timer, LogFire, &past, 0);
+    EXPECT_EQ(SimClock_ScheduleAt(pClock, &past.Timer, 5u, 0u), -1);
+    EXPECT_EQ(SimClock_ScheduleIn(pClock, &past.Timer, 2u, 0u), -1);     // overflow
+    EXPECT_EQ(SimClock_ScheduleAt(nullptr, &past.Timer, 0u, 0u), -1);
+    EXPECT_EQ(SimClock_ScheduleAt(pClock, nullptr, UINT64_MAX, 0u), -1);
+    EXPECT_EQ(pClock->Armed, 0u);
+    delete pClock;
+}
+
+// Test 3: Step / RunUntil 경계 / Stop
+static void StopFire(SimClock_t *pClock, SimTimer_t *, void *)
+{
+    SimClock_Stop(pClock);
+}
+
+TEST(SimClockTest, StepRunUntilAndStop) {
+    SimClock_t *pClock = new SimClock_t;
+    SimClock_Init(pClock, 100u);
+
+    FireLog log;
+    Item a = {}, b = {}, c = {}, d = {};
+    Item *all[] = { &a, &b, &c, &d };
+    for (int i = 0; i < 4; i++) {
+        all[i]->Id   = i;
+        all[i]->pLog = &log;
+        SimTimer_Init(&all[i]->Timer, LogFire, all[i], 0);
+    }
+    SimClock_ScheduleAt(pClock, &a.Timer, 105u, 0u);
+    SimClock_ScheduleAt(pClock, &b.Timer, 105u, 0u);
+    SimClock_ScheduleAt(pClock, &c.Timer, 5000u, 0u);
+    SimClock_ScheduleAt(pClock, &d.Timer, 5001u, 0u);
+
+    SimTime_t wake;
+    ASSERT_EQ(SimClock_NextWake(pClock, &wake), 0);
+    EXPECT_EQ(wake, 105u);
+    EXPECT_EQ(SimClock_Step(pClock), 2u);
+    EXPECT_EQ(SimClock_Now(pClock), 105u);
+    ASSERT_EQ(SimClock_NextWake(pClock, &wake), 0);
+    EXPECT_LE(wake, 5000u);                          // 상위 단 재배치 시각 (<= 실제 이벤트)
+    EXPECT_GT(wake, 105u);
+
+    EXPECT_EQ(SimClock_RunUntil(pClock, 5000u), 1u); // end 포함
+    EXPECT_EQ(SimClock_Now(pClock), 5000u);
+    EXPECT_EQ(SimClock_RunUntil(pClock, 4000u), 0u); // 과거 end: 시계 그대로
+    EXPECT_EQ(SimClock_Now(pClock), 5000u);
+    EXPECT_EQ(SimClock_Step(pClock), 1u);
+    EXPECT_EQ(SimClock_Now(pClock), 5001u);
+    EXPECT_EQ(SimClock_Step(pClock), 0u);
+    EXPECT_EQ((std::vector<int>{ 0, 1, 2, 3 }), log.Order);
+
+    // Stop: 그 시각 묶음까지 실행 후 중단, 다음 RunUntil 에서 이어서 실행
+    SimTimer_t stopper;
+    SimTimer_Init(&stopper, StopFire, nullptr, 0);
+    SimClock_ScheduleAt(pClock, &stopper, 8000u, 0u);
+    SimClock_ScheduleAt(pClock, &a.Timer, 8000u, 0u);
+    SimClock_ScheduleAt(pClock, &b.Timer, 9000u, 0u);
+    EXPECT_EQ(SimClock_RunUntil(pClock, 20000u), 2u);
+    EXPECT_EQ(SimClock_Now(pClock), 8000u);
+    EXPECT_TRUE(b.Timer.Armed);
+    EXPECT_EQ(SimClock_RunUntil(pClock, 20000u), 1u);
+    EXPECT_EQ(SimClock_Now(pClock), 20000u);
+    EXPECT_EQ(pClock->Fired, 7u);
+    delete pClock;
+}
+
+// Test 4: 센서 고유 주기 + 전달 지연, 제어 주기, 액추에이터 지연
+enum { SENSOR_PRIO = 0, CONTROL_PRIO = 10, ACTUATOR_PRIO = 20 };
+
+struct GpsPacket {
+    SimTimer_t Timer;
+    GPSData_t  Data;
+};
+
+struct CmdPacket {
+    SimTimer_t Timer;
+    SimTime_t  Issued;
+};
+
+struct Rig {
+    SimTimer_t GpsSample, ImuSample, Control;
+    GpsPacket  Flight[4];                            // 전달 중 GPS (지연 < 주기 * 4)
+    int        Flight_Next;
+    SimTime_t  Gps_Latency;
+    CmdPacket  Cmd[8];                               // 전달 중 명령 (지연 < 제어 주기 * 8)
+    int        Cmd_Next;
+    SimTime_t  Actuator_Delay;
+    SimTime_t  Last_Applied;
+
+    float      Truth_Vx;
+    GPSData_t  Gps;                                  // 최근 도착
+    IMUData_t  Imu;
+    EgoVehicleKFState_t Kf;
+    EgoData_t  Ego;
+
+    int        Ticks, Fresh_Ticks, Imu_Count, Applied;
+    float      Max_Age_Ms, Min_Age_Ms, Max_Err;
+    bool       Actuator_Late;
+};
+
+static void GpsDeliver(SimClock_t *, SimTimer_t *pTimer, void *pUser)
+{
+    Rig *pRig = (Rig *)pUser;
+    pRig->Gps = ((GpsPacket *)(void *)pTimer)->Data;
+}
+
+static void GpsMeasure(SimClock_t *pClock, SimTimer_t *, void *pUser)
+{
+    Rig *pRig = (Rig *)pUser;
+    GpsPacket *pPkt = &pRig->Flight[pRig->Flight_Next];
+    pRig->Flight_Next = (pRig->Flight_Next + 1) % 4;
+    pPkt->Data.GPS_Velocity_X = pRig->Truth_Vx;
+    pPkt->Data.GPS_Velocity_Y = 0.0f;
+    pPkt->Data.GPS_Timestamp  = SimClock_NowMs(pClock);
+    SimClock_ScheduleIn(pClock, &pPkt->Timer, pRig->Gps_Latency, 0u);
+}
+
+static void ImuMeasure(SimClock_t *, SimTimer_t *, void *pUser)
+{
+    Rig *pRig = (Rig *)pUser;
+    pRig->Imu.Linear_Acceleration_X = 0.0f;
+    pRig->Imu_Count++;
+}
+
+static void ActuatorApply(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Rig *pRig = (Rig *)pUser;
+    SimTime_t issued = ((CmdPacket *)(void *)pTimer)->Issued;
+    if ((SimClock_Now(pClock) - issued != pRig->Actuator_Delay) || (issued <= pRig->Last_Applied))
+        pRig->Actuator_Late = true;
+    pRig->Last_Applied = issued;
+    pRig->Applied++;
+}
+
+static void ControlTick(SimClock_t *pClock, SimTimer_t *, void *pUser)
+{
+    Rig *pRig = (Rig *)pUser;
+    TimeData_t time = { SimClock_NowMs(pClock) };
+    EgoVehicleEstimation(&time, &pRig->Gps, &pRig->Imu, &pRig->Ego, &pRig->Kf);
+
+    float age = time.Current_Time - pRig->Gps.GPS_Timestamp;
+    pRig->Ticks++;
+    pRig->Fresh_Ticks += (age <= GPS_VALID_TIME_THRESH) ? 1 : 0;
+    pRig->Max_Age_Ms = std::max(pRig->Max_Age_Ms, age);
+    pRig->Min_Age_Ms = std::min(pRig->Min_Age_Ms, age);
+    pRig->Max_Err    = std::max(pRig->Max_Err, std::fabs(pRig->Ego.Ego_Velocity_X - pRig->Truth_Vx));
+
+    // 명령은 Actuator_Delay 뒤 적용 (전달 지연, 명령마다 1 회성 타이머)
+    CmdPacket *pCmd = &pRig->Cmd[pRig->Cmd_Next];
+    pRig->Cmd_Next = (pRig->Cmd_Next + 1) % 8;
+    pCmd->Issued = SimClock_Now(pClock);
+    SimClock_ScheduleIn(pClock, &pCmd->Timer, pRig->Actuator_Delay, 0u);
+}
+
+TEST(SimClockTest, MultiRateSensorsControlAndActuatorDelay) {
+    SimClock_t *pClock = new SimClock_t;
+    Rig *pRig = new Rig();
+    SimClock_Init(pClock, 0u);
+
+    pRig->Truth_Vx       = 20.0f;
+    pRig->Gps_Latency    = 30u * SIM_US_PER_MS;
+    pRig->Actuator_Delay = 40u * SIM_US_PER_MS;
+    pRig->Min_Age_Ms     = 1.0e9f;
+    InitEgoVehicleKFState(&pRig->Kf);
+    pRig->Kf.X[0]           = pRig->Truth_Vx;
+    pRig->Kf.Prev_GPS_Vel_X = pRig->Truth_Vx;
+    pRig->Gps.GPS_Velocity_X = pRig->Truth_Vx;
+    pRig->Gps.GPS_Timestamp  = -1.0e6f;
+
+    for (GpsPacket &p : pRig->Flight) SimTimer_Init(&p.Timer, GpsDeliver, pRig, SENSOR_PRIO);
+    SimTimer_Init(&pRig->GpsSample, GpsMeasure, pRig, SENSOR_PRIO);
+    SimTimer_Init(&pRig->ImuSample, ImuMeasure, pRig, SENSOR_PRIO);
+    SimTimer_Init(&pRig->Control, ControlTick, pRig, CONTROL_PRIO);
+    for (CmdPacket &c : pRig->Cmd) SimTimer_Init(&c.Timer, ActuatorApply, pRig, ACTUATOR_PRIO);
+    SimClock_ScheduleAt(pClock, &pRig->GpsSample, 0u, 100u * SIM_US_PER_MS);   // 10 Hz
+    SimClock_ScheduleAt(pClock, &pRig->ImuSample, 0u, 10u * SIM_US_PER_MS);    // 100 Hz
+    SimClock_ScheduleAt(pClock, &pRig->Control, 200u * SIM_US_PER_MS, 10u * SIM_US_PER_MS);
+
+    SimClock_RunUntil(pClock, 60u * SIM_US_PER_SEC);
+
+    EXPECT_EQ(pRig->Ticks, 5981);                    // 0.2 ~ 60 s
+    EXPECT_EQ(pRig->Imu_Count, 6001);
+    // 동시각: 센서 도착(0) 이 제어(10) 보다 먼저 -> 나이 30 ~ 120 ms, 주기당 3 틱 (30, 40, 50 ms) 만 50 ms 이내
+    EXPECT_FLOAT_EQ(pRig->Min_Age_Ms, 30.0f);
+    EXPECT_FLOAT_EQ(pRig->Max_Age_Ms, 120.0f);
+    EXPECT_NEAR((double)pRig->Fresh_Ticks / pRig->Ticks, 0.3, 0.001);
+    EXPECT_LT(pRig->Max_Err, 0.01f);
+    // 액추에이터: 명령마다 정확히 40 ms 뒤, 발행 순서대로 적용 (59.96 s 이후 명령은 아직 전달 중)
+    EXPECT_FALSE(pRig->Actuator_Late);
+    EXPECT_EQ(pRig->Applied, 5977);
+    EXPECT_EQ(SimClock_Now(pClock), 60u * SIM_US_PER_SEC);
+
+    delete pRig;
+    delete pClock;
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+// stanley_lut_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+extern "C" {
+  #include "stanley_lut.h"
+  #include "adas_math.h"
+}
+
+/*
+테스트 항목:
+1. 초기화 전: 정확한 법칙 사용 (새 프로세스에서 확인 -> 테스트 순서 / 필터 / shuffle 과 무관)
+2. 초기화: 실측 오차 <= STANLEY_LUT_MAX_ERR_DEG, 테이블 범위 내 결과가 atan 과 오차 범위 내 일치
+3. 범위 밖(cte, vx): 정확한 법칙으로 fallback
+4. 배치(SIMD) 결과 = 스칼라 결과 (범위 밖 요소, 4 미만 나머지 포함)
+*/
+
+static float ExactDeg(float cte, float vx)
+{
+    return (float)(std::atan((double)LFA_STANLEY_GAIN * cte / vx) * 180.0 / M_PI);
+}
+
+// Test 1: 초기화 전 -> 정확한 법칙
+//  - 테이블은 프로세스 전역 1회 생성이라 되돌릴 수 없음 -> threadsafe death test (자식이 바이너리를 다시 실행)
+TEST(StanleyLutTest, BeforeInitUsesExactLaw) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_EXIT({
+        const float exact = AdasMath_AtanF(LFA_STANLEY_GAIN * 0.8f / 20.0f) * ADAS_MATH_RAD2DEG;
+        const bool  ok    = !StanleyLut_IsActive() && (StanleyLut_MeasuredMaxErrDeg() < 0.0f) &&
+                            (StanleyLut_OffsetDeg(0.8f, 20.0f) == exact);
+        std::exit(ok ? 0 : 1);
+    }, ::testing::ExitedWithCode(0), "");
+}
+
+// Test 2: 테이블 오차
+TEST(StanleyLutTest, TableWithinErrorBound) {
+    ASSERT_EQ(StanleyLut_Init(), 0);
+    EXPECT_TRUE(StanleyLut_IsActive());
+    std::cout << "[TableWithinErrorBound] measured=" << StanleyLut_MeasuredMaxErrDeg() << " deg\n";
+    EXPECT_LE(StanleyLut_MeasuredMaxErrDeg(), STANLEY_LUT_MAX_ERR_DEG);
+
+    float maxErr = 0.0f;
+    for (float vx = STANLEY_LUT_VX_MIN; vx <= STANLEY_LUT_VX_MAX; vx += 0.37f) {
+        for (float cte = STANLEY_LUT_CTE_MIN; cte <= STANLEY_LUT_CTE_MAX; cte += 0.013f) {
+            maxErr = std::fmax(maxErr, std::fabs(StanleyLut_OffsetDeg(cte, vx) - ExactDeg(cte, vx)));
+        }
+    }
+    EXPECT_LE(maxErr, STANLEY_LUT_MAX_ERR_DEG);
+}
+
+// Test 3: 범위 밖 fallback
+TEST(StanleyLutTest, OutOfRangeFallsBack) {
+    ASSERT_EQ(StanleyLut_Init(), 0);
+    EXPECT_NEAR(StanleyLut_OffsetDeg(3.5f, 20.0f), ExactDeg(3.5f, 20.0f), 1e-3f);  /* cte 범위 밖 */
+    EXPECT_NEAR(StanleyLut_OffsetDeg(0.5f, 5.0f),  ExactDeg(0.5f, 5.0f),  1e-3f);  /* 저속 */
+    EXPECT_NEAR(StanleyLut_OffsetDeg(1.0f, 0.0f),  ExactDeg(1.0f, 0.1f),  1e-3f);  /* 분모 보호 */
+}
+
+// Test 4: 배치 = 스칼라
+TEST(StanleyLutTest, BatchMatchesScalar) {
+    ASSERT_EQ(StanleyLut_Init(), 0);
+
+    std::vector<float> hdg, cte, vx;
+    for (int i = 0; i < 103; i++) {
+        hdg.push_back((i % 7) - 3.0f);
+        cte.push_back(-2.6f + 0.05f * i);           /* 일부는 ±2 m 밖 */
+        vx.push_back((i % 5 == 0) ? 3.0f : 12.0f + 0.35f * i);
+    }
+    const int n = (int)hdg.size();
+    std::vector<float> out(n);
+    StanleyLut_Steer_Batch(hdg.data(), cte.data(), vx.data(), out.data(), n);
+
+    for (int i = 0; i < n; i++) {
+        float ref = hdg[i] + StanleyLut_OffsetDeg(cte[i], vx[i]);
+        EXPECT_NEAR(out[i], ref, 1e-4f) << "i=" << i;
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,188 @@
+// traffic_gen_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+  #include "traffic_gen.h"
+  #include "adas_rng.h"
+  #include "lane_selection.h"
+  #include "target_selection.h"
+}
+
+/*
+테스트 항목:
+1. 결정성: 같은 (Seed, frame) -> 같은 목록, frame 이 다르면 다른 목록, capacity 제한 = 앞부분, 밀도 -> 개수
+2. 분포: 종류 비율 / 대향 비율 / 정지 비율, 정규 난수 (Box-Muller / Irwin-Hall) 평균 0 / 표준편차 1
+3. 배치: 잡음 0 이면 차량은 차로 중심 부근, 보행자는 도로 밖, 끼어들기는 자차 차로 쪽 횡속도
+4. Target Selection 입력: 객체 5000 개 필터 -> 예측 -> 타겟 선정, 끼어들기 판단 발생
+*/
+
+// Test 1: 결정성 / 개수
+TEST(TrafficGenTest, DeterministicPerSeedAndFrame) {
+    TrafficGenConfig_t cfg;
+    TrafficGen_DefaultConfig(&cfg);
+    ASSERT_EQ(TrafficGen_Count(&cfg), 50);          // 40 /km x 5 차로 x 0.25 km
+
+    cfg.Object_Count = 1000;
+    std::vector<ObjectData_t> a(1000), b(1000), c(1000), d(100);
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 7, a.data(), 1000), 1000);
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 7, b.data(), 1000), 1000);
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 8, c.data(), 1000), 1000);
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 7, d.data(), 100), 100);
+
+    EXPECT_EQ(std::memcmp(a.data(), b.data(), 1000 * sizeof(ObjectData_t)), 0);
+    EXPECT_NE(std::memcmp(a.data(), c.data(), 1000 * sizeof(ObjectData_t)), 0);
+    EXPECT_EQ(std::memcmp(a.data(), d.data(), 100 * sizeof(ObjectData_t)), 0);
+    EXPECT_EQ(a[0].Object_ID, 1);
+    EXPECT_EQ(a[999].Object_ID, 1000);
+
+    cfg.Seed = 2;
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 7, c.data(), 1000), 1000);
+    EXPECT_NE(std::memcmp(a.data(), c.data(), 1000 * sizeof(ObjectData_t)), 0);
+
+    // 설정 오류
+    TrafficGenConfig_t bad = cfg;
+    bad.Ego_Lane = bad.Lane_Count;
+    EXPECT_EQ(TrafficGen_Generate(&bad, 0, a.data(), 1000), -1);
+    bad = cfg;
+    for (float &w : bad.Type_Mix) w = 0.0f;
+    EXPECT_EQ(TrafficGen_Count(&bad), -1);
+    EXPECT_EQ(TrafficGen_Generate(&cfg, 0, nullptr, 10), -1);
+}
+
+// Test 2: 종류 / 대향 / 정지 비율, 정규 난수
+TEST(TrafficGenTest, MixAndRatesMatchConfig) {
+    TrafficGenConfig_t cfg;
+    TrafficGen_DefaultConfig(&cfg);
+    cfg.Object_Count = 200000;
+    std::vector<ObjectData_t> objs(200000);
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 0, objs.data(), 200000), 200000);
+
+    int types[TRAFFIC_GEN_TYPE_COUNT] = {};
+    int vehicles = 0, oncoming = 0, stopped = 0;
+    for (const ObjectData_t &o : objs) {
+        types[o.Object_Type]++;
+        if ((o.Object_Type == OBJTYPE_CAR) || (o.Object_Type == OBJTYPE_MOTORCYCLE)) {
+            vehicles++;
+            if (o.Object_Status == OBJSTAT_ONCOMING) {
+                oncoming++;
+                EXPECT_LT(o.Velocity_X, 0.0f);
+                EXPECT_GT(std::fabs(o.Heading), 170.0f);
+            }
+        }
+        if (o.Object_Status == OBJSTAT_STOPPED) stopped++;
+    }
+    for (int t = 0; t < TRAFFIC_GEN_TYPE_COUNT; t++)
+        EXPECT_NEAR(types[t] / 200000.0, cfg.Type_Mix[t], 0.005) << t;
+    EXPECT_NEAR((double)oncoming / vehicles, cfg.Oncoming_Rate, 0.01);
+    // 정지 = 대향 아닌 객체 중 Stopped_Rate
+    EXPECT_NEAR((double)stopped / (200000 - oncoming), cfg.Stopped_Rate, 0.005);
+
+    AdasRng_t rng;
+    AdasRng_Seed(&rng, 42, 0);
+    double sum = 0.0, sq = 0.0;
+    for (int i = 0; i < 100000; i++) {
+        float z0, z1;
+        AdasRng_Normal2F(&rng, &z0, &z1);
+        sum += z0 + z1;
+        sq  += (double)z0 * z0 + (double)z1 * z1;
+    }
+    EXPECT_NEAR(sum / 200000.0, 0.0, 0.01);
+    EXPECT_NEAR(std::sqrt(sq / 200000.0), 1.0, 0.01);
+
+    sum = sq = 0.0;
+    float zMax = 0.0f;
+    for (int i = 0; i < 200000; i++) {
+        float z = AdasRng_NormalFastF(&rng);
+        sum += z;
+        sq  += (double)z * z;
+        zMax = std::fmax(zMax, std::fabs(z));
+    }
+    EXPECT_NEAR(sum / 200000.0, 0.0, 0.01);
+    EXPECT_NEAR(std::sqrt(sq / 200000.0), 1.0, 0.01);
+    EXPECT_LE(zMax, std::sqrt(12.0f));
+}
+
+// Test 3: 잡음 없는 배치
+TEST(TrafficGenTest, NoiseFreePlacement) {
+    TrafficGenConfig_t cfg;
+    TrafficGen_DefaultConfig(&cfg);
+    cfg.Object_Count  = 20000;
+    cfg.Pos_Noise     = 0.0f;
+    cfg.Vel_Noise     = 0.0f;
+    cfg.Heading_Noise = 0.0f;
+    cfg.Cut_In_Rate   = 0.5f;
+    std::vector<ObjectData_t> objs(20000);
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 3, objs.data(), 20000), 20000);
+
+    const float w = cfg.Lane_Width;
+    const float rightEdge = -1.5f * w;              // 차로 3 개, 자차 가운데
+    int cutIns = 0;
+    for (const ObjectData_t &o : objs) {
+        EXPECT_GE(o.Position_X, -cfg.Range_Behind);
+        EXPECT_LT(o.Position_X, cfg.Range_Ahead);
+        EXPECT_NEAR(o.Distance, std::hypot(o.Position_X, o.Position_Y), 1e-3f);
+
+        if (o.Object_Type == OBJTYPE_PEDESTRIAN) {
+            EXPECT_LT(o.Position_Y, rightEdge);
+        } else if (o.Object_Status == OBJSTAT_STOPPED) {
+            continue;                               // 끼어들기 중 정지 가능 (차로 경계 쪽 치우침 유지)
+        } else if ((o.Object_Type == OBJTYPE_CAR) && (o.Velocity_Y == 0.0f)) {
+            float lane = std::round(o.Position_Y / w);
+            EXPECT_LE(std::fabs(o.Position_Y - lane * w), 0.3f + 1e-4f);
+            EXPECT_GE(lane, -1.0f);
+            EXPECT_LE(lane, 3.0f);                  // 대향 2 차로
+        } else if (o.Object_Type == OBJTYPE_CAR) {
+            cutIns++;
+            EXPECT_LT(o.Position_Y * o.Velocity_Y, 0.0f) << "자차 차로 쪽으로 이동";
+            EXPECT_GE(std::fabs(o.Velocity_Y), 0.5f);
+        }
+    }
+    // 차량 중 같은 방향 옆 차로 2/3 x 끼어들기 0.5 x 비대향 0.8 x 비정지 0.95 x 차량 0.85
+    EXPECT_NEAR(cutIns / 20000.0, 0.85 * 0.8 * (2.0 / 3.0) * 0.5 * 0.95, 0.01);
+}
+
+// Test 4: 고밀도 Target Selection
+TEST(TrafficGenTest, FeedsDenseTargetSelection) {
+    static ObjectData_t      objs[5000];
+    static FilteredObject_t  filtered[5000];
+    static PredictedObject_t predicted[5000];
+
+    TrafficGenConfig_t cfg;
+    TrafficGen_DefaultConfig(&cfg);
+    cfg.Object_Count = 5000;
+    ASSERT_EQ(TrafficGen_Generate(&cfg, 11, objs, 5000), 5000);
+
+    LaneData_t lane = {};
+    lane.Lane_Type          = LANE_TYPE_STRAIGHT;
+    lane.Lane_Width         = cfg.Lane_Width;
+    lane.Lane_Change_Status = LANE_CHANGE_KEEP;
+    EgoData_t ego = {};
+    ego.Ego_Velocity_X = cfg.Ego_Speed;
+    LaneSelectOutput_t ls;
+    LaneSelection_Update(&lane, &ego, &ls);
+
+    int nf = select_target_from_object_list(objs, 5000, &ego, &ls, filtered, 5000);
+    ASSERT_GT(nf, 0);
+    ASSERT_LT(nf, 5000);                            // 후방 / 옆 차로 원거리 제외
+    int np = predict_object_future_path(filtered, nf, &lane, &ls, predicted, 5000);
+    ASSERT_EQ(np, nf);
+
+    int cutIn = 0;
+    for (int i = 0; i < np; i++) cutIn += predicted[i].CutIn_Flag ? 1 : 0;
+    EXPECT_GT(cutIn, 0);
+
+    ACC_Target_t acc;
+    AEB_Target_t aeb;
+    select_targets_for_acc_aeb(&ego, predicted, np, &ls, &acc, &aeb);
+    EXPECT_GT(acc.ACC_Target_ID, 0);
+    EXPECT_GE(acc.ACC_Target_Distance, 0.0f);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,256 @@
+// vehicle_sim_test.cpp
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <iostream>
+#include <cstring>
+
+extern "C" {
+  #include "vehicle_sim.h"
+  #include "adas_math.h"
+}
+
+/*
+테스트 항목:
+1. 종방향: 가속 명령 1차 지연 (τ 후 약 63%), 정지 중 제동 -> 후진 없음
+2. 횡방향: 기구학 정상 요레이트 = v*tan(δ)/L, RK4 스텝 절반 -> 결과 거의 동일, 배치 내 같은 차량 = 같은 상태
+3. 센서 합성: 직선 도로 Lane_Offset / 선행차 거리·횡위치 (Lead_Offset 반영), 곡선 도로 반경·방향
+4. 폐루프: 파이프라인 제어로 차선 중심 복귀 (차선 이탈 없음), 목표 속도 수렴
+5. 폐루프 곡선 고속 주행: Pure Pursuit 의 cross-track 오차 RMS 가 Stanley 보다 작음 (좌 / 우 곡선)
+*/
+
+static VehicleSimInit_t MakeInit(float speed, float offset, float curvature, float gap, float leadSpeed)
+{
+    VehicleSimInit_t init;
+    std::memset(&init, 0, sizeof(init));
+    init.Speed          = speed;
+    init.Lane_Offset    = offset;
+    init.Road_Curvature = curvature;
+    init.Lead_Gap       = gap;
+    init.Lead_Speed     = leadSpeed;
+    return init;
+}
+
+// Test 1: 종방향 액추에이터 지연 / 후진 없음
+TEST(VehicleSimTest, LongitudinalLagAndNoReverse) {
+    VehicleSimParams_t p;
+    VehicleSim_DefaultParams(&p);
+    p.Rolling_Accel = 0.0f;
+    p.Drag_Coeff    = 0.0f;
+
+    VehicleSimFleet_t fleet;
+    ASSERT_EQ(VehicleSim_Init(&fleet, 2, &p), 0);
+    EXPECT_EQ(fleet.Capacity % 8, 0);
+
+    VehicleSimInit_t init = MakeInit(10.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    ASSERT_EQ(VehicleSim_SetVehicle(&fleet, 0, &init), 0);
+    init.Speed = 0.0f;
+    ASSERT_EQ(VehicleSim_SetVehicle(&fleet, 1, &init), 0);
+
+    VehicleControl_t throttle = { 0.2f, 0.0f, 0.0f };   // 2 m/s^2
+    VehicleControl_t brake    = { 0.0f, 1.0f, 0.0f };
+    VehicleSim_ApplyControl(&fleet, 0, &throttle);
+    VehicleSim_ApplyControl(&fleet, 1, &brake);
+
+    const float dt = 0.01f;
+    int steps = (int)std::lround(p.Accel_Tau / dt);
+    for (int k = 0; k < steps; k++) VehicleSim_Step(&fleet, dt);
+
+    EXPECT_NEAR(fleet.Accel[0], 2.0f * (1.0f - std::exp(-1.0f)), 0.01f);
+    // v = v0 + a_cmd * (t - τ(1 - e^{-t/τ}))
+    float expectV = 10.0f + 2.0f * (p.Accel_Tau - p.Accel_Tau * (1.0f - std::exp(-1.0f)));
+    EXPECT_NEAR(fleet.Vx[0], expectV, 0.01f);
+    EXPECT_NEAR(fleet.Time, p.Accel_Tau, 1e-6);
+
+    EXPECT_FLOAT_EQ(fleet.Vx[1], 0.0f);
+    EXPECT_FLOAT_EQ(fleet.X[1], 0.0f);
+    EXPECT_EQ(VehicleSim_SetVehicle(&fleet, 2, &init), -1);
+    VehicleSim_Destroy(&fleet);
+    EXPECT_EQ(VehicleSim_Init(&fleet, 0, nullptr), -1);
+}
+
+// Test 2: 기구학 요레이트 / RK4 스텝 수렴 / 배치 일관성
+TEST(VehicleSimTest, KinematicYawRateAndBatchConsistency) {
+    VehicleSimParams_t p;
+    VehicleSim_DefaultParams(&p);
+    p.Model = VEHICLE_SIM_KINEMATIC;
+
+    VehicleSimFleet_t coarse, fine;
+    ASSERT_EQ(VehicleSim_Init(&coarse, 13, &p), 0);
+    p.Substeps = 2;
+    ASSERT_EQ(VehicleSim_Init(&fine, 13, &p), 0);
+
+    VehicleSimInit_t init = MakeInit(10.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    VehicleControl_t steer = { 0.0f, 0.0f, -0.05f };    // 좌조향
+    for (int i = 0; i < 13; i++) {
+        VehicleSim_SetVehicle(&coarse, i, &init);
+        VehicleSim_SetVehicle(&fine, i, &init);
+        VehicleSim_ApplyControl(&coarse, i, &steer);
+        VehicleSim_ApplyControl(&fine, i, &steer);
+    }
+    for (int k = 0; k < 300; k++) {
+        VehicleSim_Step(&coarse, 0.01f);
+        VehicleSim_Step(&fine, 0.01f);
+    }
+
+    float delta = 0.05f * p.Max_Wheel_Angle * ADAS_MATH_DEG2RAD;
+    float expectR = coarse.Vx[0] * std::tan(delta) / (p.Lf + p.Lr);
+    EXPECT_GT(coarse.R[0], 0.0f);                       // 좌회전 = 반시계
+    EXPECT_NEAR(coarse.Delta[0], delta, 1e-4f);
+    EXPECT_NEAR(coarse.R[0], expectR, 0.01f * expectR);
+    EXPECT_NEAR(coarse.X[0], fine.X[0], 1e-3f);
+    EXPECT_NEAR(coarse.Y[0], fine.Y[0], 1e-3f);
+    EXPECT_NEAR(coarse.Psi[0], fine.Psi[0], 1e-4f);
+
+    for (int i = 1; i < 13; i++) {
+        EXPECT_EQ(coarse.X[i], coarse.X[0]);
+        EXPECT_EQ(coarse.Y[i], coarse.Y[0]);
+        EXPECT_EQ(coarse.Psi[i], coarse.Psi[0]);
+    }
+    VehicleSim_Destroy(&coarse);
+    VehicleSim_Destroy(&fine);
+}
+
+// Test 3: 센서 합성
+TEST(VehicleSimTest, SensesLaneAndLead) {
+    static AdasFrameInput_t in;
+    VehicleSimFleet_t fleet;
+    ASSERT_EQ(VehicleSim_Init(&fleet, 3, nullptr), 0);
+
+    VehicleSimInit_t straight = MakeInit(20.0f, 0.4f, 0.0f, 30.0f, 15.0f);
+    VehicleSimInit_t left     = MakeInit(20.0f, 0.0f, 1.0f / 200.0f, 0.0f, 0.0f);
+    VehicleSimInit_t right    = MakeInit(20.0f, 0.0f, -1.0f / 200.0f, 0.0f, 0.0f);
+    VehicleSim_SetVehicle(&fleet, 0, &straight);
+    VehicleSim_SetVehicle(&fleet, 1, &left);
+    VehicleSim_SetVehicle(&fleet, 2, &right);
+
+    ASSERT_EQ(VehicleSim_Sense(&fleet, 0, &in), 0);
+    EXPECT_FLOAT_EQ(in.Gps.GPS_Velocity_X, 20.0f);
+    EXPECT_NEAR(in.Lane.Lane_Offset, 0.4f, 1e-6f);
+    EXPECT_EQ(in.Lane.Lane_Type, LANE_TYPE_STRAIGHT);
+    EXPECT_FLOAT_EQ(in.Lane.Lane_Curvature, 0.0f);
+    ASSERT_EQ(in.Object_Count, 1);
+    EXPECT_EQ(in.Objects[0].Object_ID, VEHICLE_SIM_LEAD_ID);
+    EXPECT_NEAR(in.Objects[0].Position_X, 30.0f, 1e-4f);
+    EXPECT_NEAR(in.Objects[0].Position_Y, -0.4f, 1e-4f);   // 자차가 좌측 -> 선행차는 우측
+    EXPECT_FLOAT_EQ(in.Objects[0].Velocity_X, 15.0f);
+    EXPECT_EQ(in.Objects[0].Object_Status, OBJSTAT_MOVING);
+
+    // 1초 후: 간격 30 - (20 - 15) = 25m (+ 주행 저항 감속 약 0.1m)
+    for (int k = 0; k < 100; k++) VehicleSim_Step(&fleet, 0.01f);
+    EXPECT_NEAR(VehicleSim_LeadGap(&fleet, 0), 25.1f, 0.05f);
+    ASSERT_EQ(VehicleSim_Sense(&fleet, 0, &in), 0);
+    EXPECT_NEAR(in.Time.Current_Time, 1000.0f, 0.1f);
+
+    // 선행차 옆 차로로 이동 (끼어들기 시나리오는 호출자가 Lead_Offset 갱신)
+    fleet.Lead_Offset[0] = 3.5f;
+    ASSERT_EQ(VehicleSim_Sense(&fleet, 0, &in), 0);
+    EXPECT_NEAR(in.Objects[0].Position_Y, 3.5f - 0.4f, 1e-3f);
+
+    // 곡선 도로: 직진 차량은 바깥쪽으로 벗어남
+    ASSERT_EQ(VehicleSim_Sense(&fleet, 1, &in), 0);
+    EXPECT_EQ(in.Lane.Lane_Type, LANE_TYPE_CURVE);
+    EXPECT_NEAR(in.Lane.Lane_Curvature, 200.0f, 0.01f);
+    EXPECT_EQ(in.Lane.Lane_Curve_Direction, -1);
+    EXPECT_LT(in.Lane.Lane_Offset, -0.5f);
+    EXPECT_GT(in.Lane.Lane_Heading, 0.0f);
+    EXPECT_EQ(in.Object_Count, 0);
+    EXPECT_TRUE(std::isinf(VehicleSim_LeadGap(&fleet, 1)));
+
+    ASSERT_EQ(VehicleSim_Sense(&fleet, 2, &in), 0);
+    EXPECT_EQ(in.Lane.Lane_Curve_Direction, 1);
+    EXPECT_GT(in.Lane.Lane_Offset, 0.5f);
+
+    EXPECT_EQ(VehicleSim_Sense(&fleet, 3, &in), -1);
+    VehicleSim_Destroy(&fleet);
+}
+
+// Test 4: 폐루프 (센서 합성 -> 파이프라인 -> 제어 적용)
+//  - 저속 출발: Ego 추정의 GPS 스파이크 검사가 초기값 0 기준 (10 m/s 이상 차이는 거부)
+TEST(VehicleSimTest, ClosedLoopWithPipeline) {
+    static AdasPipeline_t    pipe;
+    static AdasFrameInput_t  in;
+    static AdasFrameOutput_t out;
+    const float dt = 0.01f;
+
+    VehicleSimFleet_t fleet;
+    ASSERT_EQ(VehicleSim_Init(&fleet, 1, nullptr), 0);
+    VehicleSimInit_t init = MakeInit(5.0f, 0.5f, 0.0f, 0.0f, 0.0f);
+    ASSERT_EQ(VehicleSim_SetVehicle(&fleet, 0, &init), 0);
+    AdasPipeline_Init(&pipe, dt);
+
+    float offset = 0.0f;
+    float maxOffset = 0.0f;
+    for (int k = 0; k < 2000; k++) {
+        ASSERT_EQ(VehicleSim_Sense(&fleet, 0, &in), 0);
+        AdasPipeline_Step(&pipe, &in, &out);
+        VehicleSim_ApplyControl(&fleet, 0, &out.Control);
+        VehicleSim_Step(&fleet, dt);
+        VehicleSim_LanePose(&fleet, 0, &offset, nullptr, nullptr);
+        maxOffset = std::fmax(maxOffset, std::fabs(offset));
+    }
+
+    EXPECT_LT(maxOffset, 0.5f * (3.5f - 1.9f));        // 차폭 1.9m 기준 차선 이탈 없음
+    EXPECT_LT(std::fabs(offset), 0.05f);
+    EXPECT_NEAR(fleet.Vx[0], 22.22f, 0.5f);            // ACC 속도 모드 목표 80 km/h
+    VehicleSim_Destroy(&fleet);
+}
+
+// Test 5: 고속 법칙 비교 (곡선 도로, 80 km/h 부근 고속 모드 유지)
+//  - LFA 조향각은 바퀴 조향각 기준 법칙 -> steer 1.0 = 540° 로 명령 1° = 바퀴 1° 매핑
+//  - 추정기는 초기 속도로 warm start (GPS 스파이크 검사), 처음 5 초 (과도 구간) 이후 집계
+static float CurveCrossTrackRms(LFA_High_Speed_Law_e law, float curvature)
+{
+    static AdasPipeline_t    pipe;
+    static AdasFrameInput_t  in;
+    static AdasFrameOutput_t out;
+    const float dt = 0.01f;
+
+    VehicleSimParams_t p;
+    VehicleSim_DefaultParams(&p);
+    p.Max_Wheel_Angle = LFA_MAX_STEERING_ANGLE;
+
+    VehicleSimFleet_t fleet;
+    if (VehicleSim_Init(&fleet, 1, &p) != 0)
+        return INFINITY;
+    VehicleSimInit_t init = MakeInit(20.0f, 0.0f, curvature, 0.0f, 0.0f);
+    VehicleSim_SetVehicle(&fleet, 0, &init);
+    AdasPipeline_Init(&pipe, dt);
+    pipe.Lfa.High_Speed_Law = law;
+    pipe.Kf.X[0]            = init.Speed;
+    pipe.Kf.Prev_GPS_Vel_X  = init.Speed;
+
+    double sq = 0.0;
+    int    n  = 0;
+    for (int k = 0; k < 2000; k++) {
+        VehicleSim_Sense(&fleet, 0, &in);
+        AdasPipeline_Step(&pipe, &in, &out);
+        VehicleSim_ApplyControl(&fleet, 0, &out.Control);
+        VehicleSim_Step(&fleet, dt);
+        if (k >= 500) {
+            float offset;
+            VehicleSim_LanePose(&fleet, 0, &offset, nullptr, nullptr);
+            EXPECT_EQ(out.Lfa_Mode, LFA_MODE_HIGH_SPEED);
+            sq += (double)offset * offset;
+            n++;
+        }
+    }
+    VehicleSim_Destroy(&fleet);
+    return (float)std::sqrt(sq / n);
+}
+
+TEST(VehicleSimTest, PurePursuitTracksCurveBetterThanStanley) {
+    for (float curvature : { 1.0f / 1000.0f, -1.0f / 800.0f }) {
+        float stanley = CurveCrossTrackRms(LFA_HS_LAW_STANLEY, curvature);
+        float pursuit = CurveCrossTrackRms(LFA_HS_LAW_PURE_PURSUIT, curvature);
+        std::cout << "[CurveTracking] k=" << curvature << " rms stanley=" << stanley
+                  << " m, pure pursuit=" << pursuit << " m\n";
+        EXPECT_LT(pursuit, 0.8f * stanley) << "k=" << curvature;
+        EXPECT_LT(stanley, 0.5f * (3.5f - 1.9f));
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,168 @@
+/****************************************************************************
+ * bench_compare.c
+ *
+ * - 벤치마크 기준값 저장 / 통계적 회귀 검사 (adas_bench_stats.h)
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -D_GNU_SOURCE -O2 -Iinclude tools/bench_compare.c src/adas_bench_stats.c -lm -o bench_compare
+ * - 실행 예:
+ *   ./adas_benchmark --benchmark_repetitions=10 --benchmark_out=base.json --benchmark_out_format=json
+ *   ./bench_compare -s baseline.csv base.json                 (기준값 저장)
+ *   ./adas_benchmark --benchmark_repetitions=10 --benchmark_out=new.json --benchmark_out_format=json
+ *   ./bench_compare -b baseline.csv -t 5 new.json              (5% 초과 + 유의하면 회귀)
+ * - 종료 코드: 0 = 회귀 없음, 1 = 회귀 있음 (-f 면 누락/표본 부족도 실패), 2 = 인자/파일 오류
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "adas_bench_stats.h"
+
+/*
+ * 사용법: bench_compare [-s 저장할 기준 CSV | -b 기준 CSV 또는 JSON] [-a 유의수준(기본 0.01)]
+ *                       [-t 임계 증가율 %(기본 5)] [-m cpu|real] [-f (누락/표본 부족도 실패)] [-q] 결과.json
+ *  - 기준은 .json 이면 Google Benchmark 결과로 직접 읽음
+ *  - 회귀 판정은 벤치마크(함수/인자)별, 마지막에 함수별 최악 증가율 요약
+ */
+
+static AdasBenchSet_t     s_base;
+static AdasBenchSet_t     s_new;
+static AdasBenchCompare_t s_result[2 * ADAS_BENCH_MAX_SERIES];
+
+static int ends_with(const char *s, const char *suffix)
+{
+    size_t n = strlen(s), m = strlen(suffix);
+    return (n >= m) && (strcmp(s + n - m, suffix) == 0);
+}
+
+/* 함수 이름 길이 (첫 '/' 앞, 인자 없는 벤치마크는 전체) */
+static size_t function_len(const char *name)
+{
+    const char *slash = strchr(name, '/');
+    return slash ? (size_t)(slash - name) : strlen(name);
+}
+
+int main(int argc, char **argv)
+{
+    const char *savePath = NULL;
+    const char *basePath = NULL;
+    double alpha        = 0.01;
+    double thresholdPct = 5.0;
+    AdasBenchMetric_e metric = ADAS_BENCH_METRIC_CPU;
+    int strict = 0;
+    int quiet  = 0;
+    int opt;
+
+    while((opt = getopt(argc, argv, "s:b:a:t:m:fq")) != -1)
+    {
+        switch(opt)
+        {
+        case 's': savePath     = optarg; break;
+        case 'b': basePath     = optarg; break;
+        case 'a': alpha        = atof(optarg); break;
+        case 't': thresholdPct = atof(optarg); break;
+        case 'm': metric = (strcmp(optarg, "real") == 0) ? ADAS_BENCH_METRIC_REAL : ADAS_BENCH_METRIC_CPU; break;
+        case 'f': strict = 1; break;
+        case 'q': quiet  = 1; break;
+        default:
+            fprintf(stderr, "usage: %s [-s save.csv | -b baseline] [-a alpha] [-t threshold_pct] [-m cpu|real] [-f] [-q] result.json\n", argv[0]);
+            return 2;
+        }
+    }
+    if((optind != argc - 1) || (!savePath == !basePath) || (alpha <= 0.0) || (alpha >= 1.0))
+    {
+        fprintf(stderr, "need exactly one result file and one of -s / -b (0 < alpha < 1)\n");
+        return 2;
+    }
+
+    if(AdasBench_LoadGbenchJson(argv[optind], metric, &s_new) != 0)
+    {
+        fprintf(stderr, "%s: cannot read benchmark JSON\n", argv[optind]);
+        return 2;
+    }
+    if(s_new.Truncated)
+        fprintf(stderr, "warning: %s truncated (max %d benchmarks x %d samples)\n",
+                argv[optind], ADAS_BENCH_MAX_SERIES, ADAS_BENCH_MAX_SAMPLES);
+
+    /* -s : 기준값 저장 */
+    if(savePath)
+    {
+        if(AdasBench_SaveBaseline(savePath, &s_new) != 0)
+        {
+            fprintf(stderr, "%s: write failed\n", savePath);
+            return 2;
+        }
+        printf("saved %d benchmarks to %s\n", s_new.Count, savePath);
+        return 0;
+    }
+
+    /* -b : 비교 */
+    int rc = ends_with(basePath, ".json") ? AdasBench_LoadGbenchJson(basePath, metric, &s_base)
+                                          : AdasBench_LoadBaseline(basePath, &s_base);
+    if(rc != 0)
+    {
+        fprintf(stderr, "%s: cannot read baseline\n", basePath);
+        return 2;
+    }
+
+    int n = AdasBench_Compare(&s_base, &s_new, alpha, thresholdPct, s_result,
+                              (int)(sizeof(s_result) / sizeof(s_result[0])));
+
+    int counts[ADAS_BENCH_MISSING + 1] = { 0 };
+    printf("%-48s %12s %12s %9s %9s %10s  %s\n", "benchmark", "base_med_ns", "new_med_ns", "delta%", "new_mad%", "p(slower)", "verdict");
+    for(int i = 0; i < n; i++)
+    {
+        const AdasBenchCompare_t *r = &s_result[i];
+        counts[r->Verdict]++;
+        if(quiet && (r->Verdict == ADAS_BENCH_SAME))
+            continue;
+
+        double madPct = (r->New.Median_Ns > 0.0) ? (100.0 * r->New.Mad_Ns / r->New.Median_Ns) : 0.0;
+        printf("%-48s %12.1f %12.1f %+9.2f %9.2f %10.2g  %s\n", r->Name,
+               r->Base.Median_Ns, r->New.Median_Ns, r->Delta_Pct, madPct, r->P_Slower,
+               AdasBench_VerdictName(r->Verdict));
+    }
+
+    /* 함수별 요약: 유의한 결과 중 최악 증가율 */
+    printf("---- Per function (worst significant delta) ----\n");
+    for(int i = 0; i < n; i++)
+    {
+        size_t len = function_len(s_result[i].Name);
+        int seen = 0;
+        for(int k = 0; (k < i) && !seen; k++)
+            seen = (function_len(s_result[k].Name) == len) && (strncmp(s_result[k].Name, s_result[i].Name, len) == 0);
+        if(seen)
+            continue;
+
+        double worst = 0.0;
+        int significant = 0;
+        int regressions = 0;
+        for(int k = i; k < n; k++)
+        {
+            const AdasBenchCompare_t *r = &s_result[k];
+            if((function_len(r->Name) != len) || (strncmp(r->Name, s_result[i].Name, len) != 0))
+                continue;
+            if(r->Verdict == ADAS_BENCH_REGRESSION) regressions++;
+            if((r->Verdict == ADAS_BENCH_REGRESSION) || (r->Verdict == ADAS_BENCH_IMPROVEMENT))
+            {
+                if(!significant || (r->Delta_Pct > worst))
+                    worst = r->Delta_Pct;
+                significant = 1;
+            }
+        }
+        printf("  %-40.*s %+8.2f%%  regressions=%d\n", (int)len, s_result[i].Name, worst, regressions);
+    }
+
+    printf("Regressions=%d, Improved=%d, Same=%d, Insufficient=%d, Missing=%d (alpha=%.3g, threshold=%.2f%%, metric=%s)\n",
+           counts[ADAS_BENCH_REGRESSION], counts[ADAS_BENCH_IMPROVEMENT], counts[ADAS_BENCH_SAME],
+           counts[ADAS_BENCH_INSUFFICIENT], counts[ADAS_BENCH_MISSING], alpha, thresholdPct,
+           (metric == ADAS_BENCH_METRIC_REAL) ? "real" : "cpu");
+
+    if(counts[ADAS_BENCH_REGRESSION] != 0)
+        return 1;
+    if(strict && ((counts[ADAS_BENCH_INSUFFICIENT] != 0) || (counts[ADAS_BENCH_MISSING] != 0)))
+        return 1;
+    return 0;
+}
@@ -0,0 +1,216 @@
+/****************************************************************************
+ * closed_loop_sim.c
+ *
+ * - 내장 차량 모델(vehicle_sim.h) 폐루프 / 배치 처리량 시험
+ *   : 차량 N 대 = 각자 파이프라인 인스턴스 (센서 합성 -> AdasPipeline_Step -> 제어 적용)
+ *   : -o 이면 파이프라인 없이 고정 명령으로 플랜트 적분만 측정 (배치 스텝 처리량)
+ *   : 초기 조건은 차량별로 다르게 (횡위치 / 곡률 / 선행차 간격)
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -D_GNU_SOURCE -O2 -Iinclude tools/closed_loop_sim.c $(ls src/[a-z]*.c | grep -v main.c) -lm -lpthread -o closed_loop_sim
+ * - 실행 예:
+ *   ./closed_loop_sim -n 64 -s 60          (64 대 60 초 폐루프)
+ *   ./closed_loop_sim -n 10000 -s 10 -o    (만 대 플랜트만)
+ *   ./closed_loop_sim -n 64 -s 60 -v 22 -L pursuit -a 540   (고속 Pure Pursuit, 조향각 1:1)
+ * - 종료 코드: 0 = 차선 이탈 / 추돌 없음, 1 = 있음, 2 = 인자/메모리 오류
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "vehicle_sim.h"
+#include "adas_time.h"
+
+/*
+ * 사용법: closed_loop_sim [-n 차량 수, 기본 16] [-s 시뮬레이션 시간(초), 기본 30] [-p 제어 주기(ms), 기본 10]
+ *                         [-u 주기당 RK4 스텝 수, 기본 1] [-k (기구학 모델)] [-o (플랜트만, 파이프라인 없음)]
+ *                         [-L 고속 LFA 조향 법칙 (stanley | pursuit, 기본 stanley)]
+ *                         [-v 초기 속도(m/s), 기본 차량별 5 ~ 9] [-a steer 1.0 바퀴 조향각(°), 기본 70]
+ *  - 차선 이탈: |횡위치| > (차선 폭 - 차폭) / 2, 추돌: 선행차 간격 < 0
+ *  - 횡위치 RMS = 차선 중심 기준 cross-track 오차 (전 차량 / 전 주기)
+ *  - LFA 조향각은 바퀴 조향각 기준 법칙 -> -a 540 이면 명령 1° = 바퀴 1° (법칙 간 비교용)
+ *  - 실시간 배율 = 시뮬레이션 시간 / 실행 시간 (차량 N 대 전체 기준)
+ */
+
+#define SIM_CAR_WIDTH  1.9f   /* [m] */
+
+typedef struct
+{
+    AdasPipeline_t    Pipe;
+    AdasFrameInput_t  In;
+    AdasFrameOutput_t Out;
+} Agent_t;
+
+/* 차량 i 초기 조건: 저속 출발 (Ego 추정 GPS 스파이크 검사), 곡률 / 선행차는 순환 배치
+ *  - speed > 0 이면 전 차량 그 속도로 출발 (추정기는 main 에서 warm start) */
+static void make_init(int i, float speed, VehicleSimInit_t *pInit)
+{
+    static const float curvature[4] = { 0.0f, 1.0f / 500.0f, 0.0f, -1.0f / 800.0f };
+
+    memset(pInit, 0, sizeof(*pInit));
+    pInit->Speed          = (speed > 0.0f) ? speed : (5.0f + (float)(i % 5));
+    pInit->Lane_Offset    = 0.1f * (float)((i % 11) - 5);
+    pInit->Road_Curvature = curvature[i % 4];
+    if((i % 3) == 0)
+    {
+        pInit->Lead_Gap   = 60.0f + (float)(i % 7) * 10.0f;
+        pInit->Lead_Speed = 15.0f + (float)(i % 4);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int   count = 16;
+    float simSec = 30.0f;
+    float periodMs = 10.0f;
+    int   substeps = 1;
+    int   kinematic = 0;
+    int   openLoop = 0;
+    float initSpeed = 0.0f;
+    float wheelAngle = 0.0f;
+    LFA_High_Speed_Law_e hsLaw = LFA_HS_LAW_STANLEY;
+    int   opt;
+
+    while((opt = getopt(argc, argv, "n:s:p:u:koL:v:a:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': count    = atoi(optarg); break;
+            case 's': simSec   = (float)atof(optarg); break;
+            case 'p': periodMs = (float)atof(optarg); break;
+            case 'u': substeps = atoi(optarg); break;
+            case 'k': kinematic = 1; break;
+            case 'o': openLoop  = 1; break;
+            case 'v': initSpeed  = (float)atof(optarg); break;
+            case 'a': wheelAngle = (float)atof(optarg); break;
+            case 'L':
+                if(lfa_parse_high_speed_law(optarg, &hsLaw) != 0)
+                {
+                    fprintf(stderr, "unknown LFA law: %s (stanley | pursuit)\n", optarg);
+                    return 2;
+                }
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n vehicles] [-s seconds] [-p period_ms] [-u substeps] [-k] [-o] "
+                                "[-L stanley|pursuit] [-v speed] [-a wheel_deg]\n", argv[0]);
+                return 2;
+        }
+    }
+    if((count <= 0) || (simSec <= 0.0f) || (periodMs <= 0.0f) || (substeps < 1) ||
+       (initSpeed < 0.0f) || (wheelAngle < 0.0f))
+    {
+        fprintf(stderr, "invalid arguments\n");
+        return 2;
+    }
+
+    VehicleSimParams_t params;
+    VehicleSim_DefaultParams(&params);
+    params.Model    = kinematic ? VEHICLE_SIM_KINEMATIC : VEHICLE_SIM_DYNAMIC;
+    params.Substeps = substeps;
+    if(wheelAngle > 0.0f)
+        params.Max_Wheel_Angle = wheelAngle;
+
+    VehicleSimFleet_t fleet;
+    Agent_t *pAgents = openLoop ? NULL : (Agent_t *)calloc((size_t)count, sizeof(Agent_t));
+    if((VehicleSim_Init(&fleet, count, &params) != 0) || (!openLoop && !pAgents))
+    {
+        fprintf(stderr, "out of memory\n");
+        free(pAgents);
+        return 2;
+    }
+
+    const float dt = periodMs * 0.001f;
+    for(int i = 0; i < count; i++)
+    {
+        VehicleSimInit_t init;
+        make_init(i, initSpeed, &init);
+        VehicleSim_SetVehicle(&fleet, i, &init);
+        if(pAgents)
+        {
+            AdasPipeline_t *pPipe = &pAgents[i].Pipe;
+            AdasPipeline_Init(pPipe, dt);
+            pPipe->Lfa.High_Speed_Law = hsLaw;
+            if(initSpeed > 0.0f)
+            {
+                pPipe->Kf.X[0]           = init.Speed;   /* 추정기 warm start (GPS 스파이크 검사 기준) */
+                pPipe->Kf.Prev_GPS_Vel_X = init.Speed;
+            }
+        }
+        else
+        {
+            /* 플랜트만: 약한 가속 + 차량별 소량 조향 */
+            VehicleControl_t ctl = { 0.05f, 0.0f, 0.002f * (float)((i % 9) - 4) };
+            VehicleSim_ApplyControl(&fleet, i, &ctl);
+        }
+    }
+
+    const float laneLimit = 0.5f * (params.Lane_Width - SIM_CAR_WIDTH);
+    long   steps = (long)ceilf(simSec / dt);
+    long   departures = 0, collisions = 0;
+    float  maxOffset = 0.0f, minGap = INFINITY;
+    double offsetSq = 0.0;
+    int   *pFlags = (int *)calloc((size_t)count, sizeof(int));   /* bit0 = 이탈, bit1 = 추돌 (차량별 1회 집계) */
+    if(!pFlags)
+    {
+        fprintf(stderr, "out of memory\n");
+        VehicleSim_Destroy(&fleet);
+        free(pAgents);
+        return 2;
+    }
+
+    uint64_t plantNs = 0;
+    uint64_t t0 = AdasTime_NowNs();
+    for(long k = 0; k < steps; k++)
+    {
+        if(pAgents)
+        {
+            for(int i = 0; i < count; i++)
+            {
+                Agent_t *pA = &pAgents[i];
+                VehicleSim_Sense(&fleet, i, &pA->In);
+                AdasPipeline_Step(&pA->Pipe, &pA->In, &pA->Out);
+                VehicleSim_ApplyControl(&fleet, i, &pA->Out.Control);
+            }
+        }
+
+        uint64_t s0 = AdasTime_NowNs();
+        VehicleSim_Step(&fleet, dt);
+        plantNs += AdasTime_NowNs() - s0;
+
+        for(int i = 0; i < count; i++)
+        {
+            float offset;
+            float gap = VehicleSim_LeadGap(&fleet, i);
+            VehicleSim_LanePose(&fleet, i, &offset, NULL, NULL);
+            offset = fabsf(offset);
+            offsetSq += (double)offset * (double)offset;
+            if(offset > maxOffset) maxOffset = offset;
+            if(gap < minGap)       minGap = gap;
+            if((offset > laneLimit) && !(pFlags[i] & 1)) { pFlags[i] |= 1; departures++; }
+            if((gap < 0.0f) && !(pFlags[i] & 2))         { pFlags[i] |= 2; collisions++; }
+        }
+    }
+    uint64_t wallNs = AdasTime_NowNs() - t0;
+
+    double wallSec  = (double)wallNs * 1e-9;
+    double simDone  = (double)steps * (double)dt;
+    double vehSteps = (double)steps * (double)count;
+
+    printf("vehicles=%d  model=%s  dt=%.1fms x %d RK4  sim=%.1fs  mode=%s  lfa=%s  wheel=%.0fdeg\n",
+           count, kinematic ? "kinematic" : "dynamic", periodMs, substeps, simDone,
+           pAgents ? "closed-loop" : "plant-only", lfa_high_speed_law_name(hsLaw), params.Max_Wheel_Angle);
+    printf("wall=%.3fs  real-time factor=%.1fx  vehicle-steps/s=%.3g  plant=%.1f ns/vehicle-step\n",
+           wallSec, (wallSec > 0.0) ? simDone / wallSec : 0.0,
+           (wallSec > 0.0) ? vehSteps / wallSec : 0.0,
+           (vehSteps > 0.0) ? (double)plantNs / vehSteps : 0.0);
+    printf("lane offset rms=%.3fm  max=%.3fm (limit %.2fm)  min lead gap=%.2fm  departures=%ld  collisions=%ld\n",
+           (vehSteps > 0.0) ? sqrt(offsetSq / vehSteps) : 0.0, maxOffset, laneLimit, minGap, departures, collisions);
+
+    free(pFlags);
+    free(pAgents);
+    VehicleSim_Destroy(&fleet);
+    return ((departures > 0) || (collisions > 0)) ? 1 : 0;
+}
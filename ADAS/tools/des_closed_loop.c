@@ -0,0 +1,343 @@
+/****************************************************************************
+ * des_closed_loop.c
+ *
+ * - 이산 사건(sim_clock.h) 기반 비동기 폐루프 시험 (vehicle_sim.h 플랜트 + 차량별 파이프라인)
+ *   : 센서는 고유 주기 + 차량별 위상으로 측정, GPS 는 전달 지연 + 지터 뒤 도착
+ *   : 제어 주기도 차량별 위상, 명령은 액추에이터 지연 뒤 플랜트에 적용
+ *   : 벽시계 대기 없이 다음 이벤트로 건너뜀 -> 실시간 배율 / 이벤트 처리량 출력
+ * - 동시각 순서: 플랜트 적분 -> 센서 측정 / 도착 -> 제어 -> 액추에이터
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -D_GNU_SOURCE -O2 -Iinclude tools/des_closed_loop.c $(ls src/[a-z]*.c | grep -v main.c) -lm -lpthread -o des_closed_loop
+ * - 실행 예:
+ *   ./des_closed_loop -n 64 -s 60                 (64 대 60 초, GPS 지연 20 ms, 액추에이터 지연 20 ms)
+ *   ./des_closed_loop -n 256 -s 30 -g 60 -a 50    (지연 증가 -> GPS 유효 비율 / 차선 유지 영향)
+ * - 종료 코드: 0 = 차선 이탈 / 추돌 없음, 1 = 있음, 2 = 인자/메모리 오류
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "sim_clock.h"
+#include "vehicle_sim.h"
+#include "adas_rng.h"
+#include "adas_time.h"
+
+/*
+ * 사용법: des_closed_loop [-n 차량 수, 기본 16] [-s 시뮬레이션 시간(초), 기본 30] [-p 플랜트 스텝(ms), 기본 2]
+ *                         [-g GPS 지연(ms), 기본 20] [-j GPS 지터 ±(ms), 기본 10] [-a 액추에이터 지연(ms), 기본 20]
+ *                         [-k 시드, 기본 1]
+ *  - 주기: GPS 100 ms, IMU / 카메라 / 레이더 10 ms, 제어 10 ms (차량별 위상 0 ~ 주기)
+ *  - 차선 이탈: |횡위치| > (차선 폭 - 차폭) / 2, 추돌: 선행차 간격 < 0 (플랜트 스텝마다 검사)
+ */
+
+#define DES_CAR_WIDTH      1.9f   /* [m] */
+#define DES_GPS_PERIOD_MS  100u
+#define DES_FAST_PERIOD_MS 10u
+#define DES_CONTROL_MS     10u
+#define DES_GPS_RING       8      /* 전달 중 GPS (지연 + 지터 < 주기 * 8) */
+#define DES_CMD_RING       16     /* 전달 중 명령 (지연 < 제어 주기 * 16) */
+
+/* 동시각 실행 순서 */
+enum
+{
+    DES_PRIO_PLANT    = -10,
+    DES_PRIO_SENSOR   = 0,
+    DES_PRIO_CONTROL  = 10,
+    DES_PRIO_ACTUATOR = 20
+};
+
+struct Sim;
+
+typedef struct
+{
+    SimTimer_t  Timer;
+    GPSData_t   Gps;
+} GpsPacket_t;
+
+typedef struct
+{
+    SimTimer_t       Timer;
+    VehicleControl_t Control;
+} CmdPacket_t;
+
+typedef struct
+{
+    struct Sim       *pSim;
+    int               Index;
+    AdasRng_t         Rng;
+    AdasPipeline_t    Pipe;
+    AdasFrameInput_t  In;           /* 지금까지 도착한 최신 센서 값 */
+    AdasFrameOutput_t Out;
+
+    SimTimer_t        Gps_Timer, Fast_Timer, Control_Timer;
+    GpsPacket_t       Gps_Ring[DES_GPS_RING];
+    CmdPacket_t       Cmd_Ring[DES_CMD_RING];
+    int               Gps_Next, Cmd_Next;
+    int               Flags;        /* bit0 = 이탈, bit1 = 추돌 (차량별 1회 집계) */
+} Agent_t;
+
+typedef struct Sim
+{
+    SimClock_t        Clock;
+    VehicleSimFleet_t Fleet;
+    Agent_t          *pAgents;
+    int               Count;
+    SimTimer_t        Plant_Timer;
+    float             Plant_Dt;     /* [s] */
+    float             Gps_Latency_Ms, Gps_Jitter_Ms;
+    SimTime_t         Actuator_Delay;
+    float             Lane_Limit;
+
+    /* 통계 */
+    uint64_t          Control_Ticks, Fresh_Gps_Ticks, Sensor_Events;
+    long              Departures, Collisions;
+    float             Max_Offset, Min_Gap, Max_Gps_Age_Ms;
+} Sim_t;
+
+/* ----------------------------------------------------------------------------
+ * 이벤트
+ * ---------------------------------------------------------------------------*/
+static void on_plant(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Sim_t *pSim = (Sim_t *)pUser;
+    (void)pClock;
+    (void)pTimer;
+
+    VehicleSim_Step(&pSim->Fleet, pSim->Plant_Dt);
+    for(int i = 0; i < pSim->Count; i++)
+    {
+        Agent_t *pA = &pSim->pAgents[i];
+        float offset;
+        float gap = VehicleSim_LeadGap(&pSim->Fleet, i);
+        VehicleSim_LanePose(&pSim->Fleet, i, &offset, NULL, NULL);
+        offset = fabsf(offset);
+        if(offset > pSim->Max_Offset) pSim->Max_Offset = offset;
+        if(gap < pSim->Min_Gap)       pSim->Min_Gap = gap;
+        if((offset > pSim->Lane_Limit) && !(pA->Flags & 1)) { pA->Flags |= 1; pSim->Departures++; }
+        if((gap < 0.0f) && !(pA->Flags & 2))                { pA->Flags |= 2; pSim->Collisions++; }
+    }
+}
+
+static void on_gps_arrive(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Agent_t *pA = (Agent_t *)pUser;
+    const GPSData_t *pGps = &((GpsPacket_t *)(void *)pTimer)->Gps;
+    (void)pClock;
+
+    /* 지터로 순서가 뒤바뀐 옛 측정값이 늦게 도착해도 그대로 전달 (추정기 타임스탬프 검사 대상) */
+    pA->In.Gps = *pGps;
+    pA->pSim->Sensor_Events++;
+}
+
+static void on_gps_measure(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Agent_t *pA = (Agent_t *)pUser;
+    Sim_t   *pSim = pA->pSim;
+    AdasFrameInput_t now;
+    (void)pTimer;
+
+    VehicleSim_Sense(&pSim->Fleet, pA->Index, &now);
+    GpsPacket_t *pPkt = &pA->Gps_Ring[pA->Gps_Next];
+    pA->Gps_Next = (pA->Gps_Next + 1) % DES_GPS_RING;
+    pPkt->Gps = now.Gps;
+    pPkt->Gps.GPS_Timestamp = SimClock_NowMs(pClock);
+
+    float delay = pSim->Gps_Latency_Ms + AdasRng_RangeF(&pA->Rng, -pSim->Gps_Jitter_Ms, pSim->Gps_Jitter_Ms);
+    SimClock_ScheduleIn(pClock, &pPkt->Timer, SimTime_FromMs(delay), 0u);
+}
+
+/* IMU / 카메라 / 레이더: 측정 즉시 도착 */
+static void on_fast_measure(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Agent_t *pA = (Agent_t *)pUser;
+    AdasFrameInput_t now;
+    (void)pClock;
+    (void)pTimer;
+
+    VehicleSim_Sense(&pA->pSim->Fleet, pA->Index, &now);
+    pA->In.Imu          = now.Imu;
+    pA->In.Lane         = now.Lane;
+    pA->In.Object_Count = now.Object_Count;
+    memcpy(pA->In.Objects, now.Objects, sizeof(ObjectData_t) * (size_t)now.Object_Count);
+    pA->pSim->Sensor_Events++;
+}
+
+static void on_actuate(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Agent_t *pA = (Agent_t *)pUser;
+    (void)pClock;
+
+    VehicleSim_ApplyControl(&pA->pSim->Fleet, pA->Index, &((CmdPacket_t *)(void *)pTimer)->Control);
+}
+
+static void on_control(SimClock_t *pClock, SimTimer_t *pTimer, void *pUser)
+{
+    Agent_t *pA = (Agent_t *)pUser;
+    Sim_t   *pSim = pA->pSim;
+    (void)pTimer;
+
+    pA->In.Time.Current_Time = SimClock_NowMs(pClock);
+    AdasPipeline_Step(&pA->Pipe, &pA->In, &pA->Out);
+
+    /* GPS 나이 (첫 도착 전 틱 제외) */
+    if(pA->In.Gps.GPS_Timestamp >= 0.0f)
+    {
+        float age = pA->In.Time.Current_Time - pA->In.Gps.GPS_Timestamp;
+        pSim->Control_Ticks++;
+        pSim->Fresh_Gps_Ticks += (fabsf(age) <= GPS_VALID_TIME_THRESH);
+        if(age > pSim->Max_Gps_Age_Ms) pSim->Max_Gps_Age_Ms = age;
+    }
+
+    CmdPacket_t *pCmd = &pA->Cmd_Ring[pA->Cmd_Next];
+    pA->Cmd_Next = (pA->Cmd_Next + 1) % DES_CMD_RING;
+    pCmd->Control = pA->Out.Control;
+    SimClock_ScheduleIn(pClock, &pCmd->Timer, pSim->Actuator_Delay, 0u);
+}
+
+/* ----------------------------------------------------------------------------
+ * 초기 조건 (closed_loop_sim 과 같은 순환 배치)
+ * ---------------------------------------------------------------------------*/
+static void make_init(int i, VehicleSimInit_t *pInit)
+{
+    static const float curvature[4] = { 0.0f, 1.0f / 500.0f, 0.0f, -1.0f / 800.0f };
+
+    memset(pInit, 0, sizeof(*pInit));
+    pInit->Speed          = 5.0f + (float)(i % 5);
+    pInit->Lane_Offset    = 0.1f * (float)((i % 11) - 5);
+    pInit->Road_Curvature = curvature[i % 4];
+    if((i % 3) == 0)
+    {
+        pInit->Lead_Gap   = 60.0f + (float)(i % 7) * 10.0f;
+        pInit->Lead_Speed = 15.0f + (float)(i % 4);
+    }
+}
+
+static void setup_agent(Sim_t *pSim, int i, uint64_t seed)
+{
+    Agent_t *pA = &pSim->pAgents[i];
+    VehicleSimInit_t init;
+
+    pA->pSim  = pSim;
+    pA->Index = i;
+    AdasRng_Seed(&pA->Rng, seed, (uint64_t)i);
+    make_init(i, &init);
+    VehicleSim_SetVehicle(&pSim->Fleet, i, &init);
+
+    AdasPipeline_Init(&pA->Pipe, (float)DES_CONTROL_MS * 0.001f);
+    pA->Pipe.Kf.X[0]           = init.Speed;     /* 추정기 warm start */
+    pA->Pipe.Kf.Prev_GPS_Vel_X = init.Speed;
+    VehicleSim_Sense(&pSim->Fleet, i, &pA->In);
+    pA->In.Gps.GPS_Timestamp   = -1.0e6f;        /* 첫 GPS 도착 전 = 무효 */
+
+    for(int k = 0; k < DES_GPS_RING; k++)
+        SimTimer_Init(&pA->Gps_Ring[k].Timer, on_gps_arrive, pA, DES_PRIO_SENSOR);
+    for(int k = 0; k < DES_CMD_RING; k++)
+        SimTimer_Init(&pA->Cmd_Ring[k].Timer, on_actuate, pA, DES_PRIO_ACTUATOR);
+    SimTimer_Init(&pA->Gps_Timer, on_gps_measure, pA, DES_PRIO_SENSOR);
+    SimTimer_Init(&pA->Fast_Timer, on_fast_measure, pA, DES_PRIO_SENSOR);
+    SimTimer_Init(&pA->Control_Timer, on_control, pA, DES_PRIO_CONTROL);
+
+    /* 차량별 위상 (µs 단위 무작위) -> 센서 / 제어 비동기 */
+    SimTime_t gpsPhase  = AdasRng_Next64(&pA->Rng) % (DES_GPS_PERIOD_MS * SIM_US_PER_MS);
+    SimTime_t fastPhase = AdasRng_Next64(&pA->Rng) % (DES_FAST_PERIOD_MS * SIM_US_PER_MS);
+    SimTime_t ctlPhase  = AdasRng_Next64(&pA->Rng) % (DES_CONTROL_MS * SIM_US_PER_MS);
+    SimClock_ScheduleAt(&pSim->Clock, &pA->Gps_Timer, gpsPhase, DES_GPS_PERIOD_MS * SIM_US_PER_MS);
+    SimClock_ScheduleAt(&pSim->Clock, &pA->Fast_Timer, fastPhase, DES_FAST_PERIOD_MS * SIM_US_PER_MS);
+    SimClock_ScheduleAt(&pSim->Clock, &pA->Control_Timer, ctlPhase, DES_CONTROL_MS * SIM_US_PER_MS);
+}
+
+int main(int argc, char **argv)
+{
+    int   count = 16;
+    float simSec = 30.0f;
+    float plantMs = 2.0f;
+    float gpsLatency = 20.0f, gpsJitter = 10.0f, actDelay = 20.0f;
+    unsigned long long seed = 1;
+    int   opt;
+
+    while((opt = getopt(argc, argv, "n:s:p:g:j:a:k:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': count      = atoi(optarg); break;
+            case 's': simSec     = (float)atof(optarg); break;
+            case 'p': plantMs    = (float)atof(optarg); break;
+            case 'g': gpsLatency = (float)atof(optarg); break;
+            case 'j': gpsJitter  = (float)atof(optarg); break;
+            case 'a': actDelay   = (float)atof(optarg); break;
+            case 'k': seed       = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-n vehicles] [-s seconds] [-p plant_ms] [-g gps_latency_ms] "
+                                "[-j gps_jitter_ms] [-a actuator_delay_ms] [-k seed]\n", argv[0]);
+                return 2;
+        }
+    }
+    if((count <= 0) || (simSec <= 0.0f) || (plantMs < 0.001f) || (gpsJitter < 0.0f) || (gpsLatency < gpsJitter) ||
+       ((gpsLatency + gpsJitter) >= (float)(DES_GPS_PERIOD_MS * DES_GPS_RING)) ||
+       (actDelay < 0.0f) || (actDelay >= (float)(DES_CONTROL_MS * DES_CMD_RING)))
+    {
+        fprintf(stderr, "invalid arguments\n");
+        return 2;
+    }
+
+    Sim_t *pSim = (Sim_t *)calloc(1, sizeof(Sim_t));
+    if(!pSim)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+    pSim->pAgents = (Agent_t *)calloc((size_t)count, sizeof(Agent_t));
+    if(!pSim->pAgents || (VehicleSim_Init(&pSim->Fleet, count, NULL) != 0))
+    {
+        fprintf(stderr, "out of memory\n");
+        free(pSim->pAgents);
+        free(pSim);
+        return 2;
+    }
+
+    const SimTime_t plantStep = SimTime_FromMs(plantMs);
+    pSim->Count          = count;
+    pSim->Plant_Dt       = (float)plantStep * 1.0e-6f;
+    pSim->Gps_Latency_Ms = gpsLatency;
+    pSim->Gps_Jitter_Ms  = gpsJitter;
+    pSim->Actuator_Delay = SimTime_FromMs(actDelay);
+    pSim->Lane_Limit     = 0.5f * (pSim->Fleet.Params.Lane_Width - DES_CAR_WIDTH);
+    pSim->Min_Gap        = INFINITY;
+    SimClock_Init(&pSim->Clock, 0u);
+
+    for(int i = 0; i < count; i++)
+        setup_agent(pSim, i, seed);
+    SimTimer_Init(&pSim->Plant_Timer, on_plant, pSim, DES_PRIO_PLANT);
+    SimClock_ScheduleAt(&pSim->Clock, &pSim->Plant_Timer, plantStep, plantStep);
+
+    uint64_t t0 = AdasTime_NowNs();
+    SimClock_RunUntil(&pSim->Clock, SimTime_FromMs((double)simSec * 1000.0));
+    uint64_t wallNs = AdasTime_NowNs() - t0;
+
+    double wallSec = (double)wallNs * 1e-9;
+    double simDone = (double)SimClock_Now(&pSim->Clock) * 1e-6;
+    printf("vehicles=%d  sim=%.1fs  plant=%.1fms  gps latency=%.0f±%.0fms  actuator delay=%.0fms  timers armed=%u\n",
+           count, simDone, plantMs, gpsLatency, gpsJitter, actDelay, pSim->Clock.Armed);
+    printf("wall=%.3fs  real-time factor=%.1fx  events=%llu (%.3g events/s)  cascades=%llu\n",
+           wallSec, (wallSec > 0.0) ? simDone / wallSec : 0.0,
+           (unsigned long long)pSim->Clock.Fired,
+           (wallSec > 0.0) ? (double)pSim->Clock.Fired / wallSec : 0.0,
+           (unsigned long long)pSim->Clock.Cascaded);
+    printf("sensor deliveries=%llu  control ticks=%llu  gps fresh (<= %.0fms)=%.1f%%  max gps age=%.1fms\n",
+           (unsigned long long)pSim->Sensor_Events,
+           (unsigned long long)pSim->Control_Ticks, (double)GPS_VALID_TIME_THRESH,
+           pSim->Control_Ticks ? 100.0 * (double)pSim->Fresh_Gps_Ticks / (double)pSim->Control_Ticks : 0.0,
+           pSim->Max_Gps_Age_Ms);
+    printf("max |lane offset|=%.3fm (limit %.2fm)  min lead gap=%.2fm  departures=%ld  collisions=%ld\n",
+           pSim->Max_Offset, pSim->Lane_Limit, pSim->Min_Gap, pSim->Departures, pSim->Collisions);
+
+    int rc = ((pSim->Departures > 0) || (pSim->Collisions > 0)) ? 1 : 0;
+    VehicleSim_Destroy(&pSim->Fleet);
+    free(pSim->pAgents);
+    free(pSim);
+    return rc;
+}
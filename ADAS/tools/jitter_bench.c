@@ -0,0 +1,367 @@
+/****************************************************************************
+ * jitter_bench.c
+ *
+ * - 제어 루프 jitter 벤치마크 (cyclictest 방식)
+ *   : 런타임(adas_runtime.h)으로 전체 파이프라인을 설정 주기로 N 분 실행
+ *   : 선택 사항: 배경 부하 스레드 (CPU 연산 / 메모리 대역폭·캐시 오염)
+ *   : 기상 지연(wake)과 release 기준 완료 시간(response) 분포 -> 최대 / p99.9 / 히스토그램
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -D_GNU_SOURCE -O2 -Iinclude tools/jitter_bench.c $(ls src/[a-z]*.c | grep -v main.c) -lm -lpthread -o jitter_bench
+ * - 실행 예 (PREEMPT_RT 보드, CPU 3 격리):
+ *   sudo ./jitter_bench -d 10 -r 80 -c 3 -m -S 3 -M 2 -B 256 -o jitter.csv
+ * - 종료 코드: 0 = 마감 초과 없음, 1 = 마감 초과 있음, 2 = 인자/실행 오류
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt, pthread_setaffinity_np */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include "adas_runtime.h"
+#include "adas_metrics.h"
+#include "adas_time.h"
+
+/*
+ * 사용법: jitter_bench [-p 주기(ms), 기본 10] [-d 실행 시간(분), 기본 1] [-r SCHED_FIFO 우선순위]
+ *                      [-c 루프 CPU 번호] [-m (mlockall)]
+ *                      [-S CPU 부하 스레드 수] [-M 메모리 부하 스레드 수] [-B 메모리 부하 스레드당 MiB, 기본 64]
+ *                      [-k 부하 스레드 고정 CPU 번호 (기본 고정 안 함)]
+ *                      [-o 히스토그램 CSV (버킷별 wake/response 개수)] [-q (텍스트 히스토그램 생략)]
+ *  - 부하 스레드는 SCHED_OTHER, 루프 스레드만 RT 설정 적용
+ *  - Ctrl+C 로 조기 종료해도 그때까지의 결과 출력
+ */
+
+#define STRESS_MAX_THREADS  64
+#define HIST_BAR_WIDTH      40
+
+static AdasRuntime_t   s_runtime;
+static AdasMetrics_t   s_metrics;
+static AdasLatencyHist_t s_wake;
+static AdasLatencyHist_t s_resp;
+static volatile int    s_stressStop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    AdasRuntime_RequestStop(&s_runtime);
+}
+
+/* ------ 입력: 선행차 / 보행자 / 원거리 차량이 접근, 5m 까지 가까워지면 초기 위치로 재배치 ------ */
+static const ObjectData_t s_initObjects[3] = {
+    { .Object_ID=1, .Object_Type=OBJTYPE_CAR, .Position_X=30.0f, .Position_Y=0.5f,
+      .Distance=30.0f, .Velocity_X=8.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING },
+    { .Object_ID=2, .Object_Type=OBJTYPE_PEDESTRIAN, .Position_X=25.0f, .Position_Y=2.0f,
+      .Distance=26.0f, .Velocity_X=1.0f, .Heading=10.0f, .Object_Status=OBJSTAT_MOVING },
+    { .Object_ID=3, .Object_Type=OBJTYPE_CAR, .Position_X=100.0f, .Position_Y=-0.5f,
+      .Distance=100.0f, .Velocity_X=12.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING }
+};
+
+static int bench_input(void *pUser, uint64_t cycle, AdasFrameInput_t *pIn)
+{
+    const float egoSpeed = 10.0f;
+    float t = pIn->Time.Current_Time * 0.001f;   /* [s] */
+    (void)pUser;
+    (void)cycle;
+
+    pIn->Gps.GPS_Velocity_X = egoSpeed;
+    pIn->Gps.GPS_Timestamp  = pIn->Time.Current_Time;
+    pIn->Lane.Lane_Type     = LANE_TYPE_STRAIGHT;
+    pIn->Lane.Lane_Width    = 3.5f;
+    pIn->Lane.Lane_Change_Status = LANE_CHANGE_KEEP;
+
+    pIn->Object_Count = 3;
+    for(int i = 0; i < 3; i++)
+    {
+        ObjectData_t obj = s_initObjects[i];
+        float closing = (egoSpeed - obj.Velocity_X) * t;
+        float span    = obj.Distance - 5.0f;
+        if(closing > 0.0f && span > 0.0f)
+            closing = fmodf(closing, span);
+        obj.Position_X -= closing;
+        obj.Distance   -= closing;
+        pIn->Objects[i] = obj;
+    }
+    return 0;
+}
+
+/* ------ 부하 스레드 ------ */
+typedef struct
+{
+    pthread_t Thread;
+    int       Cpu;          /* -1 = 고정 안 함 */
+    size_t    Bytes;        /* 0 = CPU 부하 */
+    uint8_t  *pBuffer;
+} Stressor_t;
+
+static void pin_self(int cpu)
+{
+    if((cpu < 0) || (cpu >= CPU_SETSIZE))
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET((size_t)cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/* CPU 부하: 부동소수점 연산 반복 (메모리 접근 없음) */
+static void *stress_cpu(void *pArg)
+{
+    Stressor_t *pS = (Stressor_t *)pArg;
+    volatile double acc = 1.0;
+    pin_self(pS->Cpu);
+
+    while(!s_stressStop)
+    {
+        for(int i = 0; i < 4096; i++)
+            acc = sqrt(acc * 1.0000001 + 1.0) + sin(acc);
+    }
+    return NULL;
+}
+
+/* 메모리 부하: 캐시 라인 단위 순차 쓰기 + 임의 위치 읽기 (LLC/TLB 오염, 대역폭 점유) */
+static void *stress_mem(void *pArg)
+{
+    Stressor_t *pS = (Stressor_t *)pArg;
+    uint64_t x = 0x9E3779B97F4A7C15ULL ^ (uint64_t)(uintptr_t)pS;
+    volatile uint8_t sink = 0;
+    pin_self(pS->Cpu);
+
+    while(!s_stressStop)
+    {
+        for(size_t i = 0; i < pS->Bytes; i += 64)
+            pS->pBuffer[i] = (uint8_t)(pS->pBuffer[i] + 1);
+        for(size_t i = 0; (i < pS->Bytes / 64) && !s_stressStop; i++)
+        {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            sink = (uint8_t)(sink + pS->pBuffer[x % pS->Bytes]);
+        }
+    }
+    return NULL;
+}
+
+static void stop_stressors(Stressor_t *pS, int count)
+{
+    s_stressStop = 1;
+    for(int i = 0; i < count; i++)
+    {
+        pthread_join(pS[i].Thread, NULL);
+        free(pS[i].pBuffer);
+        pS[i].pBuffer = NULL;
+    }
+}
+
+/* 실패 시 이미 시작한 부하 스레드는 멈추고 join 후 반환 */
+static int start_stressors(Stressor_t *pS, int cpuCount, int memCount, size_t memBytes, int cpu)
+{
+    for(int i = 0; i < cpuCount + memCount; i++)
+    {
+        pS[i].Cpu     = cpu;
+        pS[i].Bytes   = (i < cpuCount) ? 0 : memBytes;
+        pS[i].pBuffer = NULL;
+        if(pS[i].Bytes != 0)
+        {
+            pS[i].pBuffer = (uint8_t *)malloc(pS[i].Bytes);
+            if(!pS[i].pBuffer)
+            {
+                stop_stressors(pS, i);
+                return -1;
+            }
+            memset(pS[i].pBuffer, 0, pS[i].Bytes);
+        }
+        if(pthread_create(&pS[i].Thread, NULL, (i < cpuCount) ? stress_cpu : stress_mem, &pS[i]) != 0)
+        {
+            free(pS[i].pBuffer);
+            pS[i].pBuffer = NULL;
+            stop_stressors(pS, i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* ------ 보고서 ------ */
+static void print_summary_row(const char *name, const AdasLatencyHist_t *pHist)
+{
+    const double us = (double)ADAS_NS_PER_US;
+    AdasLatencySummary_t s;
+    AdasHist_Summarize(pHist, &s);
+    printf("  %-10s %10llu %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", name,
+           (unsigned long long)s.Count, (s.Count ? (double)s.Min_Ns : 0.0) / us, s.Mean_Ns / us,
+           (double)s.P50_Ns / us, (double)s.P99_Ns / us, (double)s.P999_Ns / us,
+           (double)s.P9999_Ns / us, (double)s.Max_Ns / us);
+}
+
+/* 2의 거듭제곱 us 구간으로 묶은 히스토그램 (막대는 log10 개수 비례) */
+static void print_histogram(const AdasLatencyHist_t *pWake, const AdasLatencyHist_t *pResp)
+{
+    enum { BINS = 24 };   /* [0,1) [1,2) [2,4) ... [2^22, ) us */
+    uint64_t wake[BINS] = { 0 };
+    uint64_t resp[BINS] = { 0 };
+    int first = BINS;
+    int last  = 0;
+
+    for(uint32_t b = 0; b < ADAS_HIST_BUCKETS; b++)
+    {
+        if((pWake->Buckets[b] | pResp->Buckets[b]) == 0)
+            continue;
+        uint64_t lowUs = AdasHist_BucketLow(b) / ADAS_NS_PER_US;
+        int bin = (lowUs == 0) ? 0 : (64 - __builtin_clzll(lowUs));
+        if(bin >= BINS) bin = BINS - 1;
+        wake[bin] += pWake->Buckets[b];
+        resp[bin] += pResp->Buckets[b];
+        if(bin < first) first = bin;
+        if(bin > last)  last  = bin;
+    }
+
+    printf("---- Histogram [us] (bar = log10 count) ----\n");
+    printf("  %-16s %10s %10s  %s\n", "range", "wake", "response", "response");
+    for(int i = first; i <= last; i++)
+    {
+        char range[32];
+        if(i == 0)
+            snprintf(range, sizeof(range), "[0, 1)");
+        else if(i == BINS - 1)
+            snprintf(range, sizeof(range), "[%llu, )", 1ULL << (i - 1));
+        else
+            snprintf(range, sizeof(range), "[%llu, %llu)", 1ULL << (i - 1), 1ULL << i);
+
+        char bar[HIST_BAR_WIDTH + 1];
+        int len = (resp[i] == 0) ? 0 : 1 + (int)(log10((double)resp[i]) * 4.0);
+        if(len > HIST_BAR_WIDTH) len = HIST_BAR_WIDTH;
+        memset(bar, '#', (size_t)len);
+        bar[len] = '\0';
+        printf("  %-16s %10llu %10llu  %s\n", range,
+               (unsigned long long)wake[i], (unsigned long long)resp[i], bar);
+    }
+}
+
+/* 전체 버킷 CSV (그래프용, 빈 버킷 생략) */
+static int write_histogram_csv(const char *path, const AdasLatencyHist_t *pWake, const AdasLatencyHist_t *pResp)
+{
+    FILE *fp = fopen(path, "w");
+    if(!fp)
+        return -1;
+
+    fprintf(fp, "low_ns,high_ns,wake,response\n");
+    for(uint32_t b = 0; b < ADAS_HIST_BUCKETS; b++)
+    {
+        if((pWake->Buckets[b] | pResp->Buckets[b]) == 0)
+            continue;
+        fprintf(fp, "%llu,%llu,%llu,%llu\n",
+                (unsigned long long)AdasHist_BucketLow(b), (unsigned long long)AdasHist_BucketHigh(b),
+                (unsigned long long)pWake->Buckets[b], (unsigned long long)pResp->Buckets[b]);
+    }
+    return (fclose(fp) == 0) ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    AdasRuntimeConfig_t cfg;
+    AdasRuntime_DefaultConfig(&cfg);
+
+    double minutes  = 1.0;
+    int cpuStress   = 0;
+    int memStress   = 0;
+    double memMiB   = 64.0;
+    int stressCpu   = -1;
+    const char *csvPath = NULL;
+    int quiet = 0;
+    int opt;
+
+    while((opt = getopt(argc, argv, "p:d:r:c:mS:M:B:k:o:q")) != -1)
+    {
+        switch(opt)
+        {
+        case 'p': cfg.Period_Ns   = (uint64_t)(atof(optarg) * (double)ADAS_NS_PER_MS); break;
+        case 'd': minutes         = atof(optarg); break;
+        case 'r': cfg.Rt_Priority = atoi(optarg); break;
+        case 'c': cfg.Cpu_Id      = atoi(optarg); break;
+        case 'm': cfg.Lock_Memory = 1; break;
+        case 'S': cpuStress = atoi(optarg); break;
+        case 'M': memStress = atoi(optarg); break;
+        case 'B': memMiB    = atof(optarg); break;
+        case 'k': stressCpu = atoi(optarg); break;
+        case 'o': csvPath   = optarg; break;
+        case 'q': quiet     = 1; break;
+        default:
+            fprintf(stderr, "usage: %s [-p period_ms] [-d minutes] [-r fifo_prio] [-c cpu] [-m] [-S cpu_stressors] [-M mem_stressors] [-B mem_mib] [-k stressor_cpu] [-o hist.csv] [-q]\n", argv[0]);
+            return 2;
+        }
+    }
+    if((cfg.Period_Ns == 0) || (minutes <= 0.0) || (cpuStress < 0) || (memStress < 0) ||
+       (cpuStress + memStress > STRESS_MAX_THREADS) || (memMiB <= 0.0))
+    {
+        fprintf(stderr, "invalid arguments (period > 0, minutes > 0, stressors 0..%d)\n", STRESS_MAX_THREADS);
+        return 2;
+    }
+    cfg.Cycle_Limit = (uint64_t)(minutes * 60.0 * (double)ADAS_NS_PER_SEC / (double)cfg.Period_Ns);
+    if(cfg.Cycle_Limit == 0) cfg.Cycle_Limit = 1;
+
+    if(AdasRuntime_Init(&s_runtime, &cfg, bench_input, NULL, NULL) != 0)
+    {
+        fprintf(stderr, "invalid runtime config\n");
+        return 2;
+    }
+    AdasMetrics_Init(&s_metrics);
+    AdasRuntime_SetMetrics(&s_runtime, &s_metrics);
+
+    signal(SIGINT,  on_signal);
+    signal(SIGTERM, on_signal);
+
+    /* 부하 스레드는 RT 설정 전에 생성 (루프 스레드의 우선순위/고정을 물려받지 않음) */
+    static Stressor_t stressors[STRESS_MAX_THREADS];
+    int stressCount = cpuStress + memStress;
+    if(start_stressors(stressors, cpuStress, memStress, (size_t)(memMiB * 1024.0 * 1024.0), stressCpu) != 0)
+    {
+        fprintf(stderr, "stressor start failed\n");
+        return 2;
+    }
+
+    printf("jitter_bench: period=%.3f ms, cycles=%llu (%.2f min), prio=%d, cpu=%d, mlock=%d, stress cpu=%d mem=%dx%.0fMiB\n",
+           (double)cfg.Period_Ns / (double)ADAS_NS_PER_MS, (unsigned long long)cfg.Cycle_Limit, minutes,
+           cfg.Rt_Priority, cfg.Cpu_Id, cfg.Lock_Memory, cpuStress, memStress, memMiB);
+    fflush(stdout);
+
+    int rtFail = AdasRuntime_ApplyRtSettings(&cfg);
+    AdasRuntime_Run(&s_runtime);
+    stop_stressors(stressors, stressCount);
+
+    if(rtFail & ADAS_RT_FAIL_MLOCK)    fprintf(stderr, "warning: mlockall failed\n");
+    if(rtFail & ADAS_RT_FAIL_AFFINITY) fprintf(stderr, "warning: CPU affinity failed\n");
+    if(rtFail & ADAS_RT_FAIL_SCHED)    fprintf(stderr, "warning: SCHED_FIFO failed (need CAP_SYS_NICE)\n");
+
+    /* 루프 종료 후라 기록자 없음 -> Snapshot 은 재시도 없이 성공 */
+    AdasHist_Snapshot(&s_metrics.Hist[ADAS_METRIC_WAKE], &s_wake);
+    AdasHist_Snapshot(&s_metrics.Hist[ADAS_METRIC_RESPONSE], &s_resp);
+
+    const AdasRuntimeStats_t *pSt = &s_runtime.Stats;
+    printf("---- Jitter ----\n");
+    printf("Cycles=%llu, DeadlineMiss=%llu, Skipped=%llu\n",
+           (unsigned long long)pSt->Cycles, (unsigned long long)pSt->Deadline_Misses,
+           (unsigned long long)pSt->Skipped_Periods);
+    printf("  %-10s %10s %9s %9s %9s %9s %9s %9s %9s\n", "[us]", "count", "min", "mean", "p50", "p99", "p99.9", "p99.99", "max");
+    print_summary_row("wake", &s_wake);
+    print_summary_row("response", &s_resp);
+    print_summary_row("pipeline", &s_metrics.Hist[ADAS_METRIC_PIPELINE]);
+
+    if(!quiet)
+        print_histogram(&s_wake, &s_resp);
+
+    if(csvPath)
+    {
+        if(write_histogram_csv(csvPath, &s_wake, &s_resp) != 0)
+        {
+            fprintf(stderr, "%s: write failed\n", csvPath);
+            return 2;
+        }
+        printf("histogram written to %s\n", csvPath);
+    }
+
+    AdasRuntime_Destroy(&s_runtime);
+    return (pSt->Deadline_Misses != 0) ? 1 : 0;
+}
@@ -0,0 +1,183 @@
+/****************************************************************************
+ * scenario_signoff.c
+ *
+ * - 출시 검증 시나리오 격자 일괄 실행 (scenario_batch.h)
+ *   : 끼어들기 / 정지-출발 / 곡선 격자를 작업 훔치기 스레드 풀로 전수 실행
+ *   : 종류별 KPI 표 (개수 / 평균 / 표준편차 / 최소 / p50 / p95 / p99 / 최대) 출력
+ *   : 처리량 = 실행 수 / 시간 (시간당 실행 수로 환산)
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -D_GNU_SOURCE -O2 -Iinclude tools/scenario_signoff.c $(ls src/[a-z]*.c | grep -v main.c) -lm -lpthread -o scenario_signoff
+ * - 실행 예:
+ *   ./scenario_signoff -j 8                   (축당 6 점 = 648 실행, 20 초씩)
+ *   ./scenario_signoff -j 8 -n 10 -o runs.csv (축당 10 점 = 3000 실행, 실행별 CSV)
+ * - 종료 코드: 0 = 추돌 없음, 1 = 추돌 있음, 2 = 인자/실행 오류
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "scenario_batch.h"
+
+/*
+ * 사용법: scenario_signoff [-j 스레드 수, 기본 1] [-s 실행당 시간(초), 기본 20] [-p 제어 주기(ms), 기본 10]
+ *                          [-n 축당 점 수, 기본 6] [-b 묶음 실행 수, 기본 8] [-o 실행별 CSV 파일] [-q (표 생략)]
+ *  - 격자 (축당 n 점): 자차 속도 10 ~ 30 m/s x 선행차 간격 20 ~ 80 m x 종류별 파라미터
+ *      끼어들기 진입 간격 10 ~ 40 m / 선행차 감속도 1 ~ 8 m/s^2 / 곡률 반경 250 ~ 1000 m (좌/우)
+ */
+
+typedef struct
+{
+    FILE           *pFile;
+    pthread_mutex_t Lock;
+} CsvSink_t;
+
+static void on_result(void *pUser, int64_t index, const ScenarioInstance_t *pInst, const ScenarioResult_t *pRes)
+{
+    CsvSink_t *pSink = (CsvSink_t *)pUser;
+
+    pthread_mutex_lock(&pSink->Lock);
+    fprintf(pSink->pFile, "%lld,%s,%.2f,%.2f,%.2f", (long long)index, ScenarioBatch_TypeName(pInst->Type),
+            pInst->Ego_Speed, pInst->Lead_Gap, pInst->Param);
+    for(int k = 0; k < SCENARIO_KPI_COUNT; k++)
+        fprintf(pSink->pFile, ",%.4f", pRes->Kpi[k]);
+    fprintf(pSink->pFile, ",%d,%d\n", pRes->Collision, pRes->Lane_Departure);
+    pthread_mutex_unlock(&pSink->Lock);
+}
+
+/* 출시 검증 격자 (곡선은 좌/우 각각 1 개 격자) */
+static int make_grids(ScenarioGrid_t *pGrids, int n)
+{
+    const ScenarioAxis_t speed = { 10.0f, 30.0f, n };
+    const ScenarioAxis_t gap   = { 20.0f, 80.0f, n };
+
+    pGrids[0].Type      = SCENARIO_CUT_IN;
+    pGrids[0].Ego_Speed = speed;
+    pGrids[0].Lead_Gap  = gap;
+    pGrids[0].Param     = (ScenarioAxis_t){ 10.0f, 40.0f, n };
+
+    pGrids[1].Type      = SCENARIO_STOP_AND_GO;
+    pGrids[1].Ego_Speed = speed;
+    pGrids[1].Lead_Gap  = gap;
+    pGrids[1].Param     = (ScenarioAxis_t){ 1.0f, 8.0f, n };
+
+    pGrids[2].Type      = SCENARIO_CURVE;
+    pGrids[2].Ego_Speed = speed;
+    pGrids[2].Lead_Gap  = gap;
+    pGrids[2].Param     = (ScenarioAxis_t){ 250.0f, 1000.0f, n };
+
+    pGrids[3]           = pGrids[2];
+    pGrids[3].Param     = (ScenarioAxis_t){ -1000.0f, -250.0f, n };
+    return 4;
+}
+
+static void print_table(const ScenarioAggregate_t *pAgg)
+{
+    for(int t = 0; t < SCENARIO_TYPE_COUNT; t++)
+    {
+        const ScenarioAggregate_t *pA = &pAgg[t];
+        printf("\n[%s] runs=%llu  collisions=%llu  departures=%llu\n", ScenarioBatch_TypeName((ScenarioType_e)t),
+               (unsigned long long)pA->Runs, (unsigned long long)pA->Collisions,
+               (unsigned long long)pA->Departures);
+        if(pA->Runs == 0)
+            continue;
+
+        printf("  %-16s %10s %10s %10s %10s %10s %10s %10s\n",
+               "kpi", "mean", "sd", "min", "p50", "p95", "p99", "max");
+        for(int k = 0; k < SCENARIO_KPI_COUNT; k++)
+        {
+            const ScenarioStat_t *pS = &pA->Kpi[k];
+            printf("  %-16s %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                   ScenarioBatch_KpiName((ScenarioKpi_e)k), pS->Mean, ScenarioStat_Stddev(pS), pS->Min,
+                   ScenarioStat_Quantile(pS, 50.0), ScenarioStat_Quantile(pS, 95.0),
+                   ScenarioStat_Quantile(pS, 99.0), pS->Max);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static ScenarioAggregate_t agg[SCENARIO_TYPE_COUNT];
+    static ScenarioBatchStats_t stats;
+    ScenarioGrid_t grids[4];
+    ScenarioBatchConfig_t cfg;
+    const char *pCsvPath = NULL;
+    int   points = 6;
+    int   quiet = 0;
+    float periodMs = 10.0f;
+    int   opt;
+
+    ScenarioBatch_DefaultConfig(&cfg);
+    while((opt = getopt(argc, argv, "j:s:p:n:b:o:q")) != -1)
+    {
+        switch(opt)
+        {
+            case 'j': cfg.Thread_Count = atoi(optarg); break;
+            case 's': cfg.Duration     = (float)atof(optarg); break;
+            case 'p': periodMs         = (float)atof(optarg); break;
+            case 'n': points           = atoi(optarg); break;
+            case 'b': cfg.Batch_Size   = atoi(optarg); break;
+            case 'o': pCsvPath         = optarg; break;
+            case 'q': quiet            = 1; break;
+            default:
+                fprintf(stderr, "usage: %s [-j threads] [-s seconds] [-p period_ms] [-n points] [-b batch] [-o csv] [-q]\n",
+                        argv[0]);
+                return 2;
+        }
+    }
+    cfg.Delta_Time = periodMs * 0.001f;
+    if(points < 1)
+    {
+        fprintf(stderr, "invalid arguments\n");
+        return 2;
+    }
+
+    CsvSink_t sink;
+    memset(&sink, 0, sizeof(sink));
+    if(pCsvPath)
+    {
+        sink.pFile = fopen(pCsvPath, "w");
+        if(!sink.pFile)
+        {
+            perror(pCsvPath);
+            return 2;
+        }
+        pthread_mutex_init(&sink.Lock, NULL);
+        fprintf(sink.pFile, "index,type,ego_speed,lead_gap,param");
+        for(int k = 0; k < SCENARIO_KPI_COUNT; k++)
+            fprintf(sink.pFile, ",%s", ScenarioBatch_KpiName((ScenarioKpi_e)k));
+        fprintf(sink.pFile, ",collision,lane_departure\n");
+        cfg.pfnResult = on_result;
+        cfg.pUser     = &sink;
+    }
+
+    int gridCount = make_grids(grids, points);
+    int rc = ScenarioBatch_Run(grids, gridCount, &cfg, agg, &stats);
+    if(sink.pFile)
+    {
+        fclose(sink.pFile);
+        pthread_mutex_destroy(&sink.Lock);
+    }
+    if(rc != 0)
+    {
+        fprintf(stderr, "batch run failed (invalid config or %lld runs completed)\n", (long long)stats.Runs);
+        return 2;
+    }
+
+    uint64_t collisions = 0;
+    for(int t = 0; t < SCENARIO_TYPE_COUNT; t++)
+        collisions += agg[t].Collisions;
+
+    double wallSec = (double)stats.Wall_Ns * 1e-9;
+    double perHour = (wallSec > 0.0) ? (double)stats.Runs * 3600.0 / wallSec : 0.0;
+    printf("runs=%lld  threads=%d  batch=%d  sim=%.1fs @ %.1fms  wall=%.2fs  throughput=%.0f runs/h  steals=%llu\n",
+           (long long)stats.Runs, cfg.Thread_Count, cfg.Batch_Size, cfg.Duration, periodMs, wallSec, perHour,
+           (unsigned long long)stats.Steals);
+    if(!quiet)
+        print_table(agg);
+
+    return (collisions > 0) ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/****************************************************************************
+ * sensor_fault_stress.c
+ *
+ * - Ego 추정기 센서 열화 부하 시험 (sensor_fault.h)
+ *   : 스트림(차량) N 개 x T 초: GPS / IMU 열화 샘플 생성 -> 도착 순 재생 -> EgoVehicleEstimation
+ *   : 스트림을 스레드에 나눠 병렬 처리, 결과 체크섬은 스레드 수와 무관 (카운터 기반 난수)
+ *   : 생성 처리량 (샘플/초) 과 추정 오차 (RMS / 최대), GPS 유효 시간 밖 비율 출력
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -D_GNU_SOURCE -O2 -Iinclude tools/sensor_fault_stress.c $(ls src/[a-z]*.c | grep -v main.c) -lm -lpthread -o sensor_fault_stress
+ * - 실행 예:
+ *   ./sensor_fault_stress -n 1000 -s 60 -j 4       (1000 대 x 60 초, 약 660 만 샘플)
+ *   ./sensor_fault_stress -n 1000 -s 60 -j 4 -g    (생성만, 추정기 재생 없음)
+ * - 종료 코드: 0 = 최대 오차 <= -e 한계, 1 = 초과, 2 = 인자/메모리 오류
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "sensor_fault.h"
+#include "ego_vehicle_estimation.h"
+#include "adas_time.h"
+
+/*
+ * 사용법: sensor_fault_stress [-n 스트림 수, 기본 256] [-s 스트림당 시간(초), 기본 30] [-j 스레드 수, 기본 1]
+ *                             [-k 시드, 기본 1] [-e 최대 오차 한계(m/s), 기본 2] [-g (생성만)]
+ *  - 참값: 스트림마다 속도 10 ~ 30 m/s 정속, 추정기는 참값으로 시작 (오차 = 열화 영향만)
+ *  - 제어 주기 10 ms, 오차는 시작 1 초 이후 집계
+ */
+
+#define STRESS_TICK_MS     10.0f
+#define STRESS_SETTLE_MS   1000.0f
+#define STRESS_MAX_THREADS 64
+
+typedef struct
+{
+    const SensorFaultConfig_t *pConfig;
+    int       First;
+    int       Last;
+    float     Sim_Ms;
+    int       Generate_Only;
+
+    /* 결과 */
+    uint64_t  Samples;
+    uint64_t  Gen_Ns;
+    uint64_t  Ticks;
+    uint64_t  Stale_Ticks;
+    double    Err_Sq;
+    float     Max_Err;
+    uint64_t  Checksum;
+    int       Failed;
+} StressWorker_t;
+
+static uint64_t mix64(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    return x ^ (x >> 33);
+}
+
+static void fill_truth(SensorSample_t *pS, int count, float v0)
+{
+    memset(pS, 0, sizeof(*pS) * (size_t)count);
+    for(int i = 0; i < count; i++)
+    {
+        pS[i].Index    = (uint64_t)i;
+        pS[i].Value[0] = v0;
+    }
+}
+
+static void *stress_main(void *pArg)
+{
+    StressWorker_t *pW = (StressWorker_t *)pArg;
+    const SensorFaultConfig_t *pCfg = pW->pConfig;
+    const int nGps = (int)(pW->Sim_Ms / pCfg->Sensor[SENSOR_FAULT_GPS].Period_Ms) + 2;
+    const int nImu = (int)(pW->Sim_Ms / pCfg->Sensor[SENSOR_FAULT_IMU].Period_Ms) + 2;
+    SensorSample_t *pGps = (SensorSample_t *)malloc(sizeof(SensorSample_t) * (size_t)nGps);
+    SensorSample_t *pImu = (SensorSample_t *)malloc(sizeof(SensorSample_t) * (size_t)nImu);
+    if(!pGps || !pImu)
+    {
+        pW->Failed = 1;
+        free(pGps);
+        free(pImu);
+        return NULL;
+    }
+
+    const int ticks = (int)(pW->Sim_Ms / STRESS_TICK_MS);
+    for(int s = pW->First; s < pW->Last; s++)
+    {
+        const float truth = 10.0f + (float)(s % 21);
+        fill_truth(pGps, nGps, truth);
+        fill_truth(pImu, nImu, 0.0f);
+
+        uint64_t t0 = AdasTime_NowNs();
+        SensorFault_Apply(pCfg, SENSOR_FAULT_GPS, (uint64_t)s, pGps, nGps);
+        SensorFault_Apply(pCfg, SENSOR_FAULT_IMU, (uint64_t)s, pImu, nImu);
+        pW->Gen_Ns  += AdasTime_NowNs() - t0;
+        pW->Samples += (uint64_t)(nGps + nImu);
+        if(pW->Generate_Only)
+        {
+            uint32_t bits;
+            memcpy(&bits, &pImu[nImu - 1].Value[0], sizeof(bits));
+            pW->Checksum ^= mix64(((uint64_t)s << 32) | bits);
+            continue;
+        }
+
+        SensorFault_SortByArrival(pGps, nGps);
+        SensorFault_SortByArrival(pImu, nImu);
+
+        EgoVehicleKFState_t kf;
+        InitEgoVehicleKFState(&kf);
+        kf.X[0]           = truth;
+        kf.Prev_GPS_Vel_X = truth;
+
+        const SensorSample_t *pLastGps = NULL, *pLastImu = NULL;
+        int gc = 0, ic = 0;
+        uint64_t h = (uint64_t)s;
+        for(int k = 1; k <= ticks; k++)
+        {
+            float now = STRESS_TICK_MS * (float)k;
+            pLastGps = SensorFault_Latest(pGps, nGps, &gc, now, pLastGps);
+            pLastImu = SensorFault_Latest(pImu, nImu, &ic, now, pLastImu);
+
+            TimeData_t time = { now };
+            GPSData_t  gps  = { truth, 0.0f, -1.0e6f };
+            IMUData_t  imu  = { 0.0f, 0.0f, 0.0f };
+            if(pLastGps) SensorFault_ToGps(pLastGps, &gps);
+            if(pLastImu) SensorFault_ToImu(pLastImu, &imu);
+
+            EgoData_t ego;
+            EgoVehicleEstimation(&time, &gps, &imu, &ego, &kf);
+
+            if(now >= STRESS_SETTLE_MS)
+            {
+                float err = fabsf(ego.Ego_Velocity_X - truth);
+                pW->Err_Sq += (double)err * (double)err;
+                if(err > pW->Max_Err) pW->Max_Err = err;
+                pW->Ticks++;
+                pW->Stale_Ticks += (fabsf(now - gps.GPS_Timestamp) > GPS_VALID_TIME_THRESH);
+            }
+            uint32_t bits;
+            memcpy(&bits, &ego.Ego_Velocity_X, sizeof(bits));
+            h = mix64(h ^ bits);
+        }
+        pW->Checksum ^= h;
+    }
+
+    free(pGps);
+    free(pImu);
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    static StressWorker_t workers[STRESS_MAX_THREADS];
+    int   streams = 256;
+    float simSec = 30.0f;
+    int   threads = 1;
+    float errLimit = 2.0f;
+    int   genOnly = 0;
+    unsigned long long seed = 1;
+    int   opt;
+
+    while((opt = getopt(argc, argv, "n:s:j:k:e:g")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': streams  = atoi(optarg); break;
+            case 's': simSec   = (float)atof(optarg); break;
+            case 'j': threads  = atoi(optarg); break;
+            case 'k': seed     = strtoull(optarg, NULL, 0); break;
+            case 'e': errLimit = (float)atof(optarg); break;
+            case 'g': genOnly  = 1; break;
+            default:
+                fprintf(stderr, "usage: %s [-n streams] [-s seconds] [-j threads] [-k seed] [-e max_err] [-g]\n", argv[0]);
+                return 2;
+        }
+    }
+    if((streams <= 0) || (simSec <= 0.0f) || (threads < 1) || (threads > STRESS_MAX_THREADS))
+    {
+        fprintf(stderr, "invalid arguments\n");
+        return 2;
+    }
+    if(threads > streams)
+        threads = streams;
+
+    SensorFaultConfig_t cfg;
+    SensorFault_DefaultConfig(&cfg);
+    cfg.Seed = seed;
+
+    uint64_t t0 = AdasTime_NowNs();
+    int started = 0;
+    for(int w = 0; w < threads; w++)
+    {
+        StressWorker_t *pW = &workers[w];
+        pW->pConfig       = &cfg;
+        pW->First         = (int)((int64_t)streams * w / threads);
+        pW->Last          = (int)((int64_t)streams * (w + 1) / threads);
+        pW->Sim_Ms        = simSec * 1000.0f;
+        pW->Generate_Only = genOnly;
+    }
+    pthread_t tid[STRESS_MAX_THREADS];
+    for(; started < threads; started++)
+    {
+        if(pthread_create(&tid[started], NULL, stress_main, &workers[started]) != 0)
+            break;
+    }
+    for(int w = 0; w < started; w++)
+        pthread_join(tid[w], NULL);
+    uint64_t wallNs = AdasTime_NowNs() - t0;
+    if(started < threads)
+    {
+        fprintf(stderr, "thread creation failed\n");
+        return 2;
+    }
+
+    uint64_t samples = 0, genNs = 0, ticks = 0, stale = 0, checksum = 0;
+    double   errSq = 0.0;
+    float    maxErr = 0.0f;
+    for(int w = 0; w < threads; w++)
+    {
+        const StressWorker_t *pW = &workers[w];
+        if(pW->Failed)
+        {
+            fprintf(stderr, "out of memory\n");
+            return 2;
+        }
+        samples  += pW->Samples;
+        genNs    += pW->Gen_Ns;
+        ticks    += pW->Ticks;
+        stale    += pW->Stale_Ticks;
+        errSq    += pW->Err_Sq;
+        checksum ^= pW->Checksum;
+        if(pW->Max_Err > maxErr) maxErr = pW->Max_Err;
+    }
+
+    double wallSec = (double)wallNs * 1e-9;
+    printf("streams=%d  sim=%.1fs  threads=%d  seed=%llu  mode=%s\n",
+           streams, simSec, threads, seed, genOnly ? "generate-only" : "replay");
+    printf("samples=%llu  generate=%.1f ns/sample (%.3g samples/s per thread)  wall=%.3fs\n",
+           (unsigned long long)samples, samples ? (double)genNs / (double)samples : 0.0,
+           genNs ? (double)samples * 1e9 / (double)genNs : 0.0, wallSec);
+    if(!genOnly)
+    {
+        printf("ego vx error: rms=%.3f m/s  max=%.3f m/s (limit %.2f)  gps stale ticks=%.1f%%\n",
+               ticks ? sqrt(errSq / (double)ticks) : 0.0, maxErr, errLimit,
+               ticks ? 100.0 * (double)stale / (double)ticks : 0.0);
+    }
+    printf("checksum=%016llx\n", (unsigned long long)checksum);
+
+    return (maxErr > errLimit) ? 1 : 0;
+}
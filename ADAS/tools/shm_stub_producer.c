@@ -0,0 +1,133 @@
+/****************************************************************************
+ * shm_stub_producer.c
+ *
+ * - 시뮬레이터(Carla 브리지) 대역 생산자: 데모 시나리오 프레임을 공유 메모리 링에 게시
+ * - 빌드 (ADAS 디렉터리에서):
+ *   gcc -std=c11 -O2 -Iinclude tools/shm_stub_producer.c src/shm_transport.c -lm -o shm_stub_producer
+ * - 실행 예:
+ *   ./shm_stub_producer -r 100 -n 0 &
+ *   ./adas_main -x /adas_sim_frames -n 500
+ ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* getopt */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <signal.h>
+#include <unistd.h>
+#include "shm_transport.h"
+#include "adas_time.h"
+
+/*
+ * 사용법: shm_stub_producer [-x shm 이름] [-r 프레임 속도(Hz)] [-n 프레임 수(0=Ctrl+C까지)] [-k (종료 시 shm 유지)]
+ */
+
+static volatile int s_stop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    s_stop = 1;
+}
+
+/* main.c 데모 시나리오와 동일: ego 10 m/s, 선행차 / 보행자 / 원거리 차량이 접근 */
+static const ObjectData_t s_initObjects[3] = {
+    { .Object_ID=1, .Object_Type=OBJTYPE_CAR, .Position_X=30.0f, .Position_Y=0.5f,
+      .Distance=30.0f, .Velocity_X=8.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING },
+    { .Object_ID=2, .Object_Type=OBJTYPE_PEDESTRIAN, .Position_X=25.0f, .Position_Y=2.0f,
+      .Distance=26.0f, .Velocity_X=1.0f, .Heading=10.0f, .Object_Status=OBJSTAT_MOVING },
+    { .Object_ID=3, .Object_Type=OBJTYPE_CAR, .Position_X=100.0f, .Position_Y=-0.5f,
+      .Distance=100.0f, .Velocity_X=12.0f, .Heading=0.0f, .Object_Status=OBJSTAT_MOVING }
+};
+
+#define EGO_SPEED  10.0f
+
+/* 슬롯에 직접 작성 (중간 버퍼 없음) */
+static void fill_frame(AdasFrameInput_t *pIn, float timeMs)
+{
+    float t = timeMs * 0.001f;
+
+    memset(pIn, 0, sizeof(*pIn));
+    pIn->Time.Current_Time = timeMs;
+
+    pIn->Gps.GPS_Velocity_X = EGO_SPEED;
+    pIn->Gps.GPS_Timestamp  = timeMs;
+
+    pIn->Lane.Lane_Type            = LANE_TYPE_STRAIGHT;
+    pIn->Lane.Lane_Width           = 3.5f;
+    pIn->Lane.Lane_Change_Status   = LANE_CHANGE_KEEP;
+
+    pIn->Object_Count = 3;
+    for(int i = 0; i < 3; i++)
+    {
+        ObjectData_t obj = s_initObjects[i];
+        float closing = (EGO_SPEED - obj.Velocity_X) * t;
+        float span    = obj.Distance - 5.0f;
+        if(closing > 0.0f && span > 0.0f)
+        {
+            closing = fmodf(closing, span);
+        }
+        obj.Position_X -= closing;
+        obj.Distance   -= closing;
+        pIn->Objects[i] = obj;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *name    = ADAS_SHM_DEFAULT_NAME;
+    double      rateHz  = 100.0;
+    uint64_t    limit   = 0;
+    int         keep    = 0;
+    int         opt;
+
+    while((opt = getopt(argc, argv, "x:r:n:k")) != -1)
+    {
+        switch(opt)
+        {
+        case 'x': name   = optarg; break;
+        case 'r': rateHz = atof(optarg); break;
+        case 'n': limit  = strtoull(optarg, NULL, 10); break;
+        case 'k': keep   = 1; break;
+        default:
+            fprintf(stderr, "usage: %s [-x shm_name] [-r rate_hz] [-n frames] [-k]\n", argv[0]);
+            return 1;
+        }
+    }
+    if(rateHz <= 0.0)
+    {
+        fprintf(stderr, "invalid rate\n");
+        return 1;
+    }
+
+    AdasShmTransport_t shm;
+    if(AdasShm_Create(&shm, name) != 0)
+    {
+        fprintf(stderr, "shm create failed: %s\n", name);
+        return 1;
+    }
+
+    signal(SIGINT,  on_signal);
+    signal(SIGTERM, on_signal);
+
+    const uint64_t period  = (uint64_t)((double)ADAS_NS_PER_SEC / rateHz);
+    uint64_t       release = AdasTime_NowNs();
+    uint64_t       frames  = 0;
+
+    while(!s_stop && (limit == 0 || frames < limit))
+    {
+        AdasShmFrame_t *pF = AdasShm_BeginWrite(&shm);
+        fill_frame(&pF->Input, (float)((double)(frames * period) / (double)ADAS_NS_PER_MS));
+        AdasShm_EndWrite(&shm);
+        frames++;
+
+        release += period;
+        AdasTime_SleepUntilNs(release);
+    }
+
+    printf("published %llu frames to %s\n", (unsigned long long)frames, name);
+    AdasShm_Close(&shm, !keep);
+    return 0;
+}
@@ -4,10 +4,15 @@
  * 모든 모듈(ego estimation, lane selection, target selection, ACC, AEB, LFA, arbitration)
  * 을 하나의 소스 파일로 통합한 예시
  ****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   /* clock_nanosleep */
+#endif
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
 
 /*============================================================================
  * 1) adas_shared.h : 공통 자료형 및 상수 정의
@@ -221,6 +226,12 @@ typedef enum {
 #define LFA_LOW_SPEED_THRESHOLD 16.67f
 #define LFA_MAX_STEERING_ANGLE  540.0f
 
+/* 1-7. heading 정규화 (±180°): 반복 없이 O(1) (ADAS/include/adas_math.h AdasMath_WrapDeg180) */
+static inline float normalize_heading_deg(float hdg)
+{
+    return hdg - (360.0f * rintf(hdg * (1.0f / 360.0f)));
+}
+
 /*============================================================================
  * 2) Ego Vehicle Estimation Module
  *    (칼만 필터를 이용하여 IMU+GPS 데이터로 EgoData 추정)
@@ -337,8 +348,7 @@ void EgoEstimation_Update(
     ay = accel_y;
 
     /* heading 정규화 */
-    while(hdg > 180.0f)  hdg -= 360.0f;
-    while(hdg < -180.0f) hdg += 360.0f;
+    hdg = normalize_heading_deg(hdg);
 
     pState->X[0] = vx;
     pState->X[1] = vy;
@@ -390,8 +400,7 @@ static int LaneSelection_Compute(const LaneData_t *pLaneData,
 
     /* Heading Error 계산 (Ego_Heading - Lane_Heading) */
     float hdgErr = pEgoData->Ego_Heading - pLaneData->Lane_Heading;
-    while(hdgErr > 180.0f)  hdgErr -= 360.0f;
-    while(hdgErr < -180.0f) hdgErr += 360.0f;
+    hdgErr = normalize_heading_deg(hdgErr);
     pLsOut->LS_Heading_Error = hdgErr;
 
     float halfWidth = pLaneData->Lane_Width * 0.5f;
@@ -405,13 +414,6 @@ static int LaneSelection_Compute(const LaneData_t *pLaneData,
 /*============================================================================
  * 4) Target Selection Module
  *============================================================================*/
-static float normalize_heading_deg(float hdg)
-{
-    while(hdg > 180.0f)  hdg -= 360.0f;
-    while(hdg < -180.0f) hdg += 360.0f;
-    return hdg;
-}
-
 /* (1) select_target_from_object_list */
 static int select_target_from_object_list(const ObjectData_t *pObjList, int objCount,
                                           const EgoData_t *pEgoData,
@@ -426,6 +428,13 @@ static int select_target_from_object_list(const ObjectData_t *pObjList, int objC
         adjLat += fabsf(pLsData->LS_Heading_Error) * heading_coeff;
     }
 
+    /* 곡선 거리 보정 계수: 객체와 무관 -> 루프 밖에서 1회 계산 */
+    float distScale = 1.0f;
+    if(pLsData->LS_Is_Curved_Lane) {
+        float c = cosf(pLsData->LS_Heading_Error * (float)M_PI / 180.0f);
+        if(fabsf(c) > 1e-3f) distScale = 1.0f / c;
+    }
+
     for(int i = 0; i < objCount; i++) {
         if(idx >= maxFiltCount) break;
         const ObjectData_t *obj = &pObjList[i];
@@ -436,8 +445,7 @@ static int select_target_from_object_list(const ObjectData_t *pObjList, int objC
 
         /* 상태 분류 */
         float relVel = obj->Velocity_X - pEgoData->Ego_Velocity_X;
-        float hdif = fabsf(obj->Heading - pEgoData->Ego_Heading);
-        if(hdif > 180.0f) hdif = 360.0f - hdif;
+        float hdif = fabsf(normalize_heading_deg(obj->Heading - pEgoData->Ego_Heading));
         ObjectStatus_e stat = obj->Object_Status;
         if(hdif >= 150.0f) {
             stat = OBJSTAT_ONCOMING;
@@ -447,12 +455,7 @@ static int select_target_from_object_list(const ObjectData_t *pObjList, int objC
             else stat = OBJSTAT_STATIONARY;
         }
 
-        float adjDist = obj->Distance;
-        if(pLsData->LS_Is_Curved_Lane) {
-            float he_rad = pLsData->LS_Heading_Error * (float)M_PI / 180.0f;
-            if(fabsf(cosf(he_rad)) > 1e-3f)
-                adjDist = obj->Distance / cosf(he_rad);
-        }
+        float adjDist = obj->Distance * distScale;
 
         /* 셀 번호 부여 */
         int baseCell = 1;
@@ -746,6 +749,52 @@ static float ACC_OutputSelection(ACC_Mode_e mode, float accelDist, float accelSp
     return 0.0f;
 }
 
+/* 모드 디스패치: 활성 모드의 PID만 계산, 전환 시 적분항 역산(bumpless) */
+static ACC_Mode_e g_accPrevMode = ACC_MODE_SPEED;
+static float g_accPrevAccel = 0.0f;
+static bool g_accStarted = false;
+
+static float ACC_BackCalcIntegral(float prevOut, float err, float Kp, float Ki, float dt)
+{
+    float iTerm = prevOut - Kp * err;
+    if(iTerm > MAX_ACCEL) iTerm = MAX_ACCEL;
+    if(iTerm < MIN_ACCEL) iTerm = MIN_ACCEL;
+    return iTerm / Ki - err * dt;
+}
+
+static float ACC_CalcAccel(ACC_Mode_e mode,
+                           const ACC_Target_t *pAccTarget,
+                           const EgoData_t *pEgoData,
+                           const LaneSelectOutput_t *pLsData,
+                           float dt)
+{
+    if(!pAccTarget || !pEgoData || !pLsData) return 0.0f;
+    bool changed = g_accStarted && (mode != g_accPrevMode);
+    float accel = 0.0f;
+    if(mode == ACC_MODE_SPEED) {
+        if(changed) {
+            float baseSpeed = (pLsData->LS_Is_Curved_Lane) ? 15.0f : 22.22f;
+            float err = baseSpeed - pEgoData->Ego_Velocity_X;
+            g_speedIntegral = ACC_BackCalcIntegral(g_accPrevAccel, err, 0.5f, 0.1f, dt);
+            g_speedPrevErr = err;
+        }
+        accel = ACC_CalcAccel_Speed(pEgoData, pLsData, dt);
+    }
+    else if(mode == ACC_MODE_DISTANCE) {
+        if(changed) {
+            float err = 40.0f - pAccTarget->ACC_Target_Distance;
+            g_distIntegral = ACC_BackCalcIntegral(g_accPrevAccel, err, 0.4f, 0.05f, dt);
+            g_distPrevErr = err;
+        }
+        accel = ACC_CalcAccel_Distance(pAccTarget, pEgoData, dt);
+    }
+    accel = ACC_OutputSelection(mode, accel, accel);
+    g_accPrevMode = mode;
+    g_accPrevAccel = accel;
+    g_accStarted = true;
+    return accel;
+}
+
 /*============================================================================
  * 6) AEB Module
  *============================================================================*/
@@ -892,6 +941,36 @@ static float LFA_OutputSelection(LFA_Mode_e mode,
     return steering;
 }
 
+/* 모드 디스패치: 활성 모드의 조향 법칙만 계산, Stanley -> PID 전환 시 적분항 역산 */
+static LFA_Mode_e g_lfaPrevMode = LFA_MODE_LOW_SPEED;
+static float g_lfaPrevSteer = 0.0f;
+static bool g_lfaStarted = false;
+
+static float LFA_CalcSteer(LFA_Mode_e mode,
+                           const LaneSelectOutput_t *pLs,
+                           const EgoData_t *pEgo,
+                           float dt)
+{
+    if(!pLs || !pEgo) return 0.0f;
+    float steer = 0.0f;
+    if(mode == LFA_MODE_LOW_SPEED) {
+        if(g_lfaStarted && g_lfaPrevMode != LFA_MODE_LOW_SPEED) {
+            float err = pLs->LS_Lane_Offset + pLs->LS_Heading_Error;
+            float iTerm = g_lfaPrevSteer - 0.1f * err;
+            g_lfaPidIntegral = iTerm / 0.01f - err * dt;
+            g_lfaPidPrevErr = err;
+        }
+        steer = LFA_CalcSteer_LowSpeedPID(pLs, dt);
+    }
+    else {
+        steer = LFA_CalcSteer_HighSpeedStanley(pEgo, pLs);
+    }
+    g_lfaPrevMode = mode;
+    g_lfaPrevSteer = steer;
+    g_lfaStarted = true;
+    return LFA_OutputSelection(mode, steer, steer, pLs, pEgo);
+}
+
 /*============================================================================
  * 8) Arbitration Module
  *============================================================================*/
@@ -992,40 +1071,64 @@ int main(void)
     AEB_Target_t aebTarget;
     memset(&aebTarget, 0, sizeof(aebTarget));
 
-    /* 1) Ego Vehicle Estimation */
-    EgoEstimation_Update(&timeData, &gpsData, &imuData, &egoData, &egoEstState);
-
-    /* 2) Lane Selection */
-    LaneSelection_Compute(&laneData, &egoData, &laneSelOut);
-
-    /* 3) Target Selection */
-    int filtCount = select_target_from_object_list(objList, 3, &egoData, &laneSelOut, fList, 3);
-    int predCount = predict_object_future_path(fList, filtCount, &laneData, &laneSelOut, pList, 3);
-    select_targets_for_acc_aeb(&egoData, pList, predCount, &laneSelOut, &accTarget, &aebTarget);
-
-    /* 4) ACC 계산 */
-    float dt = 0.01f; // 10ms
-    ACC_Mode_e accMode = ACC_ModeSelection(&accTarget, &egoData, &laneSelOut);
-    float accelDist = ACC_CalcAccel_Distance(&accTarget, &egoData, dt);
-    float accelSpeed = ACC_CalcAccel_Speed(&egoData, &laneSelOut, dt);
-    float accelACC = ACC_OutputSelection(accMode, accelDist, accelSpeed);
-
-    /* 5) AEB 계산 */
-    float ttc = 0.0f, ttcBrake = 0.0f, ttcAlert = 0.0f, relSpd = 0.0f;
-    AEB_CalcTTC(&egoData, &aebTarget, &ttc, &ttcBrake, &ttcAlert, &relSpd);
-    AEB_Mode_e aebMode = AEB_ModeSelection(ttc, ttcBrake, ttcAlert, &aebTarget, &egoData);
-    float decelAEB = AEB_CalcDecel(aebMode, ttc, ttcBrake);
-
-    /* 6) LFA 계산 */
-    LFA_Mode_e lfaMode = LFA_ModeSelection(&egoData);
-    float steerPid = LFA_CalcSteer_LowSpeedPID(&laneSelOut, dt);
-    float steerStanley = LFA_CalcSteer_HighSpeedStanley(&egoData, &laneSelOut);
-    float steerLFA = LFA_OutputSelection(lfaMode, steerPid, steerStanley, &laneSelOut, &egoData);
-
-    /* 7) Arbitration */
+    /* 고정 주기 루프: 절대 시각(release) 기준 clock_nanosleep -> 누적 drift 없음 */
+    const int     cycles   = 100;
+    const int64_t periodNs = 10000000;   // 10ms
+    float dt = 0.01f;
+    int deadlineMiss = 0;
+
+    ACC_Mode_e accMode = ACC_MODE_SPEED;
+    AEB_Mode_e aebMode = AEB_MODE_NORMAL;
+    LFA_Mode_e lfaMode = LFA_MODE_LOW_SPEED;
+    float accelACC = 0.0f, decelAEB = 0.0f, steerLFA = 0.0f, ttc = 0.0f;
     VehicleControl_t ctrl;
     memset(&ctrl, 0, sizeof(ctrl));
-    Arbitration_ComputeControl(accelACC, decelAEB, steerLFA, aebMode, &ctrl);
+
+    struct timespec release;
+    clock_gettime(CLOCK_MONOTONIC, &release);
+
+    for(int cycle = 0; cycle < cycles; cycle++) {
+        release.tv_nsec += periodNs;
+        while(release.tv_nsec >= 1000000000L) { release.tv_nsec -= 1000000000L; release.tv_sec++; }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, NULL);
+
+        timeData.Current_Time = 10.0f * (float)(cycle + 1);  // ms
+        gpsData.GPS_Timestamp = timeData.Current_Time;
+
+        /* 1) Ego Vehicle Estimation */
+        EgoEstimation_Update(&timeData, &gpsData, &imuData, &egoData, &egoEstState);
+
+        /* 2) Lane Selection */
+        LaneSelection_Compute(&laneData, &egoData, &laneSelOut);
+
+        /* 3) Target Selection */
+        int filtCount = select_target_from_object_list(objList, 3, &egoData, &laneSelOut, fList, 3);
+        int predCount = predict_object_future_path(fList, filtCount, &laneData, &laneSelOut, pList, 3);
+        select_targets_for_acc_aeb(&egoData, pList, predCount, &laneSelOut, &accTarget, &aebTarget);
+
+        /* 4) ACC 계산 */
+        accMode = ACC_ModeSelection(&accTarget, &egoData, &laneSelOut);
+        accelACC = ACC_CalcAccel(accMode, &accTarget, &egoData, &laneSelOut, dt);
+
+        /* 5) AEB 계산 */
+        float ttcBrake = 0.0f, ttcAlert = 0.0f, relSpd = 0.0f;
+        AEB_CalcTTC(&egoData, &aebTarget, &ttc, &ttcBrake, &ttcAlert, &relSpd);
+        aebMode = AEB_ModeSelection(ttc, ttcBrake, ttcAlert, &aebTarget, &egoData);
+        decelAEB = AEB_CalcDecel(aebMode, ttc, ttcBrake);
+
+        /* 6) LFA 계산 */
+        lfaMode = LFA_ModeSelection(&egoData);
+        steerLFA = LFA_CalcSteer(lfaMode, &laneSelOut, &egoData, dt);
+
+        /* 7) Arbitration */
+        Arbitration_ComputeControl(accelACC, decelAEB, steerLFA, aebMode, &ctrl);
+
+        /* 주기 마감 초과 검사: 처리 완료 시각이 다음 release 이후인가 */
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t lateNs = (int64_t)(now.tv_sec - release.tv_sec) * 1000000000LL + (now.tv_nsec - release.tv_nsec);
+        if(lateNs > periodNs) deadlineMiss++;
+    }
 
     /* 결과 출력 */
     printf("=== adas_all_in_one : Demo ===\n");
@@ -1035,6 +1138,7 @@ int main(void)
     printf("LFA Mode=%d, Steer_LFA=%.2f deg\n", (int)lfaMode, steerLFA);
     printf("--- Arbitration Final ---\n");
     printf("Throttle=%.2f, Brake=%.2f, Steer=%.2f\n", ctrl.throttle, ctrl.brake, ctrl.steer);
+    printf("Cycles=%d, DeadlineMiss=%d\n", cycles, deadlineMiss);
 
     return 0;
 }